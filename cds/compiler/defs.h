@@ -37,4 +37,8 @@
 #   define CDS_EXPORT_API
 #endif
 
+#ifndef CDS_DEPRECATED
+#   define CDS_DEPRECATED( reason )
+#endif
+
 #endif  // #ifndef CDSLIB_ARH_COMPILER_DEFS_H
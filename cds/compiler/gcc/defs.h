@@ -44,6 +44,9 @@
 // Inheriting constructors
 #define CDS_CXX11_INHERITING_CTOR
 
+// Deprecated declaration
+#define CDS_DEPRECATED( reason ) __attribute__(( deprecated( reason )))
+
 // *************************************************
 // Alignment macro
 
@@ -89,6 +89,13 @@
 // Inheriting constructors
 #define CDS_CXX11_INHERITING_CTOR
 
+// Deprecated declaration
+#if CDS_OS_INTERFACE == CDS_OSI_WINDOWS
+#   define CDS_DEPRECATED( reason ) __declspec( deprecated( reason ))
+#else
+#   define CDS_DEPRECATED( reason ) __attribute__(( deprecated( reason )))
+#endif
+
 // *************************************************
 // Alignment macro
 
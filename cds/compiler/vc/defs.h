@@ -114,6 +114,9 @@
 #   define CDS_CXX11_INHERITING_CTOR
 #endif
 
+// Deprecated declaration
+#define CDS_DEPRECATED( reason ) __declspec( deprecated( reason ))
+
 // *************************************************
 // Alignment macro
 
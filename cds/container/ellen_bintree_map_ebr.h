@@ -0,0 +1,9 @@
+//$$CDS-header$$
+
+#ifndef CDSLIB_CONTAINER_ELLEN_BINTREE_MAP_EBR_H
+#define CDSLIB_CONTAINER_ELLEN_BINTREE_MAP_EBR_H
+
+#include <cds/gc/ebr.h>
+#include <cds/container/impl/ellen_bintree_map.h>
+
+#endif // #ifndef CDSLIB_CONTAINER_ELLEN_BINTREE_MAP_EBR_H
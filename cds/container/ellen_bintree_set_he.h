@@ -0,0 +1,9 @@
+//$$CDS-header$$
+
+#ifndef CDSLIB_CONTAINER_ELLEN_BINTREE_SET_HE_H
+#define CDSLIB_CONTAINER_ELLEN_BINTREE_SET_HE_H
+
+#include <cds/gc/he.h>
+#include <cds/container/impl/ellen_bintree_set.h>
+
+#endif // #ifndef CDSLIB_CONTAINER_ELLEN_BINTREE_SET_HE_H
@@ -0,0 +1,11 @@
+//$$CDS-header$$
+
+#ifndef CDSLIB_CONTAINER_LAZY_LIST_EBR_H
+#define CDSLIB_CONTAINER_LAZY_LIST_EBR_H
+
+#include <cds/container/details/lazy_list_base.h>
+#include <cds/intrusive/lazy_list_ebr.h>
+#include <cds/container/details/make_lazy_list.h>
+#include <cds/container/impl/lazy_list.h>
+
+#endif // #ifndef CDSLIB_CONTAINER_LAZY_LIST_EBR_H
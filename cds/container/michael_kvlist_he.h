@@ -0,0 +1,11 @@
+//$$CDS-header$$
+
+#ifndef CDSLIB_CONTAINER_MICHAEL_KVLIST_HE_H
+#define CDSLIB_CONTAINER_MICHAEL_KVLIST_HE_H
+
+#include <cds/container/details/michael_list_base.h>
+#include <cds/intrusive/michael_list_he.h>
+#include <cds/container/details/make_michael_kvlist.h>
+#include <cds/container/impl/michael_kvlist.h>
+
+#endif  // #ifndef CDSLIB_CONTAINER_MICHAEL_KVLIST_HE_H
@@ -0,0 +1,11 @@
+//$$CDS-header$$
+
+#ifndef CDSLIB_CONTAINER_MICHAEL_LIST_EBR_H
+#define CDSLIB_CONTAINER_MICHAEL_LIST_EBR_H
+
+#include <cds/container/details/michael_list_base.h>
+#include <cds/intrusive/michael_list_ebr.h>
+#include <cds/container/details/make_michael_list.h>
+#include <cds/container/impl/michael_list.h>
+
+#endif // #ifndef CDSLIB_CONTAINER_MICHAEL_LIST_EBR_H
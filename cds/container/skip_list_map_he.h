@@ -0,0 +1,11 @@
+//$$CDS-header$$
+
+#ifndef CDSLIB_CONTAINER_SKIP_LIST_MAP_HE_H
+#define CDSLIB_CONTAINER_SKIP_LIST_MAP_HE_H
+
+#include <cds/container/details/skip_list_base.h>
+#include <cds/intrusive/skip_list_he.h>
+#include <cds/container/details/make_skip_list_map.h>
+#include <cds/container/impl/skip_list_map.h>
+
+#endif  // #ifndef CDSLIB_CONTAINER_SKIP_LIST_MAP_HE_H
@@ -0,0 +1,11 @@
+//$$CDS-header$$
+
+#ifndef CDSLIB_CONTAINER_SKIP_LIST_SET_EBR_H
+#define CDSLIB_CONTAINER_SKIP_LIST_SET_EBR_H
+
+#include <cds/container/details/skip_list_base.h>
+#include <cds/intrusive/skip_list_ebr.h>
+#include <cds/container/details/make_skip_list_set.h>
+#include <cds/container/impl/skip_list_set.h>
+
+#endif  // #ifndef CDSLIB_CONTAINER_SKIP_LIST_SET_EBR_H
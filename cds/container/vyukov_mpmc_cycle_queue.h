@@ -398,6 +398,20 @@ namespace cds { namespace container {
             return m_ItemCounter.value();
         }
 
+        /// Returns approximate item count computed from the enqueue and dequeue positions
+        /**
+            Unlike \p size() the function does not depend on \p vyukov_queue::traits::item_counter option,
+            so the item count is available without any counting cost on push and pop.
+            The positions are advanced before the item is written or read, thus
+            under concurrent access the result is approximate.
+        */
+        size_t approx_size() const
+        {
+            size_t const nDequeue = m_posDequeue.load( memory_model::memory_order_acquire );
+            size_t const nEnqueue = m_posEnqueue.load( memory_model::memory_order_relaxed );
+            return nEnqueue - nDequeue <= capacity() ? nEnqueue - nDequeue : 0;
+        }
+
         /// Returns capacity of the queue
         size_t capacity() const
         {
@@ -3,12 +3,11 @@
 #ifndef CDSLIB_GC_DETAILS_DHP_H
 #define CDSLIB_GC_DETAILS_DHP_H
 
-#include <mutex>        // unique_lock
 #include <cds/algo/atomic.h>
 #include <cds/gc/details/retired_ptr.h>
+#include <cds/gc/details/reclaim_stat.h>
 #include <cds/details/aligned_allocator.h>
 #include <cds/details/allocator.h>
-#include <cds/sync/spinlock.h>
 
 #if CDS_COMPILER == CDS_COMPILER_MSVC
 #   pragma warning(push)
@@ -18,6 +17,10 @@
 //@cond
 namespace cds { namespace gc {
 
+    namespace details {
+        class reclaimer_thread;
+    }
+
     /// Dynamic Hazard Pointer reclamation schema
     /**
         The cds::gc::dhp namespace and its members are internal representation of the GC and should not be used directly.
@@ -29,10 +32,10 @@ namespace cds { namespace gc {
         See cds::gc::DHP class for explanation.
 
         \par Implementation issues
-            The global list of free guards (\p cds::gc::dhp::details::guard_allocator) is protected by a spin-lock (i.e. serialized).
-            It seems that this solution should not introduce significant performance bottleneck, because each thread has its own set
-            of guards allocated from the global list of free guards and the access to the global list is occurred only when
-            all thread's guard is busy. In this case the thread allocates a next block of guards from the global list.
+            The global list of free guards (\p cds::gc::dhp::details::guard_allocator) is a lock-free stack
+            that is ABA-safe since the guards are popped by privatizing the whole list, see \p guard_allocator.
+            Each thread has its own set of guards allocated from the global list of free guards and the access to the global list
+            is occurred only when all thread's guard is busy. In this case the thread allocates a next block of guards from the global list.
             Guards allocated for the thread is push back to the global list only when the thread terminates.
     */
     namespace dhp {
@@ -91,6 +94,21 @@ namespace cds { namespace gc {
             };
 
             /// Guard allocator
+            /**
+                The allocator keeps two lists of guards:
+                - the list of all allocated guards (linked by \p guard_data::pGlobalNext field). The list is
+                  an accumulating list: the guards are never removed from it until the allocator is destroyed;
+                - the list of free guards (linked by \p guard_data::pNextFree field). The list is a lock-free stack.
+
+                Lock-free pop of single item from the stack is ABA-prone. Since the guards are never returned to the heap,
+                the only ABA case is the reusing of a guard popped and pushed back by another thread in the middle of pop.
+                To avoid it the allocator pops the whole free list by atomic exchange, takes the guards needed and
+                puts the rest back. Push of an item (or a list) to the stack is ABA-safe.
+                While the rest of the free list is privatized, a concurrent allocation sees empty free list
+                and allocates new guards from the heap; so the guard count is bounded by the peak count of concurrent
+                allocations. Since \p ThreadGC caches the guards and allocates them by batches, the allocator
+                is called rarely.
+            */
             template <class Alloc = CDS_DEFAULT_ALLOCATOR>
             class guard_allocator
             {
@@ -98,33 +116,83 @@ namespace cds { namespace gc {
 
                 atomics::atomic<guard_data *>  m_GuardList;     ///< Head of allocated guard list (linked by guard_data::pGlobalNext field)
                 atomics::atomic<guard_data *>  m_FreeGuardList; ///< Head of free guard list (linked by guard_data::pNextFree field)
-                cds::sync::spin                m_freeListLock;  ///< Access to m_FreeGuardList
-
-                /*
-                    Unfortunately, access to the list of free guard is lock-based.
-                    Lock-free manipulations with guard free-list are ABA-prone.
-                    TODO: working with m_FreeGuardList in lock-free manner.
-                */
 
             private:
-                /// Allocates new guard from the heap. The function uses aligned allocator
-                guard_data * allocNew()
+                /// Allocates \p nCount new guards from the heap
+                /**
+                    The list returned is linked by guard's \p pThreadNext and \p pNextFree fields,
+                    the links of the last item \p pLast are undefined.
+                    The guards are linked to the list of allocated guards by one CAS.
+                */
+                guard_data * allocNew( size_t nCount, guard_data *& pLast )
                 {
-                    //TODO: the allocator should make block allocation
+                    assert( nCount != 0 );
 
-                    details::guard_data * pGuard = m_GuardAllocator.New();
+                    guard_data * pFirst = m_GuardAllocator.New();
+                    pLast = pFirst;
+                    while ( --nCount ) {
+                        guard_data * pGuard = m_GuardAllocator.New();
+                        pGuard->pGlobalNext.store( pFirst, atomics::memory_order_relaxed );
+                        pGuard->pNextFree.store( pGuard->pThreadNext = pFirst, atomics::memory_order_relaxed );
+                        pFirst = pGuard;
+                    }
 
-                    // Link guard to the list
+                    // Link guards to the list
                     // m_GuardList is an accumulating list and it cannot support concurrent deletion,
                     // so, ABA problem is impossible for it
                     details::guard_data * pHead = m_GuardList.load( atomics::memory_order_acquire );
                     do {
-                        pGuard->pGlobalNext.store( pHead, atomics::memory_order_relaxed );
+                        pLast->pGlobalNext.store( pHead, atomics::memory_order_relaxed );
                         // pHead is changed by compare_exchange_weak
-                    } while ( !m_GuardList.compare_exchange_weak( pHead, pGuard, atomics::memory_order_release, atomics::memory_order_relaxed ));
+                    } while ( !m_GuardList.compare_exchange_weak( pHead, pFirst, atomics::memory_order_release, atomics::memory_order_relaxed ));
 
-                    pGuard->init();
-                    return pGuard;
+                    return pFirst;
+                }
+
+                /// Pushes the list [pFirst, pLast] linked by \p pNextFree field to the free list
+                void pushFree( guard_data * pFirst, guard_data * pLast ) CDS_NOEXCEPT
+                {
+                    guard_data * pHead = m_FreeGuardList.load( atomics::memory_order_relaxed );
+                    do {
+                        pLast->pNextFree.store( pHead, atomics::memory_order_relaxed );
+                    } while ( !m_FreeGuardList.compare_exchange_weak( pHead, pFirst, atomics::memory_order_release, atomics::memory_order_relaxed ));
+                }
+
+                /// Pops up to \p nCount guards from the free list
+                /**
+                    The list returned is linked by guard's \p pThreadNext and \p pNextFree fields,
+                    the links of the last item \p pLast are undefined. \p nCount is decreased by the count of guards popped.
+                */
+                guard_data * popFree( size_t& nCount, guard_data *& pLast ) CDS_NOEXCEPT
+                {
+                    if ( m_FreeGuardList.load( atomics::memory_order_relaxed ) == nullptr )
+                        return nullptr;
+
+                    // Privatize whole free list
+                    guard_data * pFirst = m_FreeGuardList.exchange( nullptr, atomics::memory_order_acquire );
+                    if ( !pFirst )
+                        return nullptr;
+
+                    pLast = pFirst;
+                    guard_data * pRest = pFirst->pNextFree.load( atomics::memory_order_relaxed );
+                    while ( --nCount && pRest ) {
+                        pLast->pThreadNext = pRest;
+                        pLast = pRest;
+                        pRest = pRest->pNextFree.load( atomics::memory_order_relaxed );
+                    }
+
+                    if ( pRest ) {
+                        // Put the rest back. Usually the free list is empty here, otherwise
+                        // the guards freed in the meantime are pushed on the top of the rest
+                        guard_data * pOther = m_FreeGuardList.exchange( pRest, atomics::memory_order_acq_rel );
+                        if ( pOther ) {
+                            guard_data * pOtherLast = pOther;
+                            for ( guard_data * p = pOther->pNextFree.load( atomics::memory_order_relaxed ); p; p = p->pNextFree.load( atomics::memory_order_relaxed ))
+                                pOtherLast = p;
+                            pushFree( pOther, pOtherLast );
+                        }
+                    }
+                    return pFirst;
                 }
 
             public:
@@ -147,20 +215,7 @@ namespace cds { namespace gc {
                 /// Allocates a guard from free list or from heap if free list is empty
                 guard_data * alloc()
                 {
-                    // Try to pop a guard from free-list
-                    details::guard_data * pGuard;
-
-                    {
-                        std::unique_lock<cds::sync::spin> al( m_freeListLock );
-                        pGuard = m_FreeGuardList.load(atomics::memory_order_relaxed);
-                        if ( pGuard )
-                            m_FreeGuardList.store( pGuard->pNextFree.load(atomics::memory_order_relaxed), atomics::memory_order_relaxed );
-                    }
-                    if ( !pGuard )
-                        return allocNew();
-
-                    pGuard->init();
-                    return pGuard;
+                    return allocList( 1 );
                 }
 
                 /// Frees guard \p pGuard
@@ -170,15 +225,14 @@ namespace cds { namespace gc {
                 void free( guard_data * pGuard ) CDS_NOEXCEPT
                 {
                     pGuard->pPost.store( nullptr, atomics::memory_order_relaxed );
-
-                    std::unique_lock<cds::sync::spin> al( m_freeListLock );
-                    pGuard->pNextFree.store( m_FreeGuardList.load(atomics::memory_order_relaxed), atomics::memory_order_relaxed );
-                    m_FreeGuardList.store( pGuard, atomics::memory_order_relaxed );
+                    pushFree( pGuard, pGuard );
                 }
 
                 /// Allocates list of guard
                 /**
                     The list returned is linked by guard's \p pThreadNext and \p pNextFree fields.
+                    The guards are taken from the free list; if it is not enough, the rest of guards
+                    is allocated from the heap.
 
                     cds::gc::dhp::ThreadGC supporting method
                 */
@@ -186,20 +240,21 @@ namespace cds { namespace gc {
                 {
                     assert( nCount != 0 );
 
-                    guard_data * pHead;
-                    guard_data * pLast;
-
-                    pHead =
-                        pLast = alloc();
+                    guard_data * pLast = nullptr;
+                    guard_data * pHead = popFree( nCount, pLast );
+
+                    if ( nCount ) {
+                        guard_data * pNewLast;
+                        guard_data * pNew = allocNew( nCount, pNewLast );
+                        if ( pHead )
+                            pLast->pNextFree.store( pLast->pThreadNext = pNew, atomics::memory_order_relaxed );
+                        else
+                            pHead = pNew;
+                        pLast = pNewLast;
+                    }
 
                     // The guard list allocated is private for the thread,
                     // so, we can use relaxed memory order
-                    while ( --nCount ) {
-                        guard_data * p = alloc();
-                        pLast->pNextFree.store( pLast->pThreadNext = p, atomics::memory_order_relaxed );
-                        pLast = p;
-                    }
-
                     pLast->pNextFree.store( pLast->pThreadNext = nullptr, atomics::memory_order_relaxed );
 
                     return pHead;
@@ -222,10 +277,9 @@ namespace cds { namespace gc {
                         pLast->pNextFree.store( p = pLast->pThreadNext, atomics::memory_order_relaxed );
                         pLast = p;
                     }
+                    pLast->pPost.store( nullptr, atomics::memory_order_relaxed );
 
-                    std::unique_lock<cds::sync::spin> al( m_freeListLock );
-                    pLast->pNextFree.store( m_FreeGuardList.load(atomics::memory_order_relaxed), atomics::memory_order_relaxed );
-                    m_FreeGuardList.store( pList, atomics::memory_order_relaxed );
+                    pushFree( pList, pLast );
                 }
 
                 /// Returns the list's head of guards allocated
@@ -269,7 +323,7 @@ namespace cds { namespace gc {
                     return m_nItemCount.fetch_add( 1, atomics::memory_order_relaxed ) + 1;
                 }
 
-                /// Pushes [pFirst, pLast] list linked by pNext field.
+                /// Pushes [pFirst, pLast] list linked by pNext field. Returns current buffer size
                 size_t push_list( retired_ptr_node* pFirst, retired_ptr_node* pLast, size_t nSize )
                 {
                     assert( pFirst );
@@ -281,7 +335,7 @@ namespace cds { namespace gc {
                         // pHead is changed by compare_exchange_weak
                     } while ( !m_pHead.compare_exchange_weak( pHead, pFirst, atomics::memory_order_release, atomics::memory_order_relaxed ) );
 
-                    return m_nItemCount.fetch_add( nSize, atomics::memory_order_relaxed ) + 1;
+                    return m_nItemCount.fetch_add( nSize, atomics::memory_order_relaxed ) + nSize;
                 }
 
                 /// Result of \ref dhp_gc_privatve "privatize" function.
@@ -666,6 +720,15 @@ namespace cds { namespace gc {
             }
         };
 
+        /// GarbageCollector::scan() strategy
+        /**
+            See \ref dhp_gc_liberate "GarbageCollector::scan()" for explanation
+        */
+        enum scan_type {
+            classic,    ///< retired pointers are placed into a hash set, the set is probed for each guard
+            sorted      ///< sorted array of retired pointers is intersected with sorted snapshot of guards
+        };
+
         /// Memory manager (Garbage collector)
         class CDS_EXPORT_API GarbageCollector
         {
@@ -720,6 +783,7 @@ namespace cds { namespace gc {
 
         private:
             static GarbageCollector * m_pManager    ;   ///< GC global instance
+            static bool               m_bAsymmetricFence;   ///< true - asymmetric fence mode is used (see \ref dhp_gc_asymmetric_fence)
 
             details::guard_allocator<>      m_GuardPool         ;   ///< Guard pool
             details::retired_ptr_pool<>     m_RetiredAllocator  ;   ///< Pool of free retired pointers
@@ -728,8 +792,12 @@ namespace cds { namespace gc {
             atomics::atomic<size_t>      m_nLiberateThreshold;   ///< Max size of retired pointer buffer to call \p scan()
             const size_t    m_nInitialThreadGuardCount; ///< Initial count of guards allocated for ThreadGC
 
+            cds::gc::details::reclaimer_thread * m_pReclaimer;  ///< Background reclamation thread, \p nullptr if it is not used
+            scan_type       m_nScanType ;   ///< scan strategy (see \ref scan_type enum)
+
             internal_stat   m_stat  ;   ///< Internal statistics
             bool            m_bStatEnabled  ;   ///< Internal Statistics enabled
+            cds::gc::details::reclaim_counters m_ReclaimStat;   ///< Reclamation telemetry, updated by \p scan()
 
         public:
             /// Initializes DHP memory manager singleton
@@ -747,11 +815,24 @@ namespace cds { namespace gc {
                     is initialized the GC allocates local guard pool for the thread from common guard pool.
                     By perforce the local thread's guard pool is grown automatically from common pool.
                     When the thread terminated its guard pool is backed to common GC's pool.
+                \li \p bAsymmetricFence - use asymmetric fence mode, see \ref dhp_gc_asymmetric_fence "publish_fence()".
+                    If the process-wide memory barrier is not supported by OS, the full fence mode
+                    is used silently; call \p isAsymmetricFence() to get the mode actually used.
+                \li \p bBackgroundReclaim - start background reclamation thread, see \ref dhp_gc_retirePtr "retirePtr()".
+                \li \p nScanType - \ref dhp_gc_liberate "scan()" strategy, see \ref scan_type enum.
+                \li \p fnAttachThread, \p fnDetachThread - the reclamation thread calls them on start and on exit
+                    to attach itself to \p cds::threading::Manager since the disposers are called by that thread.
+                    \p cds::gc::DHP passes \p Manager::attachThread and \p Manager::detachThread.
 
             */
             static void CDS_STDCALL Construct(
                 size_t nLiberateThreshold = 1024
                 , size_t nInitialThreadGuardCount = 8
+                , bool bAsymmetricFence = false
+                , bool bBackgroundReclaim = false
+                , scan_type nScanType = classic
+                , void (* fnAttachThread)() = nullptr
+                , void (* fnDetachThread)() = nullptr
             );
 
             /// Destroys DHP memory manager
@@ -779,6 +860,35 @@ namespace cds { namespace gc {
                 return m_pManager != nullptr;
             }
 
+            /// Checks if the asymmetric fence mode is used
+            static bool isAsymmetricFence() CDS_NOEXCEPT
+            {
+                return m_bAsymmetricFence;
+            }
+
+            /// Checks if the background reclamation thread is used
+            bool isBackgroundReclaim() const CDS_NOEXCEPT
+            {
+                return m_pReclaimer != nullptr;
+            }
+
+            /// Memory fence between publishing a guard and validating the guarded pointer
+            /** @anchor dhp_gc_asymmetric_fence
+                The guard store must not be reordered with the following validating load of the source pointer,
+                otherwise \p scan() may miss the guard. It requires a full memory fence on each protection,
+                paired with the full fence issued by \p scan() before reading the guards.
+
+                In asymmetric fence mode the fence is a compiler-only barrier, and \p scan() issues
+                a process-wide memory barrier (see \p cds::OS::membarrier) instead.
+            */
+            static void publish_fence() CDS_NOEXCEPT
+            {
+                if ( m_bAsymmetricFence )
+                    atomics::atomic_signal_fence( atomics::memory_order_seq_cst );
+                else
+                    atomics::atomic_thread_fence( atomics::memory_order_seq_cst );
+            }
+
         public:
             //@{
             /// Internal interface
@@ -809,6 +919,10 @@ namespace cds { namespace gc {
 
             /// Places retired pointer \p and its deleter \p pFunc into thread's array of retired pointer for deferred reclamation
             /**@anchor dhp_gc_retirePtr
+                When the count of retired pointers reaches the threshold, \ref dhp_gc_liberate "scan()" is called.
+                If the background reclamation thread is used, the retired pointers are already
+                in the shared buffer, so the retiring thread just wakes up the reclamation thread
+                that calls \p scan().
             */
             template <typename T>
             void retirePtr( T * p, void (* pFunc)(T *) )
@@ -819,8 +933,33 @@ namespace cds { namespace gc {
             /// Places retired pointer \p into thread's array of retired pointer for deferred reclamation
             void retirePtr( retired_ptr const& p )
             {
-                if ( m_RetiredBuffer.push( m_RetiredAllocator.alloc(p)) >= m_nLiberateThreshold.load(atomics::memory_order_relaxed) )
-                    scan();
+                check_retired( m_RetiredBuffer.push( m_RetiredAllocator.alloc(p)) );
+            }
+
+            /// Places the range <tt>[itFirst, itLast)</tt> of retired pointers with deleter \p pFunc into the buffer of retired pointers
+            /**
+                The iterator's value type is <tt>T *</tt>. The nodes for the retired pointers are linked locally
+                and pushed into the buffer by one CAS, the \p scan() threshold is checked once for the whole range.
+            */
+            template <typename ForwardIterator, typename T>
+            void retirePtr( ForwardIterator itFirst, ForwardIterator itLast, void (* pFunc)(T *) )
+            {
+                if ( itFirst == itLast )
+                    return;
+
+                details::retired_ptr_node * pFirst = &m_RetiredAllocator.alloc(
+                    retired_ptr( reinterpret_cast<void *>( *itFirst ), reinterpret_cast<free_retired_ptr_func>( pFunc )));
+                details::retired_ptr_node * pLast = pFirst;
+                size_t nCount = 1;
+                for ( ++itFirst; itFirst != itLast; ++itFirst ) {
+                    details::retired_ptr_node * pNode = &m_RetiredAllocator.alloc(
+                        retired_ptr( reinterpret_cast<void *>( *itFirst ), reinterpret_cast<free_retired_ptr_func>( pFunc )));
+                    pLast->m_pNext = pNode;
+                    pLast = pNode;
+                    ++nCount;
+                }
+
+                check_retired( m_RetiredBuffer.push_list( pFirst, pLast, nCount ));
             }
 
         protected:
@@ -828,8 +967,50 @@ namespace cds { namespace gc {
             /** @anchor dhp_gc_liberate
                 The main function of Dynamic Hazard Pointer algorithm. It tries to free retired pointers if they are not
                 trapped by any guard.
+
+                The function privatizes the buffer of retired pointers and finds the retired pointers that are guarded.
+                There are the following strategies (see \ref dhp_gc_setScanType "setScanType()"):
+                - \p classic - the retired pointers are placed into a hash set (\p details::liberate_set),
+                    then the set is probed for each guard. The set is a list of linked nodes, so for a large count
+                    of retired pointers each probe is a cache miss.
+                - \p sorted - the retired pointers are collected into a contiguous array and sorted, the non-null guards
+                    are collected into a sorted snapshot, then the two arrays are intersected by linear merge.
+                    This strategy is profitable for a large count of retired pointers.
+
+                The retired pointers that are guarded are placed back to the buffer of retired pointers.
+
+                Each call that has privatized a non-empty buffer updates the reclamation telemetry, see \p getReclaimStat().
             */
             void scan();
+
+            /// \p scan() implementation for \p classic strategy, returns the count of retired pointers freed
+            size_t classic_scan( details::retired_ptr_buffer::privatize_result& retiredList );
+
+            /// \p scan() implementation for \p sorted strategy, returns the count of retired pointers freed
+            size_t sorted_scan( details::retired_ptr_buffer::privatize_result& retiredList );
+
+            /// Returns the nodes [pFirst, pLast] of freed retired pointers (linked by \p m_pNextFree field) to the pool
+            /**
+                If no retired pointer has been freed (\p pFirst is \p nullptr), the \p scan() threshold \p nLiberateThreshold is doubled.
+            */
+            void release_retired( details::retired_ptr_node * pFirst, details::retired_ptr_node * pLast, size_t nLiberateThreshold );
+
+            /// Runs \p scan() or wakes up the reclamation thread if \p nRetiredCount reaches the threshold
+            void check_retired( size_t nRetiredCount )
+            {
+                if ( nRetiredCount >= m_nLiberateThreshold.load(atomics::memory_order_relaxed) ) {
+                    if ( m_pReclaimer )
+                        wake_reclaimer();
+                    else
+                        scan();
+                }
+            }
+
+            /// Wakes up background reclamation thread
+            void wake_reclaimer();
+
+            /// Wakes up background reclamation thread and waits until it runs \p scan()
+            void flush_reclaimer();
             //@}
 
         public:
@@ -839,6 +1020,20 @@ namespace cds { namespace gc {
                 return stat = m_stat;
             }
 
+            /// Get reclamation telemetry
+            /**
+                The telemetry is always collected, independently of \p enableStatistics().
+                Since the buffer of retired pointers is shared, \p reclaim_stat::nPeakBacklog is the peak size
+                of the whole buffer observed by \p scan(), and \p reclaim_stat::nBacklog is the current size of the buffer.
+            */
+            cds::gc::reclaim_stat& getReclaimStat( cds::gc::reclaim_stat& st ) const
+            {
+                st.clear();
+                m_ReclaimStat.collect( st );
+                st.nBacklog = m_RetiredBuffer.size();
+                return st;
+            }
+
             /// Checks if internal statistics enabled
             bool              isStatisticsEnabled() const
             {
@@ -853,9 +1048,29 @@ namespace cds { namespace gc {
                 return bEnabled;
             }
 
+            /// Get current scan strategy
+            scan_type getScanType() const
+            {
+                return m_nScanType;
+            }
+
+            /// Set current scan strategy
+            /** @anchor dhp_gc_setScanType
+                Scan strategy changing is allowed on the fly.
+            */
+            void setScanType(
+                scan_type nScanType     ///< new scan strategy
+            )
+            {
+                m_nScanType = nScanType;
+            }
+
         private:
-            GarbageCollector( size_t nLiberateThreshold, size_t nInitialThreadGuardCount );
+            GarbageCollector( size_t nLiberateThreshold, size_t nInitialThreadGuardCount, scan_type nScanType );
             ~GarbageCollector();
+
+            void start_reclaimer( void (* fnAttachThread)(), void (* fnDetachThread)() );
+            void stop_reclaimer();
         };
 
         /// Thread GC
@@ -912,21 +1127,31 @@ namespace cds { namespace gc {
                 }
             }
 
+        private:
+            /// Allocates next batch of guards from the common pool when the thread's free guard list is empty
+            void refill()
+            {
+                assert( m_pFree == nullptr );
+
+                details::guard_data * pNew = m_gc.allocGuardList( m_gc.m_nInitialThreadGuardCount );
+                details::guard_data * pLast = pNew;
+                while ( pLast->pThreadNext )
+                    pLast = pLast->pThreadNext;
+                pLast->pThreadNext = m_pList;
+                m_pList =
+                    m_pFree = pNew;
+            }
+
         public:
             /// Initializes guard \p g
             void allocGuard( dhp::details::guard& g )
             {
                 assert( m_pList != nullptr );
                 if ( !g.m_pGuard ) {
-                    if ( m_pFree ) {
-                        g.m_pGuard = m_pFree;
-                        m_pFree = m_pFree->pNextFree.load( atomics::memory_order_relaxed );
-                    }
-                    else {
-                        g.m_pGuard = m_gc.allocGuard();
-                        g.m_pGuard->pThreadNext = m_pList;
-                        m_pList = g.m_pGuard;
-                    }
+                    if ( !m_pFree )
+                        refill();
+                    g.m_pGuard = m_pFree;
+                    m_pFree = m_pFree->pNextFree.load( atomics::memory_order_relaxed );
                 }
             }
 
@@ -947,19 +1172,12 @@ namespace cds { namespace gc {
             void allocGuard( GuardArray<Count>& arr )
             {
                 assert( m_pList != nullptr );
-                size_t nCount = 0;
 
-                while ( m_pFree && nCount < Count ) {
+                for ( size_t nCount = 0; nCount < Count; ++nCount ) {
+                    if ( !m_pFree )
+                        refill();
                     arr[nCount].set_guard( m_pFree );
                     m_pFree = m_pFree->pNextFree.load(atomics::memory_order_relaxed);
-                    ++nCount;
-                }
-
-                while ( nCount < Count ) {
-                    details::guard& g = arr[nCount++];
-                    g.set_guard( m_gc.allocGuard() );
-                    g.get_guard()->pThreadNext = m_pList;
-                    m_pList = g.get_guard();
                 }
             }
 
@@ -988,10 +1206,23 @@ namespace cds { namespace gc {
                 m_gc.retirePtr( p, pFunc );
             }
 
+            /// Places the range <tt>[itFirst, itLast)</tt> of retired pointers with deleter \p pFunc into retired buffer of GC
+            template <typename ForwardIterator, typename T>
+            void retirePtr( ForwardIterator itFirst, ForwardIterator itLast, void (* pFunc)(T *) )
+            {
+                m_gc.retirePtr( itFirst, itLast, pFunc );
+            }
+
             /// Run retiring cycle
+            /**
+                If the background reclamation thread is used, the function waits until the reclamation thread runs \p scan().
+            */
             void scan()
             {
-                m_gc.scan();
+                if ( m_gc.isBackgroundReclaim() )
+                    m_gc.flush_reclaimer();
+                else
+                    m_gc.scan();
             }
         };
     }   // namespace dhp
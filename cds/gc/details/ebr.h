@@ -0,0 +1,677 @@
+//$$CDS-header$$
+
+#ifndef CDSLIB_GC_DETAILS_EBR_H
+#define CDSLIB_GC_DETAILS_EBR_H
+
+#include <vector>
+#include <cds/algo/atomic.h>
+#include <cds/gc/details/retired_ptr.h>
+#include <cds/os/thread.h>
+
+#if CDS_COMPILER == CDS_COMPILER_MSVC
+#   pragma warning(push)
+#   pragma warning(disable:4251)    // C4251: 'identifier' : class 'type' needs to have dll-interface to be used by clients of class 'type2'
+#endif
+
+//@cond
+namespace cds { namespace gc {
+
+    /// Epoch-based reclamation schema
+    /**
+        The cds::gc::ebr namespace and its members are internal representation of the GC and should not be used directly.
+        Use cds::gc::EBR class in your code.
+
+        Epoch-based reclamation (EBR) garbage collector is a singleton. The main user-level part of EBR schema is
+        GC class and its nested classes. Before use any EBR-related class you must initialize EBR garbage collector
+        by contructing cds::gc::EBR object in beginning of your main().
+        See cds::gc::EBR class for explanation.
+
+        \par Implementation issues
+            The GC maintains global epoch counter. Each thread has a record in the global list of thread records
+            where the thread announces the epoch observed on entering its outermost critical section.
+            The critical section is opened by first guard constructed by the thread and closed
+            by last guard destructed. Nested guards cost only an increment of thread-private counter.
+            Retired pointers are buffered per-thread together with the epoch of retirement.
+            The global epoch can be advanced only if all active threads have announced current epoch;
+            a pointer retired in epoch \p E is freed when global epoch reaches <tt>E + 2</tt>.
+    */
+    namespace ebr {
+
+        // Forward declarations
+        class Guard;
+        template <size_t Count> class GuardArray;
+        class ThreadGC;
+        class GarbageCollector;
+
+        /// Retired pointer type
+        typedef cds::gc::details::retired_ptr retired_ptr;
+
+        using cds::gc::details::free_retired_ptr_func;
+
+        /// Details of epoch-based reclamation algorithm
+        namespace details {
+
+            /// Retired pointer with the epoch of retirement
+            struct epoch_retired_ptr
+            {
+                retired_ptr m_ptr;      ///< retired pointer
+                size_t      m_nEpoch;   ///< global epoch when the pointer was retired
+
+                epoch_retired_ptr( retired_ptr const& p, size_t nEpoch )
+                    : m_ptr( p )
+                    , m_nEpoch( nEpoch )
+                {}
+
+                epoch_retired_ptr( epoch_retired_ptr const& ) = default;
+                epoch_retired_ptr& operator =( epoch_retired_ptr const& ) = default;
+            };
+
+            /// Per-thread array of retired pointers
+            typedef std::vector< epoch_retired_ptr > retired_vector;
+
+            /// Thread record
+            /**
+                The record is allocated on thread attach and is never deleted until GC destruction;
+                the record of terminated thread is reused by newly attached threads.
+            */
+            struct thread_record
+            {
+                /// Announced epoch
+                /**
+                    The value is <tt>(epoch << 1) | 1</tt> if the thread is in critical section,
+                    and 0 if the thread is quiescent.
+                */
+                atomics::atomic<size_t>             m_nEpoch;
+                size_t                              m_nNestCount;   ///< thread-private nesting depth of critical section
+                size_t                              m_nScanThreshold; ///< thread-private size of \p m_arrRetired to call \p scan()
+                bool                                m_bInScan;      ///< thread-private recursion guard of \p scan()
+                retired_vector                      m_arrRetired;   ///< retired pointers of the thread
+
+                thread_record *                     m_pNextNode;    ///< next record in the global list
+                atomics::atomic<OS::ThreadId>       m_idOwner;      ///< owner thread id; \p c_NullThreadId - the record is free
+                atomics::atomic<bool>               m_bFree;        ///< \p true if the record is free and its retired array is empty
+
+                thread_record()
+                    : m_nEpoch( 0 )
+                    , m_nNestCount( 0 )
+                    , m_nScanThreshold( 0 )
+                    , m_bInScan( false )
+                    , m_pNextNode( nullptr )
+                    , m_idOwner( OS::c_NullThreadId )
+                    , m_bFree( true )
+                {}
+            };
+
+            /// Uninitialized guard
+            /**
+                EBR guard is a plain thread-private pointer: the protection is provided by the critical section
+                of the thread, so no memory fences are needed to guard a pointer.
+
+                The guard of this type is used by \p guarded_ptr: the guard holds the critical section
+                only while it is not empty. Hence, empty \p guarded_ptr does not block the reclamation.
+                Setting the guard to non-null value opens (nests) the critical section; it is safe
+                since the value being set is always protected by another guard at that moment.
+            */
+            class guard
+            {
+                friend class ebr::ThreadGC;
+            protected:
+                void *      m_pGuarded; ///< guarded pointer
+                ThreadGC *  m_pGC;      ///< thread GC of owner thread; \p nullptr - the guard is uninitialized
+
+            public:
+                /// Initialize empty guard.
+                CDS_CONSTEXPR guard() CDS_NOEXCEPT
+                    : m_pGuarded( nullptr )
+                    , m_pGC( nullptr )
+                {}
+
+                /// Copy-ctor is disabled
+                guard( guard const& ) = delete;
+
+                /// Move-ctor is disabled
+                guard( guard&& ) = delete;
+
+                /// Get current guarded pointer
+                void * get( atomics::memory_order /*order*/ = atomics::memory_order_acquire ) const CDS_NOEXCEPT
+                {
+                    assert( is_initialized() );
+                    return m_pGuarded;
+                }
+
+                /// Guards pointer \p p
+                void set( void * p, atomics::memory_order order = atomics::memory_order_release ) CDS_NOEXCEPT; // inline after ThreadGC
+
+                /// Clears the guard
+                void clear( atomics::memory_order /*order*/ = atomics::memory_order_relaxed ) CDS_NOEXCEPT
+                {
+                    set( nullptr );
+                }
+
+                /// Guards pointer \p p
+                template <typename T>
+                T * operator =(T * p) CDS_NOEXCEPT
+                {
+                    set( reinterpret_cast<void *>( const_cast<T *>(p) ));
+                    return p;
+                }
+
+                std::nullptr_t operator=(std::nullptr_t) CDS_NOEXCEPT
+                {
+                    clear();
+                    return nullptr;
+                }
+
+                /// Moves the guard from \p src
+                /**
+                    The critical section held by \p src is passed to \p this.
+                    \p this guard must be uninitialized
+                */
+                void move_from( guard& src ) CDS_NOEXCEPT
+                {
+                    assert( !is_initialized() );
+                    m_pGuarded = src.m_pGuarded;
+                    m_pGC = src.m_pGC;
+                    src.m_pGuarded = nullptr;
+                    src.m_pGC = nullptr;
+                }
+
+                bool is_initialized() const CDS_NOEXCEPT
+                {
+                    return m_pGC != nullptr;
+                }
+            };
+
+        } // namespace details
+
+        /// Guard
+        /**
+            This class represents auto guard: ctor opens the critical section of current thread,
+            dtor closes it. The critical section is held during whole lifetime of the guard,
+            so any pointer loaded after guard construction is protected.
+        */
+        class Guard
+        {
+            friend class ThreadGC;
+            void *  m_pGuarded; ///< guarded pointer
+
+        public:
+            /// Opens the critical section of current thread
+            Guard(); // inline in ebr_impl.h
+
+            /// Closes the critical section of current thread
+            ~Guard();    // inline in ebr_impl.h
+
+            //@cond
+            Guard( Guard const& ) = delete;
+            Guard( Guard&& ) = delete;
+            //@endcond
+
+            /// Get current guarded pointer
+            void * get() const CDS_NOEXCEPT
+            {
+                return m_pGuarded;
+            }
+
+            /// Guards pointer \p p
+            void set( void * p ) CDS_NOEXCEPT
+            {
+                m_pGuarded = p;
+            }
+
+            /// Clears the guard
+            void clear() CDS_NOEXCEPT
+            {
+                m_pGuarded = nullptr;
+            }
+
+            /// Guards pointer \p p
+            template <typename T>
+            T * operator =(T * p) CDS_NOEXCEPT
+            {
+                set( reinterpret_cast<void *>( const_cast<T *>(p) ));
+                return p;
+            }
+
+            std::nullptr_t operator=(std::nullptr_t) CDS_NOEXCEPT
+            {
+                clear();
+                return nullptr;
+            }
+        };
+
+        /// Array of guards
+        /**
+            This class represents array of auto guards: ctor opens the critical section of current thread
+            once for all guards of the array, dtor closes it.
+        */
+        template <size_t Count>
+        class GuardArray
+        {
+            void *              m_arr[Count]    ;   ///< array of guarded pointers
+            const static size_t c_nCapacity = Count ;   ///< Array capacity (equal to \p Count template parameter)
+
+        public:
+            /// Rebind array for other size \p OtherCount
+            template <size_t OtherCount>
+            struct rebind {
+                typedef GuardArray<OtherCount>  other   ;   ///< rebinding result
+            };
+
+        public:
+            /// Opens the critical section of current thread
+            GuardArray();    // inline in ebr_impl.h
+
+            /// The object is not copy-constructible
+            GuardArray( GuardArray const& ) = delete;
+
+            /// The object is not move-constructible
+            GuardArray( GuardArray&& ) = delete;
+
+            /// Closes the critical section of current thread
+            ~GuardArray();    // inline in ebr_impl.h
+
+            /// Returns the capacity of array
+            CDS_CONSTEXPR size_t capacity() const CDS_NOEXCEPT
+            {
+                return c_nCapacity;
+            }
+
+            /// Returns the pointer guarded by slot \p nIndex (0 <= \p nIndex < \p Count)
+            void * get( size_t nIndex ) const CDS_NOEXCEPT
+            {
+                assert( nIndex < capacity() );
+                return m_arr[nIndex];
+            }
+
+            /// Set the guard \p nIndex. 0 <= \p nIndex < \p Count
+            template <typename T>
+            void set( size_t nIndex, T * p ) CDS_NOEXCEPT
+            {
+                assert( nIndex < capacity() );
+                m_arr[nIndex] = reinterpret_cast<void *>( const_cast<T *>( p ));
+            }
+
+            /// Clears (sets to \p nullptr) the guard \p nIndex
+            void clear( size_t nIndex ) CDS_NOEXCEPT
+            {
+                assert( nIndex < capacity() );
+                m_arr[nIndex] = nullptr;
+            }
+
+            /// Clears all guards in the array
+            void clearAll() CDS_NOEXCEPT
+            {
+                for ( size_t i = 0; i < capacity(); ++i )
+                    clear(i);
+            }
+        };
+
+        /// Memory manager (Garbage collector)
+        class CDS_EXPORT_API GarbageCollector
+        {
+        private:
+            friend class ThreadGC;
+
+            /// Internal GC statistics
+            struct internal_stat
+            {
+                atomics::atomic<size_t>  m_nEpochAdvance     ;   ///< Count of successful global epoch advance
+                atomics::atomic<size_t>  m_nScanCall         ;   ///< Count of \p scan() call
+                atomics::atomic<size_t>  m_nDeletedNode      ;   ///< Count of freed retired pointers
+                atomics::atomic<size_t>  m_nDeferredNode     ;   ///< Count of retired pointers that cannot be freed during \p scan()
+
+                internal_stat()
+                    : m_nEpochAdvance(0)
+                    , m_nScanCall(0)
+                    , m_nDeletedNode(0)
+                    , m_nDeferredNode(0)
+                {}
+            };
+
+        public:
+            /// Exception "No GarbageCollector object is created"
+            class not_initialized : public std::runtime_error
+            {
+            public:
+                //@cond
+                not_initialized()
+                    : std::runtime_error( "Global EBR GarbageCollector is not initialized" )
+                {}
+                //@endcond
+            };
+
+            /// Internal GC statistics
+            struct InternalState
+            {
+                size_t  nGlobalEpoch        ;   ///< Current value of global epoch
+                size_t  nRetiredThreshold   ;   ///< Per-thread \p scan() threshold
+                size_t  nThreadRecAllocated ;   ///< Count of thread records allocated
+                size_t  nThreadRecUsed      ;   ///< Count of thread records in use
+
+                size_t  evcEpochAdvance     ;   ///< Count of successful global epoch advance
+                size_t  evcScanCall         ;   ///< Count of \p scan() call
+                size_t  evcDeletedNode      ;   ///< Count of freed retired pointers
+                size_t  evcDeferredNode     ;   ///< Count of retired pointers that cannot be freed during \p scan()
+
+                //@cond
+                InternalState()
+                    : nGlobalEpoch(0)
+                    , nRetiredThreshold(0)
+                    , nThreadRecAllocated(0)
+                    , nThreadRecUsed(0)
+                    , evcEpochAdvance(0)
+                    , evcScanCall(0)
+                    , evcDeletedNode(0)
+                    , evcDeferredNode(0)
+                {}
+                //@endcond
+            };
+
+        private:
+            static GarbageCollector * m_pManager    ;   ///< GC global instance
+
+            atomics::atomic<size_t>                     m_nGlobalEpoch;     ///< Global epoch
+            atomics::atomic<details::thread_record *>   m_pListHead;        ///< Head of thread record list
+            size_t const                                m_nRetiredThreshold;///< Per-thread size of retired array to call \p scan()
+
+            internal_stat   m_stat  ;   ///< Internal statistics
+            bool            m_bStatEnabled  ;   ///< Internal Statistics enabled
+
+        public:
+            /// Initializes EBR memory manager singleton
+            /**
+                This member function creates and initializes EBR global object.
+                The function should be called before using CDS data structure based on cds::gc::EBR GC. Usually,
+                this member function is called in the \p main() function.
+                After calling of this function you may use CDS data structures based on cds::gc::EBR.
+
+                \par Parameters
+                \li \p nRetiredThreshold - \p scan() threshold. When count of retired pointers of a thread reaches this value,
+                    the \p scan() member function would be called for freeing retired pointers.
+            */
+            static void CDS_STDCALL Construct( size_t nRetiredThreshold = 256 );
+
+            /// Destroys EBR memory manager
+            /**
+                The member function destroys EBR global object. After calling of this function you may \b NOT
+                use CDS data structures based on cds::gc::EBR. Usually, the \p Destruct function is called
+                at the end of your \p main().
+            */
+            static void CDS_STDCALL Destruct();
+
+            /// Returns pointer to GarbageCollector instance
+            /**
+                If EBR GC is not initialized, \p not_initialized exception is thrown
+            */
+            static GarbageCollector&   instance()
+            {
+                if ( m_pManager == nullptr )
+                    throw not_initialized();
+                return *m_pManager;
+            }
+
+            /// Checks if global GC object is constructed and may be used
+            static bool isUsed() CDS_NOEXCEPT
+            {
+                return m_pManager != nullptr;
+            }
+
+            /// Returns per-thread \p scan() threshold
+            size_t getRetiredThreshold() const CDS_NOEXCEPT
+            {
+                return m_nRetiredThreshold;
+            }
+
+        public:
+            //@{
+            /// Internal interface
+
+            /// Allocates thread record
+            details::thread_record * alloc_thread_record();
+
+            /// Frees thread record; the retired pointers that cannot be freed yet are left in the record
+            void free_thread_record( details::thread_record * pRec );
+
+            /// Announces current global epoch on entering outermost critical section of the thread
+            void enter( details::thread_record * pRec ) CDS_NOEXCEPT
+            {
+                pRec->m_nEpoch.store( (m_nGlobalEpoch.load( atomics::memory_order_acquire ) << 1) | 1, atomics::memory_order_relaxed );
+                atomics::atomic_thread_fence( atomics::memory_order_seq_cst );
+            }
+
+            /// Announces quiescent state on leaving outermost critical section of the thread
+            void leave( details::thread_record * pRec ) CDS_NOEXCEPT
+            {
+                pRec->m_nEpoch.store( 0, atomics::memory_order_release );
+            }
+
+            /// Places retired pointer \p p into thread's array of retired pointer for deferred reclamation
+            void retirePtr( details::thread_record * pRec, retired_ptr const& p )
+            {
+                pRec->m_arrRetired.push_back( details::epoch_retired_ptr( p, m_nGlobalEpoch.load( atomics::memory_order_acquire )));
+                if ( pRec->m_arrRetired.size() >= pRec->m_nScanThreshold )
+                    scan( pRec );
+            }
+
+            /// Places the range <tt>[itFirst, itLast)</tt> of pointers with deleter \p pFunc to retired array of \p pRec
+            template <typename ForwardIterator, typename T>
+            void retirePtr( details::thread_record * pRec, ForwardIterator itFirst, ForwardIterator itLast, void (* pFunc)(T *) )
+            {
+                size_t const nEpoch = m_nGlobalEpoch.load( atomics::memory_order_acquire );
+                for ( ; itFirst != itLast; ++itFirst ) {
+                    pRec->m_arrRetired.push_back( details::epoch_retired_ptr(
+                        retired_ptr( reinterpret_cast<void *>( *itFirst ), reinterpret_cast<free_retired_ptr_func>( pFunc )), nEpoch ));
+                }
+                if ( pRec->m_arrRetired.size() >= pRec->m_nScanThreshold )
+                    scan( pRec );
+            }
+
+            /// Tries to advance global epoch and frees the retired pointers of \p pRec that are safe to free
+            void scan( details::thread_record * pRec );
+
+            /// Helper scan routine
+            /**
+                The function moves retired pointers of the records of terminated threads to \p pThis
+                and calls \p scan() for them.
+            */
+            void help_scan( details::thread_record * pThis );
+            //@}
+
+        private:
+            //@cond
+            bool try_advance_epoch( size_t nEpoch );
+            //@endcond
+
+        public:
+            /// Get internal statistics
+            InternalState& getInternalState(InternalState& stat) const;
+
+            /// Checks if internal statistics enabled
+            bool              isStatisticsEnabled() const
+            {
+                return m_bStatEnabled;
+            }
+
+            /// Enables/disables internal statistics
+            bool  enableStatistics( bool bEnable )
+            {
+                bool bEnabled = m_bStatEnabled;
+                m_bStatEnabled = bEnable;
+                return bEnabled;
+            }
+
+        private:
+            GarbageCollector( size_t nRetiredThreshold );
+            ~GarbageCollector();
+        };
+
+        /// Thread GC
+        /**
+            To use epoch-based reclamation schema each thread object must be linked with the object of ThreadGC class
+            that interacts with GarbageCollector global object. The linkage is performed by calling \ref cds_threading "cds::threading::Manager::attachThread()"
+            on the start of each thread that uses EBR GC. Before terminating the thread linked to EBR GC it is necessary to call
+            \ref cds_threading "cds::threading::Manager::detachThread()".
+        */
+        class ThreadGC
+        {
+            GarbageCollector&           m_gc    ;   ///< reference to GC singleton
+            details::thread_record *    m_pRec  ;   ///< thread record
+
+        public:
+            /// Default constructor
+            ThreadGC()
+                : m_gc( GarbageCollector::instance() )
+                , m_pRec( nullptr )
+            {}
+
+            /// The object is not copy-constructible
+            ThreadGC( ThreadGC const& ) = delete;
+
+            /// Dtor calls fini()
+            ~ThreadGC()
+            {
+                fini();
+            }
+
+            /// Initialization. Repeat call is available
+            void init()
+            {
+                if ( !m_pRec )
+                    m_pRec = m_gc.alloc_thread_record();
+            }
+
+            /// Finalization. Repeat call is available
+            void fini()
+            {
+                if ( m_pRec ) {
+                    details::thread_record * pRec = m_pRec;
+                    m_pRec = nullptr;
+                    m_gc.free_thread_record( pRec );
+                }
+            }
+
+        public:
+            /// Enters the critical section of current thread
+            void enter() CDS_NOEXCEPT
+            {
+                assert( m_pRec != nullptr );
+                if ( m_pRec->m_nNestCount++ == 0 )
+                    m_gc.enter( m_pRec );
+            }
+
+            /// Leaves the critical section of current thread
+            void leave() CDS_NOEXCEPT
+            {
+                assert( m_pRec != nullptr );
+                assert( m_pRec->m_nNestCount > 0 );
+                if ( --m_pRec->m_nNestCount == 0 )
+                    m_gc.leave( m_pRec );
+            }
+
+            /// Checks if current thread is in critical section
+            bool is_locked() const CDS_NOEXCEPT
+            {
+                return m_pRec && m_pRec->m_nNestCount > 0;
+            }
+
+            /// Initializes guard \p g
+            void allocGuard( ebr::details::guard& g ) CDS_NOEXCEPT
+            {
+                if ( !g.m_pGC ) {
+                    g.m_pGC = this;
+                    g.m_pGuarded = nullptr;
+                }
+            }
+
+            /// Frees guard \p g
+            void freeGuard( ebr::details::guard& g ) CDS_NOEXCEPT
+            {
+                if ( g.m_pGC ) {
+                    assert( g.m_pGC == this );
+                    if ( g.m_pGuarded )
+                        leave();
+                    g.m_pGuarded = nullptr;
+                    g.m_pGC = nullptr;
+                }
+            }
+
+            /// Initializes guard \p g
+            void allocGuard( ebr::Guard& g ) CDS_NOEXCEPT
+            {
+                enter();
+                g.m_pGuarded = nullptr;
+            }
+
+            /// Frees guard \p g
+            void freeGuard( ebr::Guard& /*g*/ ) CDS_NOEXCEPT
+            {
+                leave();
+            }
+
+            /// Initializes guard array \p arr
+            template <size_t Count>
+            void allocGuard( GuardArray<Count>& arr ) CDS_NOEXCEPT
+            {
+                enter();
+                arr.clearAll();
+            }
+
+            /// Frees guard array \p arr
+            template <size_t Count>
+            void freeGuard( GuardArray<Count>& /*arr*/ ) CDS_NOEXCEPT
+            {
+                leave();
+            }
+
+            /// Places retired pointer \p and its deleter \p pFunc into thread's array of retired pointer for deferred reclamation
+            template <typename T>
+            void retirePtr( T * p, void (* pFunc)(T *) )
+            {
+                retirePtr( retired_ptr( reinterpret_cast<void *>( p ), reinterpret_cast<free_retired_ptr_func>( pFunc )));
+            }
+
+            /// Places retired pointer \p into thread's array of retired pointer for deferred reclamation
+            void retirePtr( retired_ptr const& p )
+            {
+                assert( m_pRec != nullptr );
+                m_gc.retirePtr( m_pRec, p );
+            }
+
+            /// Places the range <tt>[itFirst, itLast)</tt> of retired pointers with deleter \p pFunc into thread's array of retired pointer
+            template <typename ForwardIterator, typename T>
+            void retirePtr( ForwardIterator itFirst, ForwardIterator itLast, void (* pFunc)(T *) )
+            {
+                assert( m_pRec != nullptr );
+                m_gc.retirePtr( m_pRec, itFirst, itLast, pFunc );
+            }
+
+            /// Run retiring cycle
+            void scan()
+            {
+                assert( m_pRec != nullptr );
+                m_gc.scan( m_pRec );
+            }
+        };
+        //@cond
+        inline void details::guard::set( void * p, atomics::memory_order /*order*/ ) CDS_NOEXCEPT
+        {
+            assert( is_initialized() );
+            if ( p ) {
+                if ( !m_pGuarded )
+                    m_pGC->enter();
+            }
+            else if ( m_pGuarded )
+                m_pGC->leave();
+            m_pGuarded = p;
+        }
+        //@endcond
+    }   // namespace ebr
+}}  // namespace cds::gc
+//@endcond
+
+#if CDS_COMPILER == CDS_COMPILER_MSVC
+#   pragma warning(pop)
+#endif
+
+#endif // #ifndef CDSLIB_GC_DETAILS_EBR_H
@@ -0,0 +1,777 @@
+//$$CDS-header$$
+
+#ifndef CDSLIB_GC_DETAILS_HE_H
+#define CDSLIB_GC_DETAILS_HE_H
+
+#include <vector>
+#include <iterator>
+#include <cds/algo/atomic.h>
+#include <cds/gc/details/retired_ptr.h>
+#include <cds/os/thread.h>
+
+#if CDS_COMPILER == CDS_COMPILER_MSVC
+#   pragma warning(push)
+#   pragma warning(disable:4251)    // C4251: 'identifier' : class 'type' needs to have dll-interface to be used by clients of class 'type2'
+#endif
+
+//@cond
+namespace cds { namespace gc {
+
+    /// Hazard eras reclamation schema
+    /**
+        The cds::gc::he namespace and its members are internal representation of the GC and should not be used directly.
+        Use cds::gc::HE class in your code.
+
+        Hazard eras (HE) garbage collector is a singleton. The main user-level part of HE schema is
+        GC class and its nested classes. Before use any HE-related class you must initialize HE garbage collector
+        by contructing cds::gc::HE object in beginning of your main().
+        See cds::gc::HE class for explanation.
+
+        \par Implementation issues
+            The GC maintains global era clock. Each thread has a record in the global list of thread records;
+            the record contains the slots of guards of the thread. The slots are allocated by blocks on demand
+            and are never freed until GC destruction.
+            A slot publishes either the era observed by \p protect() or a hazard pointer set by \p assign().
+            Retired pointers are buffered per-thread together with their birth era and retire era.
+            A retired pointer is freed if no slot publishes it as a hazard pointer and no slot publishes an era
+            from its lifetime interval <tt>[birth era, retire era]</tt>.
+    */
+    namespace he {
+
+        // Forward declarations
+        class Guard;
+        template <size_t Count> class GuardArray;
+        class ThreadGC;
+        class GarbageCollector;
+
+        /// Retired pointer type
+        typedef cds::gc::details::retired_ptr retired_ptr;
+
+        using cds::gc::details::free_retired_ptr_func;
+
+        /// Era type
+        typedef uint64_t era_type;
+
+        /// Details of hazard eras algorithm
+        namespace details {
+
+            /// Retired pointer with its lifetime interval
+            struct era_retired_ptr
+            {
+                retired_ptr m_ptr;          ///< retired pointer
+                era_type    m_nBirthEra;    ///< era when the pointer was linked to the container, 0 - unknown
+                era_type    m_nRetireEra;   ///< era when the pointer was retired
+
+                era_retired_ptr( retired_ptr const& p, era_type nBirthEra, era_type nRetireEra )
+                    : m_ptr( p )
+                    , m_nBirthEra( nBirthEra )
+                    , m_nRetireEra( nRetireEra )
+                {}
+
+                era_retired_ptr( era_retired_ptr const& ) = default;
+                era_retired_ptr& operator =( era_retired_ptr const& ) = default;
+            };
+
+            //@cond
+            // Birth era functor for the range retire of pointers with unknown birth era
+            struct unknown_birth_era {
+                template <typename T>
+                era_type operator()( T * ) const CDS_NOEXCEPT
+                {
+                    return 0;
+                }
+            };
+            //@endcond
+
+            /// Per-thread array of retired pointers
+            typedef std::vector< era_retired_ptr > retired_vector;
+
+            /// Guard slot
+            /**
+                The slot publishes the era observed by \p protect() in \p m_nEra
+                or a hazard pointer set by \p set() in \p m_pHazard; zero value means nothing is published.
+                \p m_pGuarded is thread-private value returned by \p guard::get().
+            */
+            struct guard_slot
+            {
+                atomics::atomic<era_type>   m_nEra;         ///< published era, 0 - none
+                atomics::atomic<void *>     m_pHazard;      ///< published hazard pointer
+                void *                      m_pGuarded;     ///< thread-private guarded pointer
+                guard_slot *                m_pNextFree;    ///< next item in the thread's free slot list
+
+                guard_slot()
+                    : m_nEra( 0 )
+                    , m_pHazard( nullptr )
+                    , m_pGuarded( nullptr )
+                    , m_pNextFree( nullptr )
+                {}
+
+                /// Publishes pointer \p p as hazard pointer
+                /**
+                    As for \p gc::HP, \p p should be already guarded or should not be changed concurrently.
+                    The era published is cleared after the pointer is published.
+                */
+                void set( void * p ) CDS_NOEXCEPT
+                {
+                    m_pHazard.store( p, atomics::memory_order_release );
+                    if ( m_nEra.load( atomics::memory_order_relaxed ))
+                        m_nEra.store( 0, atomics::memory_order_release );
+                    m_pGuarded = p;
+                }
+
+                /// Copies the content of \p src slot
+                void copy( guard_slot const& src ) CDS_NOEXCEPT
+                {
+                    m_pHazard.store( src.m_pHazard.load( atomics::memory_order_relaxed ), atomics::memory_order_release );
+                    m_nEra.store( src.m_nEra.load( atomics::memory_order_relaxed ), atomics::memory_order_release );
+                    m_pGuarded = src.m_pGuarded;
+                }
+
+                /// Clears the slot
+                void clear() CDS_NOEXCEPT
+                {
+                    if ( m_pHazard.load( atomics::memory_order_relaxed ))
+                        m_pHazard.store( nullptr, atomics::memory_order_release );
+                    if ( m_nEra.load( atomics::memory_order_relaxed ))
+                        m_nEra.store( 0, atomics::memory_order_release );
+                    m_pGuarded = nullptr;
+                }
+
+                /// Loads \p toGuard under the protection of current era
+                /**
+                    The function publishes current era and returns the value of \p toGuard
+                    loaded while the era published is current. The memory fence is issued only
+                    when the era is changed since last \p protect() call for this slot.
+                    The caller should store the value returned to \p m_pGuarded.
+                */
+                template <typename T>
+                T protect( atomics::atomic<T> const& toGuard ); // inline after GarbageCollector
+            };
+
+            /// Block of guard slots
+            struct slot_block
+            {
+                static const size_t c_nCapacity = 16;   ///< slot count in the block
+
+                guard_slot      m_arr[c_nCapacity]; ///< slots
+                slot_block *    m_pNext;            ///< next block of the thread record; immutable after publishing
+
+                slot_block()
+                    : m_pNext( nullptr )
+                {}
+            };
+
+            /// Thread record
+            /**
+                The record is allocated on thread attach and is never deleted until GC destruction;
+                the record of terminated thread is reused by newly attached threads.
+            */
+            struct thread_record
+            {
+                atomics::atomic<slot_block *>       m_pSlotBlocks;  ///< slot blocks of the thread; the list is extended by owner only
+                guard_slot *                        m_pFreeSlots;   ///< thread-private list of free slots
+                size_t                              m_nRetireCount; ///< thread-private count of pointers retired since last era advance
+                size_t                              m_nScanThreshold; ///< thread-private size of \p m_arrRetired to call \p scan()
+                bool                                m_bInScan;      ///< thread-private recursion guard of \p scan()
+                retired_vector                      m_arrRetired;   ///< retired pointers of the thread
+
+                std::vector< era_type >             m_arrEras;      ///< \p scan() snapshot of published eras
+                std::vector< void * >               m_arrHazards;   ///< \p scan() snapshot of published hazard pointers
+
+                thread_record *                     m_pNextNode;    ///< next record in the global list
+                atomics::atomic<OS::ThreadId>       m_idOwner;      ///< owner thread id; \p c_NullThreadId - the record is free
+                atomics::atomic<bool>               m_bFree;        ///< \p true if the record is free and its retired array is empty
+
+                thread_record()
+                    : m_pSlotBlocks( nullptr )
+                    , m_pFreeSlots( nullptr )
+                    , m_nRetireCount( 0 )
+                    , m_nScanThreshold( 0 )
+                    , m_bInScan( false )
+                    , m_pNextNode( nullptr )
+                    , m_idOwner( OS::c_NullThreadId )
+                    , m_bFree( true )
+                {}
+            };
+
+            /// Uninitialized guard
+            /**
+                The guard of this type is used by \p guarded_ptr: the slot is allocated
+                on first use and is freed when the guarded pointer is released.
+            */
+            class guard
+            {
+                friend class he::ThreadGC;
+            protected:
+                guard_slot *    m_pSlot;    ///< guard slot; \p nullptr - the guard is uninitialized
+
+            public:
+                /// Initialize empty guard.
+                CDS_CONSTEXPR guard() CDS_NOEXCEPT
+                    : m_pSlot( nullptr )
+                {}
+
+                /// Copy-ctor is disabled
+                guard( guard const& ) = delete;
+
+                /// Move-ctor is disabled
+                guard( guard&& ) = delete;
+
+                /// Get current guarded pointer
+                void * get( atomics::memory_order /*order*/ = atomics::memory_order_acquire ) const CDS_NOEXCEPT
+                {
+                    assert( is_initialized() );
+                    return m_pSlot->m_pGuarded;
+                }
+
+                /// Guards pointer \p p
+                void set( void * p, atomics::memory_order /*order*/ = atomics::memory_order_release ) CDS_NOEXCEPT
+                {
+                    assert( is_initialized() );
+                    m_pSlot->set( p );
+                }
+
+                /// Clears the guard
+                void clear( atomics::memory_order /*order*/ = atomics::memory_order_relaxed ) CDS_NOEXCEPT
+                {
+                    assert( is_initialized() );
+                    m_pSlot->clear();
+                }
+
+                /// Guards pointer \p p
+                template <typename T>
+                T * operator =(T * p) CDS_NOEXCEPT
+                {
+                    set( reinterpret_cast<void *>( const_cast<T *>(p) ));
+                    return p;
+                }
+
+                std::nullptr_t operator=(std::nullptr_t) CDS_NOEXCEPT
+                {
+                    clear();
+                    return nullptr;
+                }
+
+                /// Moves the guard from \p src
+                /**
+                    \p this guard must be uninitialized
+                */
+                void move_from( guard& src ) CDS_NOEXCEPT
+                {
+                    assert( !is_initialized() );
+                    m_pSlot = src.m_pSlot;
+                    src.m_pSlot = nullptr;
+                }
+
+                bool is_initialized() const CDS_NOEXCEPT
+                {
+                    return m_pSlot != nullptr;
+                }
+
+                /// Returns guard slot
+                guard_slot * slot() const CDS_NOEXCEPT
+                {
+                    return m_pSlot;
+                }
+            };
+
+        } // namespace details
+
+        /// Guard
+        /**
+            This class represents auto guard: ctor allocates a slot for the current thread,
+            dtor clears the slot and returns it to the thread's free list.
+        */
+        class Guard: public details::guard
+        {
+        public:
+            /// Allocates a slot
+            Guard(); // inline in he_impl.h
+
+            /// Frees the slot
+            ~Guard();    // inline in he_impl.h
+
+            //@cond
+            Guard( Guard const& ) = delete;
+            Guard( Guard&& ) = delete;
+            //@endcond
+
+            using details::guard::operator =;
+        };
+
+        /// Array of guards
+        /**
+            This class represents array of auto guards: ctor allocates \p Count slots for the current thread,
+            dtor frees them.
+        */
+        template <size_t Count>
+        class GuardArray
+        {
+            friend class ThreadGC;
+            details::guard_slot *   m_arr[Count]    ;   ///< array of slots
+            const static size_t c_nCapacity = Count ;   ///< Array capacity (equal to \p Count template parameter)
+
+        public:
+            /// Rebind array for other size \p OtherCount
+            template <size_t OtherCount>
+            struct rebind {
+                typedef GuardArray<OtherCount>  other   ;   ///< rebinding result
+            };
+
+        public:
+            /// Allocates the slots
+            GuardArray();    // inline in he_impl.h
+
+            /// The object is not copy-constructible
+            GuardArray( GuardArray const& ) = delete;
+
+            /// The object is not move-constructible
+            GuardArray( GuardArray&& ) = delete;
+
+            /// Frees the slots
+            ~GuardArray();    // inline in he_impl.h
+
+            /// Returns the capacity of array
+            CDS_CONSTEXPR size_t capacity() const CDS_NOEXCEPT
+            {
+                return c_nCapacity;
+            }
+
+            /// Returns the slot \p nIndex (0 <= \p nIndex < \p Count)
+            details::guard_slot& operator[]( size_t nIndex ) const CDS_NOEXCEPT
+            {
+                assert( nIndex < capacity() );
+                return *m_arr[nIndex];
+            }
+
+            /// Returns the pointer guarded by slot \p nIndex (0 <= \p nIndex < \p Count)
+            void * get( size_t nIndex ) const CDS_NOEXCEPT
+            {
+                return (*this)[nIndex].m_pGuarded;
+            }
+
+            /// Set the guard \p nIndex. 0 <= \p nIndex < \p Count
+            template <typename T>
+            void set( size_t nIndex, T * p ) CDS_NOEXCEPT
+            {
+                (*this)[nIndex].set( reinterpret_cast<void *>( const_cast<T *>( p )));
+            }
+
+            /// Clears (sets to \p nullptr) the guard \p nIndex
+            void clear( size_t nIndex ) CDS_NOEXCEPT
+            {
+                (*this)[nIndex].clear();
+            }
+
+            /// Clears all guards in the array
+            void clearAll() CDS_NOEXCEPT
+            {
+                for ( size_t i = 0; i < capacity(); ++i )
+                    clear(i);
+            }
+        };
+
+        /// Memory manager (Garbage collector)
+        class CDS_EXPORT_API GarbageCollector
+        {
+        private:
+            friend class ThreadGC;
+
+            /// Internal GC statistics
+            struct internal_stat
+            {
+                atomics::atomic<size_t>  m_nEraAdvance       ;   ///< Count of era clock advance
+                atomics::atomic<size_t>  m_nScanCall         ;   ///< Count of \p scan() call
+                atomics::atomic<size_t>  m_nHelpScanCall     ;   ///< Count of \p help_scan() call
+                atomics::atomic<size_t>  m_nDeletedNode      ;   ///< Count of freed retired pointers
+                atomics::atomic<size_t>  m_nDeferredNode     ;   ///< Count of retired pointers that cannot be freed during \p scan()
+
+                internal_stat()
+                    : m_nEraAdvance(0)
+                    , m_nScanCall(0)
+                    , m_nHelpScanCall(0)
+                    , m_nDeletedNode(0)
+                    , m_nDeferredNode(0)
+                {}
+            };
+
+        public:
+            /// Exception "No GarbageCollector object is created"
+            class not_initialized : public std::runtime_error
+            {
+            public:
+                //@cond
+                not_initialized()
+                    : std::runtime_error( "Global HE GarbageCollector is not initialized" )
+                {}
+                //@endcond
+            };
+
+            /// Internal GC statistics
+            struct InternalState
+            {
+                era_type nEra               ;   ///< Current value of era clock
+                size_t  nRetiredThreshold   ;   ///< Per-thread \p scan() threshold
+                size_t  nEraAdvanceFreq     ;   ///< Per-thread count of retired pointers to advance era clock
+                size_t  nThreadRecAllocated ;   ///< Count of thread records allocated
+                size_t  nThreadRecUsed      ;   ///< Count of thread records in use
+                size_t  nGuardAllocated     ;   ///< Count of guard slots allocated
+
+                size_t  evcEraAdvance       ;   ///< Count of era clock advance
+                size_t  evcScanCall         ;   ///< Count of \p scan() call
+                size_t  evcHelpScanCall     ;   ///< Count of \p help_scan() call
+                size_t  evcDeletedNode      ;   ///< Count of freed retired pointers
+                size_t  evcDeferredNode     ;   ///< Count of retired pointers that cannot be freed during \p scan()
+
+                //@cond
+                InternalState()
+                    : nEra(0)
+                    , nRetiredThreshold(0)
+                    , nEraAdvanceFreq(0)
+                    , nThreadRecAllocated(0)
+                    , nThreadRecUsed(0)
+                    , nGuardAllocated(0)
+                    , evcEraAdvance(0)
+                    , evcScanCall(0)
+                    , evcHelpScanCall(0)
+                    , evcDeletedNode(0)
+                    , evcDeferredNode(0)
+                {}
+                //@endcond
+            };
+
+        private:
+            static GarbageCollector * m_pManager    ;   ///< GC global instance
+
+            atomics::atomic<era_type>                   m_nEraClock;        ///< Global era clock
+            atomics::atomic<details::thread_record *>   m_pListHead;        ///< Head of thread record list
+            size_t const                                m_nRetiredThreshold;///< Per-thread size of retired array to call \p scan()
+            size_t const                                m_nEraAdvanceFreq;  ///< Per-thread count of retired pointers to advance the era clock
+
+            internal_stat   m_stat  ;   ///< Internal statistics
+            bool            m_bStatEnabled  ;   ///< Internal Statistics enabled
+
+        public:
+            /// Initializes HE memory manager singleton
+            /**
+                This member function creates and initializes HE global object.
+                The function should be called before using CDS data structure based on cds::gc::HE GC. Usually,
+                this member function is called in the \p main() function.
+                After calling of this function you may use CDS data structures based on cds::gc::HE.
+
+                \par Parameters
+                \li \p nRetiredThreshold - \p scan() threshold. When count of retired pointers of a thread reaches this value,
+                    the \p scan() member function would be called for freeing retired pointers.
+                \li \p nEraAdvanceFreq - the era clock is advanced each time a thread retires \p nEraAdvanceFreq pointers.
+            */
+            static void CDS_STDCALL Construct( size_t nRetiredThreshold = 256, size_t nEraAdvanceFreq = 32 );
+
+            /// Destroys HE memory manager
+            /**
+                The member function destroys HE global object. After calling of this function you may \b NOT
+                use CDS data structures based on cds::gc::HE. Usually, the \p Destruct function is called
+                at the end of your \p main().
+            */
+            static void CDS_STDCALL Destruct();
+
+            /// Returns pointer to GarbageCollector instance
+            /**
+                If HE GC is not initialized, \p not_initialized exception is thrown
+            */
+            static GarbageCollector&   instance()
+            {
+                if ( m_pManager == nullptr )
+                    throw not_initialized();
+                return *m_pManager;
+            }
+
+            /// Checks if global GC object is constructed and may be used
+            static bool isUsed() CDS_NOEXCEPT
+            {
+                return m_pManager != nullptr;
+            }
+
+            /// Returns current value of era clock
+            static era_type current_era() CDS_NOEXCEPT
+            {
+                assert( m_pManager != nullptr );
+                return m_pManager->m_nEraClock.load( atomics::memory_order_seq_cst );
+            }
+
+            /// Returns per-thread \p scan() threshold
+            size_t getRetiredThreshold() const CDS_NOEXCEPT
+            {
+                return m_nRetiredThreshold;
+            }
+
+            /// Returns per-thread count of retired pointers to advance the era clock
+            size_t getEraAdvanceFreq() const CDS_NOEXCEPT
+            {
+                return m_nEraAdvanceFreq;
+            }
+
+        public:
+            //@{
+            /// Internal interface
+
+            /// Allocates thread record
+            details::thread_record * alloc_thread_record();
+
+            /// Frees thread record; the retired pointers that cannot be freed yet are left in the record
+            void free_thread_record( details::thread_record * pRec );
+
+            /// Allocates new block of slots for \p pRec and links its slots to the free slot list of \p pRec
+            void extend_slots( details::thread_record * pRec );
+
+            /// Places retired pointer \p p born in era \p nBirthEra into thread's array of retired pointer for deferred reclamation
+            void retirePtr( details::thread_record * pRec, retired_ptr const& p, era_type nBirthEra )
+            {
+                pRec->m_arrRetired.push_back( details::era_retired_ptr( p, nBirthEra, retire_era( pRec, 1 )));
+                if ( pRec->m_arrRetired.size() >= pRec->m_nScanThreshold )
+                    scan( pRec );
+            }
+
+            /// Places the range <tt>[itFirst, itLast)</tt> of pointers with deleter \p pFunc to retired array of \p pRec
+            /**
+                \p fBirthEra( p ) returns the birth era of pointer \p p from the range, 0 - unknown.
+                The range is passed once since the iterator may destroy the links it has passed.
+            */
+            template <typename ForwardIterator, typename T, typename BirthEra>
+            void retirePtr( details::thread_record * pRec, ForwardIterator itFirst, ForwardIterator itLast, void (* pFunc)(T *), BirthEra fBirthEra )
+            {
+                size_t const nStart = pRec->m_arrRetired.size();
+                for ( ; itFirst != itLast; ++itFirst ) {
+                    T * p = *itFirst;
+                    pRec->m_arrRetired.push_back( details::era_retired_ptr(
+                        retired_ptr( reinterpret_cast<void *>( p ), reinterpret_cast<free_retired_ptr_func>( pFunc )), fBirthEra( p ), 0 ));
+                }
+
+                size_t const nSize = pRec->m_arrRetired.size();
+                era_type const nEra = retire_era( pRec, nSize - nStart );
+                for ( size_t i = nStart; i < nSize; ++i )
+                    pRec->m_arrRetired[i].m_nRetireEra = nEra;
+
+                if ( nSize >= pRec->m_nScanThreshold )
+                    scan( pRec );
+            }
+
+            /// Frees the retired pointers of \p pRec that are not protected
+            void scan( details::thread_record * pRec );
+
+            /// Helper scan routine
+            /**
+                The function moves retired pointers of the records of terminated threads to \p pThis
+                and calls \p scan() for them.
+            */
+            void help_scan( details::thread_record * pThis );
+            //@}
+
+        private:
+            //@cond
+            era_type retire_era( details::thread_record * pRec, size_t nCount )
+            {
+                // The pointers being retired are already unlinked.
+                // The fence pairs with the fence in guard_slot::protect(): if a thread has loaded
+                // a pointer before unlinking it, the era published by the thread is not greater than the era read here
+                atomics::atomic_thread_fence( atomics::memory_order_seq_cst );
+                era_type const nEra = m_nEraClock.load( atomics::memory_order_seq_cst );
+
+                pRec->m_nRetireCount += nCount;
+                if ( pRec->m_nRetireCount >= m_nEraAdvanceFreq ) {
+                    pRec->m_nRetireCount = 0;
+                    m_nEraClock.fetch_add( 1, atomics::memory_order_seq_cst );
+                    if ( m_bStatEnabled )
+                        ++m_stat.m_nEraAdvance;
+                }
+                return nEra;
+            }
+            //@endcond
+
+        public:
+            /// Get internal statistics
+            InternalState& getInternalState(InternalState& stat) const;
+
+            /// Checks if internal statistics enabled
+            bool              isStatisticsEnabled() const
+            {
+                return m_bStatEnabled;
+            }
+
+            /// Enables/disables internal statistics
+            bool  enableStatistics( bool bEnable )
+            {
+                bool bEnabled = m_bStatEnabled;
+                m_bStatEnabled = bEnable;
+                return bEnabled;
+            }
+
+        private:
+            GarbageCollector( size_t nRetiredThreshold, size_t nEraAdvanceFreq );
+            ~GarbageCollector();
+        };
+
+        /// Thread GC
+        /**
+            To use hazard eras schema each thread object must be linked with the object of ThreadGC class
+            that interacts with GarbageCollector global object. The linkage is performed by calling \ref cds_threading "cds::threading::Manager::attachThread()"
+            on the start of each thread that uses HE GC. Before terminating the thread linked to HE GC it is necessary to call
+            \ref cds_threading "cds::threading::Manager::detachThread()".
+        */
+        class ThreadGC
+        {
+            GarbageCollector&           m_gc    ;   ///< reference to GC singleton
+            details::thread_record *    m_pRec  ;   ///< thread record
+
+        public:
+            /// Default constructor
+            ThreadGC()
+                : m_gc( GarbageCollector::instance() )
+                , m_pRec( nullptr )
+            {}
+
+            /// The object is not copy-constructible
+            ThreadGC( ThreadGC const& ) = delete;
+
+            /// Dtor calls fini()
+            ~ThreadGC()
+            {
+                fini();
+            }
+
+            /// Initialization. Repeat call is available
+            void init()
+            {
+                if ( !m_pRec )
+                    m_pRec = m_gc.alloc_thread_record();
+            }
+
+            /// Finalization. Repeat call is available
+            void fini()
+            {
+                if ( m_pRec ) {
+                    details::thread_record * pRec = m_pRec;
+                    m_pRec = nullptr;
+                    m_gc.free_thread_record( pRec );
+                }
+            }
+
+        public:
+            /// Allocates a slot
+            details::guard_slot * allocSlot()
+            {
+                assert( m_pRec != nullptr );
+                if ( !m_pRec->m_pFreeSlots )
+                    m_gc.extend_slots( m_pRec );
+                details::guard_slot * pSlot = m_pRec->m_pFreeSlots;
+                m_pRec->m_pFreeSlots = pSlot->m_pNextFree;
+                return pSlot;
+            }
+
+            /// Clears slot \p pSlot and returns it to the free list
+            void freeSlot( details::guard_slot * pSlot ) CDS_NOEXCEPT
+            {
+                assert( m_pRec != nullptr );
+                pSlot->clear();
+                pSlot->m_pNextFree = m_pRec->m_pFreeSlots;
+                m_pRec->m_pFreeSlots = pSlot;
+            }
+
+            /// Initializes guard \p g
+            void allocGuard( he::details::guard& g )
+            {
+                if ( !g.m_pSlot )
+                    g.m_pSlot = allocSlot();
+            }
+
+            /// Frees guard \p g
+            void freeGuard( he::details::guard& g ) CDS_NOEXCEPT
+            {
+                if ( g.m_pSlot ) {
+                    freeSlot( g.m_pSlot );
+                    g.m_pSlot = nullptr;
+                }
+            }
+
+            /// Initializes guard array \p arr
+            template <size_t Count>
+            void allocGuard( GuardArray<Count>& arr )
+            {
+                for ( size_t i = 0; i < Count; ++i )
+                    arr.m_arr[i] = allocSlot();
+            }
+
+            /// Frees guard array \p arr
+            template <size_t Count>
+            void freeGuard( GuardArray<Count>& arr ) CDS_NOEXCEPT
+            {
+                for ( size_t i = 0; i < Count; ++i )
+                    freeSlot( arr.m_arr[i] );
+            }
+
+            /// Places retired pointer \p and its deleter \p pFunc into thread's array of retired pointer for deferred reclamation
+            /**
+                \p nBirthEra is the era when \p p has been linked to the container; 0 means unknown.
+            */
+            template <typename T>
+            void retirePtr( T * p, void (* pFunc)(T *), era_type nBirthEra = 0 )
+            {
+                retirePtr( retired_ptr( reinterpret_cast<void *>( p ), reinterpret_cast<free_retired_ptr_func>( pFunc )), nBirthEra );
+            }
+
+            /// Places retired pointer \p into thread's array of retired pointer for deferred reclamation
+            void retirePtr( retired_ptr const& p, era_type nBirthEra = 0 )
+            {
+                assert( m_pRec != nullptr );
+                m_gc.retirePtr( m_pRec, p, nBirthEra );
+            }
+
+            /// Places the range <tt>[itFirst, itLast)</tt> of retired pointers with deleter \p pFunc into thread's array of retired pointer
+            /**
+                \p fBirthEra( p ) returns the birth era of pointer \p p from the range, 0 - unknown.
+            */
+            template <typename ForwardIterator, typename T, typename BirthEra>
+            void retirePtr( ForwardIterator itFirst, ForwardIterator itLast, void (* pFunc)(T *), BirthEra fBirthEra )
+            {
+                assert( m_pRec != nullptr );
+                m_gc.retirePtr( m_pRec, itFirst, itLast, pFunc, fBirthEra );
+            }
+
+            /// Run retiring cycle
+            void scan()
+            {
+                assert( m_pRec != nullptr );
+                m_gc.scan( m_pRec );
+            }
+        };
+
+        //@cond
+        template <typename T>
+        inline T details::guard_slot::protect( atomics::atomic<T> const& toGuard )
+        {
+            if ( m_pHazard.load( atomics::memory_order_relaxed ))
+                m_pHazard.store( nullptr, atomics::memory_order_release );
+
+            era_type nPrevEra = m_nEra.load( atomics::memory_order_relaxed );
+            while ( true ) {
+                T pCur = toGuard.load( atomics::memory_order_acquire );
+                era_type const nEra = GarbageCollector::current_era();
+                if ( nEra == nPrevEra )
+                    return pCur;
+
+                // Publish the era. The fence pairs with the fence in GarbageCollector::retire_era()
+                // and in GarbageCollector::scan()
+                m_nEra.store( nEra, atomics::memory_order_relaxed );
+                atomics::atomic_thread_fence( atomics::memory_order_seq_cst );
+                nPrevEra = nEra;
+            }
+        }
+        //@endcond
+    }   // namespace he
+}}  // namespace cds::gc
+//@endcond
+
+#if CDS_COMPILER == CDS_COMPILER_MSVC
+#   pragma warning(pop)
+#endif
+
+#endif // #ifndef CDSLIB_GC_DETAILS_HE_H
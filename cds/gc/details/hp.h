@@ -5,10 +5,11 @@
 
 #include <cds/algo/atomic.h>
 #include <cds/os/thread.h>
-#include <cds/details/bounded_array.h>
+#include <vector>
 
 #include <cds/gc/details/hp_type.h>
 #include <cds/gc/details/hp_alloc.h>
+#include <cds/gc/details/reclaim_stat.h>
 
 #if CDS_COMPILER == CDS_COMPILER_MSVC
 #   pragma warning(push)
@@ -37,6 +38,12 @@ namespace cds {
     */
     namespace gc {
 
+    //@cond
+    namespace details {
+        class reclaimer_thread;
+    }
+    //@endcond
+
     /// Michael's Hazard Pointers reclamation schema
     /**
     \par Sources:
@@ -70,13 +77,17 @@ namespace cds {
                 The Hazard Pointer schema is build on thread-static arrays. For each HP-enabled thread the HP manager allocates
                 array of retired pointers. The array belongs to the thread: owner thread writes to the array, other threads
                 just read it.
+
+                The array grows on demand. When the size of the array reaches the scan threshold
+                the owner thread calls \p GarbageCollector::Scan(). The threshold is adjusted after each scan
+                proportionally to the count of hazard pointers in use, see \p GarbageCollector::Scan().
             */
             class retired_vector {
                 /// Underlying vector implementation
-                typedef cds::details::bounded_array<retired_ptr>    retired_vector_impl;
+                typedef std::vector<retired_ptr>    retired_vector_impl;
 
-                retired_vector_impl m_arr   ;   ///< the array of retired pointers
-                size_t              m_nSize ;   ///< Current size of \p m_arr
+                retired_vector_impl m_arr       ;   ///< the array of retired pointers
+                size_t              m_nThreshold;   ///< Scan threshold
 
             public:
                 /// Iterator
@@ -87,10 +98,7 @@ namespace cds {
                 ~retired_vector()
                 {}
 
-                /// Vector capacity.
-                /**
-                    The capacity is constant for any thread. It is defined by cds::gc::hp::GarbageCollector.
-                */
+                /// Vector capacity
                 size_t capacity() const CDS_NOEXCEPT
                 {
                     return m_arr.capacity();
@@ -99,28 +107,38 @@ namespace cds {
                 /// Current vector size (count of retired pointers in the vector)
                 size_t size() const CDS_NOEXCEPT
                 {
-                    return m_nSize;
+                    return m_arr.size();
                 }
 
                 /// Set vector size. Uses internally
                 void size( size_t nSize )
                 {
-                    assert( nSize <= capacity() );
-                    m_nSize = nSize;
+                    assert( nSize <= size() );
+                    m_arr.resize( nSize );
                 }
 
                 /// Pushes retired pointer to the vector
                 void push( retired_ptr const& p )
                 {
-                    assert( m_nSize < capacity() );
-                    m_arr[ m_nSize ] = p;
-                    ++m_nSize;
+                    m_arr.push_back( p );
+                }
+
+                /// Current scan threshold
+                size_t threshold() const CDS_NOEXCEPT
+                {
+                    return m_nThreshold;
                 }
 
-                /// Checks if the vector is full (size() == capacity() )
+                /// Sets scan threshold
+                void threshold( size_t nThreshold ) CDS_NOEXCEPT
+                {
+                    m_nThreshold = nThreshold;
+                }
+
+                /// Checks if the scan threshold is reached
                 bool isFull() const CDS_NOEXCEPT
                 {
-                    return m_nSize >= capacity();
+                    return size() >= m_nThreshold;
                 }
 
                 /// Begin iterator
@@ -132,13 +150,19 @@ namespace cds {
                 /// End iterator
                 iterator    end() CDS_NOEXCEPT
                 {
-                    return m_arr.begin() +  m_nSize;
+                    return m_arr.end();
                 }
 
                 /// Clears the vector. After clearing, size() == 0
                 void clear() CDS_NOEXCEPT
                 {
-                    m_nSize = 0;
+                    m_arr.clear();
+                }
+
+                /// Exchanges the content of the vector with \p v. The threshold is not changed
+                void swap( std::vector<retired_ptr>& v ) CDS_NOEXCEPT
+                {
+                    m_arr.swap( v );
                 }
             };
 
@@ -148,8 +172,10 @@ namespace cds {
                 other threads have read-only access.
             */
             struct hp_record {
-                hp_allocator<>    m_hzp; ///< array of hazard pointers. Implicit \ref CDS_DEFAULT_ALLOCATOR dependency
+                hp_allocator<>    m_hzp; ///< growing array of hazard pointers. Implicit \ref CDS_DEFAULT_ALLOCATOR dependency
                 retired_vector    m_arrRetired ; ///< Retired pointer array
+                atomics::atomic<size_t> m_nRetiredCount; ///< Size of \p m_arrRetired published by the owner for other threads
+                cds::gc::details::reclaim_counters m_ReclaimStat; ///< Reclamation telemetry of the record's scans
 
                 /// Ctor
                 hp_record( const cds::gc::hp::GarbageCollector& HzpMgr );    // inline
@@ -161,6 +187,18 @@ namespace cds {
                 {
                     m_hzp.clear();
                 }
+
+                /// Publishes current size of \p m_arrRetired. Called by the owner after the array has been changed
+                void update_retired_count() CDS_NOEXCEPT
+                {
+                    m_nRetiredCount.store( m_arrRetired.size(), atomics::memory_order_relaxed );
+                }
+
+                /// Count of retired pointers of the record; may be called by any thread
+                size_t retired_count() const CDS_NOEXCEPT
+                {
+                    return m_nRetiredCount.load( atomics::memory_order_relaxed );
+                }
             };
         }    // namespace details
 
@@ -170,7 +208,8 @@ namespace cds {
         */
         enum scan_type {
             classic,    ///< classic scan as described in Michael's works (see GarbageCollector::classic_scan)
-            inplace     ///< inplace scan without allocation (see GarbageCollector::inplace_scan)
+            inplace,    ///< inplace scan without allocation (see GarbageCollector::inplace_scan)
+            hashed      ///< scan using hash table of hazard pointers (see GarbageCollector::hashed_scan)
         };
 
         /// Hazard Pointer singleton
@@ -190,10 +229,14 @@ namespace cds {
 
             /// Internal GC statistics
             struct InternalState {
-                size_t              nHPCount                ;   ///< HP count per thread (const)
-                size_t              nMaxThreadCount         ;   ///< Max thread count (const)
-                size_t              nMaxRetiredPtrCount     ;   ///< Max retired pointer count per thread (const)
-                size_t              nHPRecSize              ;   ///< Size of HP record, bytes (const)
+                size_t              nHPCount                ;   ///< Initial HP count per thread, the size of HP block (const)
+                size_t              nRetiredThreshold       ;   ///< Min scan threshold of retired pointer array (const)
+                size_t              nMaxThreadCount         ;   ///< Deprecated: the count of allocated HP records, equal to \p nHPRecAllocated
+                size_t              nMaxRetiredPtrCount     ;   ///< Deprecated: equal to \p nRetiredThreshold
+                size_t              nHPRecSize              ;   ///< Size of HP record without its hazard pointer blocks, bytes (const)
+
+                size_t              nHPAllocated            ;   ///< Total count of allocated hazard pointers
+                size_t              nHPUsed                 ;   ///< Count of hazard pointers in use by attached threads
 
                 size_t              nHPRecAllocated         ;   ///< Count of HP record allocations
                 size_t              nHPRecUsed              ;   ///< Count of HP record used
@@ -211,6 +254,11 @@ namespace cds {
 
                 event_counter::value_type   evcDeletedNode  ;   ///< Count of deleting of retired objects
                 event_counter::value_type   evcDeferredNode ;   ///< Count of objects that cannot be deleted in Scan phase because of a hazard_pointer guards it
+
+                event_counter::value_type   evcScanTime     ;   ///< Total time of Scan calls, nanoseconds
+                size_t                      nMaxScanTime    ;   ///< Max time of Scan call, nanoseconds
+
+                event_counter::value_type   evcBatchHandoff ;   ///< Count of retired batches handed off to the reclamation thread
             };
 
             /// No GarbageCollector object is created
@@ -225,7 +273,11 @@ namespace cds {
             };
 
             /// Not enough required Hazard Pointer count
-            class too_many_hazard_ptr : public std::length_error
+            /**
+                Deprecated: the hazard pointer array of the thread grows on demand, so the exception is never thrown.
+            */
+            class CDS_DEPRECATED( "hazard pointer array grows on demand, the exception is never thrown" ) too_many_hazard_ptr
+                : public std::length_error
             {
             public:
                 //@cond
@@ -249,6 +301,17 @@ namespace cds {
 
                 event_counter  m_DeletedNode            ;    ///< Count of retired objects deleting
                 event_counter  m_DeferredNode            ;    ///< Count of objects that cannot be deleted in Scan phase because of a hazard_pointer guards it
+
+                event_counter  m_ScanTime               ;    ///< Total time of Scan calls, nanoseconds
+                atomics::atomic<size_t> m_nMaxScanTime  ;    ///< Max time of Scan call, nanoseconds
+
+                event_counter  m_BatchHandoff           ;    ///< Count of retired batches handed off to the reclamation thread
+
+                //@cond
+                Statistics()
+                    : m_nMaxScanTime( 0 )
+                {}
+                //@endcond
             };
 
             /// Internal list of cds::gc::hp::details::hp_record
@@ -275,24 +338,26 @@ namespace cds {
             };
 
             atomics::atomic<hplist_node *>   m_pListHead  ;  ///< Head of GC list
+            atomics::atomic<size_t>          m_nFreeRecords; ///< Hint: count of HP records without owner, used to skip the list scan in \p alloc_hp_record
 
             static GarbageCollector *    m_pHZPManager  ;   ///< GC instance pointer
+            static bool                  m_bAsymmetricFence ;   ///< true - asymmetric fence mode is used (see \ref hzp_gc_asymmetric_fence)
 
             Statistics              m_Stat              ;   ///< Internal statistics
             bool                    m_bStatEnabled      ;   ///< true - statistics enabled
 
-            const size_t            m_nHazardPointerCount   ;   ///< max count of thread's hazard pointer
-            const size_t            m_nMaxThreadCount       ;   ///< max count of thread
-            const size_t            m_nMaxRetiredPtrCount   ;   ///< max count of retired ptr per thread
+            const size_t            m_nHazardPointerCount   ;   ///< initial count of thread's hazard pointer
+            const size_t            m_nRetiredThreshold     ;   ///< min scan threshold of retired ptr array
             scan_type               m_nScanType             ;   ///< scan type (see \ref scan_type enum)
 
+            cds::gc::details::reclaimer_thread * m_pReclaimer   ;   ///< Background reclamation thread, \p nullptr if it is not used
+
 
         private:
             /// Ctor
             GarbageCollector(
-                size_t nHazardPtrCount = 0,         ///< Hazard pointer count per thread
-                size_t nMaxThreadCount = 0,         ///< Max count of thread
-                size_t nMaxRetiredPtrCount = 0,     ///< Capacity of the array of retired objects
+                size_t nHazardPtrCount = 0,         ///< Initial hazard pointer count per thread
+                size_t nRetiredThreshold = 0,       ///< Min scan threshold of the array of retired objects
                 scan_type nScanType = inplace       ///< Scan type (see \ref scan_type enum)
             );
 
@@ -310,29 +375,54 @@ namespace cds {
 
             void detachAllThread();
 
+            /// Starts background reclamation thread, the thread calls \p fnAttachThread on start and \p fnDetachThread on exit
+            void start_reclaimer( void (* fnAttachThread)(), void (* fnDetachThread)() );
+
+            /// Stops background reclamation thread, the retired pointers handed off to it are scanned
+            void stop_reclaimer();
+
+            /// Thread function of background reclamation thread
+            void reclaimer_func();
+
         public:
             /// Creates GarbageCollector singleton
             /**
                 GC is the singleton. If GC instance is not exist then the function creates the instance.
                 Otherwise it does nothing.
 
-                The Michael's HP reclamation schema depends of three parameters:
+                The count of threads and the count of hazard pointers per thread are not limited:
+                the list of HP records grows when a new thread is attached, and the hazard pointer array
+                and the retired pointer array of each thread grow on demand.
 
-                \p nHazardPtrCount - HP pointer count per thread. Usually it is small number (2-4) depending from
-                                     the data structure algorithms. By default, if \p nHazardPtrCount = 0,
+                \p nHazardPtrCount - initial HP count per thread. The thread's hazard pointer array grows
+                                     by blocks of \p nHazardPtrCount items. By default, if \p nHazardPtrCount = 0,
                                      the function uses maximum of HP count for CDS library.
 
-                \p nMaxThreadCount - max count of thread with using HP GC in your application. Default is 100.
+                \p nMaxThreadCount - unused, kept for compatibility.
+
+                \p nMaxRetiredPtrCount - min scan threshold of the array of retired pointers for each thread.
+                                    The actual threshold is adjusted by \p Scan() and is at least twice of the
+                                    count of hazard pointers in use. Default is 256.
+
+                \p bAsymmetricFence - use asymmetric fence mode, see \ref hzp_gc_asymmetric_fence "publish_fence()".
+                                    If the process-wide memory barrier is not supported by OS, the full fence mode
+                                    is used silently; call \p isAsymmetricFence() to get the mode actually used.
+
+                \p bBackgroundReclaim - start background reclamation thread, see \ref hzp_gc_background_reclaim "retire_batch()".
 
-                \p nMaxRetiredPtrCount - capacity of array of retired pointers for each thread. Must be greater than
-                                    \p nHazardPtrCount * \p nMaxThreadCount.
-                                    Default is 2 * \p nHazardPtrCount * \p nMaxThreadCount.
+                \p fnAttachThread, \p fnDetachThread - the reclamation thread calls them on start and on exit
+                                    to attach itself to \p cds::threading::Manager since the disposers are called
+                                    by that thread. \p cds::gc::HP passes \p Manager::attachThread and \p Manager::detachThread.
             */
             static void    CDS_STDCALL Construct(
-                size_t nHazardPtrCount = 0,     ///< Hazard pointer count per thread
-                size_t nMaxThreadCount = 0,     ///< Max count of simultaneous working thread in your application
-                size_t nMaxRetiredPtrCount = 0, ///< Capacity of the array of retired objects for the thread
-                scan_type nScanType = inplace   ///< Scan type (see \ref scan_type enum)
+                size_t nHazardPtrCount = 0,     ///< Initial hazard pointer count per thread
+                size_t nMaxThreadCount = 0,     ///< Unused, kept for compatibility
+                size_t nMaxRetiredPtrCount = 0, ///< Min scan threshold of the array of retired objects for the thread
+                scan_type nScanType = inplace,  ///< Scan type (see \ref scan_type enum)
+                bool bAsymmetricFence = false,  ///< Use asymmetric fence mode
+                bool bBackgroundReclaim = false,    ///< Use background reclamation thread
+                void (* fnAttachThread)() = nullptr,    ///< Attach hook of the reclamation thread
+                void (* fnDetachThread)() = nullptr     ///< Detach hook of the reclamation thread
             );
 
             /// Destroys global instance of GarbageCollector
@@ -360,22 +450,72 @@ namespace cds {
                 return m_pHZPManager != nullptr;
             }
 
-            /// Returns max Hazard Pointer count defined in construction time
+            /// Checks if the asymmetric fence mode is used
+            static bool isAsymmetricFence() CDS_NOEXCEPT
+            {
+                return m_bAsymmetricFence;
+            }
+
+            /// Memory fence between publishing a hazard pointer and validating the guarded pointer
+            /** @anchor hzp_gc_asymmetric_fence
+                After storing a pointer into the hazard pointer the thread must re-read the source of the pointer
+                to check the pointer is not changed (so, not retired). The hazard pointer store must not be reordered
+                with that load, otherwise \p Scan() may miss the hazard pointer. It requires a full memory fence
+                on each protection, and \p Scan() issues the paired full fence before reading the hazard pointers.
+
+                In asymmetric fence mode the fence is a compiler-only barrier, and \p Scan() issues
+                a process-wide memory barrier (see \p cds::OS::membarrier) that makes the hazard pointer
+                stores of all threads visible. It makes the protection much cheaper at the cost of more
+                expensive \p Scan().
+            */
+            static void publish_fence() CDS_NOEXCEPT
+            {
+                if ( m_bAsymmetricFence )
+                    atomics::atomic_signal_fence( atomics::memory_order_seq_cst );
+                else
+                    atomics::atomic_thread_fence( atomics::memory_order_seq_cst );
+            }
+
+            /// Checks if the background reclamation thread is used
+            bool isBackgroundReclaim() const CDS_NOEXCEPT
+            {
+                return m_pReclaimer != nullptr;
+            }
+
+            /// Returns initial Hazard Pointer count per thread defined in construction time
             size_t            getHazardPointerCount() const CDS_NOEXCEPT
             {
                 return m_nHazardPointerCount;
             }
 
-            /// Returns max thread count defined in construction time
+            /// Returns min scan threshold of retired objects array. It is defined in construction time
+            size_t            getRetiredThreshold() const CDS_NOEXCEPT
+            {
+                return m_nRetiredThreshold;
+            }
+
+            /// Returns the count of allocated HP records
+            /**
+                Deprecated: the count of threads is not limited. The function returns the current count
+                of HP records, that is, the max count of simultaneously attached threads so far.
+            */
+            CDS_DEPRECATED( "thread count is not limited, use getInternalState().nHPRecAllocated" )
             size_t            getMaxThreadCount() const CDS_NOEXCEPT
             {
-                return m_nMaxThreadCount;
+                size_t nCount = 0;
+                for ( hplist_node * hprec = m_pListHead.load( atomics::memory_order_acquire ); hprec; hprec = hprec->m_pNextNode )
+                    ++nCount;
+                return nCount;
             }
 
-            /// Returns max size of retired objects array. It is defined in construction time
+            /// Returns min scan threshold of retired objects array
+            /**
+                Deprecated: the retired array grows on demand, use \p getRetiredThreshold().
+            */
+            CDS_DEPRECATED( "retired array grows on demand, use getRetiredThreshold()" )
             size_t            getMaxRetiredPtrCount() const CDS_NOEXCEPT
             {
-                return m_nMaxRetiredPtrCount;
+                return m_nRetiredThreshold;
             }
 
             // Internal statistics
@@ -383,6 +523,15 @@ namespace cds {
             /// Get internal statistics
             InternalState& getInternalState(InternalState& stat) const;
 
+            /// Get reclamation telemetry
+            /**
+                The telemetry is always collected, independently of \p enableStatistics().
+                Each HP record has its own counters updated by \p Scan() of the record's owner;
+                the function sums up the counters of all records. \p reclaim_stat::nBacklog is the total
+                count of retired pointers in the retired arrays of the records.
+            */
+            cds::gc::reclaim_stat& getReclaimStat( cds::gc::reclaim_stat& st ) const;
+
             /// Checks if internal statistics enabled
             bool              isStatisticsEnabled() const { return m_bStatEnabled; }
 
@@ -394,15 +543,13 @@ namespace cds {
                 return bEnabled;
             }
 
-            /// Checks that required hazard pointer count \p nRequiredCount is less or equal then max hazard pointer count
+            /// Checks that required hazard pointer count \p nRequiredCount is available
             /**
-                If \p nRequiredCount > getHazardPointerCount() then the exception \p too_many_hazard_ptr is thrown
+                Deprecated: the hazard pointer array of the thread grows on demand, so the function does nothing.
             */
-            static void checkHPCount( unsigned int nRequiredCount )
-            {
-                if ( instance().getHazardPointerCount() < nRequiredCount )
-                    throw too_many_hazard_ptr();
-            }
+            CDS_DEPRECATED( "hazard pointer array grows on demand" )
+            static void checkHPCount( unsigned int /*nRequiredCount*/ )
+            {}
 
             /// Get current scan strategy
             scan_type getScanType() const
@@ -429,6 +576,22 @@ namespace cds {
             /// Free HP record. For internal use only
             void free_hp_record( details::hp_record * pRec );
 
+            /// Hands off the retired pointers of \p pRec to the background reclamation thread. For internal use only
+            /** @anchor hzp_gc_background_reclaim
+                If the background reclamation thread is used, the thread that fills its retired array
+                does not call \p Scan(). Instead, the content of the retired array is moved to the reclamation
+                thread that scans and frees the retired pointers. So the duration of \p Scan() is removed
+                from the latency of the worker thread; the cost for worker is a mutex acquisition per batch.
+                The retired pointers that cannot be freed because of a hazard are kept by the reclamation thread
+                and are rescanned when a next batch is handed off.
+
+                When a thread is detached, its retired pointers are handed off too.
+
+                If \p bSync is \p true the function waits until the reclamation thread scans the retired pointers
+                handed off; it is used by \p ThreadGC::scan() to provide \p force_dispose() semantics.
+            */
+            void retire_batch( details::hp_record * pRec, bool bSync = false );
+
             /// The main garbage collecting function
             /**
                 This function is called internally by ThreadGC object when upper bound of thread's list of reclaimed pointers
@@ -437,22 +600,22 @@ namespace cds {
                 There are the following scan algorithm:
                 - \ref hzp_gc_classic_scan "classic_scan" allocates memory for internal use
                 - \ref hzp_gc_inplace_scan "inplace_scan" does not allocate any memory
+                - \ref hzp_gc_hashed_scan "hashed_scan" builds a hash table of hazard pointers
 
                 Use \ref hzp_gc_setScanType "setScanType" member function to setup appropriate scan algorithm.
+
+                If the internal statistics is enabled, the duration of each call is accumulated
+                in \p InternalState::evcScanTime and \p InternalState::nMaxScanTime.
+                Independently of that, the function updates the reclamation telemetry of \p pRec,
+                see \p getReclaimStat().
+
+                The cost of the scan is proportional to the count of hazard pointers in use by attached threads
+                (the free HP records and never used hazard pointers are skipped). After the scan the threshold
+                of the retired array of \p pRec is set to <tt>R + max( getRetiredThreshold(), 2 * H )</tt>
+                where \p R is the count of retired pointers that cannot be freed yet and \p H is the count
+                of hazard pointers in use, so the amortized cost of the scan per retired pointer is constant.
             */
-            void Scan( details::hp_record * pRec )
-            {
-                switch ( m_nScanType ) {
-                    case inplace:
-                        inplace_scan( pRec );
-                        break;
-                    default:
-                        assert(false)   ;   // Forgotten something?..
-                    case classic:
-                        classic_scan( pRec );
-                        break;
-                }
-            }
+            void Scan( details::hp_record * pRec );
 
             /// Helper scan routine
             /**
@@ -498,6 +661,31 @@ namespace cds {
                 All operations are performed in-place.
             */
             void inplace_scan( details::hp_record * pRec );
+
+            /// Hashed scan algorithm
+            /** @anchor hzp_gc_hashed_scan
+                The algorithm is intended for large count of threads and large retired arrays.
+                The snapshot of hazard pointers is placed into an open-addressing hash table
+                of buckets; each bucket contains 4 pointers and is compared with the retired pointer
+                as a whole by SIMD instructions (SSE2 on x86/amd64, scalar loop on other architectures).
+                The hash table is half-full at most, so the search of a retired pointer usually takes
+                one bucket comparison, and the complexity of the scan is <tt>O(H + R)</tt>
+                instead of <tt>O((H + R) log H)</tt> of \ref hzp_gc_classic_scan "classic_scan",
+                where \p H is the count of hazard pointers and \p R is the size of the retired array.
+
+                This algorithm allocates memory for the hash table.
+            */
+            void hashed_scan( details::hp_record * pRec );
+
+            /// Memory fence before reading the hazard pointers, paired with \ref hzp_gc_asymmetric_fence "publish_fence()"
+            void scan_fence() const;
+
+            /// Sets scan threshold of \p pRec after the scan, \p nHPCount is the count of hazard pointers in use
+            void set_scan_threshold( details::hp_record * pRec, size_t nHPCount ) const
+            {
+                size_t const nMin = nHPCount * 2;
+                pRec->m_arrRetired.threshold( pRec->m_arrRetired.size() + ( nMin > m_nRetiredThreshold ? nMin : m_nRetiredThreshold ));
+            }
         };
 
         /// Thread's hazard pointer manager
@@ -603,19 +791,52 @@ namespace cds {
             void retirePtr( details::retired_ptr const& p )
             {
                 m_pHzpRec->m_arrRetired.push( p );
+                check_retired();
+            }
 
-                if ( m_pHzpRec->m_arrRetired.isFull() ) {
-                    // Max of retired pointer count is reached. Do scan
-                    scan();
-                }
+            /// Places the range <tt>[itFirst, itLast)</tt> of retired pointers with deleter \p pFunc into thread's array of retired pointer
+            /**
+                The iterator's value type is <tt>T *</tt>. The threshold of the retired array is checked once
+                after the whole range is appended, so at most one scan is done.
+            */
+            template <typename ForwardIterator, typename T>
+            void retirePtr( ForwardIterator itFirst, ForwardIterator itLast, void (* pFunc)(T *) )
+            {
+                details::retired_vector& arrRetired = m_pHzpRec->m_arrRetired;
+                for ( ; itFirst != itLast; ++itFirst )
+                    arrRetired.push( details::retired_ptr( reinterpret_cast<void *>( *itFirst ), reinterpret_cast<free_retired_ptr_func>( pFunc )));
+                check_retired();
             }
 
             /// Run retiring scan cycle
+            /**
+                If the background reclamation thread is used, the retired pointers are handed off to it
+                and the function waits until the reclamation thread scans them.
+            */
             void scan()
             {
-                m_HzpManager.Scan( m_pHzpRec );
-                m_HzpManager.HelpScan( m_pHzpRec );
+                if ( m_HzpManager.isBackgroundReclaim() )
+                    m_HzpManager.retire_batch( m_pHzpRec, true );
+                else {
+                    m_HzpManager.Scan( m_pHzpRec );
+                    m_HzpManager.HelpScan( m_pHzpRec );
+                }
             }
+
+        private:
+            //@cond
+            void check_retired()
+            {
+                m_pHzpRec->update_retired_count();
+                if ( m_pHzpRec->m_arrRetired.isFull() ) {
+                    // Max of retired pointer count is reached. Do scan or hand off the batch to the reclamation thread
+                    if ( m_HzpManager.isBackgroundReclaim() )
+                        m_HzpManager.retire_batch( m_pHzpRec );
+                    else
+                        scan();
+                }
+            }
+            //@endcond
         };
 
         /// Auto hp_guard.
@@ -696,13 +917,15 @@ namespace cds {
     namespace gc { namespace hp { namespace details {
 
         inline retired_vector::retired_vector( const cds::gc::hp::GarbageCollector& HzpMgr )
-            : m_arr( HzpMgr.getMaxRetiredPtrCount() ),
-            m_nSize(0)
-        {}
+            : m_nThreshold( HzpMgr.getRetiredThreshold() )
+        {
+            m_arr.reserve( m_nThreshold );
+        }
 
         inline hp_record::hp_record( const cds::gc::hp::GarbageCollector& HzpMgr )
             : m_hzp( HzpMgr.getHazardPointerCount() ),
-            m_arrRetired( HzpMgr )
+            m_arrRetired( HzpMgr ),
+            m_nRetiredCount( 0 )
         {}
 
     }}} // namespace gc::hp::details
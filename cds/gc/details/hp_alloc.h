@@ -3,6 +3,7 @@
 #ifndef CDSLIB_GC_DETAILS_HP_ALLOC_H
 #define CDSLIB_GC_DETAILS_HP_ALLOC_H
 
+#include <vector>
 #include <cds/algo/atomic.h>
 #include <cds/details/allocator.h>
 #include <cds/gc/details/hp_type.h>
@@ -95,13 +96,14 @@ namespace cds {
         /// Array of hazard pointers.
         /**
             Array of hazard-pointer. Placing a pointer into this array guards the pointer against reclamation.
-            Template parameter \p Count defines the size of hazard pointer array. \p Count parameter should not exceed
-            GarbageCollector::getHazardPointerCount().
+            Template parameter \p Count defines the size of hazard pointer array.
 
             It is unsafe to use this class directly. Instead, the \p hp::array should be used.
 
-            While creating the object of \p hp_array class an array of size \p Count of hazard pointers is reserved by
-            the HP Manager of current thread. The object's destructor cleans all of reserved hazard pointer and
+            While creating the object of \p hp_array class \p Count hazard pointers are reserved by
+            the HP Manager of current thread. The hazard pointers of the array are not required to be adjacent
+            in memory since the thread's hazard pointer pool grows by blocks.
+            The object's destructor cleans all of reserved hazard pointer and
             returns reserved HP to the HP pool of ThreadGC.
 
             Usually, it is not necessary to create an object of this class. The object of class ThreadGC contains
@@ -120,7 +122,7 @@ namespace cds {
             static CDS_CONSTEXPR const size_t c_nCapacity = Count ;   ///< Capacity of the array
 
         private:
-            atomic_hazard_ptr *     m_arr               ;   ///< Hazard pointer array of size = \p Count
+            atomic_hazard_ptr *     m_arr[Count]        ;   ///< Hazard pointers reserved for the array
             template <class Allocator> friend class hp_allocator;
 
         public:
@@ -142,36 +144,44 @@ namespace cds {
             void set( size_t nIndex, hazard_ptr_type hzPtr ) CDS_NOEXCEPT
             {
                 assert( nIndex < capacity() );
-                m_arr[nIndex] = hzPtr;
+                *m_arr[nIndex] = hzPtr;
             }
 
             /// Returns reference to hazard pointer of index \p nIndex (0 <= \p nIndex < \p Count)
             atomic_hazard_ptr& operator []( size_t nIndex ) CDS_NOEXCEPT
             {
                 assert( nIndex < capacity() );
-                return m_arr[nIndex];
+                return *m_arr[nIndex];
             }
 
             /// Returns reference to hazard pointer of index \p nIndex (0 <= \p nIndex < \p Count) [const version]
             atomic_hazard_ptr& operator []( size_t nIndex ) const CDS_NOEXCEPT
             {
                 assert( nIndex < capacity() );
-                return m_arr[nIndex];
+                return *m_arr[nIndex];
             }
 
             /// Clears (sets to \p nullptr) hazard pointer \p nIndex
             void clear( size_t nIndex ) CDS_NOEXCEPT
             {
                 assert( nIndex < capacity() );
-                m_arr[ nIndex ].clear();
+                m_arr[ nIndex ]->clear();
             }
         };
 
         /// Allocator of hazard pointers for the thread
         /**
-            The hazard pointer array is the free-list of unused hazard pointer for the thread.
-            The array is managed as a stack.
-            The max size (capacity) of array is defined at ctor time and cannot be changed during object's lifetime
+            The hazard pointers of the thread are stored in a list of fixed-size blocks.
+            The first block is allocated at ctor time, the next block is appended when
+            all hazard pointers are in use, so the thread never runs out of hazard pointers.
+            The blocks are freed only in the allocator's destructor; therefore, other threads
+            may safely traverse the blocks while the owner thread allocates new ones.
+
+            The hazard pointers are handed out in the order of their position in the block list.
+            \p size() is the count of hazard pointers that have been ever handed out
+            since the last \p clear(); the slots beyond \p size() are guaranteed to be \p nullptr,
+            so the GC scan reads only the first \p size() slots.
+            Freed hazard pointers are kept in a thread-private free-list and reused first.
 
             Each allocator object is thread-private.
 
@@ -189,74 +199,117 @@ namespace cds {
             typedef Allocator       allocator_type;     ///< allocator type
 
         private:
-            typedef cds::details::Allocator< atomic_hazard_ptr, allocator_type > allocator_impl;
+            struct block {
+                atomics::atomic<block *>  m_pNext  ;   ///< Next block
+                atomic_hazard_ptr *       m_arr    ;   ///< Hazard pointers of the block
+
+                block()
+                    : m_pNext( nullptr )
+                    , m_arr( nullptr )
+                {}
+            };
 
-            atomic_hazard_ptr * m_arrHazardPtr  ;   ///< Array of hazard pointers
-            size_t              m_nTop          ;   ///< The top of stack
-            const size_t        m_nCapacity     ;   ///< Array capacity
+            typedef cds::details::Allocator< atomic_hazard_ptr, allocator_type > allocator_impl;
+            typedef cds::details::Allocator< block, allocator_type > block_allocator;
+            typedef typename allocator_type::template rebind< atomic_hazard_ptr * >::other free_list_allocator;
+
+            block *                 m_pHead         ;   ///< The first block
+            block *                 m_pTail         ;   ///< The last block
+            block *                 m_pFresh        ;   ///< The block containing next never used hazard pointer
+            size_t                  m_nFreshIdx     ;   ///< Index of next never used hazard pointer in \p m_pFresh
+            const size_t            m_nBlockCapacity;   ///< Hazard pointer count in each block
+            size_t                  m_nCapacity     ;   ///< Total count of hazard pointers in all blocks
+            atomics::atomic<size_t> m_nUsed         ;   ///< Count of hazard pointers handed out since last \p clear()
+            std::vector< atomic_hazard_ptr *, free_list_allocator > m_FreeList; ///< Freed hazard pointers
 
         public:
             /// Default ctor
             explicit hp_allocator(
-                size_t  nCapacity            ///< max count of hazard pointer per thread
+                size_t  nCapacity            ///< initial count of hazard pointer per thread, the size of the block
                 )
-                : m_arrHazardPtr( alloc_array( nCapacity ) )
-                , m_nCapacity( nCapacity )
+                : m_pHead( nullptr )
+                , m_pTail( nullptr )
+                , m_pFresh( nullptr )
+                , m_nFreshIdx( 0 )
+                , m_nBlockCapacity( nCapacity ? nCapacity : 1 )
+                , m_nCapacity( 0 )
+                , m_nUsed( 0 )
             {
-                make_free();
+                add_block();
             }
 
             /// Dtor
             ~hp_allocator()
             {
-                allocator_impl().Delete( m_arrHazardPtr, capacity() );
+                block * pNext;
+                for ( block * p = m_pHead; p; p = pNext ) {
+                    pNext = p->m_pNext.load( atomics::memory_order_relaxed );
+                    allocator_impl().Delete( p->m_arr, m_nBlockCapacity );
+                    block_allocator().Delete( p );
+                }
             }
 
-            /// Get capacity of array
+            /// Get capacity: total count of hazard pointers allocated for the thread
             size_t capacity() const CDS_NOEXCEPT
             {
                 return m_nCapacity;
             }
 
-            /// Get size of array. The size is equal to the capacity of array
+            /// Get count of hazard pointers ever handed out since last \p clear()
+            /**
+                The hazard pointers beyond this bound are \p nullptr.
+                May be called by any thread.
+            */
             size_t size() const CDS_NOEXCEPT
             {
-                return capacity();
-            }
-
-            /// Checks if all items are allocated
-            bool isFull() const CDS_NOEXCEPT
-            {
-                return m_nTop == 0;
+                return m_nUsed.load( atomics::memory_order_acquire );
             }
 
             /// Allocates hazard pointer
+            /**
+                If there is no free hazard pointer, new block is allocated.
+            */
             atomic_hazard_ptr& alloc()
             {
-                assert( m_nTop > 0 );
-                --m_nTop;
-                return m_arrHazardPtr[m_nTop];
+                if ( m_FreeList.empty() ) {
+                    if ( m_nUsed.load( atomics::memory_order_relaxed ) == m_nCapacity )
+                        add_block();
+                    return alloc_fresh();
+                }
+                atomic_hazard_ptr * p = m_FreeList.back();
+                m_FreeList.pop_back();
+                return *p;
             }
 
             /// Frees previously allocated hazard pointer
             void free( atomic_hazard_ptr& hp ) CDS_NOEXCEPT
             {
-                assert( m_nTop < capacity() );
                 hp.clear();
-                ++m_nTop;
+                // The free-list capacity is always enough, push_back() does not reallocate
+                assert( m_FreeList.size() < m_FreeList.capacity() );
+                m_FreeList.push_back( &hp );
             }
 
             /// Allocates hazard pointers array
             /**
-                Allocates \p Count hazard pointers from array \p m_arrHazardPtr
+                Allocates \p Count hazard pointers.
                 Returns initialized object \p arr
             */
             template <size_t Count>
             void alloc( hp_array<Count>& arr )
             {
-                assert( m_nTop >= Count );
-                m_nTop -= Count;
-                arr.m_arr = m_arrHazardPtr + m_nTop;
+                // Reserve enough blocks in advance to not leak hazard pointers if add_block() throws
+                while ( m_FreeList.size() + ( m_nCapacity - m_nUsed.load( atomics::memory_order_relaxed )) < Count )
+                    add_block();
+
+                for ( size_t i = 0; i < Count; ++i ) {
+                    if ( m_FreeList.empty() )
+                        arr.m_arr[i] = &alloc_fresh();
+                    else {
+                        arr.m_arr[i] = m_FreeList.back();
+                        m_FreeList.pop_back();
+                    }
+                }
             }
 
             /// Frees hazard pointer array
@@ -266,38 +319,84 @@ namespace cds {
             template <size_t Count>
             void free( hp_array<Count> const& arr ) CDS_NOEXCEPT
             {
-                CDS_UNUSED( arr );
-
-                assert( m_nTop + Count <= capacity());
-                for ( size_t i = m_nTop; i < m_nTop + Count; ++i )
-                    m_arrHazardPtr[i].clear();
-                m_nTop += Count;
+                // Reverse order to reuse the hazard pointers in the order they have been allocated
+                for ( size_t i = Count; i > 0; --i )
+                    free( *arr.m_arr[i - 1] );
             }
 
             /// Makes all HP free
+            /**
+                The function should be called only if the thread does not use any hazard pointer
+                (for example, when the thread is detached)
+            */
             void clear() CDS_NOEXCEPT
             {
-                make_free();
+                m_FreeList.clear();
+                for_each_slot( []( atomic_hazard_ptr& hp ) { hp.clear(); } );
+                m_pFresh = m_pHead;
+                m_nFreshIdx = 0;
+                m_nUsed.store( 0, atomics::memory_order_release );
             }
 
-            /// Returns to i-th hazard pointer
-            atomic_hazard_ptr& operator []( size_t i ) CDS_NOEXCEPT
+            /// Calls \p f( hazard_ptr_type ) for each non-null hazard pointer
+            /**
+                Only the hazard pointers that have been handed out since last \p clear() are visited.
+                The function may be called by any thread.
+            */
+            template <typename Func>
+            void for_each( Func f ) const
             {
-                assert( i < capacity() );
-                return m_arrHazardPtr[i];
+                for_each_slot( [&f]( atomic_hazard_ptr& hp ) {
+                    hazard_ptr_type p = hp.get();
+                    if ( p )
+                        f( p );
+                });
             }
 
         private:
-            void make_free() CDS_NOEXCEPT
+            template <typename Func>
+            void for_each_slot( Func f ) const
+            {
+                size_t nCount = size();
+                for ( block * pBlock = m_pHead; nCount; pBlock = pBlock->m_pNext.load( atomics::memory_order_acquire )) {
+                    assert( pBlock );
+                    size_t const nBlockCount = nCount < m_nBlockCapacity ? nCount : m_nBlockCapacity;
+                    for ( size_t i = 0; i < nBlockCount; ++i )
+                        f( pBlock->m_arr[i] );
+                    nCount -= nBlockCount;
+                }
+            }
+
+            atomic_hazard_ptr& alloc_fresh() CDS_NOEXCEPT
             {
-                for ( size_t i = 0; i < capacity(); ++i )
-                    m_arrHazardPtr[i].clear();
-                m_nTop = capacity();
+                size_t const nIdx = m_nUsed.load( atomics::memory_order_relaxed );
+                assert( nIdx < m_nCapacity );
+
+                if ( m_nFreshIdx == m_nBlockCapacity ) {
+                    m_pFresh = m_pFresh->m_pNext.load( atomics::memory_order_relaxed );
+                    m_nFreshIdx = 0;
+                }
+                assert( m_pFresh );
+
+                atomic_hazard_ptr& hp = m_pFresh->m_arr[ m_nFreshIdx++ ];
+                m_nUsed.store( nIdx + 1, atomics::memory_order_release );
+                return hp;
             }
 
-            atomic_hazard_ptr * alloc_array( size_t nCapacity )
+            void add_block()
             {
-                return allocator_impl().NewArray( nCapacity );
+                // Each allocated hazard pointer can be in the free-list, so free-list push_back() never throws
+                m_FreeList.reserve( m_nCapacity + m_nBlockCapacity );
+
+                block * pBlock = block_allocator().New();
+                pBlock->m_arr = allocator_impl().NewArray( m_nBlockCapacity );
+
+                if ( m_pTail )
+                    m_pTail->m_pNext.store( pBlock, atomics::memory_order_release );
+                else
+                    m_pHead = m_pFresh = pBlock;
+                m_pTail = pBlock;
+                m_nCapacity += m_nBlockCapacity;
             }
         };
 
@@ -0,0 +1,200 @@
+//$$CDS-header$$
+
+#ifndef CDSLIB_GC_DETAILS_RECLAIM_STAT_H
+#define CDSLIB_GC_DETAILS_RECLAIM_STAT_H
+
+#include <chrono>
+#include <cds/algo/atomic.h>
+
+namespace cds { namespace gc {
+
+    /// Reclamation telemetry
+    /**
+        The snapshot of reclamation counters of a garbage collector returned by
+        \p cds::gc::HP::statistics(), \p cds::gc::DHP::statistics() and by \p statistics() of RCU classes.
+
+        A "scan" is one reclamation cycle of the GC: \p Scan() of \p HP, \p scan() of \p DHP,
+        a grace period followed by disposing the retired buffer for %RCU.
+        The counters are always maintained. They are updated once per scan, so the retire path is not burdened;
+        the only exception is buffered %RCU that keeps a relaxed count of retired pointers in its buffer.
+        The snapshot is not atomic: the counters are read one by one while the GC is working.
+    */
+    struct reclaim_stat
+    {
+        /// Size of scan duration histogram
+        static CDS_CONSTEXPR const size_t c_nHistogramSize = 24;
+
+        size_t      nBacklog        ;   ///< Current count of retired pointers not freed yet (approximate)
+        size_t      nPeakBacklog    ;   ///< Max count of retired pointers processed by one scan
+        uint64_t    nScanCount      ;   ///< Count of scans
+        uint64_t    nFreed          ;   ///< Total count of retired pointers freed
+        uint64_t    nMaxFreedPerScan;   ///< Max count of retired pointers freed by one scan
+        uint64_t    nScanTime       ;   ///< Total duration of scans, nanoseconds
+        uint64_t    nMaxScanTime    ;   ///< Max duration of scan, nanoseconds
+
+        /// Scan duration histogram
+        /**
+            <tt>arrScanHistogram[0]</tt> is the count of scans shorter than 1 microsecond,
+            <tt>arrScanHistogram[i]</tt> is the count of scans with duration in <tt>[2**(i-1), 2**i)</tt> microseconds,
+            the last item counts all scans longer than <tt>2**(c_nHistogramSize - 2)</tt> microseconds.
+            Use \p histogram_bound() to get the upper bound of a bucket.
+        */
+        uint64_t    arrScanHistogram[c_nHistogramSize];
+
+        //@cond
+        reclaim_stat()
+        {
+            clear();
+        }
+        //@endcond
+
+        /// Zeroes all counters
+        void clear()
+        {
+            nBacklog =
+                nPeakBacklog = 0;
+            nScanCount =
+                nFreed =
+                nMaxFreedPerScan =
+                nScanTime =
+                nMaxScanTime = 0;
+            for ( size_t i = 0; i < c_nHistogramSize; ++i )
+                arrScanHistogram[i] = 0;
+        }
+
+        /// Average count of retired pointers freed by one scan
+        double freed_per_scan() const
+        {
+            return nScanCount ? double( nFreed ) / nScanCount : 0.0;
+        }
+
+        /// Average scan duration, nanoseconds
+        double mean_scan_time() const
+        {
+            return nScanCount ? double( nScanTime ) / nScanCount : 0.0;
+        }
+
+        /// Returns the upper bound of histogram bucket \p nBucket in microseconds, 0 for the last (unbounded) bucket
+        static uint64_t histogram_bound( size_t nBucket )
+        {
+            return nBucket + 1 < c_nHistogramSize ? uint64_t(1) << nBucket : 0;
+        }
+
+        /// Returns histogram bucket for scan duration \p nDuration (in nanoseconds)
+        static size_t histogram_bucket( uint64_t nDuration )
+        {
+            uint64_t const nMicroSec = nDuration / 1000;
+            if ( nMicroSec == 0 )
+                return 0;
+            size_t nBucket = 1;
+            for ( uint64_t n = nMicroSec; n > 1 && nBucket + 1 < c_nHistogramSize; n >>= 1 )
+                ++nBucket;
+            return nBucket;
+        }
+    };
+
+    namespace details {
+
+        /// Reclamation counters of a GC
+        /**
+            Each counter is an atomic incremented by relaxed RMW once per scan.
+            A GC may keep several counter blocks (for example, \p HP keeps one per thread record
+            so the threads do not share a cache line) and sums them up in \p collect() on demand.
+        */
+        class reclaim_counters
+        {
+            //@cond
+            atomics::atomic<uint64_t>   m_nScanCount;
+            atomics::atomic<uint64_t>   m_nFreed;
+            atomics::atomic<uint64_t>   m_nMaxFreedPerScan;
+            atomics::atomic<uint64_t>   m_nScanTime;
+            atomics::atomic<uint64_t>   m_nMaxScanTime;
+            atomics::atomic<size_t>     m_nPeakBacklog;
+            atomics::atomic<uint64_t>   m_arrHistogram[reclaim_stat::c_nHistogramSize];
+
+            template <typename T>
+            static void update_max( atomics::atomic<T>& nMax, T nVal )
+            {
+                T nCur = nMax.load( atomics::memory_order_relaxed );
+                while ( nCur < nVal && !nMax.compare_exchange_weak( nCur, nVal, atomics::memory_order_relaxed, atomics::memory_order_relaxed ));
+            }
+            //@endcond
+
+        public:
+            //@cond
+            reclaim_counters()
+                : m_nScanCount( 0 )
+                , m_nFreed( 0 )
+                , m_nMaxFreedPerScan( 0 )
+                , m_nScanTime( 0 )
+                , m_nMaxScanTime( 0 )
+                , m_nPeakBacklog( 0 )
+            {
+                for ( size_t i = 0; i < reclaim_stat::c_nHistogramSize; ++i )
+                    m_arrHistogram[i].store( 0, atomics::memory_order_relaxed );
+            }
+            //@endcond
+
+            /// Accounts a scan that has processed \p nBacklog retired pointers and freed \p nFreed ones in \p nDuration nanoseconds
+            void on_scan( size_t nBacklog, size_t nFreed, uint64_t nDuration )
+            {
+                m_nScanCount.fetch_add( 1, atomics::memory_order_relaxed );
+                m_nFreed.fetch_add( nFreed, atomics::memory_order_relaxed );
+                m_nScanTime.fetch_add( nDuration, atomics::memory_order_relaxed );
+                m_arrHistogram[ reclaim_stat::histogram_bucket( nDuration ) ].fetch_add( 1, atomics::memory_order_relaxed );
+                update_max( m_nMaxFreedPerScan, static_cast<uint64_t>( nFreed ));
+                update_max( m_nMaxScanTime, nDuration );
+                update_max( m_nPeakBacklog, nBacklog );
+            }
+
+            /// Accounts \p nFreed retired pointers freed out of scan
+            void on_free( size_t nFreed )
+            {
+                m_nFreed.fetch_add( nFreed, atomics::memory_order_relaxed );
+            }
+
+            /// Adds the counters to \p st
+            void collect( reclaim_stat& st ) const
+            {
+                st.nScanCount += m_nScanCount.load( atomics::memory_order_relaxed );
+                st.nFreed += m_nFreed.load( atomics::memory_order_relaxed );
+                st.nScanTime += m_nScanTime.load( atomics::memory_order_relaxed );
+                for ( size_t i = 0; i < reclaim_stat::c_nHistogramSize; ++i )
+                    st.arrScanHistogram[i] += m_arrHistogram[i].load( atomics::memory_order_relaxed );
+
+                uint64_t n = m_nMaxFreedPerScan.load( atomics::memory_order_relaxed );
+                if ( st.nMaxFreedPerScan < n )
+                    st.nMaxFreedPerScan = n;
+                n = m_nMaxScanTime.load( atomics::memory_order_relaxed );
+                if ( st.nMaxScanTime < n )
+                    st.nMaxScanTime = n;
+                size_t const nBacklog = m_nPeakBacklog.load( atomics::memory_order_relaxed );
+                if ( st.nPeakBacklog < nBacklog )
+                    st.nPeakBacklog = nBacklog;
+            }
+        };
+
+        /// Scan duration timer
+        class scan_timer
+        {
+            //@cond
+            typedef std::chrono::steady_clock clock_type;
+            clock_type::time_point  m_tStart;
+            //@endcond
+        public:
+            /// Starts the timer
+            scan_timer()
+                : m_tStart( clock_type::now() )
+            {}
+
+            /// Returns nanoseconds elapsed from the timer start
+            uint64_t elapsed() const
+            {
+                return static_cast<uint64_t>( std::chrono::duration_cast<std::chrono::nanoseconds>( clock_type::now() - m_tStart ).count());
+            }
+        };
+
+    } // namespace details
+}} // namespace cds::gc
+
+#endif // #ifndef CDSLIB_GC_DETAILS_RECLAIM_STAT_H
@@ -0,0 +1,209 @@
+//$$CDS-header$$
+
+#ifndef CDSLIB_GC_DETAILS_RECLAIMER_THREAD_H
+#define CDSLIB_GC_DETAILS_RECLAIMER_THREAD_H
+
+#include <vector>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <cds/algo/atomic.h>
+#include <cds/os/thread.h>
+#include <cds/gc/details/retired_ptr.h>
+
+//@cond
+namespace cds { namespace gc { namespace details {
+
+    /// Background reclamation thread for \p cds::gc::HP and \p cds::gc::DHP
+    /**
+        The object of this class contains a reclamation thread object and necessary
+        synchronization objects, like \p cds::urcu::dispose_thread does for \p general_threaded URCU.
+        The worker threads do not scan when their retired buffer is full; instead, they hand off
+        the full batch of retired pointers to the reclamation thread by \p push(), or just wake it up
+        by \p notify() if the retired pointers are already in a shared buffer.
+        The reclamation thread calls \p wait() in a loop to get the work.
+
+        The thread function is defined by GC, see \p start(). After processing the work got by \p wait()
+        the thread function should call \p done() to release the threads waiting in \p flush().
+
+        The disposers are called by the reclamation thread, so it should be attached to \p cds::threading::Manager
+        like any other thread. The library core does not depend on the threading model, so the GC passes
+        the attach and detach hooks from the header to \p start(). \p start() returns after the attach hook is done,
+        so the thread is attached to the GCs constructed before and it is detached before they are destroyed.
+    */
+    class reclaimer_thread
+    {
+    public:
+        typedef std::vector< retired_ptr >  batch_type  ;   ///< Batch of retired pointers
+        typedef void (* thread_hook)()                  ;   ///< Attach/detach hook of reclamation thread
+
+    private:
+        typedef std::thread                     thread_type;
+        typedef std::mutex                      mutex_type;
+        typedef std::condition_variable         condvar_type;
+        typedef std::unique_lock< mutex_type >  unique_lock;
+
+        thread_type             m_Thread;
+        atomics::atomic<OS::ThreadId> m_idThread ;  // ID of reclamation thread
+
+        // synchronization with reclamation thread
+        mutex_type              m_Mutex;
+        condvar_type            m_cvDataReady;
+        condvar_type            m_cvDone;
+
+        batch_type              m_Pending   ;   // retired pointers handed off by worker threads
+        atomics::atomic<bool>   m_bSignaled ;   // new work is ready
+        bool                    m_bQuit     ;   // quit flag
+        bool                    m_bStarted  ;   // the thread has called the attach hook
+
+        // flush() sync
+        uint64_t                m_nFlushRequest ;   // last flush ticket
+        uint64_t                m_nFlushTaken   ;   // flush ticket taken by the thread in wait()
+        uint64_t                m_nFlushDone    ;   // flush ticket processed
+
+    public:
+        reclaimer_thread()
+            : m_idThread( OS::c_NullThreadId )
+            , m_bSignaled( false )
+            , m_bQuit( false )
+            , m_bStarted( false )
+            , m_nFlushRequest( 0 )
+            , m_nFlushTaken( 0 )
+            , m_nFlushDone( 0 )
+        {}
+
+        ~reclaimer_thread()
+        {
+            assert( !m_Thread.joinable() );
+        }
+
+        /// Starts reclamation thread with thread function \p f
+        /**
+            The thread calls \p fnAttach before \p f and \p fnDetach after \p f returns; the hooks may be \p nullptr.
+            The function returns when \p fnAttach is done.
+        */
+        template <typename Func>
+        void start( Func f, thread_hook fnAttach, thread_hook fnDetach )
+        {
+            m_Thread = thread_type( [this, f, fnAttach, fnDetach]() {
+                m_idThread.store( OS::get_current_thread_id(), atomics::memory_order_relaxed );
+                if ( fnAttach )
+                    fnAttach();
+                {
+                    unique_lock lock( m_Mutex );
+                    m_bStarted = true;
+                }
+                m_cvDone.notify_all();
+
+                f();
+                if ( fnDetach )
+                    fnDetach();
+                m_idThread.store( OS::c_NullThreadId, atomics::memory_order_relaxed );
+            });
+
+            unique_lock lock( m_Mutex );
+            while ( !m_bStarted )
+                m_cvDone.wait( lock );
+        }
+
+        /// Checks if the current thread is the reclamation thread
+        bool is_reclaimer_thread() const
+        {
+            return m_idThread.load( atomics::memory_order_relaxed ) == OS::get_current_thread_id();
+        }
+
+        /// Stops reclamation thread
+        /**
+            The last call of \p wait() returns the work handed off before \p stop(),
+            then \p wait() returns \p false and the thread function should return.
+        */
+        void stop()
+        {
+            {
+                unique_lock lock( m_Mutex );
+                m_bQuit = true;
+            }
+            m_cvDataReady.notify_one();
+            m_Thread.join();
+        }
+
+        /// Hands off the batch \p batch of retired pointers to reclamation thread
+        /**
+            After the call \p batch is empty. The storage of \p batch may be exchanged
+            with the storage of the batch processed by reclamation thread so the worker thread
+            does not allocate a new buffer each time.
+        */
+        void push( batch_type& batch )
+        {
+            {
+                unique_lock lock( m_Mutex );
+                if ( m_Pending.empty() )
+                    m_Pending.swap( batch );
+                else
+                    m_Pending.insert( m_Pending.end(), batch.begin(), batch.end() );
+                m_bSignaled.store( true, atomics::memory_order_relaxed );
+            }
+            batch.clear();
+            m_cvDataReady.notify_one();
+        }
+
+        /// Wakes up reclamation thread
+        /**
+            The function is cheap if reclamation thread has been already signaled
+            and has not yet got the work: no mutex is acquired in that case.
+        */
+        void notify()
+        {
+            if ( !m_bSignaled.exchange( true, atomics::memory_order_acq_rel )) {
+                // Acquire the mutex to not lose the wake-up if reclamation thread is going to wait
+                { unique_lock lock( m_Mutex ); }
+                m_cvDataReady.notify_one();
+            }
+        }
+
+        /// Wakes up reclamation thread and waits until it processes all work handed off before the call
+        void flush()
+        {
+            unique_lock lock( m_Mutex );
+            uint64_t const nTicket = ++m_nFlushRequest;
+            m_bSignaled.store( true, atomics::memory_order_relaxed );
+            m_cvDataReady.notify_one();
+
+            while ( m_nFlushDone < nTicket )
+                m_cvDone.wait( lock );
+        }
+
+        /// Waits for new work. Called from reclamation thread only
+        /**
+            The function moves the retired pointers handed off by \p push() to \p batch.
+            Returns \p false if the thread should be terminated.
+        */
+        bool wait( batch_type& batch )
+        {
+            batch.clear();
+
+            unique_lock lock( m_Mutex );
+            while ( !m_bSignaled.load( atomics::memory_order_relaxed ) && !m_bQuit )
+                m_cvDataReady.wait( lock );
+
+            bool const bSignaled = m_bSignaled.exchange( false, atomics::memory_order_acq_rel );
+            batch.swap( m_Pending );
+            m_nFlushTaken = m_nFlushRequest;
+            return bSignaled || !m_bQuit;
+        }
+
+        /// Notifies that the work got by last \p wait() is done. Called from reclamation thread only
+        void done()
+        {
+            {
+                unique_lock lock( m_Mutex );
+                m_nFlushDone = m_nFlushTaken;
+            }
+            m_cvDone.notify_all();
+        }
+    };
+
+}}} // namespace cds::gc::details
+//@endcond
+
+#endif // #ifndef CDSLIB_GC_DETAILS_RECLAIMER_THREAD_H
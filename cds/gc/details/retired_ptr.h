@@ -52,13 +52,11 @@ namespace cds { namespace gc {
                 , m_funcFree( reinterpret_cast< free_retired_ptr_func >( pFreeFunc ))
             {}
 
+            /// Copy ctor
+            retired_ptr( retired_ptr const& s ) CDS_NOEXCEPT = default;
+
             /// Assignment operator
-            retired_ptr& operator =( retired_ptr const& s) CDS_NOEXCEPT
-            {
-                m_p = s.m_p;
-                m_funcFree = s.m_funcFree;
-                return *this;
-            }
+            retired_ptr& operator =( retired_ptr const& s ) CDS_NOEXCEPT = default;
 
             /// Invokes destructor function for the pointer
             void free()
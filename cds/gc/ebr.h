@@ -0,0 +1,10 @@
+//$$CDS-header$$
+
+#ifndef CDSLIB_GC_EBR_H
+#define CDSLIB_GC_EBR_H
+
+#include <cds/gc/impl/ebr_decl.h>
+#include <cds/gc/impl/ebr_impl.h>
+#include <cds/details/lib.h>
+
+#endif // #ifndef CDSLIB_GC_EBR_H
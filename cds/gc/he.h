@@ -0,0 +1,10 @@
+//$$CDS-header$$
+
+#ifndef CDSLIB_GC_HE_H
+#define CDSLIB_GC_HE_H
+
+#include <cds/gc/impl/he_decl.h>
+#include <cds/gc/impl/he_impl.h>
+#include <cds/details/lib.h>
+
+#endif // #ifndef CDSLIB_GC_HE_H
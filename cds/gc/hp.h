@@ -16,25 +16,45 @@
             <th>Feature</th>
             <th>%cds::gc::HP</th>
             <th>%cds::gc::DHP</th>
+            <th>%cds::gc::EBR</th>
+            <th>%cds::gc::HE</th>
         </tr>
         <tr>
             <td>Max number of guarded (hazard) pointers per thread</td>
-            <td>limited (specifies in GC object ctor)</td>
+            <td>unlimited (allocated by blocks when needed, block size specifies in GC object ctor)</td>
             <td>unlimited (dynamically allocated when needed)</td>
+            <td>unlimited (guards are thread-private pointers)</td>
+            <td>unlimited (allocated by blocks when needed)</td>
         </tr>
         <tr>
             <td>Max number of retired pointers<sup>1</sup></td>
             <td>bounded</td>
             <td>bounded</td>
+            <td>unbounded<sup>2</sup></td>
+            <td>bounded<sup>3</sup></td>
         </tr>
         <tr>
             <td>Array of retired pointers</td>
-            <td>preallocated for each thread, size is limited</td>
+            <td>for each thread, unlimited (grows when needed)</td>
             <td>global for the entire process, unlimited (dynamically allocated when needed)</td>
+            <td>for each thread, unlimited (dynamically allocated when needed)</td>
+            <td>for each thread, unlimited (dynamically allocated when needed)</td>
+        </tr>
+        <tr>
+            <td>Cost of guarding a pointer</td>
+            <td>atomic store and validating reload</td>
+            <td>atomic store and validating reload</td>
+            <td>plain store; epoch announcement on entering the critical section</td>
+            <td>atomic load and era check; era announcement when the era clock has changed</td>
         </tr>
     </table>
 
     <sup>1</sup>Unbounded count of retired pointer means a possibility of memory exhaustion.
+
+    <sup>2</sup>A thread that holds a guard for a long time blocks the reclamation in all threads.
+
+    <sup>3</sup>If the container stamps the birth era of its nodes; otherwise a stalled guard blocks
+    the pointers retired after the era it has published, as for \p %cds::gc::EBR.
 */
 
 namespace cds {
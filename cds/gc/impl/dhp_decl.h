@@ -3,6 +3,7 @@
 #ifndef CDSLIB_GC_IMPL_DHP_DECL_H
 #define CDSLIB_GC_IMPL_DHP_DECL_H
 
+#include <iterator>
 #include <cds/gc/details/dhp.h>
 #include <cds/details/marked_ptr.h>
 #include <cds/details/static_functor.h>
@@ -144,6 +145,7 @@ namespace cds { namespace gc {
                 T pRet;
                 do {
                     pRet = assign( pCur );
+                    dhp::GarbageCollector::publish_fence();
                     pCur = toGuard.load(atomics::memory_order_acquire);
                 } while ( pRet != pCur );
                 return pCur;
@@ -174,6 +176,7 @@ namespace cds { namespace gc {
                 do {
                     pRet = pCur;
                     assign( f( pCur ) );
+                    dhp::GarbageCollector::publish_fence();
                     pCur = toGuard.load(atomics::memory_order_acquire);
                 } while ( pRet != pCur );
                 return pCur;
@@ -283,6 +286,7 @@ namespace cds { namespace gc {
                 T pRet;
                 do {
                     pRet = assign( nIndex, toGuard.load(atomics::memory_order_relaxed) );
+                    dhp::GarbageCollector::publish_fence();
                 } while ( pRet != toGuard.load(atomics::memory_order_acquire));
 
                 return pRet;
@@ -311,6 +315,7 @@ namespace cds { namespace gc {
                 T pRet;
                 do {
                     assign( nIndex, f( pRet = toGuard.load(atomics::memory_order_relaxed) ));
+                    dhp::GarbageCollector::publish_fence();
                 } while ( pRet != toGuard.load(atomics::memory_order_acquire));
 
                 return pRet;
@@ -561,6 +566,12 @@ namespace cds { namespace gc {
         };
 
     public:
+        /// \p scan() type
+        enum class scan_type {
+            classic = dhp::classic,   ///< retired pointers are placed into a hash set, the set is probed for each guard
+            sorted = dhp::sorted      ///< sorted array of retired pointers is intersected with sorted snapshot of guards
+        };
+
         /// Initializes %DHP memory manager singleton
         /**
             Constructor creates and initializes %DHP global object.
@@ -575,15 +586,34 @@ namespace cds { namespace gc {
                 When a thread is initialized the GC allocates local guard pool for the thread from common guard pool.
                 By perforce the local thread's guard pool is grown automatically from common pool.
                 When the thread terminated its guard pool is backed to common GC's pool.
+            - \p bAsymmetricFence - if \p true, \p Guard::protect() uses a compiler-only barrier instead of
+                the full memory fence, and \p scan() issues the process-wide memory barrier (Linux \p membarrier(2)).
+                If the process-wide barrier is not supported, the full fence mode is used, see \p is_asymmetric_fence().
+            - \p bBackgroundReclaim - if \p true, a dedicated reclamation thread is started. When the count
+                of retired pointers reaches the threshold, the retiring thread just wakes up the reclamation thread
+                that runs \p scan(), instead of running it by itself. The reclamation thread calls the disposers,
+                so it is attached to \p cds::threading::Manager like an ordinary thread when the GC is constructed;
+                thus the disposers may use the GCs and RCUs constructed before this GC. The thread is offline for QSBR RCU.
+            - \p nScanType - \p scan() strategy, see \p scan_type. The \p sorted strategy uses
+                cache-friendly contiguous arrays instead of the hash set and does not depend on
+                the distribution of the retired pointers. The strategy may be changed at run time by \p setScanType().
         */
         DHP(
             size_t nLiberateThreshold = 1024
             , size_t nInitialThreadGuardCount = 8
+            , bool bAsymmetricFence = false
+            , bool bBackgroundReclaim = false
+            , scan_type nScanType = scan_type::classic
         )
         {
             dhp::GarbageCollector::Construct(
                 nLiberateThreshold,
-                nInitialThreadGuardCount
+                nInitialThreadGuardCount,
+                bAsymmetricFence,
+                bBackgroundReclaim,
+                static_cast<dhp::scan_type>( nScanType ),
+                &attach_reclaimer_thread,
+                &detach_reclaimer_thread
             );
         }
 
@@ -614,6 +644,32 @@ namespace cds { namespace gc {
             return true;
         }
 
+        /// Checks if asymmetric fence mode is used (see the ctor)
+        static bool is_asymmetric_fence()
+        {
+            return dhp::GarbageCollector::isAsymmetricFence();
+        }
+
+        /// Checks if background reclamation thread is used (see the ctor)
+        static bool is_background_reclaim()
+        {
+            return dhp::GarbageCollector::instance().isBackgroundReclaim();
+        }
+
+        /// Get current scan strategy
+        static scan_type getScanType()
+        {
+            return static_cast<scan_type>( dhp::GarbageCollector::instance().getScanType());
+        }
+
+        /// Set current scan strategy
+        static void setScanType(
+            scan_type nScanType     ///< new scan strategy
+        )
+        {
+            dhp::GarbageCollector::instance().setScanType( static_cast<dhp::scan_type>(nScanType) );
+        }
+
         /// Retire pointer \p p with function \p pFunc
         /**
             The function places pointer \p p to array of pointers ready for removing.
@@ -639,6 +695,22 @@ namespace cds { namespace gc {
             retire( p, cds::details::static_functor<Disposer, T>::call );
         }
 
+        /// Retire the range <tt>[itFirst, itLast)</tt> of pointers with functor of type \p Disposer
+        /**
+            The value type of \p ForwardIterator is <tt>T *</tt>.
+            The retired pointers are placed into the common retired buffer by one atomic operation
+            and the \p scan() threshold is checked once for the whole range.
+            The range is walked once, so \p ForwardIterator may be a single-pass input iterator.
+
+            See \p gc::HP::retire for \p Disposer requirements.
+        */
+        template <class Disposer, typename ForwardIterator>
+        static void retire( ForwardIterator itFirst, ForwardIterator itLast )
+        {
+            typedef typename std::remove_pointer< typename std::iterator_traits<ForwardIterator>::value_type >::type value_type;
+            dhp::GarbageCollector::instance().retirePtr( itFirst, itLast, cds::details::static_functor<Disposer, value_type>::call );
+        }
+
         /// Checks if Dynamic Hazard Pointer GC is constructed and may be used
         static bool isUsed()
         {
@@ -656,6 +728,24 @@ namespace cds { namespace gc {
         {
             scan();
         }
+
+        /// Returns reclamation telemetry
+        /**
+            The function fills \p st with the snapshot of always-on reclamation counters:
+            current and peak backlog of retired pointers, scan count and duration histogram,
+            count of pointers freed per scan. See \p cds::gc::reclaim_stat.
+        */
+        static cds::gc::reclaim_stat& statistics( cds::gc::reclaim_stat& st )
+        {
+            return dhp::GarbageCollector::instance().getReclaimStat( st );
+        }
+
+    private:
+        //@cond
+        // Attach/detach hooks of background reclamation thread
+        static void attach_reclaimer_thread();  // inline in dhp_impl.h
+        static void detach_reclaimer_thread();  // inline in dhp_impl.h
+        //@endcond
     };
 
 }} // namespace cds::gc
@@ -49,6 +49,17 @@ namespace cds { namespace gc {
             cds::threading::Manager::detachThread();
     }
 
+    inline /*static*/ void DHP::attach_reclaimer_thread()
+    {
+        cds::threading::Manager::attachThread();
+        cds::threading::Manager::thread_data()->qsbr_offline();
+    }
+
+    inline /*static*/ void DHP::detach_reclaimer_thread()
+    {
+        cds::threading::Manager::detachThread();
+    }
+
     inline /*static*/ void DHP::thread_gc::alloc_guard( cds::gc::dhp::details::guard& g )
     {
         return cds::threading::getGC<DHP>().allocGuard(g);
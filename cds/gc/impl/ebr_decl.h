@@ -0,0 +1,664 @@
+//$$CDS-header$$
+
+#ifndef CDSLIB_GC_IMPL_EBR_DECL_H
+#define CDSLIB_GC_IMPL_EBR_DECL_H
+
+#include <iterator>
+#include <cds/gc/details/ebr.h>
+#include <cds/details/marked_ptr.h>
+#include <cds/details/static_functor.h>
+
+namespace cds { namespace gc {
+
+    /// Epoch-based reclamation garbage collector
+    /**  @ingroup cds_garbage_collector
+        @headerfile cds/gc/ebr.h
+
+        Implementation of epoch-based reclamation (EBR) schema.
+
+        Sources:
+            - [2004] K.Fraser "Practical lock-freedom", PhD thesis, Chapter 5.2.3
+            - [2007] T.Hart, P.McKenney, A.Demke Brown, J.Walpole "Performance of memory reclamation
+                for lockless synchronization"
+
+        %EBR is a drop-in replacement for \p gc::HP and \p gc::DHP: it has the same interface
+        (\p Guard, \p GuardArray, \p guarded_ptr, \p retire() and so on), so any container
+        parametrized by \p gc::HP or \p gc::DHP may be used with \p %gc::EBR.
+
+        Unlike hazard pointers, %EBR does not publish each guarded pointer. Instead, the first guard
+        constructed by the thread opens a <i>critical section</i>: the thread announces the global epoch
+        it observes with one store and one full memory fence. Until the last guard of the thread is destroyed,
+        any pointer loaded by the thread is protected, so \p Guard::protect() is just an atomic load
+        and nested guards are almost free. A pointer retired in epoch \p E is freed when the global epoch
+        reaches <tt>E + 2</tt>; the global epoch is advanced by \p scan() only if all threads in critical section
+        have announced current epoch.
+
+        The price is that the reclamation is not bounded: a thread that stays in critical section
+        for a long time (for example, keeps an iterator or a \p guarded_ptr alive) prevents the epoch
+        from advancing, and retired pointers of all threads will accumulate until it leaves.
+        Do not hold guards or guarded pointers longer than necessary.
+
+        See \ref cds_how_to_use "How to use" section for details how to apply garbage collector.
+    */
+    class EBR
+    {
+    public:
+        /// Native guarded pointer type
+        /**
+            @headerfile cds/gc/ebr.h
+        */
+        typedef void * guarded_pointer;
+
+        /// Atomic reference
+        /**
+            @headerfile cds/gc/ebr.h
+        */
+        template <typename T> using atomic_ref = atomics::atomic<T *>;
+
+        /// Atomic type
+        /**
+            @headerfile cds/gc/ebr.h
+        */
+        template <typename T> using atomic_type = atomics::atomic<T>;
+
+        /// Atomic marked pointer
+        /**
+            @headerfile cds/gc/ebr.h
+        */
+        template <typename MarkedPtr> using atomic_marked_ptr = atomics::atomic<MarkedPtr>;
+
+        /// Thread GC implementation for internal usage
+        /**
+            @headerfile cds/gc/ebr.h
+        */
+        typedef ebr::ThreadGC   thread_gc_impl;
+
+        /// Thread-level garbage collector
+        /**
+            @headerfile cds/gc/ebr.h
+            This class performs automatically attaching/detaching %EBR GC
+            for the current thread.
+        */
+        class thread_gc: public thread_gc_impl
+        {
+            //@cond
+            bool    m_bPersistent;
+            //@endcond
+        public:
+            /// Constructor
+            /**
+                The constructor attaches the current thread to the %EBR GC
+                if it is not yet attached.
+                The \p bPersistent parameter specifies attachment persistence:
+                - \p true - the class destructor will not detach the thread from %EBR GC.
+                - \p false (default) - the class destructor will detach the thread from %EBR GC.
+            */
+            thread_gc(
+                bool    bPersistent = false
+            )   ;   // inline in ebr_impl.h
+
+            /// Destructor
+            /**
+                If the object has been created in persistent mode, the destructor does nothing.
+                Otherwise it detaches the current thread from %EBR GC.
+            */
+            ~thread_gc()    ;   // inline in ebr_impl.h
+
+        public: // for internal use only!!!
+            //@cond
+            static void alloc_guard( cds::gc::ebr::details::guard& g ); // inline in ebr_impl.h
+            static void free_guard( cds::gc::ebr::details::guard& g ); // inline in ebr_impl.h
+            //@endcond
+        };
+
+
+        /// %EBR guard
+        /**
+            @headerfile cds/gc/ebr.h
+
+            The constructor of the guard opens the critical section of current thread
+            (if it is not yet opened by another guard), the destructor closes it.
+            The guard itself is just a thread-private pointer, no memory fences are needed to set it.
+
+            A \p %Guard object is not copy- and move-constructible
+            and not copy- and move-assignable.
+        */
+        class Guard: public ebr::Guard
+        {
+            //@cond
+            typedef ebr::Guard base_class;
+            //@endcond
+
+        public: // for internal use only
+            //@cond
+            typedef cds::gc::ebr::details::guard native_guard;
+            //@endcond
+
+        public:
+            // Default ctor
+            Guard()
+            {}
+
+            //@cond
+            Guard( Guard const& ) = delete;
+            Guard( Guard&& s ) = delete;
+            Guard& operator=(Guard const&) = delete;
+            Guard& operator=(Guard&&) = delete;
+            //@endcond
+
+            /// Protects a pointer of type <tt> atomic<T*> </tt>
+            /**
+                Return the value of \p toGuard
+
+                Since the critical section is already opened, any pointer loaded is protected
+                so no validation loop is needed: the function loads \p toGuard and stores it to the guard.
+            */
+            template <typename T>
+            T protect( atomics::atomic<T> const& toGuard )
+            {
+                T pCur = toGuard.load(atomics::memory_order_acquire);
+                assign( pCur );
+                return pCur;
+            }
+
+            /// Protects a converted pointer of type <tt> atomic<T*> </tt>
+            /**
+                Return the value of \p toGuard
+
+                The function loads \p toGuard and stores result of \p f functor to the guard.
+
+                The function is useful for intrusive containers when \p toGuard is a node pointer
+                that should be converted to a pointer to the value type before guarding.
+                The parameter \p f of type Func is a functor that makes this conversion:
+                \code
+                    struct functor {
+                        value_type * operator()( T * p );
+                    };
+                \endcode
+                Really, the result of <tt> f( toGuard.load() ) </tt> is assigned to the guard.
+            */
+            template <typename T, class Func>
+            T protect( atomics::atomic<T> const& toGuard, Func f )
+            {
+                T pCur = toGuard.load(atomics::memory_order_acquire);
+                assign( f( pCur ) );
+                return pCur;
+            }
+
+            /// Store \p p to the guard
+            /**
+                The function is just an assignment, no loop is performed.
+                Can be used for a pointer that cannot be changed concurrently
+                or for already guarded pointer.
+            */
+            template <typename T>
+            T * assign( T * p )
+            {
+                return base_class::operator =(p);
+            }
+
+            //@cond
+            std::nullptr_t assign( std::nullptr_t )
+            {
+                return base_class::operator =(nullptr);
+            }
+            //@endcond
+
+            /// Store marked pointer \p p to the guard
+            /**
+                The function is just an assignment of <tt>p.ptr()</tt>, no loop is performed.
+                Can be used for a marked pointer that cannot be changed concurrently
+                or for already guarded pointer.
+            */
+            template <typename T, int BITMASK>
+            T * assign( cds::details::marked_ptr<T, BITMASK> p )
+            {
+                return base_class::operator =( p.ptr() );
+            }
+
+            /// Copy from \p src guard to \p this guard
+            void copy( Guard const& src )
+            {
+                assign( src.get_native() );
+            }
+
+            /// Clears value of the guard
+            void clear()
+            {
+                base_class::clear();
+            }
+
+            /// Gets the value currently protected (relaxed read)
+            template <typename T>
+            T * get() const
+            {
+                return reinterpret_cast<T *>( get_native() );
+            }
+
+            /// Gets native guarded pointer stored
+            guarded_pointer get_native() const
+            {
+                return base_class::get();
+            }
+        };
+
+        /// Array of %EBR guards
+        /**
+            @headerfile cds/gc/ebr.h
+            The class is intended for allocating an array of guards.
+            Template parameter \p Count defines the size of the array.
+            The critical section is opened once for entire array.
+
+            A \p %GuardArray object is not copy- and move-constructible
+            and not copy- and move-assignable.
+        */
+        template <size_t Count>
+        class GuardArray: public ebr::GuardArray<Count>
+        {
+            //@cond
+            typedef ebr::GuardArray<Count> base_class;
+            //@endcond
+        public:
+            /// Rebind array for other size \p OtherCount
+            template <size_t OtherCount>
+            struct rebind {
+                typedef GuardArray<OtherCount>  other   ;   ///< rebinding result
+            };
+
+        public:
+            // Default ctor
+            GuardArray()
+            {}
+
+            //@cond
+            GuardArray( GuardArray const& ) = delete;
+            GuardArray( GuardArray&& ) = delete;
+            GuardArray& operator=(GuardArray const&) = delete;
+            GuardArray& operator-(GuardArray&&) = delete;
+            //@endcond
+
+            /// Protects a pointer of type \p atomic<T*>
+            /**
+                Return the value of \p toGuard
+
+                The function loads \p toGuard and stores it to the slot \p nIndex
+            */
+            template <typename T>
+            T protect( size_t nIndex, atomics::atomic<T> const& toGuard )
+            {
+                return assign( nIndex, toGuard.load(atomics::memory_order_acquire) );
+            }
+
+            /// Protects a pointer of type \p atomic<T*>
+            /**
+                Return the value of \p toGuard
+
+                The function loads \p toGuard and stores result of \p f functor to the slot \p nIndex.
+
+                The function is useful for intrusive containers when \p toGuard is a node pointer
+                that should be converted to a pointer to the value type before guarding.
+                The parameter \p f of type Func is a functor to make that conversion:
+                \code
+                    struct functor {
+                        value_type * operator()( T * p );
+                    };
+                \endcode
+                Actually, the result of <tt> f( toGuard.load() ) </tt> is assigned to the guard.
+            */
+            template <typename T, class Func>
+            T protect( size_t nIndex, atomics::atomic<T> const& toGuard, Func f )
+            {
+                T pRet = toGuard.load(atomics::memory_order_acquire);
+                assign( nIndex, f( pRet ));
+                return pRet;
+            }
+
+            /// Store \p p to the slot \p nIndex
+            /**
+                The function is just an assignment, no loop is performed.
+            */
+            template <typename T>
+            T * assign( size_t nIndex, T * p )
+            {
+                base_class::set(nIndex, p);
+                return p;
+            }
+
+            /// Store marked pointer \p p to the guard
+            /**
+                The function is just an assignment of <tt>p.ptr()</tt>, no loop is performed.
+                Can be used for a marked pointer that cannot be changed concurrently
+                or for already guarded pointer.
+            */
+            template <typename T, int Bitmask>
+            T * assign( size_t nIndex, cds::details::marked_ptr<T, Bitmask> p )
+            {
+                return assign( nIndex, p.ptr() );
+            }
+
+            /// Copy guarded value from \p src guard to slot at index \p nIndex
+            void copy( size_t nIndex, Guard const& src )
+            {
+                assign( nIndex, src.get_native() );
+            }
+
+            /// Copy guarded value from slot \p nSrcIndex to slot at index \p nDestIndex
+            void copy( size_t nDestIndex, size_t nSrcIndex )
+            {
+                assign( nDestIndex, get_native( nSrcIndex ));
+            }
+
+            /// Clear value of the slot \p nIndex
+            void clear( size_t nIndex )
+            {
+                base_class::clear( nIndex );
+            }
+
+            /// Get current value of slot \p nIndex
+            template <typename T>
+            T * get( size_t nIndex ) const
+            {
+                return reinterpret_cast<T *>( get_native( nIndex ) );
+            }
+
+            /// Get native guarded pointer stored
+            guarded_pointer get_native( size_t nIndex ) const
+            {
+                return base_class::get( nIndex );
+            }
+
+            /// Capacity of the guard array
+            static CDS_CONSTEXPR size_t capacity()
+            {
+                return Count;
+            }
+        };
+
+        /// Guarded pointer
+        /**
+            A guarded pointer is a pair of a pointer and GC's guard.
+            Usually, it is used for returning a pointer to the item from an lock-free container.
+            The guard prevents the pointer to be early disposed (freed) by GC.
+            After destructing \p %guarded_ptr object the pointer can be disposed (freed) automatically at any time.
+
+            Note that non-empty \p %guarded_ptr keeps the critical section of current thread opened,
+            so it blocks the reclamation of all retired pointers until it is released.
+
+            Template arguments:
+            - \p GuardedType - a type which the guard stores
+            - \p ValueType - a value type
+            - \p Cast - a functor for converting <tt>GuardedType*</tt> to <tt>ValueType*</tt>. Default is \p void (no casting).
+
+            For intrusive containers, \p GuardedType is the same as \p ValueType and no casting is needed.
+            In such case the \p %guarded_ptr is:
+            @code
+            typedef cds::gc::EBR::guarded_ptr< foo > intrusive_guarded_ptr;
+            @endcode
+
+            For standard (non-intrusive) containers \p GuardedType is not the same as \p ValueType and casting is needed.
+            For example:
+            @code
+            struct foo {
+                int const   key;
+                std::string value;
+            };
+
+            struct value_accessor {
+                std::string* operator()( foo* pFoo ) const
+                {
+                    return &(pFoo->value);
+                }
+            };
+
+            // Guarded ptr
+            typedef cds::gc::EBR::guarded_ptr< Foo, std::string, value_accessor > nonintrusive_guarded_ptr;
+            @endcode
+
+            You don't need use this class directly.
+            All set/map container classes from \p libcds declare the typedef for \p %guarded_ptr with appropriate casting functor.
+        */
+        template <typename GuardedType, typename ValueType=GuardedType, typename Cast=void >
+        class guarded_ptr
+        {
+            //@cond
+            struct trivial_cast {
+                ValueType * operator()( GuardedType * p ) const
+                {
+                    return p;
+                }
+            };
+            //@endcond
+
+        public:
+            typedef GuardedType guarded_type; ///< Guarded type
+            typedef ValueType   value_type;   ///< Value type
+
+            /// Functor for casting \p guarded_type to \p value_type
+            typedef typename std::conditional< std::is_same<Cast, void>::value, trivial_cast, Cast >::type value_cast;
+
+            //@cond
+            typedef cds::gc::ebr::details::guard native_guard;
+            //@endcond
+
+        private:
+            //@cond
+            native_guard    m_guard;
+            //@endcond
+
+        public:
+            /// Creates empty guarded pointer
+            guarded_ptr() CDS_NOEXCEPT
+            {}
+
+            //@cond
+            /// Initializes guarded pointer with \p p
+            explicit guarded_ptr( guarded_type * p ) CDS_NOEXCEPT
+            {
+                alloc_guard();
+                assert( m_guard.is_initialized() );
+                m_guard.set( p );
+            }
+            explicit guarded_ptr( std::nullptr_t ) CDS_NOEXCEPT
+            {}
+            //@endcond
+
+            /// Move ctor
+            guarded_ptr( guarded_ptr&& gp ) CDS_NOEXCEPT
+            {
+                m_guard.move_from( gp.m_guard );
+            }
+
+            /// The guarded pointer is not copy-constructible
+            guarded_ptr( guarded_ptr const& gp ) = delete;
+
+            /// Clears the guarded pointer
+            /**
+                \ref release is called if guarded pointer is not \ref empty
+            */
+            ~guarded_ptr() CDS_NOEXCEPT
+            {
+                free_guard();
+            }
+
+            /// Move-assignment operator
+            guarded_ptr& operator=( guarded_ptr&& gp ) CDS_NOEXCEPT
+            {
+                if ( &gp != this ) {
+                    free_guard();
+                    m_guard.move_from( gp.m_guard );
+                }
+                return *this;
+            }
+
+            /// The guarded pointer is not copy-assignable
+            guarded_ptr& operator=(guarded_ptr const& gp) = delete;
+
+            /// Returns a pointer to guarded value
+            value_type * operator ->() const CDS_NOEXCEPT
+            {
+                assert( !empty() );
+                return value_cast()( reinterpret_cast<guarded_type *>(m_guard.get()));
+            }
+
+            /// Returns a reference to guarded value
+            value_type& operator *() CDS_NOEXCEPT
+            {
+                assert( !empty());
+                return *value_cast()(reinterpret_cast<guarded_type *>(m_guard.get()));
+            }
+
+            /// Returns const reference to guarded value
+            value_type const& operator *() const CDS_NOEXCEPT
+            {
+                assert( !empty() );
+                return *value_cast()(reinterpret_cast<guarded_type *>(m_guard.get()));
+            }
+
+            /// Checks if the guarded pointer is \p nullptr
+            bool empty() const CDS_NOEXCEPT
+            {
+                return !m_guard.is_initialized() || m_guard.get( atomics::memory_order_relaxed ) == nullptr;
+            }
+
+            /// \p bool operator returns <tt>!empty()</tt>
+            explicit operator bool() const CDS_NOEXCEPT
+            {
+                return !empty();
+            }
+
+            /// Clears guarded pointer
+            /**
+                If the guarded pointer has been released, the pointer can be disposed (freed) at any time.
+                Dereferncing the guarded pointer after \p release() is dangerous.
+            */
+            void release() CDS_NOEXCEPT
+            {
+                free_guard();
+            }
+
+            //@cond
+            // For internal use only!!!
+            native_guard& guard() CDS_NOEXCEPT
+            {
+                alloc_guard();
+                assert( m_guard.is_initialized() );
+                return m_guard;
+            }
+            //@endcond
+
+        private:
+            //@cond
+            void alloc_guard()
+            {
+                if ( !m_guard.is_initialized() )
+                    thread_gc::alloc_guard( m_guard );
+            }
+
+            void free_guard()
+            {
+                if ( m_guard.is_initialized() )
+                    thread_gc::free_guard( m_guard );
+            }
+            //@endcond
+        };
+
+    public:
+        /// Initializes %EBR memory manager singleton
+        /**
+            Constructor creates and initializes %EBR global object.
+            %EBR object should be created before using CDS data structure based on \p %cds::gc::EBR GC. Usually,
+            it is created in the \p main() function.
+            After creating of global object you may use CDS data structures based on \p %cds::gc::EBR.
+
+            \par Parameters
+            - \p nRetiredThreshold - \p scan() threshold. When count of retired pointers of a thread reaches this value,
+                the \p scan() member function would be called for freeing retired pointers.
+                If \p scan() cannot free retired pointers because the epoch cannot be advanced,
+                next \p scan() call is postponed until the thread retires \p nRetiredThreshold pointers more.
+        */
+        EBR( size_t nRetiredThreshold = 256 )
+        {
+            ebr::GarbageCollector::Construct( nRetiredThreshold );
+        }
+
+        /// Destroys %EBR memory manager
+        /**
+            The destructor destroys %EBR global object. After calling of this function you may \b NOT
+            use CDS data structures based on \p %cds::gc::EBR.
+            Usually, %EBR object is destroyed at the end of your \p main().
+        */
+        ~EBR()
+        {
+            ebr::GarbageCollector::Destruct();
+        }
+
+        /// Checks if count of guards is no less than \p nCountNeeded
+        /**
+            The function always returns \p true since the guard count is unlimited for
+            \p %gc::EBR garbage collector.
+        */
+        static CDS_CONSTEXPR bool check_available_guards(
+#ifdef CDS_DOXYGEN_INVOKED
+            size_t nCountNeeded,
+#else
+            size_t,
+#endif
+            bool /*bRaiseException*/ = true )
+        {
+            return true;
+        }
+
+        /// Retire pointer \p p with function \p pFunc
+        /**
+            The function places pointer \p p to thread's array of retired pointers.
+            The pointer can be safely removed when all threads that might see it have left
+            their critical sections, i.e. after two advances of the global epoch.
+            Deleting the pointer is the function \p pFunc call.
+        */
+        template <typename T>
+        static void retire( T * p, void (* pFunc)(T *) );   // inline in ebr_impl.h
+
+        /// Retire pointer \p p with functor of type \p Disposer
+        /**
+            The function places pointer \p p to thread's array of retired pointers.
+
+            See \p gc::HP::retire for \p Disposer requirements.
+        */
+        template <class Disposer, typename T>
+        static void retire( T * p );   // inline in ebr_impl.h
+
+        /// Retire the range <tt>[itFirst, itLast)</tt> of pointers with functor of type \p Disposer
+        /**
+            The value type of \p ForwardIterator is <tt>T *</tt>.
+            The scan threshold is checked once for the whole range.
+            The range is walked once, so \p ForwardIterator may be a single-pass input iterator.
+
+            See \p gc::HP::retire for \p Disposer requirements.
+        */
+        template <class Disposer, typename ForwardIterator>
+        static void retire( ForwardIterator itFirst, ForwardIterator itLast );   // inline in ebr_impl.h
+
+        /// Checks if %EBR GC is constructed and may be used
+        static bool isUsed()
+        {
+            return ebr::GarbageCollector::isUsed();
+        }
+
+        /// Forced GC cycle call for current thread
+        /**
+            Usually, this function should not be called directly.
+            The function tries to advance the global epoch and frees the retired pointers
+            of current thread that are safe to free.
+        */
+        static void scan()  ;   // inline in ebr_impl.h
+
+        /// Synonym for \ref scan()
+        static void force_dispose()
+        {
+            scan();
+        }
+    };
+
+}} // namespace cds::gc
+
+#endif // #ifndef CDSLIB_GC_IMPL_EBR_DECL_H
@@ -0,0 +1,88 @@
+//$$CDS-header$$
+
+#ifndef CDSLIB_GC_IMPL_EBR_IMPL_H
+#define CDSLIB_GC_IMPL_EBR_IMPL_H
+
+#include <cds/threading/model.h>
+
+//@cond
+namespace cds { namespace gc {
+
+    namespace ebr {
+
+        inline Guard::Guard()
+        {
+            cds::threading::getGC<EBR>().allocGuard( *this );
+        }
+
+        inline Guard::~Guard()
+        {
+            cds::threading::getGC<EBR>().freeGuard( *this );
+        }
+
+        template <size_t Count>
+        inline GuardArray<Count>::GuardArray()
+        {
+            cds::threading::getGC<EBR>().allocGuard( *this );
+        }
+
+        template <size_t Count>
+        inline GuardArray<Count>::~GuardArray()
+        {
+            cds::threading::getGC<EBR>().freeGuard( *this );
+        }
+    } // namespace ebr
+
+
+    inline EBR::thread_gc::thread_gc(
+        bool    bPersistent
+        )
+        : m_bPersistent( bPersistent )
+    {
+        if ( !cds::threading::Manager::isThreadAttached() )
+            cds::threading::Manager::attachThread();
+    }
+
+    inline EBR::thread_gc::~thread_gc()
+    {
+        if ( !m_bPersistent )
+            cds::threading::Manager::detachThread();
+    }
+
+    inline /*static*/ void EBR::thread_gc::alloc_guard( cds::gc::ebr::details::guard& g )
+    {
+        return cds::threading::getGC<EBR>().allocGuard(g);
+    }
+    inline /*static*/ void EBR::thread_gc::free_guard( cds::gc::ebr::details::guard& g )
+    {
+        cds::threading::getGC<EBR>().freeGuard(g);
+    }
+
+    template <typename T>
+    inline void EBR::retire( T * p, void (* pFunc)(T *) )
+    {
+        cds::threading::getGC<EBR>().retirePtr( p, pFunc );
+    }
+
+    template <class Disposer, typename T>
+    inline void EBR::retire( T * p )
+    {
+        cds::threading::getGC<EBR>().retirePtr( p, cds::details::static_functor<Disposer, T>::call );
+    }
+
+    template <class Disposer, typename ForwardIterator>
+    inline void EBR::retire( ForwardIterator itFirst, ForwardIterator itLast )
+    {
+        typedef typename std::remove_pointer< typename std::iterator_traits<ForwardIterator>::value_type >::type value_type;
+        cds::threading::getGC<EBR>().retirePtr( itFirst, itLast, cds::details::static_functor<Disposer, value_type>::call );
+    }
+
+    inline void EBR::scan()
+    {
+        cds::threading::getGC<EBR>().scan();
+    }
+
+}} // namespace cds::gc
+//@endcond
+
+#endif // #ifndef CDSLIB_GC_IMPL_EBR_IMPL_H
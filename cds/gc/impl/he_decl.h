@@ -0,0 +1,739 @@
+//$$CDS-header$$
+
+#ifndef CDSLIB_GC_IMPL_HE_DECL_H
+#define CDSLIB_GC_IMPL_HE_DECL_H
+
+#include <iterator>
+#include <cds/gc/details/he.h>
+#include <cds/details/marked_ptr.h>
+#include <cds/details/static_functor.h>
+
+namespace cds { namespace gc {
+
+    /// Hazard eras garbage collector
+    /**  @ingroup cds_garbage_collector
+        @headerfile cds/gc/he.h
+
+        Implementation of hazard eras (HE) schema.
+
+        Sources:
+            - [2017] P.Ramalhete, A.Correia "Brief Announcement: Hazard Eras - Non-Blocking Memory Reclamation"
+            - [2018] H.Wen, J.Izraelevitz, W.Cai, H.A.Beadle, M.L.Scott "Interval-based memory reclamation"
+
+        %HE is a drop-in replacement for \p gc::HP and \p gc::DHP: it has the same interface
+        (\p Guard, \p GuardArray, \p guarded_ptr, \p retire() and so on), so any container
+        parametrized by \p gc::HP or \p gc::DHP may be used with \p %gc::HE.
+
+        The GC maintains global <i>era clock</i> that is advanced as pointers are retired.
+        Instead of publishing each pointer loaded, \p Guard::protect() publishes the era it observes;
+        the full memory fence is needed only if the era has changed since the previous \p protect()
+        for the same guard, so a traversal usually costs one fence per guard, not per node.
+        Each retired pointer remembers its lifetime interval <tt>[birth era, retire era]</tt>
+        and is freed when no guard publishes an era from that interval.
+
+        Unlike \p gc::EBR, the reclamation is bounded: a stalled thread blocks only the pointers
+        that were alive in the era it has published, the pointers allocated later are freed as usual.
+        The birth era is known for the nodes of containers that stamp it when the node is linked
+        (\p intrusive::MichaelList, \p intrusive::LazyList and the containers based on them, \p intrusive::SkipListSet,
+        \p intrusive::EllenBinTree, \p intrusive::TreiberStack and their non-intrusive counterparts); for other containers the birth era
+        is unknown, and a stalled thread blocks all pointers retired after the era it has published.
+
+        \p Guard::assign() and \p guarded_ptr publish the pointer itself as \p gc::HP does,
+        so a \p guarded_ptr kept for a long time blocks only one pointer.
+
+        See \ref cds_how_to_use "How to use" section for details how to apply garbage collector.
+    */
+    class HE
+    {
+    public:
+        /// Native guarded pointer type
+        /**
+            @headerfile cds/gc/he.h
+        */
+        typedef void * guarded_pointer;
+
+        /// Atomic reference
+        /**
+            @headerfile cds/gc/he.h
+        */
+        template <typename T> using atomic_ref = atomics::atomic<T *>;
+
+        /// Atomic type
+        /**
+            @headerfile cds/gc/he.h
+        */
+        template <typename T> using atomic_type = atomics::atomic<T>;
+
+        /// Atomic marked pointer
+        /**
+            @headerfile cds/gc/he.h
+        */
+        template <typename MarkedPtr> using atomic_marked_ptr = atomics::atomic<MarkedPtr>;
+
+        /// Thread GC implementation for internal usage
+        /**
+            @headerfile cds/gc/he.h
+        */
+        typedef he::ThreadGC   thread_gc_impl;
+
+        /// Thread-level garbage collector
+        /**
+            @headerfile cds/gc/he.h
+            This class performs automatically attaching/detaching %HE GC
+            for the current thread.
+        */
+        class thread_gc: public thread_gc_impl
+        {
+            //@cond
+            bool    m_bPersistent;
+            //@endcond
+        public:
+            /// Constructor
+            /**
+                The constructor attaches the current thread to the %HE GC
+                if it is not yet attached.
+                The \p bPersistent parameter specifies attachment persistence:
+                - \p true - the class destructor will not detach the thread from %HE GC.
+                - \p false (default) - the class destructor will detach the thread from %HE GC.
+            */
+            thread_gc(
+                bool    bPersistent = false
+            )   ;   // inline in he_impl.h
+
+            /// Destructor
+            /**
+                If the object has been created in persistent mode, the destructor does nothing.
+                Otherwise it detaches the current thread from %HE GC.
+            */
+            ~thread_gc()    ;   // inline in he_impl.h
+
+        public: // for internal use only!!!
+            //@cond
+            static void alloc_guard( cds::gc::he::details::guard& g ); // inline in he_impl.h
+            static void free_guard( cds::gc::he::details::guard& g ); // inline in he_impl.h
+            //@endcond
+        };
+
+
+        /// %HE guard
+        /**
+            @headerfile cds/gc/he.h
+
+            The constructor of the guard allocates a slot for current thread, the destructor frees it.
+            \p protect() publishes current era in the slot, \p assign() publishes the pointer itself.
+
+            A \p %Guard object is not copy- and move-constructible
+            and not copy- and move-assignable.
+        */
+        class Guard: public he::Guard
+        {
+            //@cond
+            typedef he::Guard base_class;
+            //@endcond
+
+        public: // for internal use only
+            //@cond
+            typedef cds::gc::he::details::guard native_guard;
+            //@endcond
+
+        public:
+            // Default ctor
+            Guard()
+            {}
+
+            //@cond
+            Guard( Guard const& ) = delete;
+            Guard( Guard&& s ) = delete;
+            Guard& operator=(Guard const&) = delete;
+            Guard& operator=(Guard&&) = delete;
+            //@endcond
+
+            /// Protects a pointer of type <tt> atomic<T*> </tt>
+            /**
+                Return the value of \p toGuard
+
+                The function publishes current era and loads \p toGuard until the era is not changed.
+                The memory fence is issued only if the era has changed since the previous call.
+            */
+            template <typename T>
+            T protect( atomics::atomic<T> const& toGuard )
+            {
+                T pCur = base_class::slot()->protect( toGuard );
+                guard_pointer( pCur );
+                return pCur;
+            }
+
+            /// Protects a converted pointer of type <tt> atomic<T*> </tt>
+            /**
+                Return the value of \p toGuard
+
+                The function publishes current era, loads \p toGuard until the era is not changed
+                and stores result of \p f functor to the guard.
+
+                The function is useful for intrusive containers when \p toGuard is a node pointer
+                that should be converted to a pointer to the value type before guarding.
+                The parameter \p f of type Func is a functor that makes this conversion:
+                \code
+                    struct functor {
+                        value_type * operator()( T * p );
+                    };
+                \endcode
+                Really, the result of <tt> f( toGuard.load() ) </tt> is assigned to the guard.
+            */
+            template <typename T, class Func>
+            T protect( atomics::atomic<T> const& toGuard, Func f )
+            {
+                T pCur = base_class::slot()->protect( toGuard );
+                guard_pointer( f( pCur ));
+                return pCur;
+            }
+
+            /// Store \p p to the guard
+            /**
+                The function publishes \p p as hazard pointer, no loop is performed.
+                Can be used for a pointer that cannot be changed concurrently
+                or for already guarded pointer.
+            */
+            template <typename T>
+            T * assign( T * p )
+            {
+                return base_class::operator =(p);
+            }
+
+            //@cond
+            std::nullptr_t assign( std::nullptr_t )
+            {
+                return base_class::operator =(nullptr);
+            }
+            //@endcond
+
+            /// Store marked pointer \p p to the guard
+            /**
+                The function publishes <tt>p.ptr()</tt> as hazard pointer, no loop is performed.
+                Can be used for a marked pointer that cannot be changed concurrently
+                or for already guarded pointer.
+            */
+            template <typename T, int BITMASK>
+            T * assign( cds::details::marked_ptr<T, BITMASK> p )
+            {
+                return base_class::operator =( p.ptr() );
+            }
+
+            /// Copy from \p src guard to \p this guard
+            void copy( Guard const& src )
+            {
+                base_class::slot()->copy( *src.slot() );
+            }
+
+            /// Clears value of the guard
+            void clear()
+            {
+                base_class::clear();
+            }
+
+            /// Gets the value currently protected (relaxed read)
+            template <typename T>
+            T * get() const
+            {
+                return reinterpret_cast<T *>( get_native() );
+            }
+
+            /// Gets native guarded pointer stored
+            guarded_pointer get_native() const
+            {
+                return base_class::get();
+            }
+
+        private:
+            //@cond
+            template <typename T>
+            void guard_pointer( T * p ) CDS_NOEXCEPT
+            {
+                base_class::slot()->m_pGuarded = reinterpret_cast<void *>( const_cast<T *>( p ));
+            }
+
+            template <typename T, int BITMASK>
+            void guard_pointer( cds::details::marked_ptr<T, BITMASK> p ) CDS_NOEXCEPT
+            {
+                guard_pointer( p.ptr() );
+            }
+            //@endcond
+        };
+
+        /// Array of %HE guards
+        /**
+            @headerfile cds/gc/he.h
+            The class is intended for allocating an array of guards.
+            Template parameter \p Count defines the size of the array.
+
+            A \p %GuardArray object is not copy- and move-constructible
+            and not copy- and move-assignable.
+        */
+        template <size_t Count>
+        class GuardArray: public he::GuardArray<Count>
+        {
+            //@cond
+            typedef he::GuardArray<Count> base_class;
+            //@endcond
+        public:
+            /// Rebind array for other size \p OtherCount
+            template <size_t OtherCount>
+            struct rebind {
+                typedef GuardArray<OtherCount>  other   ;   ///< rebinding result
+            };
+
+        public:
+            // Default ctor
+            GuardArray()
+            {}
+
+            //@cond
+            GuardArray( GuardArray const& ) = delete;
+            GuardArray( GuardArray&& ) = delete;
+            GuardArray& operator=(GuardArray const&) = delete;
+            GuardArray& operator-(GuardArray&&) = delete;
+            //@endcond
+
+            /// Protects a pointer of type \p atomic<T*>
+            /**
+                Return the value of \p toGuard
+
+                The function publishes current era in the slot \p nIndex
+                and loads \p toGuard until the era is not changed.
+            */
+            template <typename T>
+            T protect( size_t nIndex, atomics::atomic<T> const& toGuard )
+            {
+                T pRet = base_class::operator[]( nIndex ).protect( toGuard );
+                guard_pointer( nIndex, pRet );
+                return pRet;
+            }
+
+            /// Protects a pointer of type \p atomic<T*>
+            /**
+                Return the value of \p toGuard
+
+                The function publishes current era in the slot \p nIndex, loads \p toGuard
+                until the era is not changed and stores result of \p f functor to the slot \p nIndex.
+
+                The function is useful for intrusive containers when \p toGuard is a node pointer
+                that should be converted to a pointer to the value type before guarding.
+                The parameter \p f of type Func is a functor to make that conversion:
+                \code
+                    struct functor {
+                        value_type * operator()( T * p );
+                    };
+                \endcode
+                Actually, the result of <tt> f( toGuard.load() ) </tt> is assigned to the guard.
+            */
+            template <typename T, class Func>
+            T protect( size_t nIndex, atomics::atomic<T> const& toGuard, Func f )
+            {
+                T pRet = base_class::operator[]( nIndex ).protect( toGuard );
+                guard_pointer( nIndex, f( pRet ));
+                return pRet;
+            }
+
+            /// Store \p p to the slot \p nIndex
+            /**
+                The function publishes \p p as hazard pointer, no loop is performed.
+            */
+            template <typename T>
+            T * assign( size_t nIndex, T * p )
+            {
+                base_class::set(nIndex, p);
+                return p;
+            }
+
+            /// Store marked pointer \p p to the guard
+            /**
+                The function publishes <tt>p.ptr()</tt> as hazard pointer, no loop is performed.
+                Can be used for a marked pointer that cannot be changed concurrently
+                or for already guarded pointer.
+            */
+            template <typename T, int Bitmask>
+            T * assign( size_t nIndex, cds::details::marked_ptr<T, Bitmask> p )
+            {
+                return assign( nIndex, p.ptr() );
+            }
+
+            /// Copy guarded value from \p src guard to slot at index \p nIndex
+            void copy( size_t nIndex, Guard const& src )
+            {
+                base_class::operator[]( nIndex ).copy( *src.slot() );
+            }
+
+            /// Copy guarded value from slot \p nSrcIndex to slot at index \p nDestIndex
+            void copy( size_t nDestIndex, size_t nSrcIndex )
+            {
+                base_class::operator[]( nDestIndex ).copy( base_class::operator[]( nSrcIndex ));
+            }
+
+            /// Clear value of the slot \p nIndex
+            void clear( size_t nIndex )
+            {
+                base_class::clear( nIndex );
+            }
+
+            /// Get current value of slot \p nIndex
+            template <typename T>
+            T * get( size_t nIndex ) const
+            {
+                return reinterpret_cast<T *>( get_native( nIndex ) );
+            }
+
+            /// Get native guarded pointer stored
+            guarded_pointer get_native( size_t nIndex ) const
+            {
+                return base_class::get( nIndex );
+            }
+
+            /// Capacity of the guard array
+            static CDS_CONSTEXPR size_t capacity()
+            {
+                return Count;
+            }
+
+        private:
+            //@cond
+            template <typename T>
+            void guard_pointer( size_t nIndex, T * p ) CDS_NOEXCEPT
+            {
+                base_class::operator[]( nIndex ).m_pGuarded = reinterpret_cast<void *>( const_cast<T *>( p ));
+            }
+
+            template <typename T, int BITMASK>
+            void guard_pointer( size_t nIndex, cds::details::marked_ptr<T, BITMASK> p ) CDS_NOEXCEPT
+            {
+                guard_pointer( nIndex, p.ptr() );
+            }
+            //@endcond
+        };
+
+        /// Guarded pointer
+        /**
+            A guarded pointer is a pair of a pointer and GC's guard.
+            Usually, it is used for returning a pointer to the item from an lock-free container.
+            The guard prevents the pointer to be early disposed (freed) by GC.
+            After destructing \p %guarded_ptr object the pointer can be disposed (freed) automatically at any time.
+
+            Template arguments:
+            - \p GuardedType - a type which the guard stores
+            - \p ValueType - a value type
+            - \p Cast - a functor for converting <tt>GuardedType*</tt> to <tt>ValueType*</tt>. Default is \p void (no casting).
+
+            For intrusive containers, \p GuardedType is the same as \p ValueType and no casting is needed.
+            In such case the \p %guarded_ptr is:
+            @code
+            typedef cds::gc::HE::guarded_ptr< foo > intrusive_guarded_ptr;
+            @endcode
+
+            For standard (non-intrusive) containers \p GuardedType is not the same as \p ValueType and casting is needed.
+            For example:
+            @code
+            struct foo {
+                int const   key;
+                std::string value;
+            };
+
+            struct value_accessor {
+                std::string* operator()( foo* pFoo ) const
+                {
+                    return &(pFoo->value);
+                }
+            };
+
+            // Guarded ptr
+            typedef cds::gc::HE::guarded_ptr< Foo, std::string, value_accessor > nonintrusive_guarded_ptr;
+            @endcode
+
+            You don't need use this class directly.
+            All set/map container classes from \p libcds declare the typedef for \p %guarded_ptr with appropriate casting functor.
+        */
+        template <typename GuardedType, typename ValueType=GuardedType, typename Cast=void >
+        class guarded_ptr
+        {
+            //@cond
+            struct trivial_cast {
+                ValueType * operator()( GuardedType * p ) const
+                {
+                    return p;
+                }
+            };
+            //@endcond
+
+        public:
+            typedef GuardedType guarded_type; ///< Guarded type
+            typedef ValueType   value_type;   ///< Value type
+
+            /// Functor for casting \p guarded_type to \p value_type
+            typedef typename std::conditional< std::is_same<Cast, void>::value, trivial_cast, Cast >::type value_cast;
+
+            //@cond
+            typedef cds::gc::he::details::guard native_guard;
+            //@endcond
+
+        private:
+            //@cond
+            native_guard    m_guard;
+            //@endcond
+
+        public:
+            /// Creates empty guarded pointer
+            guarded_ptr() CDS_NOEXCEPT
+            {}
+
+            //@cond
+            /// Initializes guarded pointer with \p p
+            explicit guarded_ptr( guarded_type * p ) CDS_NOEXCEPT
+            {
+                alloc_guard();
+                assert( m_guard.is_initialized() );
+                m_guard.set( p );
+            }
+            explicit guarded_ptr( std::nullptr_t ) CDS_NOEXCEPT
+            {}
+            //@endcond
+
+            /// Move ctor
+            guarded_ptr( guarded_ptr&& gp ) CDS_NOEXCEPT
+            {
+                m_guard.move_from( gp.m_guard );
+            }
+
+            /// The guarded pointer is not copy-constructible
+            guarded_ptr( guarded_ptr const& gp ) = delete;
+
+            /// Clears the guarded pointer
+            /**
+                \ref release is called if guarded pointer is not \ref empty
+            */
+            ~guarded_ptr() CDS_NOEXCEPT
+            {
+                free_guard();
+            }
+
+            /// Move-assignment operator
+            guarded_ptr& operator=( guarded_ptr&& gp ) CDS_NOEXCEPT
+            {
+                if ( &gp != this ) {
+                    free_guard();
+                    m_guard.move_from( gp.m_guard );
+                }
+                return *this;
+            }
+
+            /// The guarded pointer is not copy-assignable
+            guarded_ptr& operator=(guarded_ptr const& gp) = delete;
+
+            /// Returns a pointer to guarded value
+            value_type * operator ->() const CDS_NOEXCEPT
+            {
+                assert( !empty() );
+                return value_cast()( reinterpret_cast<guarded_type *>(m_guard.get()));
+            }
+
+            /// Returns a reference to guarded value
+            value_type& operator *() CDS_NOEXCEPT
+            {
+                assert( !empty());
+                return *value_cast()(reinterpret_cast<guarded_type *>(m_guard.get()));
+            }
+
+            /// Returns const reference to guarded value
+            value_type const& operator *() const CDS_NOEXCEPT
+            {
+                assert( !empty() );
+                return *value_cast()(reinterpret_cast<guarded_type *>(m_guard.get()));
+            }
+
+            /// Checks if the guarded pointer is \p nullptr
+            bool empty() const CDS_NOEXCEPT
+            {
+                return !m_guard.is_initialized() || m_guard.get( atomics::memory_order_relaxed ) == nullptr;
+            }
+
+            /// \p bool operator returns <tt>!empty()</tt>
+            explicit operator bool() const CDS_NOEXCEPT
+            {
+                return !empty();
+            }
+
+            /// Clears guarded pointer
+            /**
+                If the guarded pointer has been released, the pointer can be disposed (freed) at any time.
+                Dereferncing the guarded pointer after \p release() is dangerous.
+            */
+            void release() CDS_NOEXCEPT
+            {
+                free_guard();
+            }
+
+            //@cond
+            // For internal use only!!!
+            native_guard& guard() CDS_NOEXCEPT
+            {
+                alloc_guard();
+                assert( m_guard.is_initialized() );
+                return m_guard;
+            }
+            //@endcond
+
+        private:
+            //@cond
+            void alloc_guard()
+            {
+                if ( !m_guard.is_initialized() )
+                    thread_gc::alloc_guard( m_guard );
+            }
+
+            void free_guard()
+            {
+                if ( m_guard.is_initialized() )
+                    thread_gc::free_guard( m_guard );
+            }
+            //@endcond
+        };
+
+    public:
+        /// Initializes %HE memory manager singleton
+        /**
+            Constructor creates and initializes %HE global object.
+            %HE object should be created before using CDS data structure based on \p %cds::gc::HE GC. Usually,
+            it is created in the \p main() function.
+            After creating of global object you may use CDS data structures based on \p %cds::gc::HE.
+
+            \par Parameters
+            - \p nRetiredThreshold - \p scan() threshold. When count of retired pointers of a thread reaches this value,
+                the \p scan() member function would be called for freeing retired pointers.
+                Next \p scan() call is postponed until the thread retires \p nRetiredThreshold pointers more.
+            - \p nEraAdvanceFreq - the era clock is advanced each time a thread retires \p nEraAdvanceFreq pointers.
+                Less value means less retired pointers blocked by a guard but more frequent memory fences
+                in \p Guard::protect().
+        */
+        HE(
+            size_t nRetiredThreshold = 256,
+            size_t nEraAdvanceFreq = 32
+        )
+        {
+            he::GarbageCollector::Construct( nRetiredThreshold, nEraAdvanceFreq );
+        }
+
+        /// Destroys %HE memory manager
+        /**
+            The destructor destroys %HE global object. After calling of this function you may \b NOT
+            use CDS data structures based on \p %cds::gc::HE.
+            Usually, %HE object is destroyed at the end of your \p main().
+        */
+        ~HE()
+        {
+            he::GarbageCollector::Destruct();
+        }
+
+        /// Checks if count of guards is no less than \p nCountNeeded
+        /**
+            The function always returns \p true since the guard count is unlimited for
+            \p %gc::HE garbage collector.
+        */
+        static CDS_CONSTEXPR bool check_available_guards(
+#ifdef CDS_DOXYGEN_INVOKED
+            size_t nCountNeeded,
+#else
+            size_t,
+#endif
+            bool /*bRaiseException*/ = true )
+        {
+            return true;
+        }
+
+        /// Retire pointer \p p with function \p pFunc
+        /**
+            The function places pointer \p p to thread's array of retired pointers.
+            The birth era of \p p is unknown, so \p p is blocked by any guard
+            that has published an era not greater than the retire era of \p p.
+            Deleting the pointer is the function \p pFunc call.
+        */
+        template <typename T>
+        static void retire( T * p, void (* pFunc)(T *) );   // inline in he_impl.h
+
+        /// Retire pointer \p p with functor of type \p Disposer
+        /**
+            The function places pointer \p p to thread's array of retired pointers.
+
+            See \p gc::HP::retire for \p Disposer requirements.
+        */
+        template <class Disposer, typename T>
+        static void retire( T * p );   // inline in he_impl.h
+
+        /// Retire pointer \p p born in era \p nBirthEra with functor of type \p Disposer
+        /**
+            \p nBirthEra is the value of \p current_era() got before \p p has been linked to the container.
+            See \p gc::HP::retire for \p Disposer requirements.
+        */
+        template <class Disposer, typename T>
+        static void retire( T * p, he::era_type nBirthEra );   // inline in he_impl.h
+
+        /// Retire pointer \p p born in era \p nBirthEra with function \p pFunc
+        /**
+            \p nBirthEra is the value of \p current_era() got before \p p has been linked to the container.
+            Deleting the pointer is the function \p pFunc call.
+        */
+        template <typename T>
+        static void retire( T * p, void (* pFunc)(T *), he::era_type nBirthEra );   // inline in he_impl.h
+
+        /// Retire the range <tt>[itFirst, itLast)</tt> of pointers with functor of type \p Disposer
+        /**
+            The value type of \p ForwardIterator is <tt>T *</tt>.
+            The scan threshold is checked once for the whole range.
+            The range is walked once, so \p ForwardIterator may be a single-pass input iterator.
+
+            See \p gc::HP::retire for \p Disposer requirements.
+        */
+        template <class Disposer, typename ForwardIterator>
+        static void retire( ForwardIterator itFirst, ForwardIterator itLast );   // inline in he_impl.h
+
+        /// Retire the range <tt>[itFirst, itLast)</tt> of pointers with known birth eras
+        /**
+            The value type of \p ForwardIterator is <tt>T *</tt>. The functor \p fBirthEra
+            has the signature <tt>he::era_type operator()( T * p )</tt> and returns the birth era of \p p,
+            see \p retire( T *, he::era_type ).
+            The range is walked once, so \p ForwardIterator may be a single-pass input iterator.
+
+            See \p gc::HP::retire for \p Disposer requirements.
+        */
+        template <class Disposer, typename ForwardIterator, typename BirthEra>
+        static void retire( ForwardIterator itFirst, ForwardIterator itLast, BirthEra fBirthEra );   // inline in he_impl.h
+
+        /// Returns current value of the era clock
+        /**
+            The function is used by the containers to stamp the birth era of a node
+            before linking it, see \p retire( T *, he::era_type ).
+        */
+        static he::era_type current_era()
+        {
+            return he::GarbageCollector::current_era();
+        }
+
+        /// Checks if %HE GC is constructed and may be used
+        static bool isUsed()
+        {
+            return he::GarbageCollector::isUsed();
+        }
+
+        /// Forced GC cycle call for current thread
+        /**
+            Usually, this function should not be called directly.
+            The function frees the retired pointers of current thread that are not protected.
+        */
+        static void scan()  ;   // inline in he_impl.h
+
+        /// Synonym for \ref scan()
+        static void force_dispose()
+        {
+            scan();
+        }
+    };
+
+}} // namespace cds::gc
+
+#endif // #ifndef CDSLIB_GC_IMPL_HE_DECL_H
@@ -0,0 +1,107 @@
+//$$CDS-header$$
+
+#ifndef CDSLIB_GC_IMPL_HE_IMPL_H
+#define CDSLIB_GC_IMPL_HE_IMPL_H
+
+#include <cds/threading/model.h>
+
+//@cond
+namespace cds { namespace gc {
+
+    namespace he {
+
+        inline Guard::Guard()
+        {
+            cds::threading::getGC<HE>().allocGuard( *this );
+        }
+
+        inline Guard::~Guard()
+        {
+            cds::threading::getGC<HE>().freeGuard( *this );
+        }
+
+        template <size_t Count>
+        inline GuardArray<Count>::GuardArray()
+        {
+            cds::threading::getGC<HE>().allocGuard( *this );
+        }
+
+        template <size_t Count>
+        inline GuardArray<Count>::~GuardArray()
+        {
+            cds::threading::getGC<HE>().freeGuard( *this );
+        }
+    } // namespace he
+
+
+    inline HE::thread_gc::thread_gc(
+        bool    bPersistent
+        )
+        : m_bPersistent( bPersistent )
+    {
+        if ( !cds::threading::Manager::isThreadAttached() )
+            cds::threading::Manager::attachThread();
+    }
+
+    inline HE::thread_gc::~thread_gc()
+    {
+        if ( !m_bPersistent )
+            cds::threading::Manager::detachThread();
+    }
+
+    inline /*static*/ void HE::thread_gc::alloc_guard( cds::gc::he::details::guard& g )
+    {
+        return cds::threading::getGC<HE>().allocGuard(g);
+    }
+    inline /*static*/ void HE::thread_gc::free_guard( cds::gc::he::details::guard& g )
+    {
+        cds::threading::getGC<HE>().freeGuard(g);
+    }
+
+    template <typename T>
+    inline void HE::retire( T * p, void (* pFunc)(T *) )
+    {
+        cds::threading::getGC<HE>().retirePtr( p, pFunc );
+    }
+
+    template <class Disposer, typename T>
+    inline void HE::retire( T * p )
+    {
+        cds::threading::getGC<HE>().retirePtr( p, cds::details::static_functor<Disposer, T>::call );
+    }
+
+    template <class Disposer, typename T>
+    inline void HE::retire( T * p, he::era_type nBirthEra )
+    {
+        cds::threading::getGC<HE>().retirePtr( p, cds::details::static_functor<Disposer, T>::call, nBirthEra );
+    }
+
+    template <typename T>
+    inline void HE::retire( T * p, void (* pFunc)(T *), he::era_type nBirthEra )
+    {
+        cds::threading::getGC<HE>().retirePtr( p, pFunc, nBirthEra );
+    }
+
+    template <class Disposer, typename ForwardIterator>
+    inline void HE::retire( ForwardIterator itFirst, ForwardIterator itLast )
+    {
+        typedef typename std::remove_pointer< typename std::iterator_traits<ForwardIterator>::value_type >::type value_type;
+        cds::threading::getGC<HE>().retirePtr( itFirst, itLast, cds::details::static_functor<Disposer, value_type>::call, he::details::unknown_birth_era() );
+    }
+
+    template <class Disposer, typename ForwardIterator, typename BirthEra>
+    inline void HE::retire( ForwardIterator itFirst, ForwardIterator itLast, BirthEra fBirthEra )
+    {
+        typedef typename std::remove_pointer< typename std::iterator_traits<ForwardIterator>::value_type >::type value_type;
+        cds::threading::getGC<HE>().retirePtr( itFirst, itLast, cds::details::static_functor<Disposer, value_type>::call, fBirthEra );
+    }
+
+    inline void HE::scan()
+    {
+        cds::threading::getGC<HE>().scan();
+    }
+
+}} // namespace cds::gc
+//@endcond
+
+#endif // #ifndef CDSLIB_GC_IMPL_HE_IMPL_H
@@ -3,7 +3,7 @@
 #ifndef CDSLIB_GC_IMPL_HP_DECL_H
 #define CDSLIB_GC_IMPL_HP_DECL_H
 
-#include <stdexcept>    // overflow_error
+#include <iterator>
 #include <cds/gc/details/hp.h>
 #include <cds/details/marked_ptr.h>
 
@@ -140,6 +140,7 @@ namespace cds { namespace gc {
                 T pRet;
                 do {
                     pRet = assign( pCur );
+                    hp::GarbageCollector::publish_fence();
                     pCur = toGuard.load(atomics::memory_order_acquire);
                 } while ( pRet != pCur );
                 return pCur;
@@ -170,6 +171,7 @@ namespace cds { namespace gc {
                 do {
                     pRet = pCur;
                     assign( f( pCur ) );
+                    hp::GarbageCollector::publish_fence();
                     pCur = toGuard.load(atomics::memory_order_acquire);
                 } while ( pRet != pCur );
                 return pCur;
@@ -277,6 +279,7 @@ namespace cds { namespace gc {
                 T pRet;
                 do {
                     pRet = assign( nIndex, toGuard.load(atomics::memory_order_relaxed) );
+                    hp::GarbageCollector::publish_fence();
                 } while ( pRet != toGuard.load(atomics::memory_order_acquire));
 
                 return pRet;
@@ -305,6 +308,7 @@ namespace cds { namespace gc {
                 T pRet;
                 do {
                     assign( nIndex, f( pRet = toGuard.load(atomics::memory_order_relaxed) ));
+                    hp::GarbageCollector::publish_fence();
                 } while ( pRet != toGuard.load(atomics::memory_order_acquire));
 
                 return pRet;
@@ -570,7 +574,8 @@ namespace cds { namespace gc {
         /// \p scan() type
         enum class scan_type {
             classic = hp::classic,    ///< classic scan as described in Michael's papers
-            inplace = hp::inplace     ///< inplace scan without allocation
+            inplace = hp::inplace,    ///< inplace scan without allocation
+            hashed = hp::hashed       ///< scan using hash table of hazard pointers with vectorized search
         };
         /// Initializes %HP singleton
         /**
@@ -578,26 +583,47 @@ namespace cds { namespace gc {
             If GC instance is not exist then the function creates the instance.
             Otherwise it does nothing.
 
-            The Michael's %HP reclamation schema depends of three parameters:
-            - \p nHazardPtrCount - hazard pointer count per thread. Usually it is small number (up to 10) depending from
+            The count of threads and the count of hazard pointers per thread are not limited:
+            the hazard pointer array and the retired pointer array of each thread grow on demand.
+            The Michael's %HP reclamation schema depends of the following parameters:
+            - \p nHazardPtrCount - initial hazard pointer count per thread. The hazard pointer array of the thread
+                grows by blocks of \p nHazardPtrCount items. Usually it is small number (up to 10) depending from
                 the data structure algorithms. By default, if \p nHazardPtrCount = 0, the function
                 uses maximum of the hazard pointer count for CDS library.
-            - \p nMaxThreadCount - max count of thread with using Hazard Pointer GC in your application. Default is 100.
-            - \p nMaxRetiredPtrCount - capacity of array of retired pointers for each thread. Must be greater than
-                <tt> nHazardPtrCount * nMaxThreadCount </tt>. Default is <tt>2 * nHazardPtrCount * nMaxThreadCount </tt>.
+            - \p nMaxThreadCount - unused, kept for source compatibility. The thread count is not limited,
+                see deprecated \p max_thread_count().
+            - \p nMaxRetiredPtrCount - min scan threshold of the array of retired pointers for each thread.
+                The scan is started when the count of thread's retired pointers reaches the threshold;
+                the threshold is adjusted to be at least twice of the count of hazard pointers in use. Default is 256.
+            - \p bAsymmetricFence - if \p true, \p Guard::protect() uses a compiler-only barrier instead of
+                the full memory fence, and \p scan() issues the process-wide memory barrier (Linux \p membarrier(2)).
+                It is profitable for read-mostly workloads. If the process-wide barrier is not supported,
+                the full fence mode is used, see \p is_asymmetric_fence().
+            - \p bBackgroundReclaim - if \p true, a dedicated reclamation thread is started. The thread
+                which retired array is full does not scan it, instead, it hands off the retired pointers to
+                the reclamation thread that scans and frees them. It removes the scan stalls from worker threads.
+                The retire call and the explicit \p scan() are not changed. The reclamation thread calls the disposers,
+                so it is attached to \p cds::threading::Manager like an ordinary thread when the GC is constructed;
+                thus the disposers may use the GCs and RCUs constructed before this GC. The thread is offline for QSBR RCU.
         */
         HP(
-            size_t nHazardPtrCount = 0,     ///< Hazard pointer count per thread
-            size_t nMaxThreadCount = 0,     ///< Max count of simultaneous working thread in your application
-            size_t nMaxRetiredPtrCount = 0, ///< Capacity of the array of retired objects for the thread
-            scan_type nScanType = scan_type::inplace   ///< Scan type (see \p scan_type enum)
+            size_t nHazardPtrCount = 0,     ///< Initial hazard pointer count per thread
+            size_t nMaxThreadCount = 0,     ///< Unused, kept for compatibility
+            size_t nMaxRetiredPtrCount = 0, ///< Min scan threshold of the array of retired objects for the thread
+            scan_type nScanType = scan_type::inplace,   ///< Scan type (see \p scan_type enum)
+            bool bAsymmetricFence = false,  ///< Use asymmetric fence mode
+            bool bBackgroundReclaim = false ///< Use background reclamation thread
         )
         {
             hp::GarbageCollector::Construct(
                 nHazardPtrCount,
                 nMaxThreadCount,
                 nMaxRetiredPtrCount,
-                static_cast<hp::scan_type>(nScanType)
+                static_cast<hp::scan_type>(nScanType),
+                bAsymmetricFence,
+                bBackgroundReclaim,
+                &attach_reclaimer_thread,
+                &detach_reclaimer_thread
             );
         }
 
@@ -614,36 +640,53 @@ namespace cds { namespace gc {
 
         /// Checks if count of hazard pointer is no less than \p nCountNeeded
         /**
-            If \p bRaiseException is \p true (that is the default), the function raises
-            an \p std::overflow_error exception "Too few hazard pointers"
-            if \p nCountNeeded is more than the count of hazard pointer per thread.
+            The hazard pointer array of the thread grows on demand, so the function always returns \p true.
         */
-        static bool check_available_guards( size_t nCountNeeded, bool bRaiseException = true )
+        static CDS_CONSTEXPR bool check_available_guards(
+#ifdef CDS_DOXYGEN_INVOKED
+            size_t nCountNeeded,
+#else
+            size_t,
+#endif
+            bool /*bRaiseException*/ = true )
         {
-            if ( hp::GarbageCollector::instance().getHazardPointerCount() < nCountNeeded ) {
-                if ( bRaiseException )
-                    throw std::overflow_error( "Too few hazard pointers" );
-                return false;
-            }
             return true;
         }
 
-        /// Returns max Hazard Pointer count
+        /// Returns initial Hazard Pointer count per thread
         static size_t max_hazard_count()
         {
             return hp::GarbageCollector::instance().getHazardPointerCount();
         }
 
-        /// Returns max count of thread
+        /// Returns the count of allocated HP records
+        /**
+            Deprecated: the count of threads is not limited. The function returns the current count
+            of HP records, that is, the max count of simultaneously attached threads so far.
+        */
+        CDS_DEPRECATED( "thread count is not limited" )
         static size_t max_thread_count()
         {
-            return hp::GarbageCollector::instance().getMaxThreadCount();
+            hp::GarbageCollector::InternalState stat;
+            return hp::GarbageCollector::instance().getInternalState( stat ).nHPRecAllocated;
         }
 
-        /// Returns capacity of retired pointer array
+        /// Returns min scan threshold of retired pointer array
         static size_t retired_array_capacity()
         {
-            return hp::GarbageCollector::instance().getMaxRetiredPtrCount();
+            return hp::GarbageCollector::instance().getRetiredThreshold();
+        }
+
+        /// Checks if asymmetric fence mode is used (see the ctor)
+        static bool is_asymmetric_fence()
+        {
+            return hp::GarbageCollector::isAsymmetricFence();
+        }
+
+        /// Checks if background reclamation thread is used (see the ctor)
+        static bool is_background_reclaim()
+        {
+            return hp::GarbageCollector::instance().isBackgroundReclaim();
         }
 
         /// Retire pointer \p p with function \p pFunc
@@ -707,6 +750,19 @@ namespace cds { namespace gc {
         template <class Disposer, typename T>
         static void retire( T * p );   // inline in hp_impl.h
 
+        /// Retire the range <tt>[itFirst, itLast)</tt> of pointers with functor of type \p Disposer
+        /**
+            The value type of \p ForwardIterator is <tt>T *</tt>, for example, the range may be an array of pointers.
+            The function appends all pointers of the range to the thread's retired array and checks
+            the scan threshold once, so at most one \p scan() is called. It is cheaper than calling \p retire()
+            for each pointer when a container frees many nodes at once, for example, in \p clear().
+            The range is walked once, so \p ForwardIterator may be a single-pass input iterator.
+
+            See \p retire() for \p Disposer requirements.
+        */
+        template <class Disposer, typename ForwardIterator>
+        static void retire( ForwardIterator itFirst, ForwardIterator itLast );   // inline in hp_impl.h
+
         /// Get current scan strategy
         static scan_type getScanType()
         {
@@ -738,6 +794,24 @@ namespace cds { namespace gc {
         {
             scan();
         }
+
+        /// Returns reclamation telemetry
+        /**
+            The function fills \p st with the snapshot of always-on reclamation counters:
+            current and peak backlog of retired pointers, scan count and duration histogram,
+            count of pointers freed per scan. See \p cds::gc::reclaim_stat.
+        */
+        static cds::gc::reclaim_stat& statistics( cds::gc::reclaim_stat& st )
+        {
+            return hp::GarbageCollector::instance().getReclaimStat( st );
+        }
+
+    private:
+        //@cond
+        // Attach/detach hooks of background reclamation thread
+        static void attach_reclaimer_thread();  // inline in hp_impl.h
+        static void detach_reclaimer_thread();  // inline in hp_impl.h
+        //@endcond
     };
 }}  // namespace cds::gc
 
@@ -57,6 +57,17 @@ namespace cds { namespace gc {
             cds::threading::Manager::detachThread();
     }
 
+    inline /*static*/ void HP::attach_reclaimer_thread()
+    {
+        cds::threading::Manager::attachThread();
+        cds::threading::Manager::thread_data()->qsbr_offline();
+    }
+
+    inline /*static*/ void HP::detach_reclaimer_thread()
+    {
+        cds::threading::Manager::detachThread();
+    }
+
     inline /*static*/ cds::gc::hp::details::hp_guard& HP::thread_gc::alloc_guard()
     {
         return cds::threading::getGC<HP>().allocGuard();
@@ -79,6 +90,13 @@ namespace cds { namespace gc {
         cds::threading::getGC<HP>().retirePtr( p, cds::details::static_functor<Disposer, T>::call );
     }
 
+    template <class Disposer, typename ForwardIterator>
+    inline void HP::retire( ForwardIterator itFirst, ForwardIterator itLast )
+    {
+        typedef typename std::remove_pointer< typename std::iterator_traits<ForwardIterator>::value_type >::type value_type;
+        cds::threading::getGC<HP>().retirePtr( itFirst, itLast, cds::details::static_functor<Disposer, value_type>::call );
+    }
+
     inline void HP::scan()
     {
         cds::threading::getGC<HP>().scan();
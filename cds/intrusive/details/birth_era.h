@@ -0,0 +1,101 @@
+//$$CDS-header$$
+
+#ifndef CDSLIB_INTRUSIVE_DETAILS_BIRTH_ERA_H
+#define CDSLIB_INTRUSIVE_DETAILS_BIRTH_ERA_H
+
+#include <cstdint>
+#include <cds/details/defs.h>
+
+//@cond
+namespace cds { namespace gc {
+    class HE;
+}} // namespace cds::gc
+
+namespace cds { namespace intrusive { namespace details {
+
+    // Birth era of a node. Only gc::HE needs it, for other GCs the base is empty
+    template <class GC>
+    struct birth_era_base
+    {};
+
+    template <>
+    struct birth_era_base< cds::gc::HE >
+    {
+        typedef cds::gc::HE era_gc;
+
+        uint64_t    m_nBirthEra;    // era when the node has been linked to the container, 0 - unknown
+
+        CDS_CONSTEXPR birth_era_base() CDS_NOEXCEPT
+            : m_nBirthEra( 0 )
+        {}
+    };
+
+    // Stamps the birth era of a node before linking and passes it to the GC on retiring.
+    // Node must be derived from birth_era_base<GC>
+    template <class GC, typename Node>
+    struct birth_era {
+        static void stamp( Node * /*pNode*/ ) CDS_NOEXCEPT
+        {}
+
+        template <typename T>
+        static void retire( Node * /*pNode*/, T * p, void (* pFunc)(T *) )
+        {
+            GC::retire( p, pFunc );
+        }
+
+        template <class Disposer, typename T>
+        static void retire( Node * /*pNode*/, T * p )
+        {
+            GC::template retire<Disposer>( p );
+        }
+
+        // Range retire, fNode( p ) returns the node of the pointer p got from the range.
+        // The range is walked once, so a single-pass iterator is allowed
+        template <class Disposer, typename ForwardIterator, typename NodeOf>
+        static void retire( ForwardIterator itFirst, ForwardIterator itLast, NodeOf /*fNode*/ )
+        {
+            GC::template retire<Disposer>( itFirst, itLast );
+        }
+    };
+
+    template <typename Node>
+    struct birth_era< cds::gc::HE, Node > {
+        template <typename NodeOf>
+        struct era_of {
+            NodeOf  m_fNode;
+
+            template <typename T>
+            uint64_t operator()( T * p ) const
+            {
+                return m_fNode( p )->m_nBirthEra;
+            }
+        };
+
+        static void stamp( Node * pNode ) CDS_NOEXCEPT
+        {
+            pNode->m_nBirthEra = Node::era_gc::current_era();
+        }
+
+        template <typename T>
+        static void retire( Node * pNode, T * p, void (* pFunc)(T *) )
+        {
+            Node::era_gc::retire( p, pFunc, pNode->m_nBirthEra );
+        }
+
+        template <class Disposer, typename T>
+        static void retire( Node * pNode, T * p )
+        {
+            Node::era_gc::template retire<Disposer>( p, pNode->m_nBirthEra );
+        }
+
+        template <class Disposer, typename ForwardIterator, typename NodeOf>
+        static void retire( ForwardIterator itFirst, ForwardIterator itLast, NodeOf fNode )
+        {
+            Node::era_gc::template retire<Disposer>( itFirst, itLast, era_of<NodeOf>{ fNode } );
+        }
+    };
+
+}}} // namespace cds::intrusive::details
+//@endcond
+
+#endif // #ifndef CDSLIB_INTRUSIVE_DETAILS_BIRTH_ERA_H
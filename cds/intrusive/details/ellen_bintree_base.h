@@ -5,6 +5,7 @@
 
 #include <type_traits>
 #include <cds/intrusive/details/base.h>
+#include <cds/intrusive/details/birth_era.h>
 #include <cds/opt/options.h>
 #include <cds/urcu/options.h>
 #include <cds/details/marked_ptr.h>
@@ -30,11 +31,16 @@ namespace cds { namespace intrusive {
             - \p LeafNode - leaf node type, see \ref node
             - \p InternalNode - internal node type, see \ref internal_node
 
-            @note Size of update descriptor is constant.
-            It does not depends of template arguments.
+            @note Size of update descriptor is constant for given GC.
+            It does not depends of other template arguments.
+            For \p gc::HE the descriptor keeps the era when it has been published.
         */
         template <typename LeafNode, typename InternalNode>
-        struct update_desc {
+        struct update_desc
+#   ifndef CDS_DOXYGEN_INVOKED
+            : public cds::intrusive::details::birth_era_base< typename LeafNode::gc >
+#   endif
+        {
             //@cond
             typedef LeafNode        leaf_node;
             typedef InternalNode    internal_node;
@@ -134,7 +140,7 @@ namespace cds { namespace intrusive {
         };
 
         template <class GC>
-        struct base_node: public basic_node
+        struct base_node: public basic_node, public cds::intrusive::details::birth_era_base< GC >
         {
             typedef basic_node base_class;
 
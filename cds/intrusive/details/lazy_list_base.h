@@ -9,6 +9,7 @@
 #include <cds/details/make_const_type.h>
 #include <cds/sync/spinlock.h>
 #include <cds/urcu/options.h>
+#include <cds/intrusive/details/birth_era.h>
 
 namespace cds { namespace intrusive {
 
@@ -28,7 +29,7 @@ namespace cds { namespace intrusive {
             ,typename Lock =  cds::sync::spin
             ,typename Tag = opt::none
         >
-        struct node
+        struct node: public cds::intrusive::details::birth_era_base< GC >
         {
             typedef GC      gc          ;   ///< Garbage collector
             typedef Lock    lock_type   ;   ///< Lock type
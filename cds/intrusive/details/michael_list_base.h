@@ -9,6 +9,7 @@
 #include <cds/algo/atomic.h>
 #include <cds/details/marked_ptr.h>
 #include <cds/urcu/options.h>
+#include <cds/intrusive/details/birth_era.h>
 
 namespace cds { namespace intrusive {
 
@@ -23,7 +24,7 @@ namespace cds { namespace intrusive {
             - \p Tag - a \ref cds_intrusive_hook_tag "tag"
         */
         template <class GC, typename Tag = opt::none>
-        struct node
+        struct node: public cds::intrusive::details::birth_era_base< GC >
         {
             typedef GC              gc  ;   ///< Garbage collector
             typedef Tag             tag ;   ///< tag
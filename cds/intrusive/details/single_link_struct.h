@@ -6,6 +6,7 @@
 #include <cds/intrusive/details/base.h>
 #include <cds/gc/default_gc.h>
 #include <cds/algo/atomic.h>
+#include <cds/intrusive/details/birth_era.h>
 
 namespace cds { namespace intrusive {
 
@@ -21,7 +22,7 @@ namespace cds { namespace intrusive {
             - Tag - a tag used to distinguish between different implementation
         */
         template <class GC, typename Tag = opt::none>
-        struct node
+        struct node: public cds::intrusive::details::birth_era_base< GC >
         {
             typedef GC              gc  ;   ///< Garbage collector
             typedef Tag             tag ;   ///< tag
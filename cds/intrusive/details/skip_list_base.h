@@ -4,6 +4,7 @@
 #define CDSLIB_INTRUSIVE_DETAILS_SKIP_LIST_BASE_H
 
 #include <cds/intrusive/details/base.h>
+#include <cds/intrusive/details/birth_era.h>
 #include <cds/details/marked_ptr.h>
 #include <cds/algo/bitop.h>
 #include <cds/os/timer.h>
@@ -23,9 +24,15 @@ namespace cds { namespace intrusive {
             Template parameters:
             - \p GC - garbage collector
             - \p Tag - a \ref cds_intrusive_hook_tag "tag"
+
+            For \p gc::HE the node keeps the era when it has been linked to the list,
+            so the node retired can be freed even if a thread has published an earlier era.
         */
         template <class GC, typename Tag = opt::none>
         class node
+#   ifndef CDS_DOXYGEN_INVOKED
+            : public cds::intrusive::details::birth_era_base< GC >
+#   endif
         {
         public:
             typedef GC      gc;  ///< Garbage collector
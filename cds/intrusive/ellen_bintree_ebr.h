@@ -0,0 +1,9 @@
+//$$CDS-header$$
+
+#ifndef CDSLIB_INTRUSIVE_ELLEN_BINTREE_EBR_H
+#define CDSLIB_INTRUSIVE_ELLEN_BINTREE_EBR_H
+
+#include <cds/gc/ebr.h>
+#include <cds/intrusive/impl/ellen_bintree.h>
+
+#endif  // #ifndef CDSLIB_INTRUSIVE_ELLEN_BINTREE_EBR_H
@@ -0,0 +1,9 @@
+//$$CDS-header$$
+
+#ifndef CDSLIB_INTRUSIVE_ELLEN_BINTREE_HE_H
+#define CDSLIB_INTRUSIVE_ELLEN_BINTREE_HE_H
+
+#include <cds/gc/he.h>
+#include <cds/intrusive/impl/ellen_bintree.h>
+
+#endif  // #ifndef CDSLIB_INTRUSIVE_ELLEN_BINTREE_HE_H
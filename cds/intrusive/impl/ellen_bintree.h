@@ -257,26 +257,31 @@ namespace cds { namespace intrusive {
             cxx_update_desc_allocator().Delete( pDesc );
         }
 
+        template <typename Node>
+        using birth_era = cds::intrusive::details::birth_era< gc, Node >;
+
         void retire_node( tree_node * pNode ) const
         {
             if ( pNode->is_leaf() ) {
                 assert( static_cast<leaf_node *>( pNode ) != &m_LeafInf1 );
                 assert( static_cast<leaf_node *>( pNode ) != &m_LeafInf2 );
 
-                gc::template retire( node_traits::to_value_ptr( static_cast<leaf_node *>( pNode )), free_leaf_node );
+                leaf_node * pLeaf = static_cast<leaf_node *>( pNode );
+                birth_era< leaf_node >::retire( pLeaf, node_traits::to_value_ptr( pLeaf ), free_leaf_node );
             }
             else {
                 assert( static_cast<internal_node *>( pNode ) != &m_Root );
                 m_Stat.onInternalNodeDeleted();
 
-                gc::template retire( static_cast<internal_node *>( pNode ), free_internal_node );
+                internal_node * pInternal = static_cast<internal_node *>( pNode );
+                birth_era< internal_node >::retire( pInternal, pInternal, free_internal_node );
             }
         }
 
         void retire_update_desc( update_desc * p ) const
         {
             m_Stat.onUpdateDescDeleted();
-            gc::template retire( p, free_update_desc );
+            birth_era< update_desc >::retire( p, p, free_update_desc );
         }
 
         void make_empty_tree()
@@ -1260,6 +1265,11 @@ namespace cds { namespace intrusive {
                 pOp->iInfo.pLeaf = res.pLeaf;
                 pOp->iInfo.bRightLeaf = res.bRightLeaf;
 
+                // pNewInternal, pNewLeaf and pOp become reachable by the CAS below
+                birth_era< internal_node >::stamp( pNewInternal );
+                birth_era< leaf_node >::stamp( pNewLeaf );
+                birth_era< update_desc >::stamp( pOp );
+
                 update_ptr updCur( res.updParent.ptr() );
                 if ( res.pParent->m_pUpdate.compare_exchange_strong( updCur, update_ptr( pOp, update_desc::IFlag ),
                     memory_model::memory_order_acquire, atomics::memory_order_relaxed ) ) {
@@ -1306,6 +1316,7 @@ namespace cds { namespace intrusive {
                         pOp->dInfo.bRightParent = res.bRightParent;
                         pOp->dInfo.bRightLeaf = res.bRightLeaf;
 
+                        birth_era< update_desc >::stamp( pOp );
                         update_ptr updGP( res.updGrandParent.ptr() );
                         if ( res.pGrandParent->m_pUpdate.compare_exchange_strong( updGP, update_ptr( pOp, update_desc::DFlag ),
                             memory_model::memory_order_acquire, atomics::memory_order_relaxed ) ) {
@@ -1380,6 +1391,7 @@ namespace cds { namespace intrusive {
                         pOp->dInfo.bRightParent = res.bRightParent;
                         pOp->dInfo.bRightLeaf = res.bRightLeaf;
 
+                        birth_era< update_desc >::stamp( pOp );
                         update_ptr updGP( res.updGrandParent.ptr() );
                         if ( res.pGrandParent->m_pUpdate.compare_exchange_strong( updGP, update_ptr( pOp, update_desc::DFlag ),
                                 memory_model::memory_order_acquire, atomics::memory_order_relaxed ) )
@@ -1430,6 +1442,7 @@ namespace cds { namespace intrusive {
                         pOp->dInfo.bRightParent = res.bRightParent;
                         pOp->dInfo.bRightLeaf = res.bRightLeaf;
 
+                        birth_era< update_desc >::stamp( pOp );
                         update_ptr updGP( res.updGrandParent.ptr() );
                         if ( res.pGrandParent->m_pUpdate.compare_exchange_strong( updGP, update_ptr( pOp, update_desc::DFlag ),
                             memory_model::memory_order_acquire, atomics::memory_order_relaxed ))
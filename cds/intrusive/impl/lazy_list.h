@@ -260,6 +260,7 @@ namespace cds { namespace intrusive {
             assert( pPred->m_pNext.load(memory_model::memory_order_relaxed).ptr() == pCur );
 
             pNode->m_pNext.store( marked_node_ptr(pCur), memory_model::memory_order_release );
+            cds::intrusive::details::birth_era< gc, node_type >::stamp( pNode );
             pPred->m_pNext.store( marked_node_ptr(pNode), memory_model::memory_order_release );
         }
 
@@ -277,7 +278,7 @@ namespace cds { namespace intrusive {
         void retire_node( node_type * pNode )
         {
             assert( pNode != nullptr );
-            gc::template retire<clean_disposer>( node_traits::to_value_ptr( *pNode ) );
+            cds::intrusive::details::birth_era< gc, node_type >::template retire<clean_disposer>( pNode, node_traits::to_value_ptr( *pNode ) );
         }
         //@endcond
 
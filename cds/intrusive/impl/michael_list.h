@@ -234,7 +234,7 @@ namespace cds { namespace intrusive {
         static void retire_node( node_type * pNode )
         {
             assert( pNode != nullptr );
-            gc::template retire<clean_disposer>( node_traits::to_value_ptr( *pNode ) );
+            cds::intrusive::details::birth_era< gc, node_type >::template retire<clean_disposer>( pNode, node_traits::to_value_ptr( *pNode ) );
         }
 
         static bool link_node( node_type * pNode, position& pos )
@@ -244,6 +244,7 @@ namespace cds { namespace intrusive {
 
             marked_node_ptr cur(pos.pCur);
             pNode->m_pNext.store( cur, memory_model::memory_order_relaxed );
+            cds::intrusive::details::birth_era< gc, node_type >::stamp( pNode );
             return pos.pPrev->compare_exchange_strong( cur, marked_node_ptr(pNode), memory_model::memory_order_release, atomics::memory_order_relaxed );
         }
 
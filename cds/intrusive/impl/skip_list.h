@@ -427,6 +427,11 @@ namespace cds { namespace intrusive {
             disposer()( pVal );
         }
 
+        static void retire_node( node_type * pNode )
+        {
+            cds::intrusive::details::birth_era< gc, node_type >::retire( pNode, node_traits::to_value_ptr( pNode ), dispose_node );
+        }
+
         template <typename Q, typename Compare >
         bool find_position( Q const& val, position& pos, Compare cmp, bool bStopIfFound )
         {
@@ -469,7 +474,7 @@ namespace cds { namespace intrusive {
                             memory_model::memory_order_release, atomics::memory_order_relaxed ))
                         {
                             if ( nLevel == 0 ) {
-                                gc::retire( node_traits::to_value_ptr( pCur.ptr() ), dispose_node );
+                                retire_node( pCur.ptr() );
                                 m_Stat.onEraseWhileFind();
                             }
                         }
@@ -537,7 +542,7 @@ namespace cds { namespace intrusive {
                             memory_model::memory_order_release, atomics::memory_order_relaxed ))
                         {
                             if ( nLevel == 0 )
-                                gc::retire( node_traits::to_value_ptr( pCur.ptr() ), dispose_node );
+                                retire_node( pCur.ptr() );
                         }
                         goto retry;
                     }
@@ -591,7 +596,7 @@ namespace cds { namespace intrusive {
                             memory_model::memory_order_release, atomics::memory_order_relaxed ))
                         {
                             if ( nLevel == 0 )
-                                gc::retire( node_traits::to_value_ptr( pCur.ptr() ), dispose_node );
+                                retire_node( pCur.ptr() );
                         }
                         goto retry;
                     }
@@ -624,6 +629,7 @@ namespace cds { namespace intrusive {
             {
                 marked_node_ptr p( pos.pSucc[0] );
                 pNode->next( 0 ).store( p, memory_model::memory_order_release );
+                cds::intrusive::details::birth_era< gc, node_type >::stamp( pNode );
                 if ( !pos.pPrev[0]->next(0).compare_exchange_strong( p, marked_node_ptr(pNode), memory_model::memory_order_release, atomics::memory_order_relaxed ) ) {
                     return false;
                 }
@@ -701,7 +707,7 @@ namespace cds { namespace intrusive {
                     }
 
                     // Fast erasing success
-                    gc::retire( node_traits::to_value_ptr( pDel ), dispose_node );
+                    retire_node( pDel );
                     m_Stat.onFastErase();
                     return true;
                 }
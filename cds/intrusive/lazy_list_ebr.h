@@ -0,0 +1,9 @@
+//$$CDS-header$$
+
+#ifndef CDSLIB_INTRUSIVE_LAZY_LIST_EBR_H
+#define CDSLIB_INTRUSIVE_LAZY_LIST_EBR_H
+
+#include <cds/intrusive/impl/lazy_list.h>
+#include <cds/gc/ebr.h>
+
+#endif // #ifndef CDSLIB_INTRUSIVE_LAZY_LIST_EBR_H
@@ -0,0 +1,9 @@
+//$$CDS-header$$
+
+#ifndef CDSLIB_INTRUSIVE_MICHAEL_LIST_HE_H
+#define CDSLIB_INTRUSIVE_MICHAEL_LIST_HE_H
+
+#include <cds/intrusive/impl/michael_list.h>
+#include <cds/gc/he.h>
+
+#endif // #ifndef CDSLIB_INTRUSIVE_MICHAEL_LIST_HE_H
@@ -0,0 +1,9 @@
+//$$CDS-header$$
+
+#ifndef CDSLIB_INTRUSIVE_SKIP_LIST_HE_H
+#define CDSLIB_INTRUSIVE_SKIP_LIST_HE_H
+
+#include <cds/gc/he.h>
+#include <cds/intrusive/impl/skip_list.h>
+
+#endif // CDSLIB_INTRUSIVE_SKIP_LIST_HE_H
@@ -4,6 +4,7 @@
 #define CDSLIB_INTRUSIVE_TREIBER_STACK_H
 
 #include <type_traits>
+#include <iterator>     // forward_iterator_tag
 #include <mutex>        // unique_lock
 #include <cds/intrusive/details/single_link_struct.h>
 #include <cds/algo/elimination.h>
@@ -631,13 +632,63 @@ namespace cds { namespace intrusive {
 
     protected:
         //@cond
-        void clear_links( node_type * pNode ) CDS_NOEXCEPT
+        static void clear_links( node_type * pNode ) CDS_NOEXCEPT
         {
             pNode->m_pNext.store( nullptr, memory_model::memory_order_relaxed );
         }
 
         template <bool EnableElimination>
         struct elimination_backoff_impl;
+
+        // Single-pass iterator over the node list popped by clear(), yields the pointers to retire.
+        // clear_links() is called for the node when the iterator moves to the next node,
+        // so the list cannot be walked twice
+        class retire_iterator
+        {
+            node_type * m_pNode;
+        public:
+            typedef std::input_iterator_tag     iterator_category;
+            typedef T *                         value_type;
+            typedef std::ptrdiff_t              difference_type;
+            typedef value_type const *          pointer;
+            typedef value_type                  reference;
+
+            explicit retire_iterator( node_type * pNode = nullptr ) CDS_NOEXCEPT
+                : m_pNode( pNode )
+            {}
+
+            value_type operator*() const
+            {
+                assert( m_pNode != nullptr );
+                return node_traits::to_value_ptr( *m_pNode );
+            }
+
+            retire_iterator& operator++()
+            {
+                assert( m_pNode != nullptr );
+                node_type * pNext = m_pNode->m_pNext.load( memory_model::memory_order_relaxed );
+                clear_links( m_pNode );
+                m_pNode = pNext;
+                return *this;
+            }
+
+            bool operator ==( retire_iterator const& it ) const CDS_NOEXCEPT
+            {
+                return m_pNode == it.m_pNode;
+            }
+            bool operator !=( retire_iterator const& it ) const CDS_NOEXCEPT
+            {
+                return m_pNode != it.m_pNode;
+            }
+        };
+
+        // Maps the pointer yielded by retire_iterator to its node
+        struct value_to_node {
+            node_type * operator()( value_type * p ) const CDS_NOEXCEPT
+            {
+                return node_traits::to_node_ptr( p );
+            }
+        };
         //@endcond
 
     public:
@@ -674,6 +725,7 @@ namespace cds { namespace intrusive {
         {
             node_type * pNew = node_traits::to_node_ptr( val );
             link_checker::is_empty( pNew );
+            cds::intrusive::details::birth_era< gc, node_type >::stamp( pNew );
 
             m_Backoff.reset();
 
@@ -745,6 +797,7 @@ namespace cds { namespace intrusive {
         /// Clear the stack
         /** @anchor cds_intrusive_TreiberStack_clear
             For each removed item the disposer is called.
+            All removed items are retired at once by range \p gc::retire(), so at most one \p scan() is done.
 
             @note It is possible that after <tt>clear()</tt> the <tt>empty()</tt> returns \p false
             if some other thread pushes an item into the stack during \p clear works
@@ -764,12 +817,7 @@ namespace cds { namespace intrusive {
                 bkoff();
             }
 
-            while( pTop ) {
-                node_type * p = pTop;
-                pTop = p->m_pNext.load(memory_model::memory_order_relaxed);
-                clear_links( p );
-                gc::template retire<disposer>( node_traits::to_value_ptr( *p ) );
-            }
+            cds::intrusive::details::birth_era< gc, node_type >::template retire<disposer>( retire_iterator( pTop ), retire_iterator(), value_to_node() );
         }
 
         /// Returns stack's item count
@@ -217,6 +217,12 @@ namespace cds { namespace intrusive {
             return base_class::size();
         }
 
+        /// Returns approximate item count, see \p cds::container::VyukovMPMCCycleQueue::approx_size()
+        size_t approx_size() const
+        {
+            return base_class::approx_size();
+        }
+
         /// Returns capacity of the queue
         size_t capacity() const
         {
@@ -17,14 +17,22 @@
 
 #include <stdlib.h>
 #include <mutex>        // unique_lock
+#include <chrono>
+#include <thread>
+#include <condition_variable>
+#include <type_traits>
 #include <cds/init.h>
 #include <cds/memory/michael/options.h>
 #include <cds/memory/michael/bound_check.h>
 #include <cds/memory/michael/procheap_stat.h>
 #include <cds/memory/michael/osalloc_stat.h>
+#include <cds/memory/michael/thread_cache.h>
 
 #include <cds/os/topology.h>
 #include <cds/os/alloc_aligned.h>
+#include <cds/os/huge_page.h>
+#include <cds/os/numa_page.h>
+#include <cds/os/page_purge.h>
 #include <cds/sync/spinlock.h>
 #include <cds/details/type_padding.h>
 #include <cds/details/marked_ptr.h>
@@ -84,11 +92,67 @@ namespace michael {
         }
     };
 
+    /// %Heap that places memory on the NUMA node of the calling thread
+    /**
+        The heap maps page-aligned regions by \p cds::OS::numa_page: on Linux the region is mapped by \p mmap
+        and bound to the NUMA node of the current processor by \p cds::OS::topology::bind_to_local_node
+        (\p mbind with \p MPOL_PREFERRED policy) before it is touched.
+        If the binding fails, the memory is placed by first-touch policy of the OS
+        and the failure is counted by \p bind_failed_count().
+
+        The region is unmapped by its size, so the heap can be used only as the base heap of \p page_allocator
+        or \p page_cached_allocator that pass the page size to \p free().
+        Use it as a base heap of the page heap to get the superblocks of each processor heap from the processor's node:
+        \code
+        cds::memory::michael::Heap<
+            opt::page_heap< page_cached_allocator< 64, numa_local_heap > >
+        >   myNumaHeap;
+        \endcode
+        A processor heap is selected by the current processor and each processor descriptor has its own page heaps,
+        so the superblocks are allocated and cached on the node of the processor heap.
+        See \p procheap_atomic_stat::remoteFreeCount() to find out how often the blocks are freed on other node.
+    */
+    struct numa_local_heap
+    {
+        /// Allocates memory block of \p nSize bytes on the node of current processor
+        static void * alloc( size_t nSize )
+        {
+            return cds::OS::numa_page::alloc( nSize );
+        }
+
+        /// Frees memory block \p p of \p nSize bytes that has been previosly allocated by \ref alloc call
+        static void free( void * p, size_t nSize )
+        {
+            cds::OS::numa_page::free( p, nSize );
+        }
+
+        /// Count of memory blocks that could not be bound to the local node
+        static size_t bind_failed_count()
+        {
+            return cds::OS::numa_page::bind_failed_count();
+        }
+    };
+
+    //@cond
+    namespace details {
+        // Checks if the heap has free( p, nSize ) function
+        template <typename Heap>
+        struct has_sized_free
+        {
+            template <typename T> static char test( decltype( T::free( static_cast<void *>( nullptr ), size_t( 0 ))) * );
+            template <typename T> static int test( ... );
+            static CDS_CONSTEXPR const bool value = sizeof( test<Heap>( nullptr )) == sizeof(char);
+        };
+    } // namespace details
+    //@endcond
+
     /// Page heap based on \p Heap
     /**
         Page heap can allocate memory by page-sized block only.
         \p Heap may be any heap that provides interface like \ref malloc_heap.
 
+        If \p Heap has <tt>free( p, nSize )</tt> function (like \ref numa_local_heap), the page size is passed to it.
+
         This class is one of available implementation of opt::page_heap option.
     */
     template <class Heap = malloc_heap>
@@ -97,6 +161,16 @@ namespace michael {
         //@cond
         typedef Heap base_class;
         size_t  m_nPageSize;
+
+        void free_page( void * pPage, std::true_type )
+        {
+            base_class::free( pPage, m_nPageSize );
+        }
+
+        void free_page( void * pPage, std::false_type )
+        {
+            base_class::free( pPage );
+        }
         //@endcond
 
     public:
@@ -116,7 +190,7 @@ namespace michael {
         /// Free page \p pPage
         void free( void * pPage )
         {
-            base_class::free( pPage );
+            free_page( pPage, std::integral_constant< bool, details::has_sized_free< Heap >::value >() );
         }
     };
 
@@ -127,7 +201,8 @@ namespace michael {
 
         Template parameters:
             \li \p FreeListCapacity - capacity of free-list, default value is 64 page
-            \li \p Heap may be any heap that provides interface like \ref malloc_heap.
+            \li \p Heap may be any heap that provides interface like \ref malloc_heap,
+                for example, \ref numa_local_heap.
 
         This class is one of available implementation of opt::page_heap option.
     */
@@ -407,14 +482,639 @@ namespace michael {
             return false;
         }
 
-        /// Count of element in the list
-        size_t size() const
+        /// Count of element in the list
+        size_t size() const
+        {
+            auto_lock al( m_access );
+            return base_class::size();
+        }
+    };
+
+    //@cond
+    namespace details {
+        template <typename Tag>
+        struct lockfree_list_hook
+        {
+            atomics::atomic<lockfree_list_hook *> pNext;
+
+            lockfree_list_hook() CDS_NOEXCEPT
+                : pNext( nullptr )
+            {}
+        };
+
+        typedef lockfree_list_hook< free_list_tag >     free_list_lockfree_hook;
+        typedef lockfree_list_hook< partial_list_tag >  partial_list_lockfree_hook;
+
+        struct lockfree_superblock_desc: public free_list_lockfree_hook, partial_list_lockfree_hook
+        {};
+
+        // Lock-free intrusive stack (Treiber's stack) of items derived from Hook.
+        // The head is a pointer and ABA-prevention tag packed into 64bit word:
+        // 48 bits of the pointer and 16 bits of the tag for 64bit build, 32 and 32 bits for 32bit build.
+        // The items popped from the stack must not be freed while the stack is in use,
+        // that is true for superblock descriptors that are freed only by Heap destructor.
+        template <typename T, typename Hook>
+        class tagged_stack
+        {
+#if CDS_BUILD_BITS == 64
+            static const unsigned int c_nPtrBits = 48;
+#else
+            static const unsigned int c_nPtrBits = 32;
+#endif
+            static const uint64_t c_nPtrMask = (uint64_t(1) << c_nPtrBits) - 1;
+
+            atomics::atomic<uint64_t>   m_Head;
+            atomics::atomic<size_t>     m_nSize;
+
+            static Hook * ptr( uint64_t nHead )
+            {
+                return reinterpret_cast<Hook *>( static_cast<uintptr_t>( nHead & c_nPtrMask ));
+            }
+
+            // Packs p with the tag of nOldHead incremented
+            static uint64_t make_head( Hook * p, uint64_t nOldHead )
+            {
+                assert( ( static_cast<uint64_t>( reinterpret_cast<uintptr_t>( p )) & ~c_nPtrMask ) == 0 );
+                return static_cast<uint64_t>( reinterpret_cast<uintptr_t>( p )) | (( nOldHead & ~c_nPtrMask ) + c_nPtrMask + 1 );
+            }
+
+        public:
+            tagged_stack() CDS_NOEXCEPT
+                : m_Head( 0 )
+                , m_nSize( 0 )
+            {}
+
+            void push( T * pItem )
+            {
+                Hook * p = static_cast<Hook *>( pItem );
+                uint64_t nHead = m_Head.load( atomics::memory_order_relaxed );
+                do {
+                    p->pNext.store( ptr( nHead ), atomics::memory_order_relaxed );
+                } while ( !m_Head.compare_exchange_weak( nHead, make_head( p, nHead ), atomics::memory_order_release, atomics::memory_order_relaxed ));
+                m_nSize.fetch_add( 1, atomics::memory_order_relaxed );
+            }
+
+            T * pop()
+            {
+                uint64_t nHead = m_Head.load( atomics::memory_order_acquire );
+                for (;;) {
+                    Hook * p = ptr( nHead );
+                    if ( !p )
+                        return nullptr;
+                    // p may be popped and pushed again by other thread, in this case the tag is changed and CAS fails
+                    Hook * pNext = static_cast<Hook *>( p->pNext.load( atomics::memory_order_relaxed ));
+                    if ( m_Head.compare_exchange_weak( nHead, make_head( pNext, nHead ), atomics::memory_order_acquire, atomics::memory_order_acquire )) {
+                        m_nSize.fetch_sub( 1, atomics::memory_order_relaxed );
+                        return static_cast<T *>( p );
+                    }
+                }
+            }
+
+            size_t size() const
+            {
+                return m_nSize.load( atomics::memory_order_relaxed );
+            }
+        };
+    } // namespace details
+    //@endcond
+
+    /// Lock-free list of free superblock descriptors
+    /**
+        The list is a Treiber's stack with ABA-prevention tag packed into the head pointer;
+        the descriptors are never freed while the heap exists, so no safe memory reclamation is needed.
+        On 64bit platform the tag is 16 bits and the descriptor address must fit into 48 bits.
+
+        This class is a implementation of \ref opt::free_list option
+    */
+    template <class T = details::lockfree_superblock_desc>
+    class free_list_lockfree
+    {
+        //@cond
+        details::tagged_stack< T, details::free_list_lockfree_hook > m_Stack;
+    public:
+        typedef details::free_list_lockfree_hook item_hook;
+        //@endcond
+
+    public:
+        /// Rebinds to other item type \p T2
+        template <class T2>
+        struct rebind {
+            typedef free_list_lockfree<T2>    other   ;   ///< rebind result
+        };
+
+    public:
+        /// Push superblock descriptor to free-list
+        void push( T * pDesc )
+        {
+            m_Stack.push( pDesc );
+        }
+
+        /// Pop superblock descriptor from free-list
+        T *   pop()
+        {
+            return m_Stack.pop();
+        }
+
+        /// Returns current count of superblocks in free-list
+        size_t  size() const
+        {
+            return m_Stack.size();
+        }
+    };
+
+    /// Lock-free list of partial filled superblock descriptors
+    /**
+        The list is a Treiber's stack like \ref free_list_lockfree.
+        The stack cannot remove an item from the middle, so \p unlink() pops up to \p UnlinkDepth
+        descriptors looking for the descriptor to unlink and pushes the others back.
+        If the descriptor is not found, it stays in the list while it is empty;
+        the heap frees such superblock when it pops the descriptor from the list (as in M.Michael's original algorithm).
+
+        This class is a implementation of \ref opt::partial_list option
+    */
+    template <unsigned int UnlinkDepth = 4, class T = details::lockfree_superblock_desc>
+    class partial_list_lockfree
+    {
+        //@cond
+        details::tagged_stack< T, details::partial_list_lockfree_hook > m_Stack;
+    public:
+        typedef details::partial_list_lockfree_hook item_hook;
+        //@endcond
+
+    public:
+        /// Rebinds to other item type \p T2
+        template <class T2>
+        struct rebind {
+            typedef partial_list_lockfree<UnlinkDepth, T2>    other   ;   ///< rebind result
+        };
+
+    public:
+        /// Push a superblock \p pDesc to the list
+        void    push( T * pDesc )
+        {
+            m_Stack.push( pDesc );
+        }
+
+        /// Pop superblock from the list
+        T * pop()
+        {
+            return m_Stack.pop();
+        }
+
+        /// Removes \p pDesc descriptor from the list if it is found in top \p UnlinkDepth items
+        bool unlink( T * pDesc )
+        {
+            assert(pDesc != nullptr);
+            T * arrPopped[ UnlinkDepth ];
+            unsigned int nPopped = 0;
+            bool bFound = false;
+            while ( nPopped < UnlinkDepth ) {
+                T * p = m_Stack.pop();
+                if ( !p )
+                    break;
+                if ( p == pDesc ) {
+                    bFound = true;
+                    break;
+                }
+                arrPopped[ nPopped++ ] = p;
+            }
+            while ( nPopped > 0 )
+                m_Stack.push( arrPopped[ --nPopped ] );
+            return bFound;
+        }
+
+        /// Count of element in the list
+        size_t size() const
+        {
+            return m_Stack.size();
+        }
+    };
+
+    //@cond
+    namespace details {
+        struct huge_page_tag;
+        typedef lockfree_list_hook< huge_page_tag > huge_page_free_hook;
+
+        // Free page of huge_page_allocator, the hook is placed at the start of the page
+        struct huge_page_free_page: public huge_page_free_hook
+        {};
+    }
+    //@endcond
+
+    /// Page heap based on huge-page regions
+    /**
+        The page heap carves the pages out of the regions of \p RegionSize bytes (a multiple of 2M)
+        mapped by \p cds::OS::huge_page: the reserved huge pages (\p MAP_HUGETLB) are used if the system has them,
+        otherwise the region is advised to be backed by transparent huge pages (\p madvise( \p MADV_HUGEPAGE )).
+        A 1M superblock takes a half of a huge page, so the TLB covers the heap by much less entries.
+
+        The free pages are kept in lock-free stack and reused by the next \p alloc() call;
+        the regions are returned to the OS by the destructor only.
+        The regions are carved under a spin-lock that is taken only when the free stack is empty.
+
+        @note The \p Heap has a page heap for each page size in each processor heap descriptor,
+        so each of them maps at least one region of \p RegionSize (2M) bytes when it allocates its first page.
+        On a machine with many processors the heap maps \p RegionSize * (processor count) * (page size count) bytes
+        at least, and the reserved huge pages (see \p /proc/sys/vm/nr_hugepages) may be exhausted quickly;
+        then the regions are backed by transparent huge pages, see \p cds::OS::huge_page.
+
+        If the page heap is constructed by \p Heap, the size of mapped regions of each kind
+        (see \p cds::OS::huge_page::kind) is reported by \ref opt::os_allocated_stat,
+        see \p summary_stat::nHugeTLBBytes, \p summary_stat::nTransparentHugeBytes
+        and \p summary_stat::nRegularRegionBytes.
+
+        This class is one of available implementation of opt::page_heap option:
+        \code
+        cds::memory::michael::Heap<
+            opt::page_heap< huge_page_allocator<> >,
+            opt::os_allocated_stat< os_allocated_atomic >
+        >   myHugePageHeap;
+        \endcode
+    */
+    template <size_t RegionSize = cds::OS::huge_page::c_nSize>
+    class huge_page_allocator
+    {
+        //@cond
+        static_assert( RegionSize % cds::OS::huge_page::c_nSize == 0, "RegionSize must be a multiple of the huge page size" );
+
+        typedef cds::OS::huge_page::kind page_kind;
+
+        struct region {
+            region *    pNext;
+            void *      pAddr;
+            size_t      nSize;
+            page_kind   nKind;
+        };
+
+        typedef void (* stat_func)( void * pStat, size_t nSize, page_kind k, bool bMapped );
+
+        template <typename Stat>
+        static void update_stat( void * pStat, size_t nSize, page_kind k, bool bMapped )
+        {
+            if ( bMapped )
+                static_cast<Stat *>( pStat )->incHugeRegionBytes( nSize, k );
+            else
+                static_cast<Stat *>( pStat )->decHugeRegionBytes( nSize, k );
+        }
+
+        typedef std::unique_lock< cds::sync::spin > auto_lock;
+
+        size_t const    m_nPageSize     ;   // page size rounded up to cache line
+        size_t const    m_nRegionSize   ;   // size of mapped region
+        details::tagged_stack< details::huge_page_free_page, details::huge_page_free_hook > m_FreePages;
+
+        cds::sync::spin m_Lock          ;   // guards the fields below
+        region *        m_pRegions      ;   // list of mapped regions
+        uintptr_t       m_nNextPage     ;   // first not carved page of the last region
+        uintptr_t       m_nRegionEnd    ;   // end of the last region
+
+        void *          m_pStat         ;   // OS-allocated memory statistics of the heap, may be nullptr
+        stat_func       m_fnStat        ;
+
+        static size_t region_size( size_t nPageSize )
+        {
+            return nPageSize <= RegionSize ? RegionSize
+                : ( nPageSize + cds::OS::huge_page::c_nSize - 1 ) & ~( cds::OS::huge_page::c_nSize - 1 );
+        }
+
+        bool new_region()
+        {
+            region * pRegion = static_cast<region *>( ::malloc( sizeof(region)));
+            if ( !pRegion )
+                return false;
+            pRegion->nSize = m_nRegionSize;
+            pRegion->pAddr = cds::OS::huge_page::alloc( pRegion->nSize, pRegion->nKind );
+            if ( !pRegion->pAddr ) {
+                ::free( pRegion );
+                return false;
+            }
+            if ( m_pStat )
+                m_fnStat( m_pStat, pRegion->nSize, pRegion->nKind, true );
+
+            pRegion->pNext = m_pRegions;
+            m_pRegions = pRegion;
+            m_nNextPage = reinterpret_cast<uintptr_t>( pRegion->pAddr );
+            m_nRegionEnd = m_nNextPage + pRegion->nSize;
+            return true;
+        }
+        //@endcond
+
+    public:
+        /// Initializes heap
+        huge_page_allocator(
+            size_t nPageSize    ///< page size in bytes
+        )
+            : m_nPageSize( ( nPageSize + c_nCacheLineSize - 1 ) & ~( c_nCacheLineSize - 1 ))
+            , m_nRegionSize( region_size( m_nPageSize ))
+            , m_pRegions( nullptr )
+            , m_nNextPage( 0 )
+            , m_nRegionEnd( 0 )
+            , m_pStat( nullptr )
+            , m_fnStat( nullptr )
+        {}
+
+        /// Initializes heap that reports mapped regions to \p stat (an implementation of \ref opt::os_allocated_stat)
+        template <typename Stat>
+        huge_page_allocator(
+            size_t nPageSize,   ///< page size in bytes
+            Stat& stat          ///< statistics
+        )
+            : m_nPageSize( ( nPageSize + c_nCacheLineSize - 1 ) & ~( c_nCacheLineSize - 1 ))
+            , m_nRegionSize( region_size( m_nPageSize ))
+            , m_pRegions( nullptr )
+            , m_nNextPage( 0 )
+            , m_nRegionEnd( 0 )
+            , m_pStat( &stat )
+            , m_fnStat( &update_stat<Stat> )
+        {}
+
+        //@cond
+        ~huge_page_allocator()
+        {
+            region * pRegion = m_pRegions;
+            while ( pRegion ) {
+                region * pNext = pRegion->pNext;
+                if ( m_pStat )
+                    m_fnStat( m_pStat, pRegion->nSize, pRegion->nKind, false );
+                cds::OS::huge_page::free( pRegion->pAddr, pRegion->nSize );
+                ::free( pRegion );
+                pRegion = pNext;
+            }
+        }
+        //@endcond
+
+        /// Allocate new page
+        void * alloc()
+        {
+            void * pPage = m_FreePages.pop();
+            if ( pPage )
+                return pPage;
+
+            auto_lock al( m_Lock );
+            if ( m_nRegionEnd - m_nNextPage < m_nPageSize && !new_region() )
+                return nullptr;
+            pPage = reinterpret_cast<void *>( m_nNextPage );
+            m_nNextPage += m_nPageSize;
+            return pPage;
+        }
+
+        /// Free page \p pPage
+        void free( void * pPage )
+        {
+            m_FreePages.push( new( pPage ) details::huge_page_free_page );
+        }
+    };
+
+    /// Page heap that returns the physical memory of long unused pages to the OS
+    /**
+        The page heap caches up to \p Capacity free pages in front of \p PageHeap.
+        A cached page that is not reused during \p DecayMs milliseconds is purged by \p cds::OS::page_purge
+        (\p madvise( \p MADV_FREE ) or \p madvise( \p MADV_DONTNEED ) on Linux): the page stays allocated,
+        but its physical memory is returned to the OS. So, the resident set size of the process goes down
+        after a spike of allocations without the cost of unmapping the memory.
+        The most recently freed pages are reused first, the purged pages are reused when no other page is cached.
+
+        The purge runs incrementally: each \p alloc() and \p free() call purges up to \p MaxPurgeStep expired pages.
+        If the heap may stay idle, call \p purge() (or \p Heap::purge()) periodically, for example,
+        from \ref purge_thread.
+
+        Template parameters:
+            \li \p PageHeap - the underlying page heap, default is \ref page_allocator
+            \li \p DecayMs - the time in milliseconds after which an unused free page is purged
+            \li \p Capacity - max count of cached pages; the pages above the capacity are freed to \p PageHeap
+            \li \p MaxPurgeStep - max count of pages purged by \p alloc() and \p free() call
+
+        The first OS page of a cached page keeps the cache list header and it is not purged.
+        If the page heap is constructed by \p Heap, the purged bytes are reported by \ref opt::os_allocated_stat
+        (see \p summary_stat::nPurgedBytes).
+
+        This class is one of available implementation of opt::page_heap option:
+        \code
+        cds::memory::michael::Heap<
+            opt::page_heap< decaying_page_allocator< page_allocator<>, 5000 > >
+        >   myHeap;
+        \endcode
+    */
+    template <class PageHeap = page_allocator<>, unsigned int DecayMs = 10000, size_t Capacity = 64, size_t MaxPurgeStep = 4>
+    class decaying_page_allocator
+    {
+        //@cond
+        static_assert( MaxPurgeStep > 0, "MaxPurgeStep must not be zero" );
+
+        typedef std::chrono::steady_clock clock_type;
+        typedef std::unique_lock< cds::sync::spin > auto_lock;
+
+        // Header at the start of a cached page
+        struct cached_page {
+            cached_page *           pPrev;
+            cached_page *           pNext;
+            clock_type::time_point  tmFree;
+        };
+
+        typedef void (* stat_func)( void * pStat, size_t nSize );
+
+        template <typename Stat>
+        static void update_stat( void * pStat, size_t nSize )
+        {
+            static_cast<Stat *>( pStat )->incPurgedBytes( nSize );
+        }
+
+        PageHeap        m_PageHeap;
+        size_t const    m_nPageSize;
+
+        cds::sync::spin m_Lock          ;   // guards the fields below
+        cached_page *   m_pDirtyHead    ;   // not purged pages, the most recently freed first
+        cached_page *   m_pDirtyTail    ;   // the oldest not purged page
+        cached_page *   m_pPurged       ;   // stack of purged pages linked by pNext
+        size_t          m_nCachedCount  ;   // count of cached pages
+
+        void *          m_pStat         ;   // OS-allocated memory statistics of the heap, may be nullptr
+        stat_func       m_fnStat        ;
+
+        template <typename Stat>
+        decaying_page_allocator( size_t nPageSize, Stat& stat, std::true_type )
+            : m_PageHeap( nPageSize, stat )
+            , m_nPageSize( nPageSize )
+            , m_pDirtyHead( nullptr )
+            , m_pDirtyTail( nullptr )
+            , m_pPurged( nullptr )
+            , m_nCachedCount( 0 )
+            , m_pStat( &stat )
+            , m_fnStat( &update_stat<Stat> )
+        {}
+
+        template <typename Stat>
+        decaying_page_allocator( size_t nPageSize, Stat& stat, std::false_type )
+            : m_PageHeap( nPageSize )
+            , m_nPageSize( nPageSize )
+            , m_pDirtyHead( nullptr )
+            , m_pDirtyTail( nullptr )
+            , m_pPurged( nullptr )
+            , m_nCachedCount( 0 )
+            , m_pStat( &stat )
+            , m_fnStat( &update_stat<Stat> )
+        {}
+
+        void unlink_dirty( cached_page * pPage )
+        {
+            if ( pPage->pPrev )
+                pPage->pPrev->pNext = pPage->pNext;
+            else
+                m_pDirtyHead = pPage->pNext;
+            if ( pPage->pNext )
+                pPage->pNext->pPrev = pPage->pPrev;
+            else
+                m_pDirtyTail = pPage->pPrev;
+        }
+
+        // Purges up to MaxPurgeStep pages expired at tmNow, returns the count of expired pages
+        size_t purge_step( clock_type::time_point tmNow )
+        {
+            cached_page * arrExpired[ MaxPurgeStep ];
+            size_t nExpired = 0;
+            {
+                auto_lock al( m_Lock );
+                while ( nExpired < MaxPurgeStep && m_pDirtyTail
+                    && tmNow - m_pDirtyTail->tmFree >= std::chrono::milliseconds( DecayMs ))
+                {
+                    cached_page * pPage = m_pDirtyTail;
+                    unlink_dirty( pPage );
+                    arrExpired[ nExpired++ ] = pPage;
+                }
+            }
+            if ( nExpired == 0 )
+                return 0;
+
+            // The system call is made out of the lock, the expired pages are not in any list meanwhile
+            size_t nPurgedBytes = 0;
+            for ( size_t i = 0; i < nExpired; ++i )
+                nPurgedBytes += cds::OS::page_purge::purge( arrExpired[i] + 1, m_nPageSize - sizeof(cached_page) );
+            if ( nPurgedBytes && m_pStat )
+                m_fnStat( m_pStat, nPurgedBytes );
+
+            auto_lock al( m_Lock );
+            for ( size_t i = 0; i < nExpired; ++i ) {
+                arrExpired[i]->pNext = m_pPurged;
+                m_pPurged = arrExpired[i];
+            }
+            return nExpired;
+        }
+        //@endcond
+
+    public:
+        /// Initializes heap
+        decaying_page_allocator(
+            size_t nPageSize    ///< page size in bytes
+        )
+            : m_PageHeap( nPageSize )
+            , m_nPageSize( nPageSize )
+            , m_pDirtyHead( nullptr )
+            , m_pDirtyTail( nullptr )
+            , m_pPurged( nullptr )
+            , m_nCachedCount( 0 )
+            , m_pStat( nullptr )
+            , m_fnStat( nullptr )
+        {
+            assert( nPageSize > sizeof(cached_page) );
+        }
+
+        /// Initializes heap that reports purged memory to \p stat (an implementation of \ref opt::os_allocated_stat)
+        /**
+            If \p PageHeap can be constructed with \p stat, \p stat is passed to \p PageHeap too.
+        */
+        template <typename Stat>
+        decaying_page_allocator(
+            size_t nPageSize,   ///< page size in bytes
+            Stat& stat          ///< statistics
+        )
+            : decaying_page_allocator( nPageSize, stat, std::integral_constant< bool, std::is_constructible< PageHeap, size_t, Stat& >::value >() )
+        {
+            assert( nPageSize > sizeof(cached_page) );
+        }
+
+        //@cond
+        ~decaying_page_allocator()
+        {
+            while ( m_pDirtyHead ) {
+                cached_page * pPage = m_pDirtyHead;
+                m_pDirtyHead = pPage->pNext;
+                m_PageHeap.free( pPage );
+            }
+            while ( m_pPurged ) {
+                cached_page * pPage = m_pPurged;
+                m_pPurged = pPage->pNext;
+                m_PageHeap.free( pPage );
+            }
+        }
+        //@endcond
+
+        /// Allocate new page
+        void * alloc()
+        {
+            cached_page * pPage = nullptr;
+            {
+                auto_lock al( m_Lock );
+                if ( m_pDirtyHead ) {
+                    pPage = m_pDirtyHead;
+                    unlink_dirty( pPage );
+                    --m_nCachedCount;
+                }
+                else if ( m_pPurged ) {
+                    pPage = m_pPurged;
+                    m_pPurged = pPage->pNext;
+                    --m_nCachedCount;
+                }
+            }
+            purge_step( clock_type::now() );
+            return pPage ? static_cast<void *>( pPage ) : m_PageHeap.alloc();
+        }
+
+        /// Free page \p pPage
+        void free( void * pPage )
+        {
+            clock_type::time_point const tmNow = clock_type::now();
+            {
+                auto_lock al( m_Lock );
+                if ( m_nCachedCount < Capacity ) {
+                    cached_page * p = static_cast<cached_page *>( pPage );
+                    p->tmFree = tmNow;
+                    p->pPrev = nullptr;
+                    p->pNext = m_pDirtyHead;
+                    if ( m_pDirtyHead )
+                        m_pDirtyHead->pPrev = p;
+                    else
+                        m_pDirtyTail = p;
+                    m_pDirtyHead = p;
+                    ++m_nCachedCount;
+                    pPage = nullptr;
+                }
+            }
+            if ( pPage )
+                m_PageHeap.free( pPage );
+            purge_step( tmNow );
+        }
+
+        /// Purges all cached pages that are not used for \p DecayMs milliseconds
+        void purge()
         {
-            auto_lock al( m_access );
-            return base_class::size();
+            clock_type::time_point const tmNow = clock_type::now();
+            while ( purge_step( tmNow ) == MaxPurgeStep );
         }
     };
 
+    //@cond
+    namespace details {
+        // Checks if the page heap has purge() function
+        template <typename PageHeap>
+        struct has_purge
+        {
+            template <typename T> static char test( decltype( &T::purge ));
+            template <typename T> static int test( ... );
+            static CDS_CONSTEXPR const bool value = sizeof( test<PageHeap>( nullptr )) == sizeof(char);
+        };
+    } // namespace details
+    //@endcond
+
     /// Summary processor heap statistics
     /**
         Summary heap statistics for use with Heap::summaryStat function.
@@ -425,6 +1125,7 @@ namespace michael {
         size_t      nAllocFromPartial   ;  ///< Event count of allocation from partial superblock
         size_t      nAllocFromNew       ;  ///< Event count of allocation from new superblock
         size_t      nFreeCount          ;  ///< Count of \p free function call
+        size_t      nRemoteFreeCount    ;  ///< Count of \p free function call on other NUMA node than the processor heap of the block
         size_t      nPageAllocCount     ;  ///< Count of page (superblock) allocated
         size_t      nPageDeallocCount   ;  ///< Count of page (superblock) deallocated
         size_t      nDescAllocCount     ;  ///< Count of superblock descriptors
@@ -436,6 +1137,10 @@ namespace michael {
         size_t      nSysFreeCount       ;  ///< Count of \p free and \p free_aligned function call (for large memory blocks that allocated directly from OS)
         atomic64u_t nSysBytesAllocated  ;  ///< Count of allocated bytes (for large memory blocks that allocated directly from OS)
         atomic64_t  nSysBytesDeallocated;  ///< Count of deallocated bytes (for large memory blocks that allocated directly from OS)
+        atomic64u_t nHugeTLBBytes       ;  ///< Size of mapped regions of \ref huge_page_allocator backed by reserved huge pages (\p MAP_HUGETLB)
+        atomic64u_t nTransparentHugeBytes; ///< Size of mapped regions of \ref huge_page_allocator advised to use transparent huge pages
+        atomic64u_t nRegularRegionBytes ;  ///< Size of mapped regions of \ref huge_page_allocator backed by regular pages
+        atomic64u_t nPurgedBytes        ;  ///< Count of bytes of free pages purged by \ref decaying_page_allocator
 
         // Internal contention indicators
         /// CAS failure counter for updating active field of active block of \p alloc_from_active Heap internal function
@@ -478,6 +1183,7 @@ namespace michael {
             nAllocFromPartial   -= stat.nAllocFromPartial;
             nAllocFromNew       -= stat.nAllocFromNew;
             nFreeCount          -= stat.nFreeCount;
+            nRemoteFreeCount    -= stat.nRemoteFreeCount;
             nPageAllocCount     -= stat.nPageAllocCount;
             nPageDeallocCount   -= stat.nPageDeallocCount;
             nDescAllocCount     -= stat.nDescAllocCount;
@@ -489,6 +1195,10 @@ namespace michael {
             nSysFreeCount       -= stat.nSysFreeCount;
             nSysBytesAllocated  -= stat.nSysBytesAllocated;
             nSysBytesDeallocated -= stat.nSysBytesDeallocated;
+            nHugeTLBBytes       -= stat.nHugeTLBBytes;
+            nTransparentHugeBytes -= stat.nTransparentHugeBytes;
+            nRegularRegionBytes -= stat.nRegularRegionBytes;
+            nPurgedBytes        -= stat.nPurgedBytes;
 
             nActiveDescCASFailureCount      -= stat.nActiveDescCASFailureCount;
             nActiveAnchorCASFailureCount    -= stat.nActiveAnchorCASFailureCount;
@@ -515,6 +1225,7 @@ namespace michael {
             nAllocFromPartial   += stat.allocFromPartial();
             nAllocFromNew       += stat.allocFromNew();
             nFreeCount          += stat.freeCount();
+            nRemoteFreeCount    += stat.remoteFreeCount();
             nPageAllocCount     += stat.blockAllocated();
             nPageDeallocCount   += stat.blockDeallocated();
             nDescAllocCount     += stat.descAllocCount();
@@ -539,6 +1250,11 @@ namespace michael {
             nSysBytesAllocated  += stat.allocatedBytes();
             nSysBytesDeallocated+= stat.deallocatedBytes();
 
+            nHugeTLBBytes       += stat.hugeRegionBytes( cds::OS::huge_page::hugetlb_pages );
+            nTransparentHugeBytes += stat.hugeRegionBytes( cds::OS::huge_page::transparent_pages );
+            nRegularRegionBytes += stat.hugeRegionBytes( cds::OS::huge_page::regular_pages );
+            nPurgedBytes        += stat.purgedBytes();
+
             return *this;
         }
         //@endcond
@@ -594,14 +1310,17 @@ namespace michael {
         - \ref opt::aligned_heap - option setter for a heap used for internal aligned memory management.
             Default is \ref aligned_malloc_heap
         - \ref opt::page_heap - option setter for a heap used for page (superblock) allocation of 64K/1M size.
-            Default is \ref page_cached_allocator
+            Default is \ref page_cached_allocator. Use <tt>page_cached_allocator< 64, numa_local_heap ></tt>
+            to allocate the superblocks of a processor heap on the NUMA node of the processor.
+            \ref huge_page_allocator places the superblocks in huge pages,
+            \ref decaying_page_allocator returns the memory of long unused superblocks to the OS (see \ref purge).
         - \ref opt::sizeclass_selector - option setter for a class used to select appropriate size-class
             for incoming allocation request.
             Default is \ref default_sizeclass_selector
         - \ref opt::free_list - option setter for a class to manage a list of free superblock descriptors
-            Default is \ref free_list_locked
+            Default is \ref free_list_locked, the lock-free alternative is \ref free_list_lockfree
         - \ref opt::partial_list - option setter for a class to manage a list of partial filled superblocks
-            Default is \ref partial_list_locked
+            Default is \ref partial_list_locked, the lock-free alternative is \ref partial_list_lockfree
         - \ref opt::procheap_stat - option setter for a class to gather internal statistics for memory allocation
             that is maintained by the heap.
             Default is \ref procheap_empty_stat
@@ -612,6 +1331,8 @@ namespace michael {
             Default is \ref os_allocated_empty
         - \ref opt::check_bounds - a bound checker.
             Default is no bound checker (cds::opt::none)
+        - \ref opt::thread_cache - capacity of thread-local cache of free blocks, for example, \ref thread_cache_capacity.
+            Default is no thread cache (cds::opt::none)
 
         \par Usage:
         The heap is the basic building block for your allocator or <tt> operator new</tt> implementation.
@@ -708,6 +1429,7 @@ namespace michael {
             typedef procheap_empty_stat         procheap_stat;
             typedef os_allocated_empty          os_allocated_stat;
             typedef cds::opt::none              check_bounds;
+            typedef cds::opt::none              thread_cache;
         };
         //@endcond
 
@@ -728,6 +1450,7 @@ namespace michael {
         typedef typename options::procheap_stat         procheap_stat       ;   ///< effective processor heap statistics
         typedef typename options::os_allocated_stat     os_allocated_stat   ;   ///< effective OS-allocated memory statistics
         typedef details::bound_checker_selector< typename options::check_bounds >    bound_checker   ;  ///< effective bound checker
+        typedef details::thread_cache_selector< typename options::thread_cache >     thread_cache    ;  ///< effective thread cache capacity
 
         // forward declarations
         //@cond
@@ -1080,6 +1803,7 @@ namespace michael {
             CDS_DATA_ALIGNMENT(8) atomics::atomic<active_tag> active;   ///< pointer to the descriptor of active superblock owned by processor heap
             processor_desc *    pProcDesc   ;   ///< pointer to parent processor descriptor
             const size_class *  pSizeClass  ;   ///< pointer to size class
+            unsigned int        nSizeClass  ;   ///< size class index
             atomics::atomic<superblock_desc *>   pPartial    ;   ///< pointer to partial filled superblock (may be \p nullptr)
             partial_list        partialList ;   ///< list of partial filled superblocks owned by the processor heap
             unsigned int        nPageIdx    ;   ///< page size-class index, \ref c_nPageSelfAllocation - "small page"
@@ -1099,6 +1823,7 @@ namespace michael {
             processor_heap_base() CDS_NOEXCEPT
                 : pProcDesc( nullptr )
                 , pSizeClass( nullptr )
+                , nSizeClass( 0 )
                 , pPartial( nullptr )
             {
                 assert( (reinterpret_cast<uintptr_t>(this) & (c_nAlignment - 1)) == 0 );
@@ -1149,11 +1874,13 @@ namespace michael {
             processor_heap *    arrProcHeap     ; ///< array of processor heap
             free_list           listSBDescFree  ; ///< List of free superblock descriptors
             page_heap *         pageHeaps       ; ///< array of page heap (one for each page size)
+            unsigned int        nNode           ; ///< NUMA node of the processor
 
             //@cond
             processor_desc()
                 : arrProcHeap( nullptr )
                 , pageHeaps( nullptr )
+                , nNode( 0 )
             {}
             //@endcond
         };
@@ -1170,6 +1897,25 @@ namespace michael {
 
         os_allocated_stat   m_OSAllocStat        ;  ///< OS-allocated memory statistics
 
+        //@cond
+        // Thread cache
+        struct thread_cache_bin {
+            block_header *  pHead       ;   // stack of cached blocks linked by the word after block header
+            unsigned int    nCount      ;   // count of cached blocks
+            unsigned int    nCapacity   ;   // max count of cached blocks, 0 - the size-class is not cached
+        };
+
+        struct thread_cache_record {
+            thread_cache_record *   pNext   ;   // next record of the heap
+            atomics::atomic<bool>   bFree   ;   // the record is not owned by any thread
+            thread_cache_bin *      arrBin  ;   // bins for each size-class
+        };
+
+        unsigned long long  m_nHeapId            ;  // unique heap id for thread cache
+        unsigned int        m_nCacheSlot         ;  // thread cache slot, details::c_nMaxThreadCacheHeaps - no thread cache
+        atomics::atomic<thread_cache_record *> m_pCacheRecords; // list of thread cache records
+        //@endcond
+
     protected:
         //@cond
 
@@ -1417,10 +2163,38 @@ namespace michael {
             pDesc->pProcHeap->add_partial( pDesc );
         }
 
+        /// Constructs the page heap that accepts OS-allocated memory statistics (see \ref huge_page_allocator)
+        void construct_page_heap( page_heap * pPageHeap, size_t nPageSize, std::true_type )
+        {
+            new (pPageHeap) page_heap( nPageSize, m_OSAllocStat );
+        }
+
+        /// Constructs the page heap
+        void construct_page_heap( page_heap * pPageHeap, size_t nPageSize, std::false_type )
+        {
+            new (pPageHeap) page_heap( nPageSize );
+        }
+
+        /// Purges the page heaps of each processor
+        void purge_page_heaps( std::true_type )
+        {
+            size_t const nPageHeapCount = m_SizeClassSelector.pageTypeCount();
+            for ( unsigned int nProcessor = 0; nProcessor < m_nProcessorCount; ++nProcessor ) {
+                processor_desc * pProcDesc = m_arrProcDesc[nProcessor].load( atomics::memory_order_acquire );
+                if ( pProcDesc ) {
+                    for ( size_t i = 0; i < nPageHeapCount; ++i )
+                        pProcDesc->pageHeaps[i].purge();
+                }
+            }
+        }
+
+        /// The page heap cannot purge
+        void purge_page_heaps( std::false_type )
+        {}
+
         /// Allocates new processor descriptor
         processor_desc * new_processor_desc( unsigned int nProcessorId )
         {
-            CDS_UNUSED( nProcessorId );
             processor_desc * pDesc;
             const size_t nPageHeapCount = m_SizeClassSelector.pageTypeCount();
 
@@ -1451,10 +2225,12 @@ namespace michael {
             static_assert( (sizeof(processor_heap) % c_nAlignment) == 0, "sizeof(processor_heap) error" );
 
             pDesc = new( m_AlignedHeap.alloc( szTotal, c_nAlignment ) ) processor_desc;
+            pDesc->nNode = m_Topology.processor_node( nProcessorId );
 
             pDesc->pageHeaps = reinterpret_cast<page_heap *>( pDesc + 1 );
             for ( size_t i = 0; i < nPageHeapCount; ++i )
-                new (pDesc->pageHeaps + i) page_heap( m_SizeClassSelector.page_size(i));
+                construct_page_heap( pDesc->pageHeaps + i, m_SizeClassSelector.page_size(i),
+                    std::integral_constant< bool, std::is_constructible< page_heap, size_t, os_allocated_stat& >::value >() );
 
             // initialize processor heaps
             pDesc->arrProcHeap =
@@ -1469,6 +2245,7 @@ namespace michael {
                 new (pProcHeap) processor_heap();
                 pProcHeap->pProcDesc = pDesc;
                 pProcHeap->pSizeClass = m_SizeClassSelector.at(i);
+                pProcHeap->nSizeClass = i;
                 if ( m_SizeClassSelector.find( pProcHeap->pSizeClass->nSBSize ) != sizeclass_selector::c_nNoSizeClass )
                     pProcHeap->nPageIdx = processor_heap::c_nPageSelfAllocation;
                 else
@@ -1600,6 +2377,267 @@ namespace michael {
             pProcDesc->listSBDescFree.push( pDesc );
         }
 
+        /// Returns block \p pBlock to its superblock \p pDesc
+        void free_block( superblock_desc * pDesc, block_header * pBlock )
+        {
+            anchor_tag oldAnchor;
+            anchor_tag newAnchor;
+            processor_heap_base * pProcHeap = pDesc->pProcHeap;
+
+            pProcHeap->stat.incDeallocatedBytes( pDesc->nBlockSize );
+
+            oldAnchor = pDesc->anchor.load(atomics::memory_order_acquire);
+            do {
+                newAnchor = oldAnchor;
+                reinterpret_cast<free_block_header *>( pBlock )->nNextFree = oldAnchor.avail;
+                newAnchor.avail = (reinterpret_cast<byte *>( pBlock ) - pDesc->pSB) / pDesc->nBlockSize;
+                newAnchor.tag += 1;
+
+                assert( oldAnchor.state != SBSTATE_EMPTY );
+
+                if ( oldAnchor.state == SBSTATE_FULL )
+                    newAnchor.state = SBSTATE_PARTIAL;
+
+                if ( oldAnchor.count == pDesc->nCapacity - 1 ) {
+                    //pProcHeap = pDesc->pProcHeap;
+                    //CDS_COMPILER_RW_BARRIER         ;   // instruction fence is needed?..
+                    newAnchor.state = SBSTATE_EMPTY;
+                }
+                else
+                    newAnchor.count += 1;
+            } while ( !pDesc->anchor.compare_exchange_strong( oldAnchor, newAnchor, atomics::memory_order_release, atomics::memory_order_relaxed ) );
+
+            pProcHeap->stat.incFreeCount();
+            if ( procheap_stat::c_bRemoteFreeStat && m_Topology.node_count() > 1
+                && m_Topology.current_node() != pProcHeap->pProcDesc->nNode )
+            {
+                pProcHeap->stat.incRemoteFreeCount();
+            }
+
+            if ( newAnchor.state == SBSTATE_EMPTY ) {
+                if ( pProcHeap->unlink_partial( pDesc ))
+                    free_superblock( pDesc );
+            }
+            else if (oldAnchor.state == SBSTATE_FULL ) {
+                assert( pProcHeap != nullptr );
+                pProcHeap->stat.decDescFull();
+                pProcHeap->add_partial( pDesc );
+            }
+        }
+
+        /// Pushes block \p pBlock to thread cache bin \p bin
+        static void push_cached_block( thread_cache_bin& bin, block_header * pBlock )
+        {
+            *reinterpret_cast<block_header **>( pBlock + 1 ) = bin.pHead;
+            bin.pHead = pBlock;
+            ++bin.nCount;
+        }
+
+        /// Pops a block from non-empty thread cache bin \p bin
+        static block_header * pop_cached_block( thread_cache_bin& bin )
+        {
+            assert( bin.nCount > 0 );
+            block_header * pBlock = bin.pHead;
+            bin.pHead = *reinterpret_cast<block_header **>( pBlock + 1 );
+            --bin.nCount;
+            return pBlock;
+        }
+
+        /// Reserves up to \p nMax blocks of the active superblock of \p pProcHeap and pushes them to thread cache bin \p bin
+        /**
+            The blocks are reserved by one CAS of \p active field and popped by one CAS of the superblock anchor.
+            Returns the count of blocks pushed, 0 if the processor heap has no active superblock.
+        */
+        unsigned int alloc_batch_from_active( processor_heap * pProcHeap, thread_cache_bin& bin, unsigned int nMax )
+        {
+            assert( nMax > 0 );
+
+            active_tag  oldActive;
+            unsigned int nCount;
+            int nCollision = -1;
+
+            // Reserve blocks: the active superblock has credits() + 1 blocks available for reservation
+            while ( true ) {
+                ++nCollision;
+                oldActive = pProcHeap->active.load(atomics::memory_order_acquire);
+                if ( !oldActive.ptr() )
+                    return 0;
+                unsigned int nCredits = oldActive.credits();
+                active_tag  newActive   ; // default = 0
+                if ( nCredits >= nMax ) {
+                    nCount = nMax;
+                    newActive = oldActive;
+                    newActive.credits( nCredits - nMax );
+                }
+                else
+                    nCount = nCredits + 1;
+                if ( pProcHeap->active.compare_exchange_strong( oldActive, newActive, atomics::memory_order_release, atomics::memory_order_relaxed ))
+                    break;
+            }
+
+            if ( nCollision )
+                pProcHeap->stat.incActiveDescCASFailureCount( nCollision );
+
+            // pop the blocks
+            superblock_desc * pDesc = oldActive.ptr();
+            bool const bLastCredit = nCount == oldActive.credits() + 1;
+
+            anchor_tag  oldAnchor;
+            anchor_tag  newAnchor;
+            unsigned int nMoreCredits = 0;
+
+            nCollision = -1;
+            while ( true ) {
+                ++nCollision;
+                newAnchor = oldAnchor = pDesc->anchor.load(atomics::memory_order_acquire);
+
+                unsigned int nAvail = oldAnchor.avail;
+                unsigned int i = 0;
+                for ( ; i < nCount && nAvail < pDesc->nCapacity; ++i )
+                    nAvail = reinterpret_cast<free_block_header *>( pDesc->pSB + nAvail * (unsigned long long) pDesc->nBlockSize )->nNextFree;
+                if ( i < nCount ) {
+                    // The free list has been changed by other thread while we walked through it
+                    continue;
+                }
+
+                newAnchor.avail = nAvail;
+                newAnchor.tag += 1;
+
+                if ( bLastCredit ) {
+                    // state must be ACTIVE
+                    if ( oldAnchor.count == 0 )
+                        newAnchor.state = SBSTATE_FULL;
+                    else {
+                        nMoreCredits = oldAnchor.count < active_tag::c_nMaxCredits ? ((unsigned int) oldAnchor.count) : active_tag::c_nMaxCredits;
+                        newAnchor.count -= nMoreCredits;
+                    }
+                }
+                if ( pDesc->anchor.compare_exchange_strong( oldAnchor, newAnchor, atomics::memory_order_release, atomics::memory_order_relaxed ))
+                    break;
+            }
+
+            if ( nCollision )
+                pProcHeap->stat.incActiveAnchorCASFailureCount( nCollision );
+
+            if ( newAnchor.state == SBSTATE_FULL )
+                pProcHeap->stat.incDescFull();
+            if ( bLastCredit && oldAnchor.count > 0 )
+                update_active( pProcHeap, pDesc, nMoreCredits );
+
+            pProcHeap->stat.incAllocFromActive( nCount );
+
+            // The popped blocks are owned by current thread now
+            unsigned int nAvail = oldAnchor.avail;
+            for ( unsigned int i = 0; i < nCount; ++i ) {
+                byte * pAddr = pDesc->pSB + nAvail * (unsigned long long) pDesc->nBlockSize;
+                nAvail = reinterpret_cast<free_block_header *>( pAddr )->nNextFree;
+                assert( reinterpret_cast<block_header *>( pAddr )->desc() == pDesc );
+                push_cached_block( bin, reinterpret_cast<block_header *>( pAddr ));
+            }
+            return nCount;
+        }
+
+        /// Refills empty thread cache bin \p bin of size-class \p nSizeClassIndex by half of its capacity
+        bool refill_thread_cache( thread_cache_bin& bin, typename sizeclass_selector::sizeclass_index nSizeClassIndex )
+        {
+            unsigned int const nBatch = ( bin.nCapacity + 1 ) / 2;
+            while ( true ) {
+                processor_heap * pProcHeap = find_heap( nSizeClassIndex );
+                if ( !pProcHeap )
+                    return false;
+
+                unsigned int nCount = alloc_batch_from_active( pProcHeap, bin, nBatch );
+                if ( nCount == 0 ) {
+                    // No active superblock: the partial or new superblock becomes active
+                    block_header * pBlock = alloc_from_partial( pProcHeap );
+                    if ( !pBlock )
+                        pBlock = alloc_from_new_superblock( pProcHeap );
+                    if ( !pBlock )
+                        continue;
+                    push_cached_block( bin, pBlock );
+                    nCount = 1;
+                    if ( nBatch > 1 )
+                        nCount += alloc_batch_from_active( pProcHeap, bin, nBatch - 1 );
+                }
+
+                pProcHeap->stat.incAllocatedBytes( size_t( nCount ) * pProcHeap->pSizeClass->nBlockSize );
+                return true;
+            }
+        }
+
+        /// Returns up to \p nCount blocks of thread cache bin \p bin to the heap
+        void flush_thread_cache_bin( thread_cache_bin& bin, unsigned int nCount )
+        {
+            for ( ; nCount > 0 && bin.nCount > 0; --nCount ) {
+                block_header * pBlock = pop_cached_block( bin );
+                free_block( pBlock->desc(), pBlock );
+            }
+        }
+
+        /// Returns all blocks of thread cache record \p pRec to the heap
+        void flush_thread_cache_record( thread_cache_record * pRec )
+        {
+            size_t const nClassCount = m_SizeClassSelector.size();
+            for ( size_t i = 0; i < nClassCount; ++i )
+                flush_thread_cache_bin( pRec->arrBin[i], pRec->arrBin[i].nCount );
+        }
+
+        /// Finds free thread cache record or allocates new one
+        thread_cache_record * acquire_thread_cache_record()
+        {
+            for ( thread_cache_record * p = m_pCacheRecords.load( atomics::memory_order_acquire ); p; p = p->pNext ) {
+                bool bFree = true;
+                if ( p->bFree.load( atomics::memory_order_relaxed )
+                    && p->bFree.compare_exchange_strong( bFree, false, atomics::memory_order_acquire, atomics::memory_order_relaxed ))
+                {
+                    return p;
+                }
+            }
+
+            size_t const nClassCount = m_SizeClassSelector.size();
+            thread_cache_record * pRec = new( m_AlignedHeap.alloc( sizeof(thread_cache_record) + sizeof(thread_cache_bin) * nClassCount, c_nAlignment ))
+                thread_cache_record;
+            pRec->bFree.store( false, atomics::memory_order_relaxed );
+            pRec->arrBin = reinterpret_cast<thread_cache_bin *>( pRec + 1 );
+            for ( size_t i = 0; i < nClassCount; ++i ) {
+                pRec->arrBin[i].pHead = nullptr;
+                pRec->arrBin[i].nCount = 0;
+                pRec->arrBin[i].nCapacity = thread_cache::capacity( *m_SizeClassSelector.at( static_cast<typename sizeclass_selector::sizeclass_index>( i )));
+            }
+
+            thread_cache_record * pHead = m_pCacheRecords.load( atomics::memory_order_relaxed );
+            do {
+                pRec->pNext = pHead;
+            } while ( !m_pCacheRecords.compare_exchange_weak( pHead, pRec, atomics::memory_order_release, atomics::memory_order_relaxed ));
+            return pRec;
+        }
+
+        /// Returns thread cache record of current thread, \p nullptr if the heap has no thread cache
+        thread_cache_record * get_thread_cache()
+        {
+            if ( m_nCacheSlot >= details::c_nMaxThreadCacheHeaps )
+                return nullptr;
+            details::thread_cache_slot * pSlots = details::thread_cache_slots();
+            if ( !pSlots )
+                return nullptr;
+
+            details::thread_cache_slot& slot = pSlots[ m_nCacheSlot ];
+            if ( slot.nHeapId != m_nHeapId ) {
+                // The slot is free or it is left by a destroyed heap
+                slot.pRecord = acquire_thread_cache_record();
+                slot.nHeapId = m_nHeapId;
+            }
+            return reinterpret_cast<thread_cache_record *>( slot.pRecord );
+        }
+
+        /// Flushes thread cache record \p pRecord of exiting thread and makes it free
+        static void release_thread_cache( void * pHeap, void * pRecord )
+        {
+            thread_cache_record * pRec = reinterpret_cast<thread_cache_record *>( pRecord );
+            reinterpret_cast<Heap *>( pHeap )->flush_thread_cache_record( pRec );
+            pRec->bFree.store( true, atomics::memory_order_release );
+        }
+
         /// Allocate memory block
         block_header * int_alloc(
             size_t nSize    ///< Size of memory block to allocate in bytes
@@ -1611,6 +2649,15 @@ namespace michael {
             }
             assert( nSizeClassIndex < m_SizeClassSelector.size() );
 
+            if ( thread_cache::enabled ) {
+                thread_cache_record * pCache = get_thread_cache();
+                if ( pCache ) {
+                    thread_cache_bin& bin = pCache->arrBin[ nSizeClassIndex ];
+                    if ( bin.nCapacity && ( bin.nCount > 0 || refill_thread_cache( bin, nSizeClassIndex )))
+                        return pop_cached_block( bin );
+                }
+            }
+
             block_header * pBlock;
             processor_heap * pProcHeap;
             while ( true ) {
@@ -1644,6 +2691,12 @@ namespace michael {
             m_arrProcDesc = new( m_AlignedHeap.alloc(sizeof(processor_desc *) * m_nProcessorCount, c_nAlignment ))
                 atomics::atomic<processor_desc *>[ m_nProcessorCount ];
             memset( m_arrProcDesc, 0, sizeof(processor_desc *) * m_nProcessorCount )    ;   // ?? memset for atomic<>
+
+            m_nHeapId = 0;
+            m_nCacheSlot = details::c_nMaxThreadCacheHeaps;
+            m_pCacheRecords.store( nullptr, atomics::memory_order_relaxed );
+            if ( thread_cache::enabled )
+                m_nCacheSlot = details::register_thread_cache_heap( this, release_thread_cache, m_nHeapId );
         }
 
         /// Heap destructor
@@ -1652,6 +2705,20 @@ namespace michael {
         */
         ~Heap()
         {
+            if ( thread_cache::enabled ) {
+                // After unregistering the exiting threads do not flush their caches to the heap.
+                // The cached blocks are freed together with their superblocks
+                details::unregister_thread_cache_heap( m_nCacheSlot );
+                m_nCacheSlot = details::c_nMaxThreadCacheHeaps;
+                thread_cache_record * pRec = m_pCacheRecords.load( atomics::memory_order_relaxed );
+                while ( pRec ) {
+                    thread_cache_record * pNext = pRec->pNext;
+                    pRec->~thread_cache_record();
+                    m_AlignedHeap.free( pRec );
+                    pRec = pNext;
+                }
+            }
+
             for ( unsigned int i = 0; i < m_nProcessorCount; ++i ) {
                 processor_desc * pDesc = m_arrProcDesc[i].load(atomics::memory_order_relaxed);
                 if ( pDesc )
@@ -1711,45 +2778,20 @@ namespace michael {
                 pDesc->nBlockSize
             );
 
-
-            anchor_tag oldAnchor;
-            anchor_tag newAnchor;
-            processor_heap_base * pProcHeap = pDesc->pProcHeap;
-
-            pProcHeap->stat.incDeallocatedBytes( pDesc->nBlockSize );
-
-            oldAnchor = pDesc->anchor.load(atomics::memory_order_acquire);
-            do {
-                newAnchor = oldAnchor;
-                reinterpret_cast<free_block_header *>( pBlock )->nNextFree = oldAnchor.avail;
-                newAnchor.avail = (reinterpret_cast<byte *>( pBlock ) - pDesc->pSB) / pDesc->nBlockSize;
-                newAnchor.tag += 1;
-
-                assert( oldAnchor.state != SBSTATE_EMPTY );
-
-                if ( oldAnchor.state == SBSTATE_FULL )
-                    newAnchor.state = SBSTATE_PARTIAL;
-
-                if ( oldAnchor.count == pDesc->nCapacity - 1 ) {
-                    //pProcHeap = pDesc->pProcHeap;
-                    //CDS_COMPILER_RW_BARRIER         ;   // instruction fence is needed?..
-                    newAnchor.state = SBSTATE_EMPTY;
+            if ( thread_cache::enabled ) {
+                thread_cache_record * pCache = get_thread_cache();
+                if ( pCache ) {
+                    thread_cache_bin& bin = pCache->arrBin[ pDesc->pProcHeap->nSizeClass ];
+                    if ( bin.nCapacity ) {
+                        if ( bin.nCount == bin.nCapacity )
+                            flush_thread_cache_bin( bin, bin.nCapacity / 2 );
+                        push_cached_block( bin, pBlock );
+                        return;
+                    }
                 }
-                else
-                    newAnchor.count += 1;
-            } while ( !pDesc->anchor.compare_exchange_strong( oldAnchor, newAnchor, atomics::memory_order_release, atomics::memory_order_relaxed ) );
-
-            pProcHeap->stat.incFreeCount();
-
-            if ( newAnchor.state == SBSTATE_EMPTY ) {
-                if ( pProcHeap->unlink_partial( pDesc ))
-                    free_superblock( pDesc );
-            }
-            else if (oldAnchor.state == SBSTATE_FULL ) {
-                assert( pProcHeap != nullptr );
-                pProcHeap->stat.decDescFull();
-                pProcHeap->add_partial( pDesc );
             }
+
+            free_block( pDesc, pBlock );
         }
 
         /// Reallocate memory block
@@ -1869,6 +2911,32 @@ namespace michael {
             free( pMemory );
         }
 
+        /// Returns the blocks cached by current thread to the heap
+        /**
+            The function is useful for a thread that stops using the heap for a long time.
+            It does nothing if the heap has no thread cache (see \ref opt::thread_cache).
+            On thread exit the thread cache is flushed automatically.
+        */
+        void flush_thread_cache()
+        {
+            if ( thread_cache::enabled ) {
+                thread_cache_record * pCache = get_thread_cache();
+                if ( pCache )
+                    flush_thread_cache_record( pCache );
+            }
+        }
+
+        /// Purges the free pages of the page heaps that are not used for a long time
+        /**
+            The function calls \p purge() of the page heaps of each processor, see \ref decaying_page_allocator.
+            It does nothing if the page heap (see \ref opt::page_heap) has no \p purge() function.
+            The function may be called from any thread, for example, from \ref purge_thread.
+        */
+        void purge()
+        {
+            purge_page_heaps( std::integral_constant< bool, details::has_purge< page_heap >::value >() );
+        }
+
     public:
 
         /// Get instant summary statistics
@@ -1891,6 +2959,63 @@ namespace michael {
         }
     };
 
+    /// Background thread that purges the free pages of the heap periodically
+    /**
+        The thread calls \p heap.purge() every \p nPeriodMs milliseconds, so the expired free pages
+        of \ref decaying_page_allocator are purged even if the heap is idle.
+        The thread is stopped by the destructor; \p purge_thread object must be destroyed before the heap.
+        \code
+        typedef cds::memory::michael::Heap<
+            opt::page_heap< decaying_page_allocator<> >
+        > heap_type;
+
+        heap_type myHeap;
+        cds::memory::michael::purge_thread< heap_type > myPurgeThread( myHeap, 1000 );
+        \endcode
+    */
+    template <class Heap>
+    class purge_thread
+    {
+        //@cond
+        Heap&                       m_Heap;
+        std::chrono::milliseconds   m_Period;
+        std::mutex                  m_Mutex;
+        std::condition_variable     m_Cond;
+        bool                        m_bStop;
+        std::thread                 m_Thread;   // must be the last member
+
+        void run()
+        {
+            std::unique_lock<std::mutex> lock( m_Mutex );
+            while ( !m_Cond.wait_for( lock, m_Period, [this]() { return m_bStop; } )) {
+                lock.unlock();
+                m_Heap.purge();
+                lock.lock();
+            }
+        }
+        //@endcond
+
+    public:
+        /// Starts the thread purging \p heap every \p nPeriodMs milliseconds
+        explicit purge_thread( Heap& heap, unsigned int nPeriodMs = 1000 )
+            : m_Heap( heap )
+            , m_Period( nPeriodMs )
+            , m_bStop( false )
+            , m_Thread( &purge_thread::run, this )
+        {}
+
+        /// Stops the thread
+        ~purge_thread()
+        {
+            {
+                std::unique_lock<std::mutex> lock( m_Mutex );
+                m_bStop = true;
+            }
+            m_Cond.notify_one();
+            m_Thread.join();
+        }
+    };
+
 }}} // namespace cds::memory::michael
 
 #endif // CDSLIB_MEMORY_MICHAEL_ALLOCATOR_TMPL_H
@@ -84,6 +84,8 @@ namespace cds { namespace memory { namespace michael {
             Available \p HEAP implementations:
                 - page_allocator
                 - page_cached_allocator
+                - huge_page_allocator
+                - decaying_page_allocator
         */
         template <typename HEAP>
         struct page_heap {
@@ -118,6 +120,7 @@ namespace cds { namespace memory { namespace michael {
         /**
             Available \p Type implementations:
                 - free_list_locked
+                - free_list_lockfree
         */
         template <typename Type>
         struct free_list {
@@ -133,6 +136,7 @@ namespace cds { namespace memory { namespace michael {
         /**
             Available \p Type implementations:
                 - partial_list_locked
+                - partial_list_lockfree
         */
         template <typename Type>
         struct partial_list {
@@ -247,6 +251,34 @@ namespace cds { namespace memory { namespace michael {
             };
             //@endcond
         };
+
+        /// Option setter for thread-local cache of free blocks
+        /**
+            The thread cache keeps a small stack of free blocks for each size-class in each thread.
+            \p Heap::alloc takes a block from the cache without any atomic operation;
+            the empty cache is refilled from the active superblock of the processor heap by a batch
+            reserved with one CAS of \p active field and one CAS of the superblock anchor.
+            \p Heap::free puts the block into the cache; the full cache flushes half of its blocks back to the heap.
+
+            The cache of a thread is returned to the heap on thread exit or by \p Heap::flush_thread_cache().
+            Up to 16 \p Heap objects with thread cache can exist at the same time, the next ones work without cache.
+            The thread cache requires C++11 \p thread_local support.
+
+            Possible \p Type values:
+                \li \p cds::opt::none - no thread cache (default)
+                \li \p michael::thread_cache_capacity - the cache with capacity depending on block size
+                \li user-defined class with <tt>static unsigned int capacity( size_class const& )</tt>
+                    function that returns the capacity of the cache for each size-class, see \p thread_cache_capacity.
+        */
+        template <typename Type>
+        struct thread_cache {
+            //@cond
+            template <class BASE> struct pack: public BASE
+            {
+                typedef Type thread_cache;
+            };
+            //@endcond
+        };
     }
 
 }}} // namespace cds::memory::michael
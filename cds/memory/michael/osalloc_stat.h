@@ -4,6 +4,7 @@
 #define CDSLIB_MEMORY_MICHAEL_ALLOCATOR_OSALLOC_STAT_H
 
 #include <cds/algo/atomic.h>
+#include <cds/os/huge_page.h>
 
 namespace cds { namespace memory { namespace michael {
 
@@ -15,13 +16,19 @@ namespace cds { namespace memory { namespace michael {
         atomics::atomic<size_t>              nFreeCount          ;   ///< Event count of large block deallocation to %OS
         atomics::atomic<unsigned long long>  nBytesAllocated     ;   ///< Total size of allocated large blocks, in bytes
         atomics::atomic<unsigned long long>  nBytesDeallocated   ;   ///< Total size of deallocated large blocks, in bytes
+        atomics::atomic<unsigned long long>  nHugeRegionBytes[3] ;   ///< Size of mapped huge-page regions of each cds::OS::huge_page::kind, in bytes
+        atomics::atomic<unsigned long long>  nPurgedBytes        ;   ///< Total size of purged free pages, in bytes
 
         os_allocated_atomic()
             : nAllocCount(0)
             , nFreeCount(0)
             , nBytesAllocated(0)
             , nBytesDeallocated(0)
-        {}
+            , nPurgedBytes(0)
+        {
+            for ( size_t i = 0; i < sizeof(nHugeRegionBytes) / sizeof(nHugeRegionBytes[0]); ++i )
+                nHugeRegionBytes[i].store( 0, atomics::memory_order_relaxed );
+        }
         ///@endcond
 
         /// Adds \p nSize to nBytesAllocated counter
@@ -61,6 +68,36 @@ namespace cds { namespace memory { namespace michael {
         {
             return nBytesDeallocated.load(atomics::memory_order_relaxed);
         }
+
+        /// Adds \p nSize to the size of mapped huge-page regions of kind \p k (see \ref huge_page_allocator)
+        void incHugeRegionBytes( size_t nSize, cds::OS::huge_page::kind k )
+        {
+            nHugeRegionBytes[k].fetch_add( nSize, atomics::memory_order_relaxed );
+        }
+
+        /// Subtracts \p nSize from the size of mapped huge-page regions of kind \p k
+        void decHugeRegionBytes( size_t nSize, cds::OS::huge_page::kind k )
+        {
+            nHugeRegionBytes[k].fetch_sub( nSize, atomics::memory_order_relaxed );
+        }
+
+        /// Returns current size of mapped huge-page regions of kind \p k
+        atomic64u_t hugeRegionBytes( cds::OS::huge_page::kind k ) const
+        {
+            return nHugeRegionBytes[k].load(atomics::memory_order_relaxed);
+        }
+
+        /// Adds \p nSize to the size of purged free pages (see \ref decaying_page_allocator)
+        void incPurgedBytes( size_t nSize )
+        {
+            nPurgedBytes.fetch_add( nSize, atomics::memory_order_relaxed );
+        }
+
+        /// Returns total size of purged free pages
+        atomic64u_t purgedBytes() const
+        {
+            return nPurgedBytes.load(atomics::memory_order_relaxed);
+        }
     };
 
     /// Dummy statistics for large (allocated directly from %OS) block
@@ -102,6 +139,31 @@ namespace cds { namespace memory { namespace michael {
         {
             return 0;
         }
+
+        /// Adds \p nSize to the size of mapped huge-page regions of kind \p k
+        void incHugeRegionBytes( size_t nSize, cds::OS::huge_page::kind k )
+        { CDS_UNUSED(nSize); CDS_UNUSED(k); }
+
+        /// Subtracts \p nSize from the size of mapped huge-page regions of kind \p k
+        void decHugeRegionBytes( size_t nSize, cds::OS::huge_page::kind k )
+        { CDS_UNUSED(nSize); CDS_UNUSED(k); }
+
+        /// Returns current size of mapped huge-page regions of kind \p k
+        atomic64u_t hugeRegionBytes( cds::OS::huge_page::kind k ) const
+        {
+            CDS_UNUSED(k);
+            return 0;
+        }
+
+        /// Adds \p nSize to the size of purged free pages
+        void incPurgedBytes( size_t nSize )
+        { CDS_UNUSED(nSize); }
+
+        /// Returns total size of purged free pages
+        atomic64u_t purgedBytes() const
+        {
+            return 0;
+        }
     //@endcond
     };
 
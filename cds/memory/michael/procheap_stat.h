@@ -23,6 +23,7 @@ namespace cds { namespace memory { namespace michael {
         atomics::atomic<size_t>      nAllocFromPartial   ;  ///< Event count of allocation from partial superblock
         atomics::atomic<size_t>      nAllocFromNew       ;  ///< Event count of allocation from new superblock
         atomics::atomic<size_t>      nFreeCount          ;  ///< \ref free function call count
+        atomics::atomic<size_t>      nRemoteFreeCount    ;  ///< \ref free function call count on other NUMA node
         atomics::atomic<size_t>      nBlockCount         ;  ///< Count of superblock allocated
         atomics::atomic<size_t>      nBlockDeallocCount  ;  ///< Count of superblock deallocated
         atomics::atomic<size_t>      nDescAllocCount     ;  ///< Count of superblock descriptors
@@ -44,6 +45,7 @@ namespace cds { namespace memory { namespace michael {
             , nAllocFromPartial(0)
             , nAllocFromNew(0)
             , nFreeCount(0)
+            , nRemoteFreeCount(0)
             , nBlockCount(0)
             , nDescFull(0)
             , nBytesAllocated(0)
@@ -55,6 +57,10 @@ namespace cds { namespace memory { namespace michael {
         {}
         //@endcond
 
+    public:
+        /// The heap detects remote \p free calls for this statistics
+        static CDS_CONSTEXPR const bool c_bRemoteFreeStat = true;
+
     public:
         /// Increment event counter of allocation from active superblock
         void incAllocFromActive()
@@ -100,6 +106,12 @@ namespace cds { namespace memory { namespace michael {
             nFreeCount.fetch_add( n, atomics::memory_order_relaxed );
         }
 
+        /// Increment event counter of \p free calling on other NUMA node than the node of block's processor heap
+        void incRemoteFreeCount()
+        {
+            nRemoteFreeCount.fetch_add( 1, atomics::memory_order_relaxed );
+        }
+
         /// Increment counter of superblock allocated
         void incBlockAllocated()
         {
@@ -216,6 +228,17 @@ namespace cds { namespace memory { namespace michael {
             return nFreeCount.load(atomics::memory_order_relaxed);
         }
 
+        /// Read event counter of remote free calling
+        /**
+            The free is remote if the calling thread runs on other NUMA node than the processor heap
+            of the block. The counter is gathered only on NUMA system (\p node_count() of heap's topology is more than 1).
+            Large share of remote frees means the blocks are produced and consumed on different nodes.
+        */
+        size_t remoteFreeCount() const
+        {
+            return nRemoteFreeCount.load(atomics::memory_order_relaxed);
+        }
+
         /// Read counter of superblock allocated
         size_t blockAllocated() const
         {
@@ -300,6 +323,8 @@ namespace cds { namespace memory { namespace michael {
     {
     //@cond
     public:
+        static CDS_CONSTEXPR const bool c_bRemoteFreeStat = false;
+
         void incAllocFromActive()
         {}
         void incAllocFromPartial()
@@ -308,6 +333,8 @@ namespace cds { namespace memory { namespace michael {
         {}
         void incFreeCount()
         {}
+        void incRemoteFreeCount()
+        {}
         void incBlockAllocated()
         {}
         void incBlockDeallocated()
@@ -362,6 +389,8 @@ namespace cds { namespace memory { namespace michael {
         { return 0; }
         size_t freeCount() const
         { return 0; }
+        size_t remoteFreeCount() const
+        { return 0; }
         size_t blockAllocated() const
         { return 0; }
         size_t blockDeallocated() const
@@ -0,0 +1,101 @@
+//$$CDS-header$$
+
+#ifndef CDSLIB_MEMORY_MICHAEL_THREAD_CACHE_H
+#define CDSLIB_MEMORY_MICHAEL_THREAD_CACHE_H
+
+#include <cds/details/defs.h>
+#include <cds/opt/options.h>
+
+namespace cds { namespace memory { namespace michael {
+
+    /// Capacity of thread-local cache for opt::thread_cache option
+    /**
+        The thread cache keeps at most \p capacity( sc ) free blocks of size-class \p sc for each thread:
+        <tt>min( MaxBlockCount, MaxCacheBytes / sc.nBlockSize )</tt>; the size-classes with capacity less than 2
+        are not cached. So, the cache holds up to \p MaxBlockCount small blocks and does not cache large ones.
+
+        The cache is refilled from the processor heap and flushed to it by halves of the capacity.
+
+        To tune the capacity per size-class, declare your own class with the same static \p capacity() function:
+        \code
+        struct my_cache_capacity {
+            static unsigned int capacity( cds::memory::michael::size_class const& sc )
+            {
+                // cache the blocks up to 256 bytes only
+                return sc.nBlockSize <= 256 ? 256 : 0;
+            }
+        };
+        \endcode
+    */
+    template <unsigned int MaxBlockCount = 64, unsigned int MaxCacheBytes = 32 * 1024>
+    struct thread_cache_capacity
+    {
+        /// Returns the count of cached blocks of size-class \p sc, 0 - the size-class is not cached
+        template <typename SizeClass>
+        static unsigned int capacity( SizeClass const& sc )
+        {
+            unsigned int nCapacity = MaxCacheBytes / sc.nBlockSize;
+            if ( nCapacity > MaxBlockCount )
+                nCapacity = MaxBlockCount;
+            return nCapacity < 2 ? 0 : nCapacity;
+        }
+    };
+
+    //@cond
+    namespace details {
+
+        template <typename Capacity>
+        struct thread_cache_selector
+        {
+            static CDS_CONSTEXPR const bool enabled = true;
+
+            template <typename SizeClass>
+            static unsigned int capacity( SizeClass const& sc )
+            {
+                return Capacity::capacity( sc );
+            }
+        };
+
+        template <>
+        struct thread_cache_selector< cds::opt::none >
+        {
+            static CDS_CONSTEXPR const bool enabled = false;
+
+            template <typename SizeClass>
+            static unsigned int capacity( SizeClass const& /*sc*/ )
+            {
+                return 0;
+            }
+        };
+
+        // Max count of Heap objects with thread cache that may exist at the same time
+        static const unsigned int c_nMaxThreadCacheHeaps = 16;
+
+        // Thread cache record of the heap for current thread
+        struct thread_cache_slot {
+            unsigned long long  nHeapId;    // unique id of the heap, 0 - free slot
+            void *              pRecord;    // thread cache record of the heap
+        };
+
+        // Flushes the thread cache record pRecord of heap pHeap and makes the record free
+        typedef void (* thread_cache_release_func)( void * pHeap, void * pRecord );
+
+        // Registers the heap with thread cache.
+        // Returns the slot index of the heap or c_nMaxThreadCacheHeaps if there is no free slot.
+        // nHeapId is set to the unique id of the heap.
+        CDS_EXPORT_API unsigned int register_thread_cache_heap( void * pHeap, thread_cache_release_func func, unsigned long long& nHeapId );
+
+        // Unregisters the heap. After the call the records of the heap are not released on thread exit
+        CDS_EXPORT_API void unregister_thread_cache_heap( unsigned int nSlot );
+
+        // Returns the array of c_nMaxThreadCacheHeaps slots for current thread,
+        // nullptr if thread_local is not supported or current thread is terminating.
+        // On thread exit the records of registered heaps are released
+        CDS_EXPORT_API thread_cache_slot * thread_cache_slots();
+
+    } // namespace details
+    //@endcond
+
+}}} // namespace cds::memory::michael
+
+#endif // #ifndef CDSLIB_MEMORY_MICHAEL_THREAD_CACHE_H
@@ -5,6 +5,7 @@
 
 #include <cds/details/defs.h>
 #include <cds/threading/model.h>
+#include <cds/os/details/uniform_topology.h>
 
 //@cond
 namespace cds { namespace OS { namespace details {
@@ -0,0 +1,87 @@
+//$$CDS-header$$
+
+#ifndef CDSLIB_OS_DETAILS_UNIFORM_TOPOLOGY_H
+#define CDSLIB_OS_DETAILS_UNIFORM_TOPOLOGY_H
+
+#include <cds/details/defs.h>
+
+//@cond
+namespace cds { namespace OS { namespace details {
+
+    /// Locality functions for the system without NUMA, SMT and cache topology information
+    /**
+        The system is treated as one NUMA node with one shared cache domain,
+        each logical processor is a separate core.
+        \p Topology is the OS-specific topology class that defines \p processor_count()
+        and \p current_processor().
+    */
+    template <class Topology>
+    struct uniform_topology {
+        /// Upper bound of processor IDs, equal to \p processor_count()
+        static unsigned int processor_id_bound()
+        {
+            return Topology::processor_count();
+        }
+
+        /// Checks whether the processor \p nProcessor is online: processor IDs are dense
+        static bool is_processor_online( unsigned int nProcessor )
+        {
+            return nProcessor < Topology::processor_count();
+        }
+
+        /// NUMA node count. Always returns 1
+        static unsigned int node_count()
+        {
+            return 1;
+        }
+
+        /// NUMA node of processor \p nProcessor. Always returns 0
+        static unsigned int processor_node( unsigned int nProcessor )
+        {
+            CDS_UNUSED( nProcessor );
+            return 0;
+        }
+
+        /// NUMA node of current processor. Always returns 0
+        static unsigned int current_node()
+        {
+            return 0;
+        }
+
+        /// Physical core count, equal to \p processor_count()
+        static unsigned int core_count()
+        {
+            return Topology::processor_count();
+        }
+
+        /// Physical core of processor \p nProcessor, each processor is a separate core
+        static unsigned int processor_core( unsigned int nProcessor )
+        {
+            return nProcessor;
+        }
+
+        /// Count of last-level cache domains. Always returns 1
+        static unsigned int cache_domain_count()
+        {
+            return 1;
+        }
+
+        /// Last-level cache domain of processor \p nProcessor. Always returns 0
+        static unsigned int processor_cache_domain( unsigned int nProcessor )
+        {
+            CDS_UNUSED( nProcessor );
+            return 0;
+        }
+
+        /// Binds memory to the NUMA node of current processor. Not supported, always returns \p false
+        static bool bind_to_local_node( void * pMemory, size_t nSize )
+        {
+            CDS_UNUSED( pMemory );
+            CDS_UNUSED( nSize );
+            return false;
+        }
+    };
+}}}  // namespace cds::OS::details
+//@endcond
+
+#endif  // #ifndef CDSLIB_OS_DETAILS_UNIFORM_TOPOLOGY_H
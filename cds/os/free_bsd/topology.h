@@ -22,7 +22,7 @@ namespace cds { namespace OS {
             The implementation assumes that processor IDs are in numerical order
             from 0 to N - 1, where N - count of processor in the system
         */
-        struct topology: public OS::details::fake_topology
+        struct topology: public OS::details::fake_topology, public OS::details::uniform_topology<topology>
         {
         private:
             //@cond
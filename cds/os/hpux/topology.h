@@ -7,6 +7,7 @@
 #   error "<cds/os/topology.h> must be included instead"
 #endif
 
+#include <cds/os/details/uniform_topology.h>
 #include <sys/mpctl.h>
 
 namespace cds { namespace OS {
@@ -14,7 +15,8 @@ namespace cds { namespace OS {
     CDS_CXX11_INLINE_NAMESPACE namespace Hpux {
 
         /// System topology
-        struct topology {
+        struct topology: public OS::details::uniform_topology<topology>
+        {
         public:
             /// Logical processor count for the system
             static unsigned int processor_count()
@@ -0,0 +1,58 @@
+//$$CDS-header$$
+
+#ifndef CDSLIB_OS_HUGE_PAGE_H
+#define CDSLIB_OS_HUGE_PAGE_H
+
+#include <cds/algo/atomic.h>
+
+namespace cds { namespace OS {
+
+    /// Memory regions backed by huge pages
+    /**
+        The class maps memory regions of \p c_nSize (2M) multiple aligned on \p c_nSize boundary.
+        On Linux the region is mapped:
+        - by \p mmap with \p MAP_HUGETLB | \p MAP_HUGE_2MB flags if 2M huge pages are reserved by the system
+          (see \p /proc/sys/vm/nr_hugepages);
+        - otherwise by regular \p mmap followed by \p madvise( \p MADV_HUGEPAGE ),
+          so the transparent huge pages are used if they are enabled.
+          If the kernel rejects \p MAP_HUGETLB (\p EINVAL or \p ENOSYS) this way is used only.
+          If the reserved huge pages are exhausted or not reserved at all (\p ENOMEM) the next \p alloc() calls
+          do not try \p MAP_HUGETLB; the count of such calls is doubled after each \p ENOMEM in a row
+          (up to 1024) and is reset when \p MAP_HUGETLB succeeds, so the reserved pages freed later are used again.
+
+        On other systems the region is allocated by \p cds::OS::aligned_malloc without huge pages.
+    */
+    class CDS_EXPORT_API huge_page
+    {
+        //@cond
+        static atomics::atomic<bool> s_bHugeTLBFailed;
+        static atomics::atomic<unsigned int> s_nHugeTLBSkip;      // count of next alloc() calls that do not try MAP_HUGETLB
+        static atomics::atomic<unsigned int> s_nHugeTLBBackoff;   // current back-off after ENOMEM, 0 - no ENOMEM
+
+        static bool skip_hugetlb();
+        //@endcond
+
+    public:
+        /// Huge page size (2M)
+        static const size_t c_nSize = 2 * 1024 * 1024;
+
+        /// How the region is backed
+        enum kind {
+            regular_pages,      ///< Regular pages, huge pages are not available
+            hugetlb_pages,      ///< Reserved huge pages (\p MAP_HUGETLB)
+            transparent_pages   ///< Transparent huge pages (\p madvise( \p MADV_HUGEPAGE ))
+        };
+
+        /// Maps a region of \p nSize bytes, \p nSize must be a multiple of \p c_nSize
+        /**
+            Returns \p nullptr if no memory is available. \p k is set to the kind of the pages of the region.
+        */
+        static void * alloc( size_t nSize, kind& k );
+
+        /// Unmaps region \p p of \p nSize bytes allocated by \p alloc()
+        static void free( void * p, size_t nSize );
+    };
+
+}} // namespace cds::OS
+
+#endif // #ifndef CDSLIB_OS_HUGE_PAGE_H
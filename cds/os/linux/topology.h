@@ -19,13 +19,41 @@ namespace cds { namespace OS {
 
         /// System topology
         /**
-            The implementation assumes that processor IDs are in numerical order
-            from 0 to N - 1, where N - count of processor in the system
+            \p processor_count() is the count of online processors. Processor IDs may be sparse
+            if some processors are offline; the locality tables are sized by the highest possible ID
+            from <tt>/sys/devices/system/cpu/possible</tt>.
+
+            Besides the processor count, \p init() reads the locality of each processor
+            from \p /sys/devices/system:
+            - NUMA node (<tt>node/nodeN/cpulist</tt>);
+            - physical core: SMT siblings (<tt>cpu/cpuN/topology/thread_siblings_list</tt>) share the core;
+            - last-level cache domain (<tt>cpu/cpuN/cache/indexK/shared_cpu_list</tt> of the highest cache level).
+
+            Nodes, cores and cache domains are numbered densely from 0. If \p /sys is unavailable
+            the system is treated as one node with one cache domain and each processor is a separate core.
+
+            For testing, the real topology can be replaced with a synthetic one by \p set_fake_topology().
         */
         struct topology {
         private:
             //@cond
+            struct processor_location {
+                unsigned int    nNode;  // NUMA node
+                unsigned int    nCore;  // physical core
+                unsigned int    nCache; // last-level cache domain
+                bool            bOnline;
+            };
+
             static unsigned int     s_nProcessorCount;
+            static unsigned int     s_nLocationCount;   // size of s_pLocation: the highest possible processor ID + 1
+            static unsigned int     s_nNodeCount;
+            static unsigned int     s_nCoreCount;
+            static unsigned int     s_nCacheCount;
+            static processor_location * s_pLocation;
+            static bool             s_bFake;
+
+            static void make_processor_map();
+            static void free_processor_map();
             //@endcond
         public:
 
@@ -35,6 +63,22 @@ namespace cds { namespace OS {
                 return s_nProcessorCount;
             }
 
+            /// Upper bound of processor IDs: each online processor ID is less than the value
+            /**
+                If some processors are offline the bound may be greater than \p processor_count().
+            */
+            static unsigned int processor_id_bound()
+            {
+                return s_nLocationCount ? s_nLocationCount : s_nProcessorCount;
+            }
+
+            /// Checks whether the processor \p nProcessor is online
+            static bool is_processor_online( unsigned int nProcessor )
+            {
+                return s_nLocationCount ? nProcessor < s_nLocationCount && s_pLocation[nProcessor].bOnline
+                                        : nProcessor < s_nProcessorCount;
+            }
+
             /// Get current processor number
             /**
                 Caveat: \p current_processor calls system \p sched_getcpu function
@@ -42,9 +86,15 @@ namespace cds { namespace OS {
                 If \p sched_getcpu is not defined the function emulates "current processor number" using
                 thread-specific data. You may manually disable the \p sched_getcpu usage compiling with
                 <tt>-DCDS_LINUX_NO_sched_getcpu</tt>.
+
+                In fake topology mode the function returns the fake "current processor number"
+                assigned for current thread.
             */
             static unsigned int current_processor()
             {
+                if ( s_bFake )
+                    return (unsigned int) threading::Manager::fake_current_processor() % s_nProcessorCount;
+
             // Compile libcds with -DCDS_LINUX_NO_sched_getcpu if your linux does not have sched_getcpu (glibc version less than 2.6)
 #           if !defined(CDS_LINUX_NO_sched_getcpu) && defined(SYS_getcpu)
                 int nProcessor = ::sched_getcpu();
@@ -77,6 +127,85 @@ namespace cds { namespace OS {
                 return current_processor();
             }
 
+            /// NUMA node count
+            static unsigned int node_count()
+            {
+                return s_nNodeCount;
+            }
+
+            /// NUMA node of processor \p nProcessor
+            static unsigned int processor_node( unsigned int nProcessor )
+            {
+                return nProcessor < s_nLocationCount ? s_pLocation[nProcessor].nNode : 0;
+            }
+
+            /// NUMA node of current processor
+            static unsigned int current_node()
+            {
+                return processor_node( current_processor() );
+            }
+
+            /// Physical core count
+            static unsigned int core_count()
+            {
+                return s_nCoreCount;
+            }
+
+            /// Physical core of processor \p nProcessor; SMT siblings have the same core number
+            static unsigned int processor_core( unsigned int nProcessor )
+            {
+                return nProcessor < s_nLocationCount ? s_pLocation[nProcessor].nCore : 0;
+            }
+
+            /// Count of last-level cache domains
+            static unsigned int cache_domain_count()
+            {
+                return s_nCacheCount;
+            }
+
+            /// Last-level cache domain of processor \p nProcessor
+            static unsigned int processor_cache_domain( unsigned int nProcessor )
+            {
+                return nProcessor < s_nLocationCount ? s_pLocation[nProcessor].nCache : 0;
+            }
+
+            /// Binds memory range \p pMemory of \p nSize bytes to the NUMA node of current processor
+            /**
+                The function calls \p mbind with \p MPOL_PREFERRED policy for the node the calling thread
+                is running on. Call it before the memory is touched: then the pages are placed on the node
+                when they are touched first; the pages already touched are migrated, which is expensive.
+                Only whole pages of the range are bound, so \p pMemory should be page-aligned,
+                for example, mapped by \p mmap. On a single-node system the function does nothing.
+
+                Returns \p true if the range has been bound, \p false if the system has one node
+                or \p mbind is not available (for example, it is forbidden in a container).
+            */
+            static bool bind_to_local_node( void * pMemory, size_t nSize );
+
+            /// Replaces the system topology with the synthetic one
+            /**
+                The fake topology has \p nNodeCount NUMA nodes, \p nCoresPerNode cores per node
+                and \p nThreadsPerCore SMT threads per core; each node is a separate cache domain.
+                Processors are numbered compactly: the SMT siblings are adjacent, then the cores of the node.
+                In fake mode \p current_processor() returns the fake processor number assigned for current thread
+                modulo the fake processor count. The fake numbers are assigned when the thread is attached
+                and are bounded by the real processor count, so on a small machine several threads may share
+                one fake processor.
+
+                The function is intended for tests. It is not thread-safe: call it when no other thread
+                uses the topology. \p reset_fake_topology() restores the real topology.
+            */
+            static void set_fake_topology( unsigned int nNodeCount, unsigned int nCoresPerNode, unsigned int nThreadsPerCore );
+
+            /// Restores the real system topology after \p set_fake_topology()
+            static void reset_fake_topology();
+
+            /// Checks whether the fake topology is set
+            static bool is_fake_topology()
+            {
+                return s_bFake;
+            }
+
             //@cond
             static void init();
             static void fini();
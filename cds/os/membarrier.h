@@ -0,0 +1,58 @@
+//$$CDS-header$$
+
+#ifndef CDSLIB_OS_MEMBARRIER_H
+#define CDSLIB_OS_MEMBARRIER_H
+
+#include <cds/algo/atomic.h>
+
+namespace cds { namespace OS {
+
+    /// Process-wide memory barrier
+    /**
+        The class is a wrapper around Linux \p membarrier(2) system call with \p MEMBARRIER_CMD_PRIVATE_EXPEDITED command.
+        The system call issues a full memory barrier on all running threads of the process.
+        It allows to build an asymmetric fence: the frequent (fast) side of an algorithm
+        uses a compiler-only barrier instead of a full memory fence, and the rare (slow) side calls \p barrier().
+
+        If the system call is not supported (other OS, old kernel or the process cannot register
+        for the expedited command), \p init() returns \p false. In this case \p barrier() is
+        a full memory fence of the calling thread, and the fast side must use a full fence too.
+    */
+    class CDS_EXPORT_API membarrier
+    {
+        //@cond
+        static atomics::atomic<int> s_nState;
+        //@endcond
+
+    public:
+        /// Initializes the process-wide barrier. Repeat call is available
+        /**
+            Returns \p true if the system call is supported and the process is registered
+            for the expedited process-wide barrier.
+        */
+        static bool init();
+
+        /// Checks if the process-wide barrier is available
+        /**
+            Returns \p false if \p init() has not been called or the system call is not supported.
+        */
+        static bool is_available() CDS_NOEXCEPT
+        {
+            return s_nState.load( atomics::memory_order_relaxed ) > 0;
+        }
+
+        /// Issues process-wide memory barrier
+        /**
+            If the process-wide barrier is not available, a full memory fence of current thread is issued.
+
+            If the system call fails after \p init() has succeeded the process is aborted:
+            the fast side uses a compiler-only barrier, so a fence of current thread cannot replace
+            the process-wide barrier, and continuing would break the ordering that hazard pointers
+            and \p membarrier_buffered / \p membarrier_threaded RCU readers rely on.
+        */
+        static void barrier();
+    };
+
+}} // namespace cds::OS
+
+#endif // #ifndef CDSLIB_OS_MEMBARRIER_H
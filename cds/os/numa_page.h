@@ -0,0 +1,45 @@
+//$$CDS-header$$
+
+#ifndef CDSLIB_OS_NUMA_PAGE_H
+#define CDSLIB_OS_NUMA_PAGE_H
+
+#include <cds/algo/atomic.h>
+
+namespace cds { namespace OS {
+
+    /// Memory regions placed on the NUMA node of the calling thread
+    /**
+        On Linux the region is mapped by \p mmap and bound by \p cds::OS::topology::bind_to_local_node()
+        before any page of it is touched, so no page has to be migrated.
+        If the binding fails (for example, \p mbind is forbidden in a container) the region is still returned,
+        its pages are placed by the first-touch policy of the OS; the failure is counted
+        by \p bind_failed_count().
+
+        On other systems the region is allocated by \p cds::OS::aligned_malloc with page alignment without binding.
+    */
+    class CDS_EXPORT_API numa_page
+    {
+        //@cond
+        static atomics::atomic<size_t> s_nBindFailed;
+        //@endcond
+
+    public:
+        /// Maps a page-aligned region of \p nSize bytes on the node of current processor
+        /**
+            \p nSize is rounded up to the OS page size. Returns \p nullptr if no memory is available.
+        */
+        static void * alloc( size_t nSize );
+
+        /// Unmaps region \p p of \p nSize bytes allocated by \p alloc()
+        static void free( void * p, size_t nSize );
+
+        /// Count of regions that could not be bound to the local node on a multi-node system
+        static size_t bind_failed_count()
+        {
+            return s_nBindFailed.load( atomics::memory_order_relaxed );
+        }
+    };
+
+}} // namespace cds::OS
+
+#endif // #ifndef CDSLIB_OS_NUMA_PAGE_H
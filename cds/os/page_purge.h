@@ -0,0 +1,41 @@
+//$$CDS-header$$
+
+#ifndef CDSLIB_OS_PAGE_PURGE_H
+#define CDSLIB_OS_PAGE_PURGE_H
+
+#include <cds/algo/atomic.h>
+
+namespace cds { namespace OS {
+
+    /// Returns the physical memory of unused pages to the OS
+    /**
+        The address range stays mapped (valid to access), but the OS may reclaim its physical pages;
+        the contents of purged pages is undefined (zero-filled on Linux).
+        So, the resident set size of the process is reduced without unmapping the memory.
+
+        On Linux \p madvise( \p MADV_FREE ) is used, the pages are reclaimed lazily under memory pressure;
+        if the kernel does not support \p MADV_FREE (before 4.5), \p madvise( \p MADV_DONTNEED ) is used.
+        Other Unix systems use \p madvise( \p MADV_DONTNEED ) or \p MADV_FREE.
+        On Windows the purge is not supported.
+    */
+    class CDS_EXPORT_API page_purge
+    {
+        //@cond
+        static atomics::atomic<bool> s_bFreeFailed;
+        //@endcond
+
+    public:
+        /// Returns the OS page size
+        static size_t page_size();
+
+        /// Purges whole pages within \p nSize bytes starting from \p p
+        /**
+            The partial pages at the ends of the range are not purged.
+            Returns the count of bytes purged, 0 if the purge is not supported or no whole page is within the range.
+        */
+        static size_t purge( void * p, size_t nSize );
+    };
+
+}} // namespace cds::OS
+
+#endif // #ifndef CDSLIB_OS_PAGE_PURGE_H
@@ -13,7 +13,8 @@
 namespace cds { namespace OS {
     CDS_CXX11_INLINE_NAMESPACE namespace posix {
         /// Fake system topology
-        struct topology {
+        struct topology: public OS::details::uniform_topology<topology>
+        {
             /// Logical processor count for the system. Always returns 1
             static unsigned int processor_count()
             {
@@ -7,6 +7,7 @@
 #   error "<cds/os/topology.h> must be included instead"
 #endif
 
+#include <cds/os/details/uniform_topology.h>
 #include <sys/processor.h>
 #include <unistd.h>
 
@@ -20,7 +21,8 @@ namespace cds { namespace OS {
             The implementation assumes that the processor IDs are in numerical order
             from 0 to N - 1, where N - count of processor in the system
         */
-        struct topology {
+        struct topology: public OS::details::uniform_topology<topology>
+        {
             /// Logical processor count for the system
             static unsigned int processor_count()
             {
@@ -8,6 +8,7 @@
 #endif
 
 #include <cds/details/defs.h>
+#include <cds/os/details/uniform_topology.h>
 #include <windows.h>
 
 namespace cds { namespace OS {
@@ -21,7 +22,7 @@ namespace cds { namespace OS {
                 \li the system has no more than 64 logical processors;
                 \li processor IDs are in numerical order from 0 to N - 1, where N - count of processor in the system
         */
-        struct CDS_EXPORT_API topology
+        struct CDS_EXPORT_API topology: public OS::details::uniform_topology<topology>
         {
 #   if _WIN32_WINNT >= 0x0601       // >= Windows 7
             static unsigned int    processor_count()
@@ -5,9 +5,13 @@
 
 #include <cds/gc/impl/hp_decl.h>
 #include <cds/gc/impl/dhp_decl.h>
+#include <cds/gc/impl/ebr_decl.h>
+#include <cds/gc/impl/he_decl.h>
 
 #include <cds/urcu/details/gp_decl.h>
 #include <cds/urcu/details/sh_decl.h>
+#include <cds/urcu/details/qsbr_decl.h>
+#include <cds/urcu/details/mb_decl.h>
 #include <cds/algo/elimination_tls.h>
 
 namespace cds {
@@ -76,6 +80,12 @@ namespace cds {
 
             // Get cds::gc::DHP thread GC implementation for current thread;
             static gc::DHP::thread_gc_impl&   getDHPGC();
+
+            // Get cds::gc::EBR thread GC implementation for current thread;
+            static gc::EBR::thread_gc_impl&   getEBRGC();
+
+            // Get cds::gc::HE thread GC implementation for current thread;
+            static gc::HE::thread_gc_impl&   getHEGC();
         };
         \endcode
 
@@ -111,6 +121,8 @@ namespace cds {
             //@cond
             char CDS_DATA_ALIGNMENT(8) m_hpManagerPlaceholder[sizeof(cds::gc::HP::thread_gc_impl)];   ///< Michael's Hazard Pointer GC placeholder
             char CDS_DATA_ALIGNMENT(8) m_dhpManagerPlaceholder[sizeof(cds::gc::DHP::thread_gc_impl)]; ///< Dynamic Hazard Pointer GC placeholder
+            char CDS_DATA_ALIGNMENT(8) m_ebrManagerPlaceholder[sizeof(cds::gc::EBR::thread_gc_impl)]; ///< Epoch-based reclamation GC placeholder
+            char CDS_DATA_ALIGNMENT(8) m_heManagerPlaceholder[sizeof(cds::gc::HE::thread_gc_impl)];   ///< Hazard eras GC placeholder
 
             cds::urcu::details::thread_data< cds::urcu::general_instant_tag > *     m_pGPIRCU;
             cds::urcu::details::thread_data< cds::urcu::general_buffered_tag > *    m_pGPBRCU;
@@ -119,11 +131,16 @@ namespace cds {
             cds::urcu::details::thread_data< cds::urcu::signal_buffered_tag > *    m_pSHBRCU;
             cds::urcu::details::thread_data< cds::urcu::signal_threaded_tag > *    m_pSHTRCU;
 #endif
+            cds::urcu::details::thread_data< cds::urcu::qsbr_buffered_tag > *      m_pQSBRCU;
+            cds::urcu::details::thread_data< cds::urcu::membarrier_buffered_tag > * m_pMBBRCU;
+            cds::urcu::details::thread_data< cds::urcu::membarrier_threaded_tag > * m_pMBTRCU;
 
             //@endcond
 
             cds::gc::HP::thread_gc_impl  * m_hpManager     ;   ///< Michael's Hazard Pointer GC thread-specific data
             cds::gc::DHP::thread_gc_impl * m_dhpManager    ;   ///< Dynamic Hazard Pointer GC thread-specific data
+            cds::gc::EBR::thread_gc_impl * m_ebrManager    ;   ///< Epoch-based reclamation GC thread-specific data
+            cds::gc::HE::thread_gc_impl  * m_heManager     ;   ///< Hazard eras GC thread-specific data
 
             size_t  m_nFakeProcessorNumber  ;   ///< fake "current processor" number
 
@@ -137,6 +154,10 @@ namespace cds {
             //@cond
             static CDS_EXPORT_API atomics::atomic<size_t> s_nLastUsedProcNo;
             static CDS_EXPORT_API size_t                     s_nProcCount;
+            static CDS_EXPORT_API atomics::atomic<int>      s_nPlacement;           // see cds/threading/placement.h
+            static CDS_EXPORT_API atomics::atomic<size_t>   s_nPlacedThreadCount;
+
+            static CDS_EXPORT_API void place_attached_thread();
             //@endcond
 
             //@cond
@@ -148,6 +169,9 @@ namespace cds {
                 , m_pSHBRCU( nullptr )
                 , m_pSHTRCU( nullptr )
 #endif
+                , m_pQSBRCU( nullptr )
+                , m_pMBBRCU( nullptr )
+                , m_pMBTRCU( nullptr )
                 , m_nFakeProcessorNumber( s_nLastUsedProcNo.fetch_add(1, atomics::memory_order_relaxed) % s_nProcCount )
                 , m_nAttachCount(0)
             {
@@ -160,6 +184,16 @@ namespace cds {
                     m_dhpManager = new (m_dhpManagerPlaceholder) cds::gc::DHP::thread_gc_impl;
                 else
                     m_dhpManager = nullptr;
+
+                if ( cds::gc::EBR::isUsed() )
+                    m_ebrManager = new (m_ebrManagerPlaceholder) cds::gc::EBR::thread_gc_impl;
+                else
+                    m_ebrManager = nullptr;
+
+                if ( cds::gc::HE::isUsed() )
+                    m_heManager = new (m_heManagerPlaceholder) cds::gc::HE::thread_gc_impl;
+                else
+                    m_heManager = nullptr;
             }
 
             ~ThreadData()
@@ -176,6 +210,18 @@ namespace cds {
                     m_dhpManager = nullptr;
                 }
 
+                if ( m_ebrManager ) {
+                    typedef cds::gc::EBR::thread_gc_impl ebr_thread_gc_impl;
+                    m_ebrManager->~ebr_thread_gc_impl();
+                    m_ebrManager = nullptr;
+                }
+
+                if ( m_heManager ) {
+                    typedef cds::gc::HE::thread_gc_impl he_thread_gc_impl;
+                    m_heManager->~he_thread_gc_impl();
+                    m_heManager = nullptr;
+                }
+
                 assert( m_pGPIRCU == nullptr );
                 assert( m_pGPBRCU == nullptr );
                 assert( m_pGPTRCU == nullptr );
@@ -183,51 +229,63 @@ namespace cds {
                 assert( m_pSHBRCU == nullptr );
                 assert( m_pSHTRCU == nullptr );
 #endif
+                assert( m_pQSBRCU == nullptr );
+                assert( m_pMBBRCU == nullptr );
+                assert( m_pMBTRCU == nullptr );
             }
 
             void init()
             {
                 if ( m_nAttachCount++ == 0 ) {
+                    if ( s_nPlacement.load( atomics::memory_order_relaxed ) != 0 )
+                        place_attached_thread();
+
                     if ( cds::gc::HP::isUsed() )
                         m_hpManager->init();
                     if ( cds::gc::DHP::isUsed() )
                         m_dhpManager->init();
-
-                    if ( cds::urcu::details::singleton<cds::urcu::general_instant_tag>::isUsed() )
-                        m_pGPIRCU = cds::urcu::details::singleton<cds::urcu::general_instant_tag>::attach_thread();
-                    if ( cds::urcu::details::singleton<cds::urcu::general_buffered_tag>::isUsed() )
-                        m_pGPBRCU = cds::urcu::details::singleton<cds::urcu::general_buffered_tag>::attach_thread();
-                    if ( cds::urcu::details::singleton<cds::urcu::general_threaded_tag>::isUsed() )
-                        m_pGPTRCU = cds::urcu::details::singleton<cds::urcu::general_threaded_tag>::attach_thread();
+                    if ( cds::gc::EBR::isUsed() )
+                        m_ebrManager->init();
+                    if ( cds::gc::HE::isUsed() )
+                        m_heManager->init();
+
+                    // General-purpose and membarrier RCU records are attached on first use, see attach_rcu().
+                    // Signal-handling and QSBR RCU records are attached here: signal-handling RCU may be
+                    // accessed from a signal handler, and a QSBR thread is online from the moment it is attached
 #ifdef CDS_URCU_SIGNAL_HANDLING_ENABLED
                     if ( cds::urcu::details::singleton<cds::urcu::signal_buffered_tag>::isUsed() )
                         m_pSHBRCU = cds::urcu::details::singleton<cds::urcu::signal_buffered_tag>::attach_thread();
                     if ( cds::urcu::details::singleton<cds::urcu::signal_threaded_tag>::isUsed() )
                         m_pSHTRCU = cds::urcu::details::singleton<cds::urcu::signal_threaded_tag>::attach_thread();
 #endif
+                    if ( cds::urcu::details::singleton<cds::urcu::qsbr_buffered_tag>::isUsed() )
+                        m_pQSBRCU = cds::urcu::details::singleton<cds::urcu::qsbr_buffered_tag>::attach_thread();
                 }
             }
 
+            // The service thread of libcds (the background reclamation thread of HP/DHP) does not pass
+            // through quiescent states of QSBR RCU, so it should be offline to not block the grace period
+            void qsbr_offline()
+            {
+                if ( m_pQSBRCU )
+                    m_pQSBRCU->m_nCtr.store( 0, atomics::memory_order_release );
+            }
+
             bool fini()
             {
                 if ( --m_nAttachCount == 0 ) {
+                    if ( cds::gc::HE::isUsed() )
+                        m_heManager->fini();
+                    if ( cds::gc::EBR::isUsed() )
+                        m_ebrManager->fini();
                     if ( cds::gc::DHP::isUsed() )
                         m_dhpManager->fini();
                     if ( cds::gc::HP::isUsed() )
                         m_hpManager->fini();
 
-                    if ( cds::urcu::details::singleton<cds::urcu::general_instant_tag>::isUsed() ) {
-                        cds::urcu::details::singleton<cds::urcu::general_instant_tag>::detach_thread( m_pGPIRCU );
-                        m_pGPIRCU = nullptr;
-                    }
-                    if ( cds::urcu::details::singleton<cds::urcu::general_buffered_tag>::isUsed() ) {
-                        cds::urcu::details::singleton<cds::urcu::general_buffered_tag>::detach_thread( m_pGPBRCU );
-                        m_pGPBRCU = nullptr;
-                    }
-                    if ( cds::urcu::details::singleton<cds::urcu::general_threaded_tag>::isUsed() ) {
-                        cds::urcu::details::singleton<cds::urcu::general_threaded_tag>::detach_thread( m_pGPTRCU );
-                        m_pGPTRCU = nullptr;
-                    }
+                    detach_rcu( m_pGPIRCU );
+                    detach_rcu( m_pGPBRCU );
+                    detach_rcu( m_pGPTRCU );
 #ifdef CDS_URCU_SIGNAL_HANDLING_ENABLED
                     if ( cds::urcu::details::singleton<cds::urcu::signal_buffered_tag>::isUsed() ) {
                         cds::urcu::details::singleton<cds::urcu::signal_buffered_tag>::detach_thread( m_pSHBRCU );
@@ -238,6 +296,12 @@ namespace cds {
                         m_pSHTRCU = nullptr;
                     }
 #endif
+                    if ( cds::urcu::details::singleton<cds::urcu::qsbr_buffered_tag>::isUsed() ) {
+                        cds::urcu::details::singleton<cds::urcu::qsbr_buffered_tag>::detach_thread( m_pQSBRCU );
+                        m_pQSBRCU = nullptr;
+                    }
+                    detach_rcu( m_pMBBRCU );
+                    detach_rcu( m_pMBTRCU );
                     return true;
                 }
                 return false;
@@ -247,6 +311,23 @@ namespace cds {
             {
                 return m_nFakeProcessorNumber;
             }
+
+            // Returns RCU thread record attaching the thread to the RCU singleton on first use
+            template <typename RCUtag>
+            cds::urcu::details::thread_data<RCUtag> * attach_rcu( cds::urcu::details::thread_data<RCUtag> *& pRec )
+            {
+                if ( pRec == nullptr && cds::urcu::details::singleton<RCUtag>::isUsed() )
+                    pRec = cds::urcu::details::singleton<RCUtag>::attach_thread();
+                return pRec;
+            }
+
+            template <typename RCUtag>
+            static void detach_rcu( cds::urcu::details::thread_data<RCUtag> *& pRec )
+            {
+                if ( pRec && cds::urcu::details::singleton<RCUtag>::isUsed() )
+                    cds::urcu::details::singleton<RCUtag>::detach_thread( pRec );
+                pRec = nullptr;
+            }
             //@endcond
         };
         //@endcond
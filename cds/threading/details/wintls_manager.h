@@ -210,6 +210,28 @@ namespace cds { namespace threading {
                 return *(_threadData( do_getData )->m_dhpManager);
             }
 
+            /// Get gc::EBR thread GC implementation for current thread
+            /**
+                The object returned may be uninitialized if you did not call attachThread in the beginning of thread execution
+                or if you did not use gc::EBR.
+                To initialize gc::EBR GC you must constuct cds::gc::EBR object in the beginning of your application
+            */
+            static gc::EBR::thread_gc_impl&   getEBRGC()
+            {
+                return *(_threadData( do_getData )->m_ebrManager);
+            }
+
+            /// Get gc::HE thread GC implementation for current thread
+            /**
+                The object returned may be uninitialized if you did not call attachThread in the beginning of thread execution
+                or if you did not use gc::HE.
+                To initialize gc::HE GC you must constuct cds::gc::HE object in the beginning of your application
+            */
+            static gc::HE::thread_gc_impl&   getHEGC()
+            {
+                return *(_threadData( do_getData )->m_heManager);
+            }
+
             //@cond
             static size_t fake_current_processor()
             {
@@ -44,21 +44,50 @@ namespace cds { namespace threading {
         return Manager::getDHPGC();
     }
 
+    /// Get cds::gc::EBR thread GC implementation for current thread
+    /**
+        The object returned may be uninitialized if you did not call attachThread in the beginning of thread execution
+        or if you did not use cds::gc::EBR.
+        To initialize cds::gc::EBR GC you must constuct cds::gc::EBR object in the beginning of your application,
+        see \ref cds_how_to_use "How to use libcds"
+    */
+    template <>
+    inline cds::gc::EBR::thread_gc_impl&   getGC<cds::gc::EBR>()
+    {
+        return Manager::getEBRGC();
+    }
+
+    /// Get cds::gc::HE thread GC implementation for current thread
+    /**
+        The object returned may be uninitialized if you did not call attachThread in the beginning of thread execution
+        or if you did not use cds::gc::HE.
+        To initialize cds::gc::HE GC you must constuct cds::gc::HE object in the beginning of your application,
+        see \ref cds_how_to_use "How to use libcds"
+    */
+    template <>
+    inline cds::gc::HE::thread_gc_impl&   getGC<cds::gc::HE>()
+    {
+        return Manager::getHEGC();
+    }
+
     //@cond
     template<>
     inline cds::urcu::details::thread_data<cds::urcu::general_instant_tag> * getRCU<cds::urcu::general_instant_tag>()
     {
-        return Manager::thread_data()->m_pGPIRCU;
+        ThreadData * p = Manager::thread_data();
+        return p->m_pGPIRCU ? p->m_pGPIRCU : p->attach_rcu( p->m_pGPIRCU );
     }
     template<>
     inline cds::urcu::details::thread_data<cds::urcu::general_buffered_tag> * getRCU<cds::urcu::general_buffered_tag>()
     {
-        return Manager::thread_data()->m_pGPBRCU;
+        ThreadData * p = Manager::thread_data();
+        return p->m_pGPBRCU ? p->m_pGPBRCU : p->attach_rcu( p->m_pGPBRCU );
     }
     template<>
     inline cds::urcu::details::thread_data<cds::urcu::general_threaded_tag> * getRCU<cds::urcu::general_threaded_tag>()
     {
-        return Manager::thread_data()->m_pGPTRCU;
+        ThreadData * p = Manager::thread_data();
+        return p->m_pGPTRCU ? p->m_pGPTRCU : p->attach_rcu( p->m_pGPTRCU );
     }
 #ifdef CDS_URCU_SIGNAL_HANDLING_ENABLED
     template<>
@@ -74,6 +103,24 @@ namespace cds { namespace threading {
         return p ? p->m_pSHTRCU : nullptr;
     }
 #endif
+    template<>
+    inline cds::urcu::details::thread_data<cds::urcu::qsbr_buffered_tag> * getRCU<cds::urcu::qsbr_buffered_tag>()
+    {
+        ThreadData * p = Manager::thread_data();
+        return p ? p->m_pQSBRCU : nullptr;
+    }
+    template<>
+    inline cds::urcu::details::thread_data<cds::urcu::membarrier_buffered_tag> * getRCU<cds::urcu::membarrier_buffered_tag>()
+    {
+        ThreadData * p = Manager::thread_data();
+        return p->m_pMBBRCU ? p->m_pMBBRCU : p->attach_rcu( p->m_pMBBRCU );
+    }
+    template<>
+    inline cds::urcu::details::thread_data<cds::urcu::membarrier_threaded_tag> * getRCU<cds::urcu::membarrier_threaded_tag>()
+    {
+        ThreadData * p = Manager::thread_data();
+        return p->m_pMBTRCU ? p->m_pMBTRCU : p->attach_rcu( p->m_pMBTRCU );
+    }
 
     static inline cds::algo::elimination::record& elimination_record()
     {
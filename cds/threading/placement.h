@@ -0,0 +1,103 @@
+//$$CDS-header$$
+
+#ifndef CDSLIB_THREADING_PLACEMENT_H
+#define CDSLIB_THREADING_PLACEMENT_H
+
+#include <cds/os/topology.h>
+
+namespace cds { namespace threading {
+
+    /// Thread placement policy
+    /**
+        The policy maps the thread number to the processor (or the NUMA node) the thread is pinned to.
+        The order of processors is built from \p cds::OS::topology, so the placement is the same
+        for each run on the same machine. Only online processors are used; on Linux the processors
+        are also restricted to the affinity mask of the process, for example, to the cpuset of a container.
+
+        The policy can be applied by two ways:
+        - explicitly by \p place_current_thread( policy, nThreadNo ); the caller numbers its threads itself,
+          for example, the test harness uses the thread number in the pool;
+        - automatically by \p Manager::attachThread(): \p set_thread_placement( policy ) sets the policy
+          applied to newly attached threads, the threads are numbered in attach order.
+
+        The pinning is supported on Linux and Windows; on other systems the placement is ignored.
+    */
+    enum thread_placement {
+        placement_none,     ///< No pinning, the OS scheduler places the threads
+        placement_compact,  ///< Fill the SMT siblings of a core first, then the cores of a NUMA node, then the next node
+        placement_scatter,  ///< Spread the threads over the NUMA nodes first, then over the cores of a node, then over SMT siblings
+        placement_per_node  ///< Thread \p i may run on any processor of NUMA node <tt>i % node_count()</tt>
+    };
+
+    /// Returns the name of placement policy \p p: "none", "compact", "scatter" or "per_node"
+    CDS_EXPORT_API char const * placement_name( thread_placement p );
+
+    /// Returns the target of \p nThreadNo-th thread for placement policy \p p
+    /**
+        For \p placement_compact and \p placement_scatter the function returns the processor number,
+        for \p placement_per_node - the NUMA node number, for \p placement_none - 0.
+    */
+    CDS_EXPORT_API unsigned int placement_target( thread_placement p, size_t nThreadNo );
+
+    /// Pins current thread as \p nThreadNo-th thread of placement policy \p p
+    /**
+        Returns \p false if \p p is \p placement_none or the OS does not support thread pinning.
+    */
+    CDS_EXPORT_API bool place_current_thread( thread_placement p, size_t nThreadNo );
+
+    /// Placement policy with the processor order computed once
+    /**
+        \p placement_target() and \p place_current_thread() build the processor order
+        from \p cds::OS::topology on each call. A thread pool should build the map once
+        when it is set up and use it for each of its threads.
+        The map is not updated if the topology is changed after \p reset().
+    */
+    class CDS_EXPORT_API placement_map
+    {
+    public:
+        /// Builds the map for policy \p p from current topology
+        explicit placement_map( thread_placement p = placement_none );
+        ~placement_map();
+
+        /// Rebuilds the map for policy \p p from current topology
+        void reset( thread_placement p );
+
+        /// Placement policy of the map
+        thread_placement policy() const
+        {
+            return m_nPolicy;
+        }
+
+        /// Returns the target of \p nThreadNo-th thread, see \p placement_target()
+        unsigned int target( size_t nThreadNo ) const;
+
+        /// Pins current thread as \p nThreadNo-th thread, see \p place_current_thread()
+        bool place_current_thread( size_t nThreadNo ) const;
+
+    private:
+        //@cond
+        placement_map( placement_map const& ) = delete;
+        placement_map& operator=( placement_map const& ) = delete;
+
+        thread_placement    m_nPolicy;
+        unsigned int *      m_pOrder;       // processors in the policy order, for compact and scatter policies only
+        unsigned int        m_nProcCount;   // size of m_pOrder
+        //@endcond
+    };
+
+    /// Sets the placement policy applied by \p Manager::attachThread() to newly attached threads
+    /**
+        The thread numbering restarts from 0 on each call.
+        \p placement_none (the default) switches the automatic placement off.
+    */
+    CDS_EXPORT_API void set_thread_placement( thread_placement p );
+
+    /// Returns the placement policy set by \p set_thread_placement()
+    static inline thread_placement get_thread_placement()
+    {
+        return static_cast<thread_placement>( ThreadData::s_nPlacement.load( atomics::memory_order_relaxed ));
+    }
+
+}} // namespace cds::threading
+
+#endif // #ifndef CDSLIB_THREADING_PLACEMENT_H
@@ -3,8 +3,10 @@
 #ifndef CDSLIB_URCU_DETAILS_BASE_H
 #define CDSLIB_URCU_DETAILS_BASE_H
 
+#include <type_traits>
 #include <cds/algo/atomic.h>
 #include <cds/gc/details/retired_ptr.h>
+#include <cds/gc/details/reclaim_stat.h>
 #include <cds/details/allocator.h>
 #include <cds/os/thread.h>
 #include <cds/details/marked_ptr.h>
@@ -74,8 +76,8 @@ namespace cds {
         - The Quiescent-State-Based Reclamation (QSBR) %RCU implementation offers
           the best possible read-side performance, but requires that each thread periodically
           calls a function to announce that it is in a quiescent state, thus strongly
-          constraining the application design. This type of %RCU is not implemented in \p libcds.
-        - The general-purpose %RCU implementation places almost no constraints on the applications
+          constraining the application design. The \p libcds contains \ref qsbr_buffered implementation of QSBR %RCU.
+        - The general-purpose %RCU implementation places almost no constraints on the application�s
           design, thus being appropriate for use within a general-purpose library, but it has
           relatively higher read-side overhead. The \p libcds contains several implementations of general-purpose
           %RCU: \ref general_instant, \ref general_buffered, \ref general_threaded.
@@ -83,9 +85,27 @@ namespace cds {
           requiring only that the application give up one POSIX signal to %RCU update processing.
           The \p libcds contains several implementations if signal-handling %RCU: \ref signal_buffered,
           \ref signal_threaded.
+        - The membarrier-based %RCU has the same read-side cost as signal-handling %RCU, but the writer forces
+          the memory barrier on the reader threads by Linux \p membarrier(2) system call instead of signals.
+          The \p libcds contains \ref membarrier_buffered and \ref membarrier_threaded.
 
     @note The signal-handled %RCU is defined only for UNIX-like systems, not for Windows.
 
+    @anchor cds_urcu_gp_reader_groups
+    <b>Reader groups of general-purpose RCU</b>
+
+        The \p synchronize() of \ref general_instant, \ref general_buffered and \ref general_threaded
+        walks the list of all attached threads and waits for each thread inside read-side critical section.
+        With hundreds of threads attached the grace period latency grows linearly with the thread count.
+        If \p nReaderGroups ctor argument is not zero the threads are registered in \p nReaderGroups groups
+        by the processor they attach on. Each group has a summary flag that is set by a reader entering
+        read-side critical section if it is clear, and is cleared by \p synchronize() when it finds no reader
+        in the group; \p synchronize() scans the per-thread nesting counters of the groups with the flag set only.
+        So its cost depends mostly on the number of groups with active readers.
+        The price is a full memory fence in each outermost \p access_lock(); the group flag is written only when
+        it changes, and \p access_unlock() does not touch the group. Choose the group count about the number
+        of processors (or NUMA nodes for huge thread counts).
+
     @anchor cds_urcu_type
     <b>RCU implementation type</b>
 
@@ -95,6 +115,9 @@ namespace cds {
         - \ref general_threaded - general purpose RCU with special reclamation thread
         - \ref signal_buffered - signal-handling RCU with deferred (buffered) reclamation
         - \ref signal_threaded - signal-handling RCU with special reclamation thread
+        - \ref qsbr_buffered - quiescent-state-based RCU with deferred (buffered) reclamation
+        - \ref membarrier_buffered - membarrier-based RCU with deferred (buffered) reclamation
+        - \ref membarrier_threaded - membarrier-based RCU with special reclamation thread
 
         You cannot create an object of any of those classes directly.
         Instead, you should use wrapper classes.
@@ -114,6 +137,12 @@ namespace cds {
             include file <tt><cds/urcu/signal_buffered.h></tt>
         - \ref cds_urcu_signal_threaded_gc "gc<signal_threaded>" - signal-handling RCU with special reclamation thread
             include file <tt><cds/urcu/signal_threaded.h></tt>
+        - \ref cds_urcu_qsbr_buffered_gc "gc<qsbr_buffered>" - quiescent-state-based RCU with deferred (buffered) reclamation
+            include file <tt><cds/urcu/qsbr_buffered.h></tt>
+        - \ref cds_urcu_membarrier_buffered_gc "gc<membarrier_buffered>" - membarrier-based RCU with deferred (buffered) reclamation
+            include file <tt><cds/urcu/membarrier_buffered.h></tt>
+        - \ref cds_urcu_membarrier_threaded_gc "gc<membarrier_threaded>" - membarrier-based RCU with special reclamation thread
+            include file <tt><cds/urcu/membarrier_threaded.h></tt>
 
         Any RCU-related container in \p libcds expects that its \p RCU template parameter is one of those wrapper.
 
@@ -125,12 +154,17 @@ namespace cds {
         - \ref general_threaded_tag - for \ref general_threaded
         - \ref signal_buffered_tag - for \ref signal_buffered
         - \ref signal_threaded_tag - for \ref signal_threaded
+        - \ref qsbr_buffered_tag - for \ref qsbr_buffered
+        - \ref membarrier_buffered_tag - for \ref membarrier_buffered
+        - \ref membarrier_threaded_tag - for \ref membarrier_threaded
 
     @anchor cds_urcu_performance
     <b>Performance</b>
 
         As a result of our experiments we can range above %RCU implementation in such order,
         from high to low performance:
+        - <tt>gc<qsbr_buffered></tt> - highest read-side performance, but the application must announce
+          quiescent states of its threads
         - <tt>gc<general_buffered></tt> - high
         - <tt>gc<general_threaded></tt>
         - <tt>gc<signal_buffered></tt>
@@ -253,6 +287,32 @@ namespace cds {
         };
 #   endif
 
+        /// Membarrier-based URCU type
+        struct membarrier_rcu {
+            //@cond
+            static uint32_t const c_nControlBit = 0x80000000;
+            static uint32_t const c_nNestMask   = c_nControlBit - 1;
+            //@endcond
+        };
+
+        /// Tag for membarrier_buffered URCU
+        struct membarrier_buffered_tag: public membarrier_rcu {
+            typedef membarrier_rcu     rcu_class ; ///< The URCU type
+        };
+
+        /// Tag for membarrier_threaded URCU
+        struct membarrier_threaded_tag: public membarrier_rcu {
+            typedef membarrier_rcu     rcu_class ; ///< The URCU type
+        };
+
+        /// Quiescent-state-based URCU type
+        struct quiescent_state_rcu {};
+
+        /// Tag for qsbr_buffered URCU
+        struct qsbr_buffered_tag: public quiescent_state_rcu {
+            typedef quiescent_state_rcu     rcu_class ; ///< The URCU type
+        };
+
         ///@anchor cds_urcu_retired_ptr Retired pointer, i.e. pointer that ready for reclamation
         typedef cds::gc::details::retired_ptr   retired_ptr;
 
@@ -288,6 +348,110 @@ namespace cds {
             };
             //@endcond
 
+            //@cond
+            // Deferred callback of call_rcu(). The callback is retired as an ordinary retired_ptr
+            // whose disposer calls the functor and then frees the node
+            template <typename Func>
+            class rcu_callback
+            {
+                typedef cds::details::Allocator< rcu_callback, CDS_DEFAULT_ALLOCATOR > allocator_type;
+
+                Func    m_func;
+
+                static void invoke( rcu_callback * p )
+                {
+                    p->m_func();
+                    allocator_type().Delete( p );
+                }
+
+            public:
+                template <typename Q>
+                explicit rcu_callback( Q&& f )
+                    : m_func( std::forward<Q>( f ))
+                {}
+
+                template <typename Q>
+                static retired_ptr make( Q&& f )
+                {
+                    return retired_ptr( reinterpret_cast<void *>( allocator_type().MoveNew( std::forward<Q>( f ))),
+                        reinterpret_cast<free_retired_ptr_func>( invoke ));
+                }
+            };
+            //@endcond
+
+            //@cond
+            // Grace period sequence of RCU singleton, see general_buffered::start_grace_period().
+            // The value is odd while a grace period is in progress.
+            // run() and poll() must be called under the lock of the singleton
+            class gp_sequence
+            {
+                atomics::atomic<uint64_t>   m_nSeq;
+                unsigned int                m_nPollStage;   // flavor-specific step of the polled grace period in progress
+
+            public:
+                gp_sequence()
+                    : m_nSeq( 0 )
+                    , m_nPollStage( 0 )
+                {}
+
+                // Returns the value of the sequence that means a full grace period has elapsed since the call:
+                // the end of the next grace period if no one is running, or the end of the one after the running
+                uint64_t snap() const
+                {
+                    atomics::atomic_thread_fence( atomics::memory_order_seq_cst );
+                    return ( m_nSeq.load( atomics::memory_order_seq_cst ) + 3 ) & ~uint64_t(1);
+                }
+
+                bool done( uint64_t nSnap ) const
+                {
+                    return m_nSeq.load( atomics::memory_order_acquire ) >= nSnap;
+                }
+
+                // Runs a blocking grace period, f() waits for the readers.
+                // If a polled grace period is in progress, the blocking one completes it
+                template <typename Func>
+                void run( Func f )
+                {
+                    uint64_t nSeq = m_nSeq.load( atomics::memory_order_relaxed );
+                    if ( nSeq & 1 ) {
+                        m_nPollStage = 0;
+                        --nSeq;
+                    }
+                    else
+                        m_nSeq.store( nSeq + 1, atomics::memory_order_seq_cst );
+
+                    f();
+
+                    m_nSeq.store( nSeq + 2, atomics::memory_order_release );
+                }
+
+                // Makes non-blocking steps of polled grace periods until nSnap is done or the readers have not passed yet.
+                // step( nStage ) makes the next step; nStage is 0 when a grace period begins.
+                // The step returns true when the grace period is completed.
+                // Return: true if a grace period has been completed
+                template <typename Step>
+                bool poll( uint64_t nSnap, Step step )
+                {
+                    bool bCompleted = false;
+                    while ( !done( nSnap )) {
+                        uint64_t const nSeq = m_nSeq.load( atomics::memory_order_relaxed );
+                        if ( !( nSeq & 1 )) {
+                            m_nSeq.store( nSeq + 1, atomics::memory_order_seq_cst );
+                            m_nPollStage = 0;
+                        }
+
+                        if ( !step( m_nPollStage ))
+                            break;
+
+                        m_nPollStage = 0;
+                        m_nSeq.store( ( nSeq | 1 ) + 1, atomics::memory_order_release );
+                        bCompleted = true;
+                    }
+                    return bCompleted;
+                }
+            };
+            //@endcond
+
             //@cond
             template <typename ThreadData>
             struct thread_list_record {
@@ -313,10 +477,12 @@ namespace cds {
 
             private:
                 atomics::atomic<thread_record *>   m_pHead;
+                atomics::atomic<size_t>            m_nFreeCount; // hint: count of records without owner
 
             public:
                 thread_list()
                     : m_pHead( nullptr )
+                    , m_nFreeCount( 0 )
                 {}
 
                 ~thread_list()
@@ -325,17 +491,32 @@ namespace cds {
                 }
 
                 thread_record * alloc()
+                {
+                    return alloc( []( thread_record const * ) { return true; } );
+                }
+
+                // Reuses a free record for which \p pred returns \p true, otherwise allocates a new record.
+                // The predicate is called for free records only, it may read the fields that
+                // the previous owner has set before retire()
+                template <typename Predicate>
+                thread_record * alloc( Predicate pred )
                 {
                     thread_record * pRec;
                     cds::OS::ThreadId const nullThreadId = cds::OS::c_NullThreadId;
                     cds::OS::ThreadId const curThreadId  = cds::OS::get_current_thread_id();
 
-                    // First try to reuse a retired (non-active) HP record
-                    for ( pRec = m_pHead.load( atomics::memory_order_acquire ); pRec; pRec = pRec->m_list.m_pNext ) {
-                        cds::OS::ThreadId thId = nullThreadId;
-                        if ( !pRec->m_list.m_idOwner.compare_exchange_strong( thId, curThreadId, atomics::memory_order_seq_cst, atomics::memory_order_relaxed ) )
-                            continue;
-                        return pRec;
+                    // First try to reuse a retired (non-active) record.
+                    // The list is not scanned if there is no free record
+                    if ( m_nFreeCount.load( atomics::memory_order_acquire ) != 0 ) {
+                        for ( pRec = m_pHead.load( atomics::memory_order_acquire ); pRec; pRec = pRec->m_list.m_pNext ) {
+                            cds::OS::ThreadId thId = nullThreadId;
+                            if ( pRec->m_list.m_idOwner.load( atomics::memory_order_acquire ) != nullThreadId
+                              || !pred( pRec )
+                              || !pRec->m_list.m_idOwner.compare_exchange_strong( thId, curThreadId, atomics::memory_order_seq_cst, atomics::memory_order_relaxed ) )
+                                continue;
+                            m_nFreeCount.fetch_sub( 1, atomics::memory_order_relaxed );
+                            return pRec;
+                        }
                     }
 
                     // No records available for reuse
@@ -356,6 +537,7 @@ namespace cds {
                 void retire( thread_record * pRec )
                 {
                     assert( pRec != nullptr );
+                    m_nFreeCount.fetch_add( 1, atomics::memory_order_relaxed );
                     pRec->m_list.m_idOwner.store( cds::OS::c_NullThreadId, atomics::memory_order_release );
                 }
 
@@ -452,6 +634,45 @@ namespace cds {
             {}
         };
 
+        //@cond
+        namespace details {
+            // Returns the item count of the buffer of buffered %RCU: Buffer::approx_size() if it is defined,
+            // Buffer::size() otherwise. The default VyukovMPMCCycleQueue has no item counter, its size() is always 0
+            template <class Buffer>
+            struct buffer_size
+            {
+                template <typename T> static char test( decltype( &T::approx_size ));
+                template <typename T> static int test( ... );
+                static CDS_CONSTEXPR const bool c_bApprox = sizeof( test<Buffer>( nullptr )) == sizeof(char);
+
+                static size_t get( Buffer const& buf, std::true_type )
+                {
+                    return buf.approx_size();
+                }
+                static size_t get( Buffer const& buf, std::false_type )
+                {
+                    return buf.size();
+                }
+                static size_t get( Buffer const& buf )
+                {
+                    return get( buf, std::integral_constant< bool, c_bApprox >() );
+                }
+            };
+
+            template <class Buffer>
+            inline size_t get_buffer_size( Buffer const& buf )
+            {
+                return buffer_size< Buffer >::get( buf );
+            }
+        } // namespace details
+        //@endcond
+
+        /// Retired pointer buffering of \p general_buffered and \p general_threaded %RCU
+        enum retire_buffering {
+            shared_buffer,  ///< all threads put retired pointers into one shared \p Buffer queue (default)
+            thread_buffer   ///< each attached thread puts retired pointers into its own buffer drained after a grace period
+        };
+
     } // namespace urcu
 } // namespace cds
 
@@ -39,8 +39,22 @@ namespace cds { namespace urcu { namespace details {
 
         uint32_t tmp = pRec->m_nAccessControl.load( atomics::memory_order_relaxed );
         if ( (tmp & rcu_class::c_nNestMask) == 0 ) {
-            pRec->m_nAccessControl.store( gp_singleton<RCUtag>::instance()->global_control_word(atomics::memory_order_relaxed),
-                atomics::memory_order_relaxed );
+            uint32_t const nControl = gp_singleton<RCUtag>::instance()->global_control_word(atomics::memory_order_relaxed);
+            pRec->m_nAccessControl.store( nControl, atomics::memory_order_relaxed );
+            if ( pRec->m_pGroupActive ) {
+                // Hierarchical registry: the record is published before the group summary is read,
+                // and the summary is set only if it is zero, see gp_singleton::scan_group().
+                // The grace period may skip the group if the summary is zero, so the control word is
+                // read again after the summary; if it has been flipped, the record is switched
+                // to the new control word. No shared data is read yet, so it is safe
+                atomics::atomic_thread_fence( atomics::memory_order_seq_cst );
+                if ( pRec->m_pGroupActive->load( atomics::memory_order_seq_cst ) == 0 )
+                    pRec->m_pGroupActive->store( 1, atomics::memory_order_seq_cst );
+
+                uint32_t const nNewControl = gp_singleton<RCUtag>::instance()->global_control_word(atomics::memory_order_seq_cst);
+                if ( nNewControl != nControl )
+                    pRec->m_nAccessControl.store( nNewControl, atomics::memory_order_relaxed );
+            }
             atomics::atomic_thread_fence( atomics::memory_order_acquire );
             //CDS_COMPILER_RW_BARRIER;
         }
@@ -80,20 +94,119 @@ namespace cds { namespace urcu { namespace details {
 
     template <typename RCUtag>
     template <class Backoff>
-    inline void gp_singleton<RCUtag>::flip_and_wait( Backoff& bkoff )
+    inline void gp_singleton<RCUtag>::wait_for_readers( typename gp_singleton<RCUtag>::thread_record * pRec, Backoff& bkoff )
     {
         OS::ThreadId const nullThreadId = OS::c_NullThreadId;
+        while ( pRec->m_list.m_idOwner.load( atomics::memory_order_acquire) != nullThreadId && check_grace_period( pRec ) ) {
+            bkoff();
+            CDS_COMPILER_RW_BARRIER;
+        }
+        bkoff.reset();
+    }
+
+    template <typename RCUtag>
+    template <typename Func>
+    inline bool gp_singleton<RCUtag>::scan_group( typename gp_singleton<RCUtag>::reader_group& g, Func f )
+    {
+        // The flip must precede the load of the summary, see gp_thread_gc::access_lock()
+        atomics::atomic_thread_fence( atomics::memory_order_seq_cst );
+        if ( g.m_nActive.load( atomics::memory_order_seq_cst ) == 0 )
+            return true;
+
+        // The summary is cleared before the records are read: a reader that publishes its record
+        // after the scan has read it finds the summary cleared and sets it again.
+        // Grace periods are serialized, so only one thread clears the summary
+        g.m_nActive.store( 0, atomics::memory_order_seq_cst );
+        atomics::atomic_thread_fence( atomics::memory_order_seq_cst );
+
+        OS::ThreadId const nullThreadId = OS::c_NullThreadId;
+        bool bActive = false;
+        bool bPassed = true;
+        for ( thread_record * pRec = g.m_pHead.load( atomics::memory_order_acquire ); pRec; pRec = pRec->m_pGroupNext ) {
+            if ( pRec->m_list.m_idOwner.load( atomics::memory_order_acquire ) == nullThreadId )
+                continue;
+            if ( !f( pRec )) {
+                // The rest of records is not scanned
+                bActive = true;
+                bPassed = false;
+                break;
+            }
+            if ( pRec->m_nAccessControl.load( atomics::memory_order_relaxed ) & general_purpose_rcu::c_nNestMask )
+                bActive = true;
+        }
+
+        if ( bActive )
+            g.m_nActive.store( 1, atomics::memory_order_seq_cst );
+        return bPassed;
+    }
+
+    template <typename RCUtag>
+    inline void gp_singleton<RCUtag>::flip()
+    {
         m_nGlobalControl.fetch_xor( general_purpose_rcu::c_nControlBit, atomics::memory_order_seq_cst );
+    }
 
-        for ( thread_record * pRec = m_ThreadList.head( atomics::memory_order_acquire); pRec; pRec = pRec->m_list.m_pNext ) {
-            while ( pRec->m_list.m_idOwner.load( atomics::memory_order_acquire) != nullThreadId && check_grace_period( pRec ) ) {
-                bkoff();
-                CDS_COMPILER_RW_BARRIER;
+    // Returns true if no thread is inside read-side critical section started before the last flip()
+    template <typename RCUtag>
+    inline bool gp_singleton<RCUtag>::readers_passed()
+    {
+        if ( m_arrGroups ) {
+            for ( size_t i = 0; i < m_nGroupCount; ++i ) {
+                if ( !scan_group( m_arrGroups[i], [this]( thread_record * pRec ) { return !check_grace_period( pRec ); } ))
+                    return false;
             }
-            bkoff.reset();
+            return true;
         }
+
+        OS::ThreadId const nullThreadId = OS::c_NullThreadId;
+        for ( thread_record * pRec = m_ThreadList.head( atomics::memory_order_acquire); pRec; pRec = pRec->m_list.m_pNext ) {
+            if ( pRec->m_list.m_idOwner.load( atomics::memory_order_acquire ) != nullThreadId && check_grace_period( pRec ))
+                return false;
+        }
+        return true;
     }
 
+    // Makes a non-blocking step of a grace period that is two flips each followed by waiting for readers.
+    // nStage is the number of flips done, 0 - the grace period is not started.
+    // Returns true if the readers have passed both flips
+    template <typename RCUtag>
+    inline bool gp_singleton<RCUtag>::advance_flips( unsigned int& nStage )
+    {
+        if ( nStage == 0 ) {
+            flip();
+            nStage = 1;
+        }
+
+        if ( nStage == 1 ) {
+            if ( !readers_passed() )
+                return false;
+            flip();
+            nStage = 2;
+        }
+
+        return readers_passed();
+    }
+
+    template <typename RCUtag>
+    template <class Backoff>
+    inline void gp_singleton<RCUtag>::flip_and_wait( Backoff& bkoff )
+    {
+        flip();
+
+        if ( m_arrGroups ) {
+            // Hierarchical registry: the groups without active readers are skipped
+            for ( size_t i = 0; i < m_nGroupCount; ++i ) {
+                scan_group( m_arrGroups[i], [this, &bkoff]( thread_record * pRec ) {
+                    wait_for_readers( pRec, bkoff );
+                    return true;
+                });
+            }
+        }
+        else {
+            for ( thread_record * pRec = m_ThreadList.head( atomics::memory_order_acquire); pRec; pRec = pRec->m_list.m_pNext )
+                wait_for_readers( pRec, bkoff );
+        }
+    }
 
 }}} // namespace cds:urcu::details
 //@endcond
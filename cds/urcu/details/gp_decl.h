@@ -6,6 +6,10 @@
 #include <cds/urcu/details/base.h>
 #include <cds/details/static_functor.h>
 #include <cds/details/lib.h>
+#include <cds/details/allocator.h>
+#include <cds/algo/int_algo.h>
+#include <cds/details/type_padding.h>
+#include <cds/user_setup/cache_line.h>
 
 //@cond
 namespace cds { namespace urcu { namespace details {
@@ -17,16 +21,139 @@ namespace cds { namespace urcu { namespace details {
     template <> struct thread_data<tag_> { \
         atomics::atomic<uint32_t>        m_nAccessControl ; \
         thread_list_record< thread_data >   m_list ; \
-        thread_data(): m_nAccessControl(0) {} \
+        atomics::atomic<uint32_t> *      m_pGroupActive ; \
+        thread_data *                    m_pGroupNext ; \
+        thread_data(): m_nAccessControl(0), m_pGroupActive( nullptr ), m_pGroupNext( nullptr ) {} \
         ~thread_data() {} \
     }
 
+    // Per-thread buffer of retired pointers of general_buffered and general_threaded RCU
+    // in cds::urcu::thread_buffer mode.
+    // It is a ring with single producer (the owner thread) and single consumer.
+    // The consumer is the thread that has passed a grace period; m_bDraining flag
+    // excludes concurrent consumers: a thread that finds the flag set skips the buffer.
+    // The ring is allocated on the first push
+    class thread_retire_buffer
+    {
+        typedef cds::details::Allocator< epoch_retired_ptr, CDS_DEFAULT_ALLOCATOR > allocator_type;
+
+        epoch_retired_ptr *         m_arr;
+        size_t                      m_nCapacity;    // power of 2
+        atomics::atomic<size_t>     m_nHead;        // next push position, changed by the owner only
+        atomics::atomic<size_t>     m_nTail;        // next pop position, changed by the consumer only
+        atomics::atomic<bool>       m_bDraining;
+
+    public:
+        thread_retire_buffer()
+            : m_arr( nullptr )
+            , m_nCapacity( 0 )
+            , m_nHead( 0 )
+            , m_nTail( 0 )
+            , m_bDraining( false )
+        {}
+
+        ~thread_retire_buffer()
+        {
+            assert( size() == 0 );
+            if ( m_arr )
+                allocator_type().Delete( m_arr, m_nCapacity );
+        }
+
+        // Called by the owner thread only. Returns false if the buffer is full
+        bool push( epoch_retired_ptr const& p, size_t nCapacity )
+        {
+            if ( !m_arr ) {
+                m_nCapacity = cds::beans::ceil2( nCapacity );
+                m_arr = allocator_type().NewArray( m_nCapacity );
+            }
+
+            size_t const nHead = m_nHead.load( atomics::memory_order_relaxed );
+            if ( nHead - m_nTail.load( atomics::memory_order_acquire ) >= m_nCapacity )
+                return false;
+            m_arr[ nHead & (m_nCapacity - 1) ] = p;
+            m_nHead.store( nHead + 1, atomics::memory_order_release );
+            return true;
+        }
+
+        // Passes the retired pointers with epoch <= nEpoch to f in FIFO order while f returns true.
+        // The item is removed from the buffer if f returns true.
+        // Returns the count of removed items
+        template <typename Func>
+        size_t drain( uint64_t nEpoch, Func f )
+        {
+            if ( m_bDraining.exchange( true, atomics::memory_order_acquire ))
+                return 0;
+
+            size_t nCount = 0;
+            size_t nTail = m_nTail.load( atomics::memory_order_relaxed );
+            size_t const nHead = m_nHead.load( atomics::memory_order_acquire );
+            for ( ; nTail != nHead; ++nTail ) {
+                epoch_retired_ptr p = m_arr[ nTail & (m_nCapacity - 1) ];
+                if ( p.m_nEpoch > nEpoch || !f( p ))
+                    break;
+                m_nTail.store( nTail + 1, atomics::memory_order_release );
+                ++nCount;
+            }
+
+            m_bDraining.store( false, atomics::memory_order_release );
+            return nCount;
+        }
+
+        // May be called by any thread. The tail is read first, so the result is not negative
+        size_t size() const
+        {
+            size_t const nTail = m_nTail.load( atomics::memory_order_acquire );
+            return m_nHead.load( atomics::memory_order_relaxed ) - nTail;
+        }
+    };
+
     CDS_GPURCU_DECLARE_THREAD_DATA( general_instant_tag );
-    CDS_GPURCU_DECLARE_THREAD_DATA( general_buffered_tag );
-    CDS_GPURCU_DECLARE_THREAD_DATA( general_threaded_tag );
 
 #   undef CDS_GPURCU_DECLARE_THREAD_DATA
 
+#   define CDS_GPURCU_DECLARE_BUFFERED_THREAD_DATA(tag_) \
+    template <> struct thread_data<tag_> { \
+        atomics::atomic<uint32_t>        m_nAccessControl ; \
+        thread_list_record< thread_data >   m_list ; \
+        atomics::atomic<uint32_t> *      m_pGroupActive ; \
+        thread_data *                    m_pGroupNext ; \
+        thread_retire_buffer                m_RetireBuffer ; \
+        thread_data(): m_nAccessControl(0), m_pGroupActive( nullptr ), m_pGroupNext( nullptr ) {} \
+        ~thread_data() {} \
+    }
+
+    CDS_GPURCU_DECLARE_BUFFERED_THREAD_DATA( general_buffered_tag );
+    CDS_GPURCU_DECLARE_BUFFERED_THREAD_DATA( general_threaded_tag );
+
+#   undef CDS_GPURCU_DECLARE_BUFFERED_THREAD_DATA
+
+    // Returns the reader group index [0, nGroupCount) for current thread (by current processor)
+    CDS_EXPORT_API size_t gp_reader_group_index( size_t nGroupCount );
+
+    // Reader group of the hierarchical thread registry of general-purpose RCU.
+    // A thread record is bound to a group when it is allocated; the group is chosen by current processor
+    // when the thread attaches, a free record is reused only by a thread attaching in the same group.
+    // m_nActive is the summary of the nesting counters of group's records: it is nonzero if a thread
+    // of the group may be inside read-side critical section. The reader sets it only if it is zero,
+    // the grace period clears it and scans the records of the group, see gp_singleton::scan_group().
+    // The grace period skips the group entirely if m_nActive is zero.
+    // The group list of thread records is push-only like thread_list
+    template <typename ThreadRecord>
+    struct gp_reader_group_data
+    {
+        atomics::atomic<uint32_t>       m_nActive;
+        atomics::atomic<ThreadRecord *> m_pHead;
+
+        gp_reader_group_data()
+            : m_nActive( 0 )
+            , m_pHead( nullptr )
+        {}
+    };
+
+    template <typename ThreadRecord>
+    struct gp_reader_group: public cds::details::type_padding< gp_reader_group_data< ThreadRecord >, cds::c_nCacheLineSize >::type
+    {};
+
     template <typename RCUtag>
     struct gp_singleton_instance
     {
@@ -100,17 +227,28 @@ namespace cds { namespace urcu { namespace details {
         typedef typename thread_gc::thread_record   thread_record;
         typedef gp_singleton_instance< rcu_tag >    rcu_instance;
 
+        typedef gp_reader_group< thread_record >    reader_group;
+        typedef cds::details::Allocator< reader_group, CDS_DEFAULT_ALLOCATOR > reader_group_allocator;
+
     protected:
         atomics::atomic<uint32_t>    m_nGlobalControl;
         thread_list< rcu_tag >          m_ThreadList;
+        cds::gc::details::reclaim_counters  m_ReclaimStat;   ///< Reclamation telemetry
+        reader_group *                  m_arrGroups;    // nullptr - flat thread registry
+        size_t const                    m_nGroupCount;
 
     protected:
-        gp_singleton()
+        gp_singleton( size_t nReaderGroups = 0 )
             : m_nGlobalControl(1)
+            , m_arrGroups( nReaderGroups ? reader_group_allocator().NewArray( nReaderGroups ) : nullptr )
+            , m_nGroupCount( nReaderGroups )
         {}
 
         ~gp_singleton()
-        {}
+        {
+            if ( m_arrGroups )
+                reader_group_allocator().Delete( m_arrGroups, m_nGroupCount );
+        }
 
     public:
         static gp_singleton * instance()
@@ -129,7 +267,24 @@ namespace cds { namespace urcu { namespace details {
     public: // thread_gc interface
         thread_record * attach_thread()
         {
-            return m_ThreadList.alloc();
+            if ( !m_arrGroups )
+                return m_ThreadList.alloc();
+
+            // A record is bound to its group for life since the group list is push-only.
+            // So only a free record of the group of current processor is reused,
+            // otherwise a new record is allocated and bound to that group
+            reader_group& g = m_arrGroups[ gp_reader_group_index( m_nGroupCount ) ];
+            thread_record * pRec = m_ThreadList.alloc( [&g]( thread_record const * p ) { return p->m_pGroupActive == &g.m_nActive; } );
+            if ( !pRec->m_pGroupActive ) {
+                // New record
+                pRec->m_pGroupActive = &g.m_nActive;
+
+                thread_record * pOldHead = g.m_pHead.load( atomics::memory_order_acquire );
+                do {
+                    pRec->m_pGroupNext = pOldHead;
+                } while ( !g.m_pHead.compare_exchange_weak( pOldHead, pRec, atomics::memory_order_release, atomics::memory_order_relaxed ));
+            }
+            return pRec;
         }
 
         void detach_thread( thread_record * pRec )
@@ -142,11 +297,50 @@ namespace cds { namespace urcu { namespace details {
             return m_nGlobalControl.load( mo );
         }
 
+        /// Returns the number of reader groups, 0 means flat thread registry
+        size_t reader_group_count() const
+        {
+            return m_nGroupCount;
+        }
+
     protected:
         bool check_grace_period( thread_record * pRec ) const;
 
+        // Returns the count of retired pointers in per-thread buffers, for statistics
+        size_t thread_buffers_size() const
+        {
+            size_t nCount = 0;
+            for ( thread_record * pRec = m_ThreadList.head( atomics::memory_order_acquire ); pRec; pRec = pRec->m_list.m_pNext )
+                nCount += pRec->m_RetireBuffer.size();
+            return nCount;
+        }
+
+        // Passes the retired pointers with epoch <= nEpoch from per-thread buffers to f,
+        // see thread_retire_buffer::drain(). Returns the count of items removed
+        template <typename Func>
+        size_t drain_thread_buffers( uint64_t nEpoch, Func f )
+        {
+            size_t nCount = 0;
+            for ( thread_record * pRec = m_ThreadList.head( atomics::memory_order_acquire ); pRec; pRec = pRec->m_list.m_pNext )
+                nCount += pRec->m_RetireBuffer.drain( nEpoch, f );
+            return nCount;
+        }
+
         template <class Backoff>
         void flip_and_wait( Backoff& bkoff );
+
+        // Non-blocking parts of flip_and_wait() for polled grace periods
+        void flip();
+        bool readers_passed();
+        bool advance_flips( unsigned int& nStage );
+
+        template <class Backoff>
+        void wait_for_readers( thread_record * pRec, Backoff& bkoff );
+
+        // Scans the records of group g after the flip, f( pRec ) is called for each attached record
+        // and returns false to stop the scan. Returns false if the scan has been stopped
+        template <typename Func>
+        bool scan_group( reader_group& g, Func f );
     };
 
 #   define CDS_GP_RCU_DECLARE_SINGLETON( tag_ ) \
@@ -30,6 +30,23 @@ namespace cds { namespace urcu {
 
         The buffer is considered as full if \p push returns \p false or the buffer size reaches the RCU threshold.
 
+        Concurrent \p synchronize() callers share grace periods. Each completed grace period advances
+        an internal sequence number. A caller takes a snapshot of the sequence on entry.
+        If a grace period that started after the snapshot has completed while the caller was waiting
+        for the lock, the caller returns without running its own grace period.
+        So N simultaneous updaters cost about one or two grace periods instead of N.
+
+        An updater that cannot block may use polled grace periods: \p start_grace_period() returns a cookie
+        and \p poll_grace_period() checks it without blocking, advancing the grace period step by step.
+        \p synchronize_expedited() waits for a grace period with minimal latency.
+
+        By default all threads put retired pointers into one shared \p Buffer queue that can become
+        a contention point under heavy erase traffic. In \p cds::urcu::thread_buffer mode
+        (see \p Construct() and \p set_buffering()) each attached thread has its own buffer
+        of the same capacity; the buffers of all threads are drained after each grace period.
+        \p synchronize() is called when the buffer of current thread becomes full.
+        A thread that is not attached to the %RCU uses the shared buffer in any mode.
+
         There is a wrapper \ref cds_urcu_general_buffered_gc "gc<general_buffered>" for \p %general_buffered class
         that provides unified RCU interface. You should use this wrapper class instead \p %general_buffered
 
@@ -53,6 +70,7 @@ namespace cds { namespace urcu {
         typedef Buffer  buffer_type ;   ///< Buffer type
         typedef Lock    lock_type   ;   ///< Lock type
         typedef Backoff back_off    ;   ///< Back-off type
+        typedef uint64_t gp_cookie  ;   ///< Grace period cookie, see \p start_grace_period()
 
         typedef base_class::thread_gc thread_gc ;   ///< Thread-side RCU part
         typedef typename thread_gc::scoped_lock scoped_lock ; ///< Access lock class
@@ -70,6 +88,10 @@ namespace cds { namespace urcu {
         atomics::atomic<uint64_t>    m_nCurEpoch;
         lock_type                       m_Lock;
         size_t const                    m_nCapacity;
+        details::gp_sequence            m_GPSeq;    // grace period sequence, guarded by m_Lock
+        uint64_t                        m_nGPEpoch; // buffer epoch covered by the last completed grace period, guarded by m_Lock
+        uint64_t                        m_nPollEpoch;   // buffer epoch covered by the polled grace period in progress, guarded by m_Lock
+        atomics::atomic<retire_buffering>   m_nBuffering;
         //@endcond
 
     public:
@@ -86,44 +108,100 @@ namespace cds { namespace urcu {
 
     protected:
         //@cond
-        general_buffered( size_t nBufferCapacity )
-            : m_Buffer( nBufferCapacity )
+        general_buffered( size_t nBufferCapacity, retire_buffering nBuffering, size_t nReaderGroups )
+            : base_class( nReaderGroups )
+            , m_Buffer( nBufferCapacity )
             , m_nCurEpoch(0)
             , m_nCapacity( nBufferCapacity )
+            , m_nGPEpoch( 0 )
+            , m_nPollEpoch( 0 )
+            , m_nBuffering( nBuffering )
         {}
 
         ~general_buffered()
         {
+            clear_thread_buffers( (uint64_t) -1 );
             clear_buffer( (uint64_t) -1 );
         }
 
-        void flip_and_wait()
+        // Runs a full grace period, m_Lock must be locked.
+        // Return: the buffer epoch covered by the grace period
+        template <class BackOff>
+        uint64_t run_grace_period()
         {
-            back_off bkoff;
-            base_class::flip_and_wait( bkoff );
+            uint64_t const nEpoch = m_nCurEpoch.fetch_add( 1, atomics::memory_order_relaxed );
+            m_GPSeq.run( [this]() {
+                BackOff bkoff;
+                base_class::flip_and_wait( bkoff );
+                base_class::flip_and_wait( bkoff );
+            });
+            m_nGPEpoch = nEpoch;
+            return nEpoch;
+        }
+
+        // Makes non-blocking steps of the polled grace period, m_Lock must be locked.
+        // Return: true and the buffer epoch covered in nEpoch if a grace period is completed
+        bool advance_polled_grace_period( gp_cookie nCookie, uint64_t& nEpoch )
+        {
+            return m_GPSeq.poll( nCookie, [this, &nEpoch]( unsigned int& nStage ) -> bool {
+                if ( nStage == 0 )
+                    m_nPollEpoch = m_nCurEpoch.fetch_add( 1, atomics::memory_order_relaxed );
+                if ( !base_class::advance_flips( nStage ))
+                    return false;
+                m_nGPEpoch = nEpoch = m_nPollEpoch;
+                return true;
+            });
         }
 
-        void clear_buffer( uint64_t nEpoch )
+        // Return: the count of retired pointers freed
+        size_t clear_buffer( uint64_t nEpoch )
         {
+            size_t nFreed = 0;
             epoch_retired_ptr p;
             while ( m_Buffer.pop( p )) {
-                if ( p.m_nEpoch <= nEpoch )
+                if ( p.m_nEpoch <= nEpoch ) {
                     p.free();
+                    ++nFreed;
+                }
                 else {
                     push_buffer( p );
                     break;
                 }
             }
+            return nFreed;
+        }
+
+        // Return: the count of retired pointers freed
+        size_t clear_thread_buffers( uint64_t nEpoch )
+        {
+            return base_class::drain_thread_buffers( nEpoch, []( epoch_retired_ptr& p ) -> bool { p.free(); return true; } );
+        }
+
+        // Returns the record of current thread if its own buffer should be used, nullptr otherwise
+        typename base_class::thread_record * thread_buffer_owner() const
+        {
+            if ( m_nBuffering.load( atomics::memory_order_relaxed ) == thread_buffer && cds::threading::Manager::isThreadAttached() )
+                return cds::threading::getRCU< rcu_tag >();
+            return nullptr;
+        }
+
+        bool is_buffer_full() const
+        {
+            typename base_class::thread_record * pRec = thread_buffer_owner();
+            return ( pRec ? pRec->m_RetireBuffer.size() : m_Buffer.size() ) >= capacity();
         }
 
         // Return: true - synchronize has been called, false - otherwise
         bool push_buffer( epoch_retired_ptr& ep )
         {
-            bool bPushed = m_Buffer.push( ep );
-            if ( !bPushed || m_Buffer.size() >= capacity() ) {
+            typename base_class::thread_record * pRec = thread_buffer_owner();
+            bool bPushed = pRec ? pRec->m_RetireBuffer.push( ep, capacity() ) : m_Buffer.push( ep );
+            if ( !bPushed || ( pRec ? pRec->m_RetireBuffer.size() : m_Buffer.size() ) >= capacity() ) {
                 synchronize();
-                if ( !bPushed )
+                if ( !bPushed ) {
                     ep.free();
+                    base_class::m_ReclaimStat.on_free( 1 );
+                }
                 return true;
             }
             return false;
@@ -134,17 +212,21 @@ namespace cds { namespace urcu {
         /// Creates singleton object
         /**
             The \p nBufferCapacity parameter defines RCU threshold.
+            In \p cds::urcu::thread_buffer mode (\p nBuffering) it is the capacity of the buffer of each thread.
+            \p nReaderGroups - the number of reader groups of hierarchical thread registry, see \ref cds_urcu_gp_reader_groups "reader groups".
+            0 (default) means flat registry.
         */
-        static void Construct( size_t nBufferCapacity = 256 )
+        static void Construct( size_t nBufferCapacity = 256, retire_buffering nBuffering = shared_buffer, size_t nReaderGroups = 0 )
         {
             if ( !singleton_ptr::s_pRCU )
-                singleton_ptr::s_pRCU = new general_buffered( nBufferCapacity );
+                singleton_ptr::s_pRCU = new general_buffered( nBufferCapacity, nBuffering, nReaderGroups );
         }
 
         /// Destroys singleton object
         static void Destruct( bool bDetachAll = false )
         {
             if ( isUsed() ) {
+                instance()->clear_thread_buffers( (uint64_t) -1 );
                 instance()->clear_buffer( (uint64_t) -1 );
                 if ( bDetachAll )
                     instance()->m_ThreadList.detach_all();
@@ -181,6 +263,11 @@ namespace cds { namespace urcu {
         }
 
         /// Wait to finish a grace period and then clear the buffer
+        /**
+            If another thread completes a full grace period while the caller is waiting for the internal lock,
+            the caller shares that grace period and returns without waiting again.
+            In this case the caller frees only the retired pointers covered by the shared grace period.
+        */
         void synchronize()
         {
             epoch_retired_ptr ep( retired_ptr(), m_nCurEpoch.load( atomics::memory_order_relaxed ));
@@ -191,26 +278,130 @@ namespace cds { namespace urcu {
         bool synchronize( epoch_retired_ptr& ep )
         {
             uint64_t nEpoch;
-            atomics::atomic_thread_fence( atomics::memory_order_acquire );
+            size_t nBacklog;
+            cds::gc::details::scan_timer timer;
+            uint64_t const nSnap = m_GPSeq.snap();
             {
                 std::unique_lock<lock_type> sl( m_Lock );
-                if ( ep.m_p && m_Buffer.push( ep ) )
+                if ( ep.m_p && m_Buffer.push( ep ))
                     return false;
-                nEpoch = m_nCurEpoch.fetch_add( 1, atomics::memory_order_relaxed );
-                flip_and_wait();
-                flip_and_wait();
+
+                if ( m_GPSeq.done( nSnap )) {
+                    // Another thread has passed a full grace period while we were waiting for the lock.
+                    // If the buffer is still full after freeing the pointers covered by that grace period
+                    // we run our own one, otherwise each next retire_ptr() would call synchronize() again.
+                    // clear_buffer() may call synchronize() recursively, so the lock is released
+                    nEpoch = m_nGPEpoch;
+                    sl.unlock();
+                    base_class::m_ReclaimStat.on_free( clear_thread_buffers( nEpoch ) + clear_buffer( nEpoch ));
+                    if ( !is_buffer_full() )
+                        return true;
+                    sl.lock();
+                }
+
+                nBacklog = details::get_buffer_size( m_Buffer ) + base_class::thread_buffers_size();
+                nEpoch = run_grace_period< back_off >();
             }
-            clear_buffer( nEpoch );
+            size_t const nFreed = clear_thread_buffers( nEpoch ) + clear_buffer( nEpoch );
+            base_class::m_ReclaimStat.on_scan( nBacklog, nFreed, timer.elapsed() );
             atomics::atomic_thread_fence( atomics::memory_order_release );
             return true;
         }
         //@endcond
 
+        /// Starts a grace period without waiting for its end
+        /**
+            The function returns a cookie that should be passed to \p poll_grace_period().
+            The grace period identified by the cookie begins after the call, so the objects
+            removed before \p %start_grace_period() may be freed when the cookie is completed.
+            The function makes the first non-blocking step of the grace period if no thread is running one.
+        */
+        gp_cookie start_grace_period()
+        {
+            gp_cookie const nCookie = m_GPSeq.snap();
+            poll_grace_period( nCookie );
+            return nCookie;
+        }
+
+        /// Checks if the grace period identified by \p nCookie is completed
+        /**
+            The function never blocks. If the grace period is not completed and no other thread
+            is running a grace period now, the function makes a step of the polled grace period:
+            it checks the reader threads once and, if all of them have passed, advances the grace period.
+            When a grace period is completed by \p %poll_grace_period() the retired pointers covered by it
+            are freed in the calling thread.
+
+            The caller should call \p %poll_grace_period() periodically until it returns \p true,
+            doing other work between the calls.
+        */
+        bool poll_grace_period( gp_cookie nCookie )
+        {
+            uint64_t nEpoch = 0;
+            bool bCompleted;
+            {
+                std::unique_lock<lock_type> sl( m_Lock, std::try_to_lock );
+                if ( !sl.owns_lock() ) {
+                    // Another thread is running a grace period now
+                    return m_GPSeq.done( nCookie );
+                }
+                bCompleted = advance_polled_grace_period( nCookie, nEpoch );
+            }
+            if ( bCompleted )
+                base_class::m_ReclaimStat.on_free( clear_thread_buffers( nEpoch ) + clear_buffer( nEpoch ));
+            return m_GPSeq.done( nCookie );
+        }
+
+        /// Waits for the end of grace period with minimal latency
+        /**
+            Unlike \p synchronize() the function busy-waits for the reader threads
+            by \p cds::backoff::pause instead of \p Backoff template argument and does not free the buffer:
+            the pointers covered by the grace period are freed by the next \p synchronize()
+            or \p poll_grace_period(). If another thread completes a full grace period
+            while the caller is waiting for the internal lock, the caller shares it.
+        */
+        void synchronize_expedited()
+        {
+            uint64_t const nSnap = m_GPSeq.snap();
+            std::unique_lock<lock_type> sl( m_Lock );
+            if ( !m_GPSeq.done( nSnap ))
+                run_grace_period< cds::backoff::pause >();
+        }
+
         /// Returns internal buffer capacity
         size_t capacity() const
         {
             return m_nCapacity;
         }
+
+        /// Returns current retired pointer buffering mode
+        retire_buffering buffering() const
+        {
+            return m_nBuffering.load( atomics::memory_order_relaxed );
+        }
+
+        /// Changes retired pointer buffering mode
+        /**
+            The mode may be changed on the fly: the buffers of both kinds are drained after each grace period.
+        */
+        void set_buffering( retire_buffering nBuffering )
+        {
+            m_nBuffering.store( nBuffering, atomics::memory_order_relaxed );
+        }
+
+        /// Returns reclamation telemetry
+        /**
+            A scan is a grace period followed by freeing the internal buffer.
+            \p reclaim_stat::nBacklog is the current size of the buffer (the sum of per-thread buffers
+            in \p cds::urcu::thread_buffer mode). The per-thread buffers are summed over the thread list
+            when the function is called, so the retire path does not maintain a shared counter.
+        */
+        cds::gc::reclaim_stat& statistics( cds::gc::reclaim_stat& st )
+        {
+            st.clear();
+            base_class::m_ReclaimStat.collect( st );
+            st.nBacklog = details::get_buffer_size( m_Buffer ) + base_class::thread_buffers_size();
+            return st;
+        }
     };
 
 }} // namespace cds::urcu
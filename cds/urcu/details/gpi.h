@@ -19,6 +19,11 @@ namespace cds { namespace urcu {
         After that the retired object is freed immediately.
         Thus, the implementation blocks for any retired object
 
+        An updater that cannot block may use polled grace periods: \p start_grace_period() returns a cookie
+        and \p poll_grace_period() checks it without blocking, advancing the grace period step by step.
+        \p synchronize_expedited() waits for a grace period with minimal latency.
+        Polled and blocking grace periods share one sequence, see \ref general_buffered.
+
         There is a wrapper \ref cds_urcu_general_instant_gc "gc<general_instant>" for \p %general_instant class
         that provides unified RCU interface. You should use this wrapper class instead \p %general_instant
 
@@ -40,6 +45,7 @@ namespace cds { namespace urcu {
         typedef general_instant_tag rcu_tag ;   ///< RCU tag
         typedef Lock    lock_type   ;           ///< Lock type
         typedef Backoff back_off    ;           ///< Back-off schema type
+        typedef uint64_t gp_cookie  ;           ///< Grace period cookie, see \p start_grace_period()
 
         typedef typename base_class::thread_gc  thread_gc ;   ///< Thread-side RCU part
         typedef typename thread_gc::scoped_lock scoped_lock ; ///< Access lock class
@@ -53,7 +59,8 @@ namespace cds { namespace urcu {
 
     protected:
         //@cond
-        lock_type   m_Lock;
+        lock_type               m_Lock;
+        details::gp_sequence    m_GPSeq;    // grace period sequence, guarded by m_Lock
         //@endcond
 
     public:
@@ -71,24 +78,34 @@ namespace cds { namespace urcu {
 
     protected:
         //@cond
-        general_instant()
+        general_instant( size_t nReaderGroups )
+            : base_class( nReaderGroups )
         {}
         ~general_instant()
         {}
 
-        void flip_and_wait()
+        // Runs a full grace period, m_Lock must be locked
+        template <class BackOff>
+        void run_grace_period()
         {
-            back_off bkoff;
-            base_class::flip_and_wait( bkoff );
+            m_GPSeq.run( [this]() {
+                BackOff bkoff;
+                base_class::flip_and_wait( bkoff );
+                base_class::flip_and_wait( bkoff );
+            });
         }
         //@endcond
 
     public:
         /// Creates singleton object
-        static void Construct()
+        /**
+            \p nReaderGroups - the number of reader groups of hierarchical thread registry, see \ref cds_urcu_gp_reader_groups "reader groups".
+            0 (default) means flat registry.
+        */
+        static void Construct( size_t nReaderGroups = 0 )
         {
             if ( !singleton_ptr::s_pRCU )
-                singleton_ptr::s_pRCU = new general_instant();
+                singleton_ptr::s_pRCU = new general_instant( nReaderGroups );
         }
 
         /// Destroys singleton object
@@ -110,9 +127,12 @@ namespace cds { namespace urcu {
         */
         virtual void retire_ptr( retired_ptr& p )
         {
+            cds::gc::details::scan_timer timer;
             synchronize();
-            if ( p.m_p )
+            if ( p.m_p ) {
                 p.free();
+                base_class::m_ReclaimStat.on_scan( 1, 1, timer.elapsed() );
+            }
         }
 
         /// Retires the pointer chain [\p itFirst, \p itLast)
@@ -120,13 +140,18 @@ namespace cds { namespace urcu {
         void batch_retire( ForwardIterator itFirst, ForwardIterator itLast )
         {
             if ( itFirst != itLast ) {
+                cds::gc::details::scan_timer timer;
                 synchronize();
+                size_t nFreed = 0;
                 while ( itFirst != itLast ) {
                     retired_ptr p( *itFirst );
                     ++itFirst;
-                    if ( p.m_p )
+                    if ( p.m_p ) {
                         p.free();
+                        ++nFreed;
+                    }
                 }
+                base_class::m_ReclaimStat.on_scan( nFreed, nFreed, timer.elapsed() );
             }
         }
 
@@ -136,12 +161,56 @@ namespace cds { namespace urcu {
             atomics::atomic_thread_fence( atomics::memory_order_acquire );
             {
                 std::unique_lock<lock_type> sl( m_Lock );
-                flip_and_wait();
-                flip_and_wait();
+                run_grace_period< back_off >();
             }
             atomics::atomic_thread_fence( atomics::memory_order_release );
         }
 
+        /// Starts a grace period without waiting for its end
+        /**
+            The function returns a cookie that should be passed to \p poll_grace_period().
+            The grace period identified by the cookie begins after the call.
+            The function makes the first non-blocking step of the grace period if no thread is running one.
+        */
+        gp_cookie start_grace_period()
+        {
+            gp_cookie const nCookie = m_GPSeq.snap();
+            poll_grace_period( nCookie );
+            return nCookie;
+        }
+
+        /// Checks if the grace period identified by \p nCookie is completed
+        /**
+            The function never blocks. If the grace period is not completed and no other thread
+            is running a grace period now, the function checks the reader threads once and,
+            if all of them have passed, advances the grace period.
+        */
+        bool poll_grace_period( gp_cookie nCookie )
+        {
+            std::unique_lock<lock_type> sl( m_Lock, std::try_to_lock );
+            if ( sl.owns_lock() ) {
+                m_GPSeq.poll( nCookie, [this]( unsigned int& nStage ) -> bool {
+                    return base_class::advance_flips( nStage );
+                });
+            }
+            return m_GPSeq.done( nCookie );
+        }
+
+        /// Waits for the end of grace period with minimal latency
+        /**
+            Unlike \p synchronize() the function busy-waits for the reader threads
+            by \p cds::backoff::pause instead of \p Backoff template argument.
+            If another thread completes a full grace period while the caller is waiting for the internal lock,
+            the caller shares it.
+        */
+        void synchronize_expedited()
+        {
+            uint64_t const nSnap = m_GPSeq.snap();
+            std::unique_lock<lock_type> sl( m_Lock );
+            if ( !m_GPSeq.done( nSnap ))
+                run_grace_period< cds::backoff::pause >();
+        }
+
         //@cond
         // Added for uniformity
         size_t CDS_CONSTEXPR capacity() const
@@ -149,6 +218,18 @@ namespace cds { namespace urcu {
             return 1;
         }
         //@endcond
+
+        /// Returns reclamation telemetry
+        /**
+            A scan is the grace period waited by \p retire_ptr() or \p batch_retire() followed by freeing the pointers retired.
+            There is no backlog since the retired pointers are freed immediately.
+        */
+        cds::gc::reclaim_stat& statistics( cds::gc::reclaim_stat& st )
+        {
+            st.clear();
+            base_class::m_ReclaimStat.collect( st );
+            return st;
+        }
     };
 
 }} // namespace cds::urcu
@@ -23,6 +23,15 @@ namespace cds { namespace urcu {
         The reclamation thread frees the buffer.
         This synchronization cycle may be called in any thread that calls \ref retire_ptr function.
 
+        In \p cds::urcu::thread_buffer mode (see \p Construct() and \p set_buffering()) each attached thread
+        puts retired pointers into its own buffer instead of the shared one, see \ref general_buffered.
+        After a grace period the per-thread buffers are moved to the shared buffer that is passed
+        to the reclamation thread, so the shared buffer is accessed by one thread at a time.
+
+        Polled grace periods (\p start_grace_period(), \p poll_grace_period()) and \p synchronize_expedited()
+        are supported like in \ref general_buffered. When a polled grace period is completed
+        the retired pointers covered by it are passed to the reclamation thread.
+
         There is a wrapper \ref cds_urcu_general_threaded_gc "gc<general_threaded>" for \p %general_threaded class
         that provides unified RCU interface. You should use this wrapper class instead \p %general_threaded
 
@@ -53,6 +62,7 @@ namespace cds { namespace urcu {
         typedef Lock            lock_type   ;   ///< Lock type
         typedef Backoff         back_off    ;   ///< Back-off scheme
         typedef DisposerThread  disposer_thread ;   ///< Disposer thread type
+        typedef uint64_t        gp_cookie   ;   ///< Grace period cookie, see \p start_grace_period()
 
         typedef general_threaded_tag    rcu_tag ;       ///< Thread-side RCU part
         typedef base_class::thread_gc   thread_gc ;     ///< Access lock class
@@ -79,6 +89,9 @@ namespace cds { namespace urcu {
         lock_type                       m_Lock;
         size_t const                    m_nCapacity;
         disposer_thread                 m_DisposerThread;
+        atomics::atomic<retire_buffering>   m_nBuffering;
+        details::gp_sequence            m_GPSeq;    // grace period sequence, guarded by m_Lock
+        uint64_t                        m_nPollEpoch;   // buffer epoch covered by the polled grace period in progress, guarded by m_Lock
         //@endcond
 
     public:
@@ -95,26 +108,85 @@ namespace cds { namespace urcu {
 
     protected:
         //@cond
-        general_threaded( size_t nBufferCapacity )
-            : m_Buffer( nBufferCapacity )
+        general_threaded( size_t nBufferCapacity, retire_buffering nBuffering, size_t nReaderGroups )
+            : base_class( nReaderGroups )
+            , m_Buffer( nBufferCapacity )
             , m_nCurEpoch( 1 )
             , m_nCapacity( nBufferCapacity )
+            , m_nBuffering( nBuffering )
+            , m_nPollEpoch( 0 )
         {}
 
-        void flip_and_wait()
+        // Runs a full grace period, m_Lock must be locked
+        template <class BackOff>
+        void run_grace_period()
+        {
+            m_GPSeq.run( [this]() {
+                BackOff bkoff;
+                base_class::flip_and_wait( bkoff );
+                base_class::flip_and_wait( bkoff );
+            });
+        }
+
+        // Passes the retired pointers with epoch <= nEpoch to the reclamation thread, m_Lock must be locked.
+        // Returns the count of retired pointers handed off; nBacklog is the count of buffered pointers before the hand-off
+        size_t hand_off( uint64_t nEpoch, bool bSync, size_t& nBacklog )
+        {
+            // The pointers with newer epoch stay in per-thread buffers.
+            // m_Buffer is handed off to the reclamation thread as a whole
+            size_t nHandedOff = details::get_buffer_size( m_Buffer );
+            nBacklog = nHandedOff + base_class::thread_buffers_size();
+            while ( true ) {
+                bool bFull = false;
+                nHandedOff += move_thread_buffers( nEpoch, bFull );
+                if ( !bFull )
+                    break;
+
+                // m_Buffer has the capacity of one per-thread buffer and it is full.
+                // The reclamation thread frees it, then the rest of per-thread buffers is moved.
+                // If nothing has been freed m_Buffer contains the pointers retired after the grace period,
+                // the rest is moved on next hand-off
+                size_t const nSize = details::get_buffer_size( m_Buffer );
+                m_DisposerThread.dispose( m_Buffer, nEpoch, true );
+                if ( details::get_buffer_size( m_Buffer ) >= nSize )
+                    break;
+            }
+            m_DisposerThread.dispose( m_Buffer, nEpoch, bSync );
+            return nHandedOff;
+        }
+
+        // Returns the record of current thread if its own buffer should be used, nullptr otherwise
+        typename base_class::thread_record * thread_buffer_owner() const
+        {
+            if ( m_nBuffering.load( atomics::memory_order_relaxed ) == thread_buffer && cds::threading::Manager::isThreadAttached() )
+                return cds::threading::getRCU< rcu_tag >();
+            return nullptr;
+        }
+
+        // Moves the retired pointers with epoch <= nEpoch from per-thread buffers to m_Buffer,
+        // bFull is set if m_Buffer has become full. Returns the count of pointers moved
+        size_t move_thread_buffers( uint64_t nEpoch, bool& bFull )
         {
-            back_off bkoff;
-            base_class::flip_and_wait( bkoff );
+            buffer_type& buf = m_Buffer;
+            return base_class::drain_thread_buffers( nEpoch, [&buf, &bFull]( epoch_retired_ptr& p ) -> bool {
+                if ( buf.push( p ))
+                    return true;
+                bFull = true;
+                return false;
+            });
         }
 
         // Return: true - synchronize has been called, false - otherwise
         bool push_buffer( epoch_retired_ptr& p )
         {
-            bool bPushed = m_Buffer.push( p );
-            if ( !bPushed || m_Buffer.size() >= capacity() ) {
+            typename base_class::thread_record * pRec = thread_buffer_owner();
+            bool bPushed = pRec ? pRec->m_RetireBuffer.push( p, capacity() ) : m_Buffer.push( p );
+            if ( !bPushed || ( pRec ? pRec->m_RetireBuffer.size() : m_Buffer.size() ) >= capacity() ) {
                 synchronize();
-                if ( !bPushed )
+                if ( !bPushed ) {
                     p.free();
+                    base_class::m_ReclaimStat.on_free( 1 );
+                }
                 return true;
             }
             return false;
@@ -131,11 +203,14 @@ namespace cds { namespace urcu {
         /// Creates singleton object and starts reclamation thread
         /**
             The \p nBufferCapacity parameter defines RCU threshold.
+            In \p cds::urcu::thread_buffer mode (\p nBuffering) it is the capacity of the buffer of each thread.
+            \p nReaderGroups - the number of reader groups of hierarchical thread registry, see \ref cds_urcu_gp_reader_groups "reader groups".
+            0 (default) means flat registry.
         */
-        static void Construct( size_t nBufferCapacity = 256 )
+        static void Construct( size_t nBufferCapacity = 256, retire_buffering nBuffering = shared_buffer, size_t nReaderGroups = 0 )
         {
             if ( !singleton_ptr::s_pRCU ) {
-                std::unique_ptr< general_threaded, scoped_disposer > pRCU( new general_threaded( nBufferCapacity ) );
+                std::unique_ptr< general_threaded, scoped_disposer > pRCU( new general_threaded( nBufferCapacity, nBuffering, nReaderGroups ) );
                 pRCU->m_DisposerThread.start();
 
                 singleton_ptr::s_pRCU = pRCU.release();
@@ -151,6 +226,7 @@ namespace cds { namespace urcu {
                     pThis->m_ThreadList.detach_all();
 
                 pThis->m_DisposerThread.stop( pThis->m_Buffer, pThis->m_nCurEpoch.load( atomics::memory_order_acquire ));
+                pThis->drain_thread_buffers( (uint64_t) -1, []( epoch_retired_ptr& p ) -> bool { p.free(); return true; } );
 
                 delete pThis;
                 singleton_ptr::s_pRCU = nullptr;
@@ -194,15 +270,17 @@ namespace cds { namespace urcu {
         //@cond
         void synchronize( bool bSync )
         {
+            cds::gc::details::scan_timer timer;
             uint64_t nPrevEpoch = m_nCurEpoch.fetch_add( 1, atomics::memory_order_release );
 
             atomics::atomic_thread_fence( atomics::memory_order_acquire );
             {
                 std::unique_lock<lock_type> sl( m_Lock );
-                flip_and_wait();
-                flip_and_wait();
+                run_grace_period< back_off >();
 
-                m_DisposerThread.dispose( m_Buffer, nPrevEpoch, bSync );
+                size_t nBacklog;
+                size_t const nHandedOff = hand_off( nPrevEpoch, bSync, nBacklog );
+                base_class::m_ReclaimStat.on_scan( nBacklog, nHandedOff, timer.elapsed() );
             }
             atomics::atomic_thread_fence( atomics::memory_order_release );
         }
@@ -212,11 +290,104 @@ namespace cds { namespace urcu {
         }
         //@endcond
 
+        /// Starts a grace period without waiting for its end
+        /**
+            The function returns a cookie that should be passed to \p poll_grace_period().
+            The grace period identified by the cookie begins after the call, so the objects
+            removed before \p %start_grace_period() may be freed when the cookie is completed.
+            The function makes the first non-blocking step of the grace period if no thread is running one.
+        */
+        gp_cookie start_grace_period()
+        {
+            gp_cookie const nCookie = m_GPSeq.snap();
+            poll_grace_period( nCookie );
+            return nCookie;
+        }
+
+        /// Checks if the grace period identified by \p nCookie is completed
+        /**
+            The function never blocks. If the grace period is not completed and no other thread
+            is running a grace period now, the function checks the reader threads once and,
+            if all of them have passed, advances the grace period.
+            When a grace period is completed by \p %poll_grace_period() the retired pointers covered by it
+            are passed to the reclamation thread; the function does not wait for readers but it may wait
+            until the reclamation thread finishes its previous pass.
+        */
+        bool poll_grace_period( gp_cookie nCookie )
+        {
+            std::unique_lock<lock_type> sl( m_Lock, std::try_to_lock );
+            if ( sl.owns_lock() ) {
+                uint64_t nEpoch = 0;
+                bool const bCompleted = m_GPSeq.poll( nCookie, [this, &nEpoch]( unsigned int& nStage ) -> bool {
+                    if ( nStage == 0 )
+                        m_nPollEpoch = m_nCurEpoch.fetch_add( 1, atomics::memory_order_release );
+                    if ( !base_class::advance_flips( nStage ))
+                        return false;
+                    nEpoch = m_nPollEpoch;
+                    return true;
+                });
+
+                if ( bCompleted ) {
+                    size_t nBacklog;
+                    base_class::m_ReclaimStat.on_free( hand_off( nEpoch, false, nBacklog ));
+                }
+            }
+            return m_GPSeq.done( nCookie );
+        }
+
+        /// Waits for the end of grace period with minimal latency
+        /**
+            Unlike \p synchronize() the function busy-waits for the reader threads
+            by \p cds::backoff::pause instead of \p Backoff template argument and does not
+            call the reclamation thread: the pointers covered by the grace period are passed to it
+            by the next \p synchronize() or \p poll_grace_period().
+            If another thread completes a full grace period while the caller is waiting for the internal lock,
+            the caller shares it.
+        */
+        void synchronize_expedited()
+        {
+            uint64_t const nSnap = m_GPSeq.snap();
+            std::unique_lock<lock_type> sl( m_Lock );
+            if ( !m_GPSeq.done( nSnap ))
+                run_grace_period< cds::backoff::pause >();
+        }
+
         /// Returns the threshold of internal buffer
         size_t capacity() const
         {
             return m_nCapacity;
         }
+
+        /// Returns current retired pointer buffering mode
+        retire_buffering buffering() const
+        {
+            return m_nBuffering.load( atomics::memory_order_relaxed );
+        }
+
+        /// Changes retired pointer buffering mode
+        /**
+            The mode may be changed on the fly: the per-thread buffers are drained after each grace period.
+        */
+        void set_buffering( retire_buffering nBuffering )
+        {
+            m_nBuffering.store( nBuffering, atomics::memory_order_relaxed );
+        }
+
+        /// Returns reclamation telemetry
+        /**
+            A scan is a grace period followed by handing off the internal buffer to the reclamation thread.
+            The retired pointers are freed by the reclamation thread, so \p reclaim_stat::nFreed
+            is the count of retired pointers handed off and the scan duration does not include freeing them.
+            \p reclaim_stat::nBacklog is the current size of the shared buffer and the per-thread buffers;
+            the per-thread buffers are summed over the thread list when the function is called.
+        */
+        cds::gc::reclaim_stat& statistics( cds::gc::reclaim_stat& st )
+        {
+            st.clear();
+            base_class::m_ReclaimStat.collect( st );
+            st.nBacklog = details::get_buffer_size( m_Buffer ) + base_class::thread_buffers_size();
+            return st;
+        }
     };
 }} // namespace cds::urcu
 
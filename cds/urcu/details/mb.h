@@ -0,0 +1,143 @@
+//$$CDS-header$$
+
+#ifndef CDSLIB_URCU_DETAILS_MB_H
+#define CDSLIB_URCU_DETAILS_MB_H
+
+#include <cds/urcu/details/mb_decl.h>
+#include <cds/threading/model.h>
+
+//@cond
+namespace cds { namespace urcu { namespace details {
+
+    // Inlines
+
+    // mb_thread_gc
+    template <typename RCUtag>
+    inline mb_thread_gc<RCUtag>::mb_thread_gc()
+    {
+        if ( !threading::Manager::isThreadAttached() )
+            cds::threading::Manager::attachThread();
+    }
+
+    template <typename RCUtag>
+    inline mb_thread_gc<RCUtag>::~mb_thread_gc()
+    {
+        cds::threading::Manager::detachThread();
+    }
+
+    template <typename RCUtag>
+    inline typename mb_thread_gc<RCUtag>::thread_record * mb_thread_gc<RCUtag>::get_thread_record()
+    {
+        return cds::threading::getRCU<RCUtag>();
+    }
+
+    // Only the owner thread changes m_nAccessControl, so plain load/store is used instead of atomic RMW.
+    // The fences are replaced with the compiler barriers; the writer issues process-wide membarrier(2)
+    // instead. If membarrier(2) is not available the reader issues the full fence.
+    template <typename RCUtag>
+    inline void mb_thread_gc<RCUtag>::access_lock()
+    {
+        thread_record * pRec = get_thread_record();
+        assert( pRec != nullptr );
+
+        uint32_t tmp = pRec->m_nAccessControl.load( atomics::memory_order_relaxed );
+        if ( (tmp & rcu_class::c_nNestMask) == 0 ) {
+            pRec->m_nAccessControl.store( mb_singleton<RCUtag>::instance()->global_control_word(atomics::memory_order_relaxed),
+                atomics::memory_order_relaxed );
+            if ( cds::OS::membarrier::is_available() )
+                CDS_COMPILER_RW_BARRIER;
+            else
+                atomics::atomic_thread_fence( atomics::memory_order_seq_cst );
+        }
+        else {
+            pRec->m_nAccessControl.store( tmp + 1, atomics::memory_order_relaxed );
+        }
+    }
+
+    template <typename RCUtag>
+    inline void mb_thread_gc<RCUtag>::access_unlock()
+    {
+        thread_record * pRec = get_thread_record();
+        assert( pRec != nullptr );
+
+        if ( cds::OS::membarrier::is_available() )
+            CDS_COMPILER_RW_BARRIER;
+        else
+            atomics::atomic_thread_fence( atomics::memory_order_seq_cst );
+        pRec->m_nAccessControl.store( pRec->m_nAccessControl.load( atomics::memory_order_relaxed ) - 1, atomics::memory_order_relaxed );
+    }
+
+    template <typename RCUtag>
+    inline bool mb_thread_gc<RCUtag>::is_locked()
+    {
+        thread_record * pRec = get_thread_record();
+        assert( pRec != nullptr );
+
+        return (pRec->m_nAccessControl.load( atomics::memory_order_relaxed ) & rcu_class::c_nNestMask) != 0;
+    }
+
+
+    // mb_singleton
+    template <typename RCUtag>
+    inline bool mb_singleton<RCUtag>::check_grace_period( typename mb_singleton<RCUtag>::thread_record * pRec ) const
+    {
+        uint32_t const v = pRec->m_nAccessControl.load( atomics::memory_order_acquire );
+        return (v & membarrier_rcu::c_nNestMask)
+            && ((( v ^ m_nGlobalControl.load( atomics::memory_order_relaxed )) & ~membarrier_rcu::c_nNestMask ));
+    }
+
+    template <typename RCUtag>
+    template <class Backoff>
+    inline void mb_singleton<RCUtag>::wait_for_quiescent_state( Backoff& bkOff )
+    {
+        OS::ThreadId const nullThreadId = OS::c_NullThreadId;
+
+        for ( thread_record * pRec = m_ThreadList.head( atomics::memory_order_acquire); pRec; pRec = pRec->m_list.m_pNext ) {
+            while ( pRec->m_list.m_idOwner.load( atomics::memory_order_acquire) != nullThreadId && check_grace_period( pRec ))
+                bkOff();
+            bkOff.reset();
+        }
+    }
+
+    // Returns true if no thread is inside read-side critical section started before the last switch_next_epoch()
+    template <typename RCUtag>
+    inline bool mb_singleton<RCUtag>::readers_passed() const
+    {
+        OS::ThreadId const nullThreadId = OS::c_NullThreadId;
+
+        for ( thread_record * pRec = m_ThreadList.head( atomics::memory_order_acquire); pRec; pRec = pRec->m_list.m_pNext ) {
+            if ( pRec->m_list.m_idOwner.load( atomics::memory_order_acquire) != nullThreadId && check_grace_period( pRec ))
+                return false;
+        }
+        return true;
+    }
+
+    // Makes a non-blocking step of the grace period, see membarrier_buffered::synchronize().
+    // nStage is the number of epoch switches done, 0 - the grace period is not started.
+    // Returns true if the grace period is completed
+    template <typename RCUtag>
+    inline bool mb_singleton<RCUtag>::advance_epochs( unsigned int& nStage )
+    {
+        if ( nStage == 0 ) {
+            force_membar_all_threads();
+            switch_next_epoch();
+            nStage = 1;
+        }
+
+        if ( nStage == 1 ) {
+            if ( !readers_passed() )
+                return false;
+            switch_next_epoch();
+            nStage = 2;
+        }
+
+        if ( !readers_passed() )
+            return false;
+        force_membar_all_threads();
+        return true;
+    }
+
+}}} // namespace cds:urcu::details
+//@endcond
+
+#endif // #ifndef CDSLIB_URCU_DETAILS_MB_H
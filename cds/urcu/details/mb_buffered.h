@@ -0,0 +1,335 @@
+//$$CDS-header$$
+
+#ifndef CDSLIB_URCU_DETAILS_MB_BUFFERED_H
+#define CDSLIB_URCU_DETAILS_MB_BUFFERED_H
+
+#include <cds/urcu/details/mb.h>
+
+#include <mutex>
+#include <cds/algo/backoff_strategy.h>
+#include <cds/container/vyukov_mpmc_cycle_queue.h>
+
+namespace cds { namespace urcu {
+
+    /// User-space membarrier-based RCU with deferred (buffered) reclamation
+    /**
+        @headerfile cds/urcu/membarrier_buffered.h
+
+        This %RCU is an alternative to \ref signal_buffered that does not use signals.
+        Like signal-handling %RCU, the readers do not issue memory fences: \p access_lock() and \p access_unlock()
+        update the thread's control word by plain stores separated from the critical section by compiler barriers.
+        Instead of sending a signal to each reader thread, the writer calls Linux \p membarrier(2)
+        with \p MEMBARRIER_CMD_PRIVATE_EXPEDITED command (see \p cds::OS::membarrier) that issues
+        a memory barrier on all running threads of the process. Thus, the grace period costs
+        two system calls regardless of the reader count, and the application can use any signal itself.
+
+        If \p membarrier(2) is not supported (other OS or old kernel) the readers issue full memory fences,
+        like \ref general_buffered does.
+
+        This URCU implementation contains an internal buffer where retired objects are
+        accumulated. When the buffer becomes full, the RCU \p synchronize function is called
+        that waits until all reader/updater threads end up their read-side critical sections,
+        i.e. until the RCU quiescent state will come. After that the buffer and all retired objects are freed.
+        This synchronization cycle may be called in any thread that calls \p retire_ptr function.
+
+        The \p Buffer contains items of \ref cds_urcu_retired_ptr "retired_ptr" type and it should support a queue interface with
+        three function:
+        - <tt> bool push( retired_ptr& p ) </tt> - places the retired pointer \p p into queue. If the function
+            returns \p false it means that the buffer is full and RCU synchronization cycle must be processed.
+        - <tt>bool pop( retired_ptr& p ) </tt> - pops queue's head item into \p p parameter; if the queue is empty
+            this function must return \p false
+        - <tt>size_t size()</tt> - returns queue's item count.
+
+        The buffer is considered as full if \p push returns \p false or the buffer size reaches the RCU threshold.
+
+        Polled grace periods (\p start_grace_period(), \p poll_grace_period()) and \p synchronize_expedited()
+        are supported like in \ref general_buffered.
+
+        There is a wrapper \ref cds_urcu_membarrier_buffered_gc "gc<membarrier_buffered>" for \p %membarrier_buffered class
+        that provides unified RCU interface. You should use this wrapper class instead \p %membarrier_buffered
+
+        Template arguments:
+        - \p Buffer - buffer type. Default is cds::container::VyukovMPMCCycleQueue
+        - \p Lock - mutex type, default is \p std::mutex
+        - \p Backoff - back-off schema, default is cds::backoff::Default
+    */
+    template <
+        class Buffer = cds::container::VyukovMPMCCycleQueue< epoch_retired_ptr >
+        ,class Lock = std::mutex
+        ,class Backoff = cds::backoff::Default
+    >
+    class membarrier_buffered: public details::mb_singleton< membarrier_buffered_tag >
+    {
+        //@cond
+        typedef details::mb_singleton< membarrier_buffered_tag > base_class;
+        //@endcond
+    public:
+        typedef membarrier_buffered_tag rcu_tag ;  ///< RCU tag
+        typedef Buffer  buffer_type ;   ///< Buffer type
+        typedef Lock    lock_type   ;   ///< Lock type
+        typedef Backoff back_off    ;   ///< Back-off type
+        typedef uint64_t gp_cookie  ;   ///< Grace period cookie, see \p start_grace_period()
+
+        typedef base_class::thread_gc thread_gc ;   ///< Thread-side RCU part
+        typedef typename thread_gc::scoped_lock scoped_lock ; ///< Access lock class
+
+        static bool const c_bBuffered = true ; ///< This RCU buffers disposed elements
+
+    protected:
+        //@cond
+        typedef details::mb_singleton_instance< rcu_tag >    singleton_ptr;
+        //@endcond
+
+    protected:
+        //@cond
+        buffer_type                     m_Buffer;
+        atomics::atomic<uint64_t>    m_nCurEpoch;
+        lock_type                       m_Lock;
+        size_t const                    m_nCapacity;
+        details::gp_sequence            m_GPSeq;    // grace period sequence, guarded by m_Lock
+        uint64_t                        m_nPollEpoch;   // buffer epoch covered by the polled grace period in progress, guarded by m_Lock
+        //@endcond
+
+    public:
+        /// Returns singleton instance
+        static membarrier_buffered * instance()
+        {
+            return static_cast<membarrier_buffered *>( base_class::instance() );
+        }
+        /// Checks if the singleton is created and ready to use
+        static bool isUsed()
+        {
+            return singleton_ptr::s_pRCU != nullptr;
+        }
+
+    protected:
+        //@cond
+        membarrier_buffered( size_t nBufferCapacity )
+            : m_Buffer( nBufferCapacity )
+            , m_nCurEpoch(0)
+            , m_nCapacity( nBufferCapacity )
+            , m_nPollEpoch( 0 )
+        {}
+
+        ~membarrier_buffered()
+        {
+            clear_buffer( (uint64_t) -1 );
+        }
+
+        // Runs a full grace period, m_Lock must be locked
+        template <class BackOff>
+        void run_grace_period()
+        {
+            m_GPSeq.run( [this]() {
+                BackOff bkOff;
+                base_class::force_membar_all_threads();
+                base_class::switch_next_epoch();
+                bkOff.reset();
+                base_class::wait_for_quiescent_state( bkOff );
+                base_class::switch_next_epoch();
+                bkOff.reset();
+                base_class::wait_for_quiescent_state( bkOff );
+                base_class::force_membar_all_threads();
+            });
+        }
+
+        // Return: the count of retired pointers freed
+        size_t clear_buffer( uint64_t nEpoch )
+        {
+            size_t nFreed = 0;
+            epoch_retired_ptr p;
+            while ( m_Buffer.pop( p )) {
+                if ( p.m_nEpoch <= nEpoch ) {
+                    p.free();
+                    ++nFreed;
+                }
+                else {
+                    push_buffer( p );
+                    break;
+                }
+            }
+            return nFreed;
+        }
+
+        bool push_buffer( epoch_retired_ptr& ep )
+        {
+            bool bPushed = m_Buffer.push( ep );
+            if ( !bPushed || m_Buffer.size() >= capacity() ) {
+                synchronize();
+                if ( !bPushed ) {
+                    ep.free();
+                    base_class::m_ReclaimStat.on_free( 1 );
+                }
+                return true;
+            }
+            return false;
+        }
+        //@endcond
+
+    public:
+        /// Creates singleton object
+        /**
+            The \p nBufferCapacity parameter defines RCU threshold.
+        */
+        static void Construct( size_t nBufferCapacity = 256 )
+        {
+            if ( !singleton_ptr::s_pRCU )
+                singleton_ptr::s_pRCU = new membarrier_buffered( nBufferCapacity );
+        }
+
+        /// Destroys singleton object
+        static void Destruct( bool bDetachAll = false )
+        {
+            if ( isUsed() ) {
+                instance()->clear_buffer( (uint64_t) -1 );
+                if ( bDetachAll )
+                    instance()->m_ThreadList.detach_all();
+                delete instance();
+                singleton_ptr::s_pRCU = nullptr;
+            }
+        }
+
+    public:
+        /// Retire \p p pointer
+        /**
+            The method pushes \p p pointer to internal buffer.
+            When the buffer becomes full \ref synchronize function is called
+            to wait for the end of grace period and then to free all pointers from the buffer.
+        */
+        virtual void retire_ptr( retired_ptr& p )
+        {
+            if ( p.m_p ) {
+                epoch_retired_ptr ep( p, m_nCurEpoch.load( atomics::memory_order_relaxed ));
+                push_buffer( ep );
+            }
+        }
+
+        /// Retires the pointer chain [\p itFirst, \p itLast)
+        template <typename ForwardIterator>
+        void batch_retire( ForwardIterator itFirst, ForwardIterator itLast )
+        {
+            uint64_t nEpoch = m_nCurEpoch.load( atomics::memory_order_relaxed );
+            while ( itFirst != itLast ) {
+                epoch_retired_ptr ep( *itFirst, nEpoch );
+                ++itFirst;
+                push_buffer( ep );
+            }
+        }
+
+        /// Wait to finish a grace period and then clear the buffer
+        void synchronize()
+        {
+            epoch_retired_ptr ep( retired_ptr(), m_nCurEpoch.load( atomics::memory_order_relaxed ));
+            synchronize( ep );
+        }
+
+        //@cond
+        bool synchronize( epoch_retired_ptr& ep )
+        {
+            uint64_t nEpoch;
+            size_t nBacklog;
+            cds::gc::details::scan_timer timer;
+            atomics::atomic_thread_fence( atomics::memory_order_acquire );
+            {
+                std::unique_lock<lock_type> sl( m_Lock );
+                if ( ep.m_p && m_Buffer.push( ep ) && m_Buffer.size() < capacity())
+                    return false;
+                nBacklog = details::get_buffer_size( m_Buffer );
+                nEpoch = m_nCurEpoch.fetch_add( 1, atomics::memory_order_relaxed );
+
+                run_grace_period< back_off >();
+            }
+
+            size_t const nFreed = clear_buffer( nEpoch );
+            base_class::m_ReclaimStat.on_scan( nBacklog, nFreed, timer.elapsed() );
+            return true;
+        }
+        //@endcond
+
+        /// Starts a grace period without waiting for its end
+        /**
+            The function returns a cookie that should be passed to \p poll_grace_period().
+            The grace period identified by the cookie begins after the call, so the objects
+            removed before \p %start_grace_period() may be freed when the cookie is completed.
+            The function makes the first step of the grace period if no thread is running one.
+        */
+        gp_cookie start_grace_period()
+        {
+            gp_cookie const nCookie = m_GPSeq.snap();
+            poll_grace_period( nCookie );
+            return nCookie;
+        }
+
+        /// Checks if the grace period identified by \p nCookie is completed
+        /**
+            The function never blocks. If the grace period is not completed and no other thread
+            is running a grace period now, the function checks the reader threads once and,
+            if all of them have passed, advances the grace period.
+            When a grace period is completed by \p %poll_grace_period() the retired pointers covered by it
+            are freed in the calling thread.
+        */
+        bool poll_grace_period( gp_cookie nCookie )
+        {
+            uint64_t nEpoch = 0;
+            bool bCompleted;
+            {
+                std::unique_lock<lock_type> sl( m_Lock, std::try_to_lock );
+                if ( !sl.owns_lock() ) {
+                    // Another thread is running a grace period now
+                    return m_GPSeq.done( nCookie );
+                }
+
+                bCompleted = m_GPSeq.poll( nCookie, [this, &nEpoch]( unsigned int& nStage ) -> bool {
+                    if ( nStage == 0 )
+                        m_nPollEpoch = m_nCurEpoch.fetch_add( 1, atomics::memory_order_relaxed );
+                    if ( !base_class::advance_epochs( nStage ))
+                        return false;
+                    nEpoch = m_nPollEpoch;
+                    return true;
+                });
+            }
+            if ( bCompleted )
+                base_class::m_ReclaimStat.on_free( clear_buffer( nEpoch ));
+            return m_GPSeq.done( nCookie );
+        }
+
+        /// Waits for the end of grace period with minimal latency
+        /**
+            Unlike \p synchronize() the function busy-waits for the reader threads
+            by \p cds::backoff::pause instead of \p Backoff template argument and does not free the buffer:
+            the pointers covered by the grace period are freed by the next \p synchronize()
+            or \p poll_grace_period().
+            If another thread completes a full grace period while the caller is waiting for the internal lock,
+            the caller shares it.
+        */
+        void synchronize_expedited()
+        {
+            uint64_t const nSnap = m_GPSeq.snap();
+            std::unique_lock<lock_type> sl( m_Lock );
+            if ( !m_GPSeq.done( nSnap ))
+                run_grace_period< cds::backoff::pause >();
+        }
+
+        /// Returns the threshold of internal buffer
+        size_t capacity() const
+        {
+            return m_nCapacity;
+        }
+
+        /// Returns reclamation telemetry
+        /**
+            A scan is a grace period followed by freeing the internal buffer.
+            \p reclaim_stat::nBacklog is the current size of the buffer.
+        */
+        cds::gc::reclaim_stat& statistics( cds::gc::reclaim_stat& st )
+        {
+            st.clear();
+            base_class::m_ReclaimStat.collect( st );
+            st.nBacklog = details::get_buffer_size( m_Buffer );
+            return st;
+        }
+    };
+
+}} // namespace cds::urcu
+
+#endif // #endif // #ifndef CDSLIB_URCU_DETAILS_MB_BUFFERED_H
@@ -0,0 +1,193 @@
+//$$CDS-header$$
+
+#ifndef CDSLIB_URCU_DETAILS_MB_DECL_H
+#define CDSLIB_URCU_DETAILS_MB_DECL_H
+
+#include <cds/urcu/details/base.h>
+#include <cds/details/static_functor.h>
+#include <cds/details/lib.h>
+#include <cds/os/membarrier.h>
+
+//@cond
+namespace cds { namespace urcu { namespace details {
+
+    // We could derive thread_data from thread_list_record
+    // but in this case m_nAccessControl would have offset != 0
+    // that is not so efficiently
+#   define CDS_MBURCU_DECLARE_THREAD_DATA(tag_) \
+    template <> struct thread_data<tag_> { \
+        atomics::atomic<uint32_t>        m_nAccessControl ; \
+        thread_list_record< thread_data >   m_list ; \
+        thread_data(): m_nAccessControl(0) {} \
+        ~thread_data() {} \
+    }
+
+    CDS_MBURCU_DECLARE_THREAD_DATA( membarrier_buffered_tag );
+    CDS_MBURCU_DECLARE_THREAD_DATA( membarrier_threaded_tag );
+
+#   undef CDS_MBURCU_DECLARE_THREAD_DATA
+
+    template <typename RCUtag>
+    struct mb_singleton_instance
+    {
+        static CDS_EXPORT_API singleton_vtbl *     s_pRCU;
+    };
+#if !( CDS_COMPILER == CDS_COMPILER_MSVC || (CDS_COMPILER == CDS_COMPILER_INTEL && CDS_OS_INTERFACE == CDS_OSI_WINDOWS))
+    template<> CDS_EXPORT_API singleton_vtbl * mb_singleton_instance< membarrier_buffered_tag >::s_pRCU;
+    template<> CDS_EXPORT_API singleton_vtbl * mb_singleton_instance< membarrier_threaded_tag >::s_pRCU;
+#endif
+
+    template <typename MbRCUtag>
+    class mb_thread_gc
+    {
+    public:
+        typedef MbRCUtag                    rcu_tag;
+        typedef typename rcu_tag::rcu_class rcu_class;
+        typedef thread_data< rcu_tag >      thread_record;
+        typedef cds::urcu::details::scoped_lock< mb_thread_gc > scoped_lock;
+
+    protected:
+        static thread_record * get_thread_record();
+
+    public:
+        mb_thread_gc();
+        ~mb_thread_gc();
+    public:
+        static void access_lock();
+        static void access_unlock();
+        static bool is_locked();
+
+        /// Retire pointer \p by the disposer \p Disposer
+        template <typename Disposer, typename T>
+        static void retire( T * p )
+        {
+            retire( p, cds::details::static_functor<Disposer, T>::call );
+        }
+
+        /// Retire pointer \p by the disposer \p pFunc
+        template <typename T>
+        static void retire( T * p, void (* pFunc)(T *) )
+        {
+            retired_ptr rp( reinterpret_cast<void *>( p ), reinterpret_cast<free_retired_ptr_func>( pFunc ) );
+            retire( rp );
+        }
+
+        /// Retire pointer \p
+        static void retire( retired_ptr& p )
+        {
+            assert( mb_singleton_instance< rcu_tag >::s_pRCU );
+            mb_singleton_instance< rcu_tag >::s_pRCU->retire_ptr( p );
+        }
+    };
+
+#   define CDS_MB_RCU_DECLARE_THREAD_GC( tag_ ) template <> class thread_gc<tag_>: public mb_thread_gc<tag_> {}
+
+    CDS_MB_RCU_DECLARE_THREAD_GC( membarrier_buffered_tag );
+    CDS_MB_RCU_DECLARE_THREAD_GC( membarrier_threaded_tag );
+
+#   undef CDS_MB_RCU_DECLARE_THREAD_GC
+
+    template <class RCUtag>
+    class mb_singleton: public singleton_vtbl
+    {
+    public:
+        typedef RCUtag  rcu_tag;
+        typedef cds::urcu::details::thread_gc< rcu_tag >   thread_gc;
+
+    protected:
+        typedef typename thread_gc::thread_record   thread_record;
+        typedef mb_singleton_instance< rcu_tag >    rcu_instance;
+
+    protected:
+        atomics::atomic<uint32_t>           m_nGlobalControl;
+        thread_list< rcu_tag >              m_ThreadList;
+        cds::gc::details::reclaim_counters  m_ReclaimStat;   ///< Reclamation telemetry
+
+    protected:
+        mb_singleton()
+            : m_nGlobalControl(1)
+        {
+            // If membarrier(2) is not supported the readers issue full fences
+            cds::OS::membarrier::init();
+        }
+
+        ~mb_singleton()
+        {}
+
+    public:
+        static mb_singleton * instance()
+        {
+            return static_cast< mb_singleton *>( rcu_instance::s_pRCU );
+        }
+
+        static bool isUsed()
+        {
+            return rcu_instance::s_pRCU != nullptr;
+        }
+
+    public:
+        virtual void retire_ptr( retired_ptr& p ) = 0;
+
+    public: // thread_gc interface
+        thread_record * attach_thread()
+        {
+            return m_ThreadList.alloc();
+        }
+
+        void detach_thread( thread_record * pRec )
+        {
+            m_ThreadList.retire( pRec );
+        }
+
+        uint32_t global_control_word( atomics::memory_order mo ) const
+        {
+            return m_nGlobalControl.load( mo );
+        }
+
+    protected:
+        // Issues memory barrier on all running threads of the process
+        void force_membar_all_threads()
+        {
+            cds::OS::membarrier::barrier();
+        }
+
+        void switch_next_epoch()
+        {
+            m_nGlobalControl.fetch_xor( rcu_tag::c_nControlBit, atomics::memory_order_seq_cst );
+        }
+        bool check_grace_period( thread_record * pRec ) const;
+
+        template <class Backoff>
+        void wait_for_quiescent_state( Backoff& bkOff );
+
+        // Non-blocking parts of the grace period for polled grace periods
+        bool readers_passed() const;
+        bool advance_epochs( unsigned int& nStage );
+    };
+
+#   define CDS_MBRCU_DECLARE_SINGLETON( tag_ ) \
+    template <> class singleton< tag_ > { \
+    public: \
+        typedef tag_  rcu_tag ; \
+        typedef cds::urcu::details::thread_gc< rcu_tag >   thread_gc ; \
+    protected: \
+        typedef thread_gc::thread_record            thread_record ; \
+        typedef mb_singleton_instance< rcu_tag >    rcu_instance  ; \
+        typedef mb_singleton< rcu_tag >             rcu_singleton ; \
+    public: \
+        static bool isUsed() { return rcu_singleton::isUsed() ; } \
+        static rcu_singleton * instance() { assert( rcu_instance::s_pRCU ); return static_cast<rcu_singleton *>( rcu_instance::s_pRCU ); } \
+        static thread_record * attach_thread() { return instance()->attach_thread() ; } \
+        static void detach_thread( thread_record * pRec ) { return instance()->detach_thread( pRec ) ; } \
+        static uint32_t global_control_word( atomics::memory_order mo ) { return instance()->global_control_word( mo ) ; } \
+    }
+
+    CDS_MBRCU_DECLARE_SINGLETON( membarrier_buffered_tag );
+    CDS_MBRCU_DECLARE_SINGLETON( membarrier_threaded_tag );
+
+#   undef CDS_MBRCU_DECLARE_SINGLETON
+
+}}} // namespace cds::urcu::details
+//@endcond
+
+#endif // #ifndef CDSLIB_URCU_DETAILS_MB_DECL_H
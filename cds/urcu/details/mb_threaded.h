@@ -0,0 +1,324 @@
+//$$CDS-header$$1
+
+#ifndef CDSLIB_URCU_DETAILS_MB_THREADED_H
+#define CDSLIB_URCU_DETAILS_MB_THREADED_H
+
+#include <mutex>    //unique_lock
+#include <cds/urcu/details/mb.h>
+
+#include <cds/urcu/dispose_thread.h>
+#include <cds/algo/backoff_strategy.h>
+#include <cds/container/vyukov_mpmc_cycle_queue.h>
+
+namespace cds { namespace urcu {
+
+    /// User-space membarrier-based RCU with deferred threaded reclamation
+    /**
+        @headerfile cds/urcu/membarrier_threaded.h
+
+        This implementation is similar to \ref membarrier_buffered but separate thread is created
+        for deleting the retired objects. Like \p %membarrier_buffered, the class contains an internal buffer
+        where retired objects are accumulated. When the buffer becomes full,
+        the RCU \p synchronize function is called that waits until all reader/updater threads end up their read-side critical sections,
+        i.e. until the RCU quiescent state will come. After that the "work ready" message is sent to reclamation thread.
+        The reclamation thread frees the buffer.
+        This synchronization cycle may be called in any thread that calls \ref retire_ptr function.
+
+        Polled grace periods (\p start_grace_period(), \p poll_grace_period()) and \p synchronize_expedited()
+        are supported like in \ref general_buffered.
+
+        There is a wrapper \ref cds_urcu_membarrier_threaded_gc "gc<membarrier_threaded>" for \p %membarrier_threaded class
+        that provides unified RCU interface. You should use this wrapper class instead \p %membarrier_threaded
+
+        Template arguments:
+        - \p Buffer - buffer type with FIFO semantics. Default is cds::container::VyukovMPMCCycleQueue. See \ref membarrier_buffered
+            for description of buffer's interface. The buffer contains the objects of \ref epoch_retired_ptr
+            type that contains additional \p m_nEpoch field. This field specifies an epoch when the object
+            has been placed into the buffer. The \p %membarrier_threaded object has a global epoch counter
+            that is incremented on each \p synchronize call. The epoch is used internally to prevent early deletion.
+        - \p Lock - mutex type, default is \p std::mutex
+        - \p DisposerThread - the reclamation thread class. Default is \ref cds::urcu::dispose_thread,
+            see the description of this class for required interface.
+        - \p Backoff - back-off schema, default is cds::backoff::Default
+    */
+    template <
+        class Buffer = cds::container::VyukovMPMCCycleQueue< epoch_retired_ptr >
+        ,class Lock = std::mutex
+        ,class DisposerThread = dispose_thread<Buffer>
+        ,class Backoff = cds::backoff::Default
+    >
+    class membarrier_threaded: public details::mb_singleton< membarrier_threaded_tag >
+    {
+        //@cond
+        typedef details::mb_singleton< membarrier_threaded_tag > base_class;
+        //@endcond
+    public:
+        typedef Buffer          buffer_type ;   ///< Buffer type
+        typedef Lock            lock_type   ;   ///< Lock type
+        typedef Backoff         back_off    ;   ///< Back-off scheme
+        typedef DisposerThread  disposer_thread ;   ///< Disposer thread type
+        typedef uint64_t        gp_cookie   ;   ///< Grace period cookie, see \p start_grace_period()
+
+        typedef membarrier_threaded_tag     rcu_tag ;       ///< Thread-side RCU part
+        typedef base_class::thread_gc   thread_gc ;     ///< Access lock class
+        typedef typename thread_gc::scoped_lock scoped_lock ; ///< Access lock class
+
+        static bool const c_bBuffered = true ; ///< This RCU buffers disposed elements
+
+    protected:
+        //@cond
+        typedef details::mb_singleton_instance< rcu_tag >    singleton_ptr;
+
+        struct scoped_disposer {
+            void operator ()( membarrier_threaded * p )
+            {
+                delete p;
+            }
+        };
+        //@endcond
+
+    protected:
+        //@cond
+        buffer_type                     m_Buffer;
+        atomics::atomic<uint64_t>    m_nCurEpoch;
+        lock_type                       m_Lock;
+        size_t const                    m_nCapacity;
+        disposer_thread                 m_DisposerThread;
+        details::gp_sequence            m_GPSeq;    // grace period sequence, guarded by m_Lock
+        uint64_t                        m_nPollEpoch;   // buffer epoch covered by the polled grace period in progress, guarded by m_Lock
+        //@endcond
+
+    public:
+        /// Returns singleton instance
+        static membarrier_threaded * instance()
+        {
+            return static_cast<membarrier_threaded *>( base_class::instance() );
+        }
+        /// Checks if the singleton is created and ready to use
+        static bool isUsed()
+        {
+            return singleton_ptr::s_pRCU != nullptr;
+        }
+
+    protected:
+        //@cond
+        membarrier_threaded( size_t nBufferCapacity )
+            : m_Buffer( nBufferCapacity )
+            , m_nCurEpoch( 1 )
+            , m_nCapacity( nBufferCapacity )
+            , m_nPollEpoch( 0 )
+        {}
+
+        // Runs a full grace period, m_Lock must be locked
+        template <class BackOff>
+        void run_grace_period()
+        {
+            m_GPSeq.run( [this]() {
+                BackOff bkOff;
+                base_class::force_membar_all_threads();
+                base_class::switch_next_epoch();
+                bkOff.reset();
+                base_class::wait_for_quiescent_state( bkOff );
+                base_class::switch_next_epoch();
+                bkOff.reset();
+                base_class::wait_for_quiescent_state( bkOff );
+                base_class::force_membar_all_threads();
+            });
+        }
+
+        // Return: true - synchronize has been called, false - otherwise
+        bool push_buffer( epoch_retired_ptr& p )
+        {
+            bool bPushed = m_Buffer.push( p );
+            if ( !bPushed || m_Buffer.size() >= capacity() ) {
+                synchronize();
+                if ( !bPushed ) {
+                    p.free();
+                    base_class::m_ReclaimStat.on_free( 1 );
+                }
+                return true;
+            }
+            return false;
+        }
+
+        //@endcond
+
+    public:
+        //@cond
+        ~membarrier_threaded()
+        {}
+        //@endcond
+
+        /// Creates singleton object and starts reclamation thread
+        /**
+            The \p nBufferCapacity parameter defines RCU threshold.
+        */
+        static void Construct( size_t nBufferCapacity = 256 )
+        {
+            if ( !singleton_ptr::s_pRCU ) {
+                std::unique_ptr< membarrier_threaded, scoped_disposer > pRCU( new membarrier_threaded( nBufferCapacity ) );
+                pRCU->m_DisposerThread.start();
+
+                singleton_ptr::s_pRCU = pRCU.release();
+            }
+        }
+
+        /// Destroys singleton object and terminates internal reclamation thread
+        static void Destruct( bool bDetachAll = false )
+        {
+            if ( isUsed() ) {
+                membarrier_threaded * pThis = instance();
+                if ( bDetachAll )
+                    pThis->m_ThreadList.detach_all();
+
+                pThis->m_DisposerThread.stop( pThis->m_Buffer, pThis->m_nCurEpoch.load( atomics::memory_order_acquire ));
+
+                delete pThis;
+                singleton_ptr::s_pRCU = nullptr;
+            }
+        }
+
+    public:
+        /// Retires \p p pointer
+        /**
+            The method pushes \p p pointer to internal buffer.
+            When the buffer becomes full \ref synchronize function is called
+            to wait for the end of grace period and then
+            a message is sent to the reclamation thread.
+        */
+        virtual void retire_ptr( retired_ptr& p )
+        {
+            if ( p.m_p ) {
+                epoch_retired_ptr ep( p, m_nCurEpoch.load( atomics::memory_order_acquire ) );
+                push_buffer( ep );
+            }
+        }
+
+        /// Retires the pointer chain [\p itFirst, \p itLast)
+        template <typename ForwardIterator>
+        void batch_retire( ForwardIterator itFirst, ForwardIterator itLast )
+        {
+            uint64_t nEpoch = m_nCurEpoch.load( atomics::memory_order_relaxed );
+            while ( itFirst != itLast ) {
+                epoch_retired_ptr p( *itFirst, nEpoch );
+                ++itFirst;
+                push_buffer( p );
+            }
+        }
+
+        /// Waits to finish a grace period and calls disposing thread
+        void synchronize()
+        {
+            synchronize( false );
+        }
+
+        //@cond
+        void synchronize( bool bSync )
+        {
+            cds::gc::details::scan_timer timer;
+            uint64_t nPrevEpoch = m_nCurEpoch.fetch_add( 1, atomics::memory_order_release );
+
+            atomics::atomic_thread_fence( atomics::memory_order_acquire );
+            {
+                std::unique_lock<lock_type> sl( m_Lock );
+
+                run_grace_period< back_off >();
+
+                size_t const nBacklog = details::get_buffer_size( m_Buffer );
+                m_DisposerThread.dispose( m_Buffer, nPrevEpoch, bSync );
+                base_class::m_ReclaimStat.on_scan( nBacklog, nBacklog, timer.elapsed() );
+            }
+        }
+        void force_dispose()
+        {
+            synchronize( true );
+        }
+        //@endcond
+
+        /// Starts a grace period without waiting for its end
+        /**
+            The function returns a cookie that should be passed to \p poll_grace_period().
+            The grace period identified by the cookie begins after the call, so the objects
+            removed before \p %start_grace_period() may be freed when the cookie is completed.
+            The function makes the first step of the grace period if no thread is running one.
+        */
+        gp_cookie start_grace_period()
+        {
+            gp_cookie const nCookie = m_GPSeq.snap();
+            poll_grace_period( nCookie );
+            return nCookie;
+        }
+
+        /// Checks if the grace period identified by \p nCookie is completed
+        /**
+            The function never blocks. If the grace period is not completed and no other thread
+            is running a grace period now, the function checks the reader threads once and,
+            if all of them have passed, advances the grace period.
+            When a grace period is completed by \p %poll_grace_period() the retired pointers covered by it
+            are passed to the reclamation thread; the function may wait until the reclamation thread
+            finishes its previous pass.
+        */
+        bool poll_grace_period( gp_cookie nCookie )
+        {
+            std::unique_lock<lock_type> sl( m_Lock, std::try_to_lock );
+            if ( sl.owns_lock() ) {
+                uint64_t nEpoch = 0;
+                bool const bCompleted = m_GPSeq.poll( nCookie, [this, &nEpoch]( unsigned int& nStage ) -> bool {
+                    if ( nStage == 0 )
+                        m_nPollEpoch = m_nCurEpoch.fetch_add( 1, atomics::memory_order_release );
+                    if ( !base_class::advance_epochs( nStage ))
+                        return false;
+                    nEpoch = m_nPollEpoch;
+                    return true;
+                });
+
+                if ( bCompleted ) {
+                    size_t const nHandedOff = details::get_buffer_size( m_Buffer );
+                    m_DisposerThread.dispose( m_Buffer, nEpoch, false );
+                    base_class::m_ReclaimStat.on_free( nHandedOff );
+                }
+            }
+            return m_GPSeq.done( nCookie );
+        }
+
+        /// Waits for the end of grace period with minimal latency
+        /**
+            Unlike \p synchronize() the function busy-waits for the reader threads
+            by \p cds::backoff::pause instead of \p Backoff template argument and does not
+            call the reclamation thread: the pointers covered by the grace period are passed to it
+            by the next \p synchronize() or \p poll_grace_period().
+            If another thread completes a full grace period while the caller is waiting for the internal lock,
+            the caller shares it.
+        */
+        void synchronize_expedited()
+        {
+            uint64_t const nSnap = m_GPSeq.snap();
+            std::unique_lock<lock_type> sl( m_Lock );
+            if ( !m_GPSeq.done( nSnap ))
+                run_grace_period< cds::backoff::pause >();
+        }
+
+        /// Returns the threshold of internal buffer
+        size_t capacity() const
+        {
+            return m_nCapacity;
+        }
+
+        /// Returns reclamation telemetry
+        /**
+            A scan is a grace period followed by handing off the internal buffer to the reclamation thread.
+            The retired pointers are freed by the reclamation thread, so \p reclaim_stat::nFreed
+            is the count of retired pointers handed off and the scan duration does not include freeing them.
+            \p reclaim_stat::nBacklog is the current size of the buffer.
+        */
+        cds::gc::reclaim_stat& statistics( cds::gc::reclaim_stat& st )
+        {
+            st.clear();
+            base_class::m_ReclaimStat.collect( st );
+            st.nBacklog = details::get_buffer_size( m_Buffer );
+            return st;
+        }
+    };
+}} // namespace cds::urcu
+
+#endif // #endif // #ifndef CDSLIB_URCU_DETAILS_MB_THREADED_H
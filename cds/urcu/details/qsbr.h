@@ -0,0 +1,167 @@
+//$$CDS-header$$
+
+#ifndef CDSLIB_URCU_DETAILS_QSBR_H
+#define CDSLIB_URCU_DETAILS_QSBR_H
+
+#include <cds/urcu/details/qsbr_decl.h>
+#include <cds/threading/model.h>
+
+//@cond
+namespace cds { namespace urcu { namespace details {
+
+    // Inlines
+
+    // qsbr_thread_gc
+    template <typename RCUtag>
+    inline qsbr_thread_gc<RCUtag>::qsbr_thread_gc()
+    {
+        if ( !threading::Manager::isThreadAttached() )
+            cds::threading::Manager::attachThread();
+    }
+
+    template <typename RCUtag>
+    inline qsbr_thread_gc<RCUtag>::~qsbr_thread_gc()
+    {
+        cds::threading::Manager::detachThread();
+    }
+
+    template <typename RCUtag>
+    inline typename qsbr_thread_gc<RCUtag>::thread_record * qsbr_thread_gc<RCUtag>::get_thread_record()
+    {
+        return cds::threading::getRCU<RCUtag>();
+    }
+
+    // In release mode the read-side lock/unlock is empty.
+    // In debug mode the nesting depth is counted to support the assertions
+    // like "RCU must be locked" and the deadlock checking
+    template <typename RCUtag>
+    inline void qsbr_thread_gc<RCUtag>::access_lock()
+    {
+#   ifndef NDEBUG
+        thread_record * pRec = get_thread_record();
+        assert( pRec != nullptr );
+        assert( pRec->m_nCtr.load( atomics::memory_order_relaxed ) != 0 ) ; // the thread must be online
+        ++pRec->m_nNestCount;
+#   endif
+        CDS_COMPILER_RW_BARRIER;
+    }
+
+    template <typename RCUtag>
+    inline void qsbr_thread_gc<RCUtag>::access_unlock()
+    {
+        CDS_COMPILER_RW_BARRIER;
+#   ifndef NDEBUG
+        thread_record * pRec = get_thread_record();
+        assert( pRec != nullptr );
+        assert( pRec->m_nNestCount > 0 );
+        --pRec->m_nNestCount;
+#   endif
+    }
+
+    template <typename RCUtag>
+    inline bool qsbr_thread_gc<RCUtag>::is_locked()
+    {
+#   ifndef NDEBUG
+        thread_record * pRec = get_thread_record();
+        assert( pRec != nullptr );
+        return pRec->m_nNestCount != 0;
+#   else
+        return false;
+#   endif
+    }
+
+    template <typename RCUtag>
+    inline void qsbr_thread_gc<RCUtag>::quiescent_state()
+    {
+        thread_record * pRec = get_thread_record();
+        assert( pRec != nullptr );
+        assert( pRec->m_nNestCount == 0 ) ; // quiescent state inside read-side critical section
+
+        // The reads of previous read-side critical sections must not be reordered after the announce,
+        // and the reads of next sections must not be reordered before it
+        pRec->m_nCtr.store( singleton<RCUtag>::global_ctr( atomics::memory_order_relaxed ), atomics::memory_order_release );
+        atomics::atomic_thread_fence( atomics::memory_order_seq_cst );
+    }
+
+    template <typename RCUtag>
+    inline void qsbr_thread_gc<RCUtag>::thread_offline()
+    {
+        thread_record * pRec = get_thread_record();
+        assert( pRec != nullptr );
+        assert( pRec->m_nNestCount == 0 );
+
+        pRec->m_nCtr.store( 0, atomics::memory_order_release );
+    }
+
+    template <typename RCUtag>
+    inline void qsbr_thread_gc<RCUtag>::thread_online()
+    {
+        thread_record * pRec = get_thread_record();
+        assert( pRec != nullptr );
+
+        pRec->m_nCtr.store( singleton<RCUtag>::global_ctr( atomics::memory_order_relaxed ), atomics::memory_order_relaxed );
+        atomics::atomic_thread_fence( atomics::memory_order_seq_cst );
+    }
+
+    template <typename RCUtag>
+    inline bool qsbr_thread_gc<RCUtag>::is_online()
+    {
+        thread_record * pRec = get_thread_record();
+        return pRec && pRec->m_nCtr.load( atomics::memory_order_relaxed ) != 0;
+    }
+
+
+    // qsbr_singleton
+    template <typename RCUtag>
+    template <class Backoff>
+    inline void qsbr_singleton<RCUtag>::wait_for_readers( Backoff& bkoff )
+    {
+        OS::ThreadId const nullThreadId = OS::c_NullThreadId;
+        uint64_t const nCtr = m_nGlobalCtr.fetch_add( 1, atomics::memory_order_seq_cst ) + 1;
+
+        // Wait until each online thread passes through a quiescent state,
+        // i.e. its counter snapshot becomes equal to the new global counter
+        for ( thread_record * pRec = m_ThreadList.head( atomics::memory_order_acquire); pRec; pRec = pRec->m_list.m_pNext ) {
+            while ( pRec->m_list.m_idOwner.load( atomics::memory_order_acquire ) != nullThreadId ) {
+                uint64_t const v = pRec->m_nCtr.load( atomics::memory_order_acquire );
+                if ( v == 0 || v == nCtr )
+                    break;
+                bkoff();
+                CDS_COMPILER_RW_BARRIER;
+            }
+            bkoff.reset();
+        }
+        atomics::atomic_thread_fence( atomics::memory_order_seq_cst );
+    }
+
+    // Makes a non-blocking step of the grace period.
+    // nStage: 0 - the grace period is not started, 1 - the global counter has been incremented.
+    // The current thread is not in read-side critical section, so it is skipped.
+    // Returns true if each other online thread has passed through a quiescent state
+    template <typename RCUtag>
+    inline bool qsbr_singleton<RCUtag>::advance_ctr( unsigned int& nStage )
+    {
+        if ( nStage == 0 ) {
+            m_nGlobalCtr.fetch_add( 1, atomics::memory_order_seq_cst );
+            nStage = 1;
+        }
+
+        OS::ThreadId const nullThreadId = OS::c_NullThreadId;
+        OS::ThreadId const curThreadId = OS::get_current_thread_id();
+        uint64_t const nCtr = m_nGlobalCtr.load( atomics::memory_order_relaxed );
+        for ( thread_record * pRec = m_ThreadList.head( atomics::memory_order_acquire); pRec; pRec = pRec->m_list.m_pNext ) {
+            OS::ThreadId const tid = pRec->m_list.m_idOwner.load( atomics::memory_order_acquire );
+            if ( tid != nullThreadId && tid != curThreadId ) {
+                uint64_t const v = pRec->m_nCtr.load( atomics::memory_order_acquire );
+                if ( v != 0 && v != nCtr )
+                    return false;
+            }
+        }
+        atomics::atomic_thread_fence( atomics::memory_order_seq_cst );
+        return true;
+    }
+
+}}} // namespace cds:urcu::details
+//@endcond
+
+#endif // #ifndef CDSLIB_URCU_DETAILS_QSBR_H
@@ -0,0 +1,172 @@
+//$$CDS-header$$
+
+#ifndef CDSLIB_URCU_DETAILS_QSBR_DECL_H
+#define CDSLIB_URCU_DETAILS_QSBR_DECL_H
+
+#include <cds/urcu/details/base.h>
+#include <cds/details/static_functor.h>
+#include <cds/details/lib.h>
+
+//@cond
+namespace cds { namespace urcu { namespace details {
+
+    // m_nCtr is the snapshot of the global grace period counter
+    // taken by the thread at its last quiescent state; 0 means the thread is offline.
+    // m_nNestCount is the read-side nesting depth that is maintained in debug mode only
+    // (it is used by assertions like "RCU must be locked" in the containers)
+    template <> struct thread_data< qsbr_buffered_tag > {
+        atomics::atomic<uint64_t>           m_nCtr ;
+        thread_list_record< thread_data >   m_list ;
+        uint32_t                            m_nNestCount;
+
+        thread_data(): m_nCtr(0), m_nNestCount(0) {}
+        ~thread_data() {}
+    };
+
+    template <typename RCUtag>
+    struct qsbr_singleton_instance
+    {
+        static CDS_EXPORT_API singleton_vtbl *     s_pRCU;
+    };
+#if !( CDS_COMPILER == CDS_COMPILER_MSVC || (CDS_COMPILER == CDS_COMPILER_INTEL && CDS_OS_INTERFACE == CDS_OSI_WINDOWS))
+    template<> CDS_EXPORT_API singleton_vtbl * qsbr_singleton_instance< qsbr_buffered_tag >::s_pRCU;
+#endif
+
+    template <typename QSBRtag>
+    class qsbr_thread_gc
+    {
+    public:
+        typedef QSBRtag                     rcu_tag;
+        typedef typename rcu_tag::rcu_class rcu_class;
+        typedef thread_data< rcu_tag >      thread_record;
+        typedef cds::urcu::details::scoped_lock< qsbr_thread_gc > scoped_lock;
+
+    protected:
+        static thread_record * get_thread_record();
+
+    public:
+        qsbr_thread_gc();
+        ~qsbr_thread_gc();
+    public:
+        static void access_lock();
+        static void access_unlock();
+        static bool is_locked();
+
+        static void quiescent_state();
+        static void thread_offline();
+        static void thread_online();
+        static bool is_online();
+
+        /// Retire pointer \p by the disposer \p Disposer
+        template <typename Disposer, typename T>
+        static void retire( T * p )
+        {
+            retire( p, cds::details::static_functor<Disposer, T>::call );
+        }
+
+        /// Retire pointer \p by the disposer \p pFunc
+        template <typename T>
+        static void retire( T * p, void (* pFunc)(T *) )
+        {
+            retired_ptr rp( reinterpret_cast<void *>( p ), reinterpret_cast<free_retired_ptr_func>( pFunc ) );
+            retire( rp );
+        }
+
+        /// Retire pointer \p
+        static void retire( retired_ptr& p )
+        {
+            assert( qsbr_singleton_instance< rcu_tag >::s_pRCU );
+            qsbr_singleton_instance< rcu_tag >::s_pRCU->retire_ptr( p );
+        }
+    };
+
+    template <> class thread_gc< qsbr_buffered_tag >: public qsbr_thread_gc< qsbr_buffered_tag > {};
+
+    template <class RCUtag>
+    class qsbr_singleton: public singleton_vtbl
+    {
+    public:
+        typedef RCUtag  rcu_tag;
+        typedef cds::urcu::details::thread_gc< rcu_tag >   thread_gc;
+
+    protected:
+        typedef typename thread_gc::thread_record   thread_record;
+        typedef qsbr_singleton_instance< rcu_tag >  rcu_instance;
+
+    protected:
+        atomics::atomic<uint64_t>           m_nGlobalCtr;   // grace period counter, never 0
+        thread_list< rcu_tag >              m_ThreadList;
+        cds::gc::details::reclaim_counters  m_ReclaimStat;  ///< Reclamation telemetry
+
+    protected:
+        qsbr_singleton()
+            : m_nGlobalCtr(1)
+        {}
+
+        ~qsbr_singleton()
+        {}
+
+    public:
+        static qsbr_singleton * instance()
+        {
+            return static_cast< qsbr_singleton *>( rcu_instance::s_pRCU );
+        }
+
+        static bool isUsed()
+        {
+            return rcu_instance::s_pRCU != nullptr;
+        }
+
+    public:
+        virtual void retire_ptr( retired_ptr& p ) = 0;
+
+    public: // thread_gc interface
+        thread_record * attach_thread()
+        {
+            // The attached thread is online
+            thread_record * pRec = m_ThreadList.alloc();
+            pRec->m_nCtr.store( m_nGlobalCtr.load( atomics::memory_order_relaxed ), atomics::memory_order_relaxed );
+            atomics::atomic_thread_fence( atomics::memory_order_seq_cst );
+            return pRec;
+        }
+
+        void detach_thread( thread_record * pRec )
+        {
+            // The detached thread is in extended quiescent state
+            pRec->m_nCtr.store( 0, atomics::memory_order_release );
+            m_ThreadList.retire( pRec );
+        }
+
+        uint64_t global_ctr( atomics::memory_order mo ) const
+        {
+            return m_nGlobalCtr.load( mo );
+        }
+
+    protected:
+        template <class Backoff>
+        void wait_for_readers( Backoff& bkoff );
+
+        // Non-blocking version of wait_for_readers() for polled grace periods
+        bool advance_ctr( unsigned int& nStage );
+    };
+
+    template <> class singleton< qsbr_buffered_tag > {
+    public:
+        typedef qsbr_buffered_tag  rcu_tag ;
+        typedef cds::urcu::details::thread_gc< rcu_tag >   thread_gc ;
+    protected:
+        typedef thread_gc::thread_record            thread_record ;
+        typedef qsbr_singleton_instance< rcu_tag >  rcu_instance  ;
+        typedef qsbr_singleton< rcu_tag >           rcu_singleton ;
+    public:
+        static bool isUsed() { return rcu_singleton::isUsed() ; }
+        static rcu_singleton * instance() { assert( rcu_instance::s_pRCU ); return static_cast<rcu_singleton *>( rcu_instance::s_pRCU ); }
+        static thread_record * attach_thread() { return instance()->attach_thread() ; }
+        static void detach_thread( thread_record * pRec ) { return instance()->detach_thread( pRec ) ; }
+        static uint64_t global_ctr( atomics::memory_order mo ) { return instance()->global_ctr( mo ) ; }
+    };
+
+}}} // namespace cds::urcu::details
+//@endcond
+
+#endif // #ifndef CDSLIB_URCU_DETAILS_QSBR_DECL_H
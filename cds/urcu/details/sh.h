@@ -163,6 +163,48 @@ namespace cds { namespace urcu { namespace details {
         }
     }
 
+    // Returns true if no thread is inside read-side critical section started before the last switch_next_epoch()
+    template <typename RCUtag>
+    bool sh_singleton<RCUtag>::readers_passed() const
+    {
+        OS::ThreadId const nullThreadId = OS::c_NullThreadId;
+
+        for ( thread_record * pRec = m_ThreadList.head( atomics::memory_order_acquire); pRec; pRec = pRec->m_list.m_pNext ) {
+            if ( pRec->m_list.m_idOwner.load( atomics::memory_order_acquire) != nullThreadId && check_grace_period( pRec ))
+                return false;
+        }
+        return true;
+    }
+
+    // Makes a step of the grace period, see signal_buffered::synchronize().
+    // nStage is the number of epoch switches done, 0 - the grace period is not started.
+    // The step does not wait for readers but force_membar_all_threads() waits until
+    // each RCU thread processes the signal.
+    // Returns true if the grace period is completed
+    template <typename RCUtag>
+    template <class Backoff>
+    bool sh_singleton<RCUtag>::advance_epochs( unsigned int& nStage, Backoff& bkOff )
+    {
+        if ( nStage == 0 ) {
+            force_membar_all_threads( bkOff );
+            switch_next_epoch();
+            nStage = 1;
+        }
+
+        if ( nStage == 1 ) {
+            if ( !readers_passed() )
+                return false;
+            switch_next_epoch();
+            nStage = 2;
+        }
+
+        if ( !readers_passed() )
+            return false;
+        bkOff.reset();
+        force_membar_all_threads( bkOff );
+        return true;
+    }
+
 }}} // namespace cds:urcu::details
 //@endcond
 
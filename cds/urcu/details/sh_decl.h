@@ -105,6 +105,7 @@ namespace cds { namespace urcu { namespace details {
     protected:
         atomics::atomic<uint32_t>    m_nGlobalControl;
         thread_list< rcu_tag >          m_ThreadList;
+        cds::gc::details::reclaim_counters  m_ReclaimStat;   ///< Reclamation telemetry
         int const                       m_nSigNo;
 
     protected:
@@ -172,6 +173,11 @@ namespace cds { namespace urcu { namespace details {
 
         template <class Backoff>
         void wait_for_quiescent_state( Backoff& bkOff );
+
+        // Parts of the grace period for polled grace periods
+        bool readers_passed() const;
+        template <class Backoff>
+        bool advance_epochs( unsigned int& nStage, Backoff& bkOff );
     };
 
 #   define CDS_SIGRCU_DECLARE_SINGLETON( tag_ ) \
@@ -32,6 +32,10 @@ namespace cds { namespace urcu {
 
         The buffer is considered as full if \p push returns \p false or the buffer size reaches the RCU threshold.
 
+        Polled grace periods (\p start_grace_period(), \p poll_grace_period()) and \p synchronize_expedited()
+        are supported like in \ref general_buffered, but \p %poll_grace_period() waits for signal delivery
+        when it starts or completes a grace period, see \p poll_grace_period().
+
         There is a wrapper \ref cds_urcu_signal_buffered_gc "gc<signal_buffered>" for \p %signal_buffered class
         that provides unified RCU interface. You should use this wrapper class instead \p %signal_buffered
 
@@ -55,6 +59,7 @@ namespace cds { namespace urcu {
         typedef Buffer  buffer_type ;   ///< Buffer type
         typedef Lock    lock_type   ;   ///< Lock type
         typedef Backoff back_off    ;   ///< Back-off type
+        typedef uint64_t gp_cookie  ;   ///< Grace period cookie, see \p start_grace_period()
 
         typedef base_class::thread_gc thread_gc ;   ///< Thread-side RCU part
         typedef typename thread_gc::scoped_lock scoped_lock ; ///< Access lock class
@@ -72,6 +77,8 @@ namespace cds { namespace urcu {
         atomics::atomic<uint64_t>    m_nCurEpoch;
         lock_type                       m_Lock;
         size_t const                    m_nCapacity;
+        details::gp_sequence            m_GPSeq;    // grace period sequence, guarded by m_Lock
+        uint64_t                        m_nPollEpoch;   // buffer epoch covered by the polled grace period in progress, guarded by m_Lock
         //@endcond
 
     public:
@@ -93,6 +100,7 @@ namespace cds { namespace urcu {
             , m_Buffer( nBufferCapacity )
             , m_nCurEpoch(0)
             , m_nCapacity( nBufferCapacity )
+            , m_nPollEpoch( 0 )
         {}
 
         ~signal_buffered()
@@ -100,17 +108,39 @@ namespace cds { namespace urcu {
             clear_buffer( (uint64_t) -1 );
         }
 
-        void clear_buffer( uint64_t nEpoch )
+        // Runs a full grace period, m_Lock must be locked
+        template <class BackOff>
+        void run_grace_period()
+        {
+            m_GPSeq.run( [this]() {
+                BackOff bkOff;
+                base_class::force_membar_all_threads( bkOff );
+                base_class::switch_next_epoch();
+                bkOff.reset();
+                base_class::wait_for_quiescent_state( bkOff );
+                base_class::switch_next_epoch();
+                bkOff.reset();
+                base_class::wait_for_quiescent_state( bkOff );
+                base_class::force_membar_all_threads( bkOff );
+            });
+        }
+
+        // Return: the count of retired pointers freed
+        size_t clear_buffer( uint64_t nEpoch )
         {
+            size_t nFreed = 0;
             epoch_retired_ptr p;
             while ( m_Buffer.pop( p )) {
-                if ( p.m_nEpoch <= nEpoch )
+                if ( p.m_nEpoch <= nEpoch ) {
                     p.free();
+                    ++nFreed;
+                }
                 else {
                     push_buffer( p );
                     break;
                 }
             }
+            return nFreed;
         }
 
         bool push_buffer( epoch_retired_ptr& ep )
@@ -118,8 +148,10 @@ namespace cds { namespace urcu {
             bool bPushed = m_Buffer.push( ep );
             if ( !bPushed || m_Buffer.size() >= capacity() ) {
                 synchronize();
-                if ( !bPushed )
+                if ( !bPushed ) {
                     ep.free();
+                    base_class::m_ReclaimStat.on_free( 1 );
+                }
                 return true;
             }
             return false;
@@ -189,35 +221,110 @@ namespace cds { namespace urcu {
         bool synchronize( epoch_retired_ptr& ep )
         {
             uint64_t nEpoch;
+            size_t nBacklog;
+            cds::gc::details::scan_timer timer;
             atomics::atomic_thread_fence( atomics::memory_order_acquire );
             {
                 std::unique_lock<lock_type> sl( m_Lock );
                 if ( ep.m_p && m_Buffer.push( ep ) && m_Buffer.size() < capacity())
                     return false;
+                nBacklog = details::get_buffer_size( m_Buffer );
                 nEpoch = m_nCurEpoch.fetch_add( 1, atomics::memory_order_relaxed );
 
-                back_off bkOff;
-                base_class::force_membar_all_threads( bkOff );
-                base_class::switch_next_epoch();
-                bkOff.reset();
-                base_class::wait_for_quiescent_state( bkOff );
-                base_class::switch_next_epoch();
-                bkOff.reset();
-                base_class::wait_for_quiescent_state( bkOff );
-                base_class::force_membar_all_threads( bkOff );
+                run_grace_period< back_off >();
             }
 
-            clear_buffer( nEpoch );
+            size_t const nFreed = clear_buffer( nEpoch );
+            base_class::m_ReclaimStat.on_scan( nBacklog, nFreed, timer.elapsed() );
             return true;
         }
         //@endcond
 
+        /// Starts a grace period without waiting for its end
+        /**
+            The function returns a cookie that should be passed to \p poll_grace_period().
+            The grace period identified by the cookie begins after the call, so the objects
+            removed before \p %start_grace_period() may be freed when the cookie is completed.
+            The function makes the first step of the grace period if no thread is running one.
+        */
+        gp_cookie start_grace_period()
+        {
+            gp_cookie const nCookie = m_GPSeq.snap();
+            poll_grace_period( nCookie );
+            return nCookie;
+        }
+
+        /// Checks if the grace period identified by \p nCookie is completed
+        /**
+            The function does not wait for the reader threads. If the grace period is not completed and no other thread
+            is running a grace period now, the function checks the reader threads once and,
+            if all of them have passed, advances the grace period. Unlike other %RCU types, the first and the last
+            steps of the grace period wait until each %RCU thread processes the "need membar" signal.
+            When a grace period is completed by \p %poll_grace_period() the retired pointers covered by it
+            are freed in the calling thread.
+        */
+        bool poll_grace_period( gp_cookie nCookie )
+        {
+            uint64_t nEpoch = 0;
+            bool bCompleted;
+            {
+                std::unique_lock<lock_type> sl( m_Lock, std::try_to_lock );
+                if ( !sl.owns_lock() ) {
+                    // Another thread is running a grace period now
+                    return m_GPSeq.done( nCookie );
+                }
+
+                bCompleted = m_GPSeq.poll( nCookie, [this, &nEpoch]( unsigned int& nStage ) -> bool {
+                    if ( nStage == 0 )
+                        m_nPollEpoch = m_nCurEpoch.fetch_add( 1, atomics::memory_order_relaxed );
+                    back_off bkOff;
+                    if ( !base_class::advance_epochs( nStage, bkOff ))
+                        return false;
+                    nEpoch = m_nPollEpoch;
+                    return true;
+                });
+            }
+            if ( bCompleted )
+                base_class::m_ReclaimStat.on_free( clear_buffer( nEpoch ));
+            return m_GPSeq.done( nCookie );
+        }
+
+        /// Waits for the end of grace period with minimal latency
+        /**
+            Unlike \p synchronize() the function busy-waits for the reader threads
+            by \p cds::backoff::pause instead of \p Backoff template argument and does not free the buffer:
+            the pointers covered by the grace period are freed by the next \p synchronize()
+            or \p poll_grace_period().
+            If another thread completes a full grace period while the caller is waiting for the internal lock,
+            the caller shares it.
+        */
+        void synchronize_expedited()
+        {
+            uint64_t const nSnap = m_GPSeq.snap();
+            std::unique_lock<lock_type> sl( m_Lock );
+            if ( !m_GPSeq.done( nSnap ))
+                run_grace_period< cds::backoff::pause >();
+        }
+
         /// Returns the threshold of internal buffer
         size_t capacity() const
         {
             return m_nCapacity;
         }
 
+        /// Returns reclamation telemetry
+        /**
+            A scan is a grace period followed by freeing the internal buffer.
+            \p reclaim_stat::nBacklog is the current size of the buffer.
+        */
+        cds::gc::reclaim_stat& statistics( cds::gc::reclaim_stat& st )
+        {
+            st.clear();
+            base_class::m_ReclaimStat.collect( st );
+            st.nBacklog = details::get_buffer_size( m_Buffer );
+            return st;
+        }
+
         /// Returns the signal number stated for RCU
         int signal_no() const
         {
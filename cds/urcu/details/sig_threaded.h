@@ -25,6 +25,10 @@ namespace cds { namespace urcu {
         The reclamation thread frees the buffer.
         This synchronization cycle may be called in any thread that calls \ref retire_ptr function.
 
+        Polled grace periods (\p start_grace_period(), \p poll_grace_period()) and \p synchronize_expedited()
+        are supported like in \ref general_buffered, but \p %poll_grace_period() waits for signal delivery
+        when it starts or completes a grace period, see \p poll_grace_period().
+
         There is a wrapper \ref cds_urcu_signal_threaded_gc "gc<signal_threaded>" for \p %signal_threaded class
         that provides unified RCU interface. You should use this wrapper class instead \p %signal_threaded
 
@@ -55,6 +59,7 @@ namespace cds { namespace urcu {
         typedef Lock            lock_type   ;   ///< Lock type
         typedef Backoff         back_off    ;   ///< Back-off scheme
         typedef DisposerThread  disposer_thread ;   ///< Disposer thread type
+        typedef uint64_t        gp_cookie   ;   ///< Grace period cookie, see \p start_grace_period()
 
         typedef signal_threaded_tag     rcu_tag ;       ///< Thread-side RCU part
         typedef base_class::thread_gc   thread_gc ;     ///< Access lock class
@@ -81,6 +86,8 @@ namespace cds { namespace urcu {
         lock_type                       m_Lock;
         size_t const                    m_nCapacity;
         disposer_thread                 m_DisposerThread;
+        details::gp_sequence            m_GPSeq;    // grace period sequence, guarded by m_Lock
+        uint64_t                        m_nPollEpoch;   // buffer epoch covered by the polled grace period in progress, guarded by m_Lock
         //@endcond
 
     public:
@@ -102,16 +109,36 @@ namespace cds { namespace urcu {
             , m_Buffer( nBufferCapacity )
             , m_nCurEpoch( 1 )
             , m_nCapacity( nBufferCapacity )
+            , m_nPollEpoch( 0 )
         {}
 
+        // Runs a full grace period, m_Lock must be locked
+        template <class BackOff>
+        void run_grace_period()
+        {
+            m_GPSeq.run( [this]() {
+                BackOff bkOff;
+                base_class::force_membar_all_threads( bkOff );
+                base_class::switch_next_epoch();
+                bkOff.reset();
+                base_class::wait_for_quiescent_state( bkOff );
+                base_class::switch_next_epoch();
+                bkOff.reset();
+                base_class::wait_for_quiescent_state( bkOff );
+                base_class::force_membar_all_threads( bkOff );
+            });
+        }
+
         // Return: true - synchronize has been called, false - otherwise
         bool push_buffer( epoch_retired_ptr& p )
         {
             bool bPushed = m_Buffer.push( p );
             if ( !bPushed || m_Buffer.size() >= capacity() ) {
                 synchronize();
-                if ( !bPushed )
+                if ( !bPushed ) {
                     p.free();
+                    base_class::m_ReclaimStat.on_free( 1 );
+                }
                 return true;
             }
             return false;
@@ -193,23 +220,18 @@ namespace cds { namespace urcu {
         //@cond
         void synchronize( bool bSync )
         {
+            cds::gc::details::scan_timer timer;
             uint64_t nPrevEpoch = m_nCurEpoch.fetch_add( 1, atomics::memory_order_release );
 
             atomics::atomic_thread_fence( atomics::memory_order_acquire );
             {
                 std::unique_lock<lock_type> sl( m_Lock );
 
-                back_off bkOff;
-                base_class::force_membar_all_threads( bkOff );
-                base_class::switch_next_epoch();
-                bkOff.reset();
-                base_class::wait_for_quiescent_state( bkOff );
-                base_class::switch_next_epoch();
-                bkOff.reset();
-                base_class::wait_for_quiescent_state( bkOff );
-                base_class::force_membar_all_threads( bkOff );
+                run_grace_period< back_off >();
 
+                size_t const nBacklog = details::get_buffer_size( m_Buffer );
                 m_DisposerThread.dispose( m_Buffer, nPrevEpoch, bSync );
+                base_class::m_ReclaimStat.on_scan( nBacklog, nBacklog, timer.elapsed() );
             }
         }
         void force_dispose()
@@ -218,12 +240,92 @@ namespace cds { namespace urcu {
         }
         //@endcond
 
+        /// Starts a grace period without waiting for its end
+        /**
+            The function returns a cookie that should be passed to \p poll_grace_period().
+            The grace period identified by the cookie begins after the call, so the objects
+            removed before \p %start_grace_period() may be freed when the cookie is completed.
+            The function makes the first step of the grace period if no thread is running one.
+        */
+        gp_cookie start_grace_period()
+        {
+            gp_cookie const nCookie = m_GPSeq.snap();
+            poll_grace_period( nCookie );
+            return nCookie;
+        }
+
+        /// Checks if the grace period identified by \p nCookie is completed
+        /**
+            The function does not wait for the reader threads. If the grace period is not completed and no other thread
+            is running a grace period now, the function checks the reader threads once and,
+            if all of them have passed, advances the grace period. Unlike other %RCU types, the first and the last
+            steps of the grace period wait until each %RCU thread processes the "need membar" signal.
+            When a grace period is completed by \p %poll_grace_period() the retired pointers covered by it
+            are passed to the reclamation thread; the function may wait until the reclamation thread
+            finishes its previous pass.
+        */
+        bool poll_grace_period( gp_cookie nCookie )
+        {
+            std::unique_lock<lock_type> sl( m_Lock, std::try_to_lock );
+            if ( sl.owns_lock() ) {
+                uint64_t nEpoch = 0;
+                bool const bCompleted = m_GPSeq.poll( nCookie, [this, &nEpoch]( unsigned int& nStage ) -> bool {
+                    if ( nStage == 0 )
+                        m_nPollEpoch = m_nCurEpoch.fetch_add( 1, atomics::memory_order_release );
+                    back_off bkOff;
+                    if ( !base_class::advance_epochs( nStage, bkOff ))
+                        return false;
+                    nEpoch = m_nPollEpoch;
+                    return true;
+                });
+
+                if ( bCompleted ) {
+                    size_t const nHandedOff = details::get_buffer_size( m_Buffer );
+                    m_DisposerThread.dispose( m_Buffer, nEpoch, false );
+                    base_class::m_ReclaimStat.on_free( nHandedOff );
+                }
+            }
+            return m_GPSeq.done( nCookie );
+        }
+
+        /// Waits for the end of grace period with minimal latency
+        /**
+            Unlike \p synchronize() the function busy-waits for the reader threads
+            by \p cds::backoff::pause instead of \p Backoff template argument and does not
+            call the reclamation thread: the pointers covered by the grace period are passed to it
+            by the next \p synchronize() or \p poll_grace_period().
+            If another thread completes a full grace period while the caller is waiting for the internal lock,
+            the caller shares it.
+        */
+        void synchronize_expedited()
+        {
+            uint64_t const nSnap = m_GPSeq.snap();
+            std::unique_lock<lock_type> sl( m_Lock );
+            if ( !m_GPSeq.done( nSnap ))
+                run_grace_period< cds::backoff::pause >();
+        }
+
         /// Returns the threshold of internal buffer
         size_t capacity() const
         {
             return m_nCapacity;
         }
 
+        /// Returns reclamation telemetry
+        /**
+            A scan is a grace period followed by handing off the internal buffer to the reclamation thread.
+            The retired pointers are freed by the reclamation thread, so \p reclaim_stat::nFreed
+            is the count of retired pointers handed off and the scan duration does not include freeing them.
+            \p reclaim_stat::nBacklog is the current size of the buffer.
+        */
+        cds::gc::reclaim_stat& statistics( cds::gc::reclaim_stat& st )
+        {
+            st.clear();
+            base_class::m_ReclaimStat.collect( st );
+            st.nBacklog = details::get_buffer_size( m_Buffer );
+            return st;
+        }
+
         /// Returns the signal number stated for RCU
         int signal_no() const
         {
@@ -193,6 +193,162 @@ namespace cds { namespace urcu {
             }
         }
     };
+
+    /// Pool of reclamation threads for \p general_threaded and \p signal_threaded URCU
+    /**
+        The class has the same interface as \ref dispose_thread but the reclamation cycle
+        is processed by \p WorkerCount threads concurrently: each worker pops retired objects
+        from the buffer until it meets an object retired after the grace period or the buffer becomes empty.
+        So, the buffer must support multiple consumers, like the default \p cds::container::VyukovMPMCCycleQueue.
+
+        The pool is useful when the disposers are heavy, for example the callbacks of \p call_rcu().
+        The order of disposing is not defined.
+
+        Template arguments:
+        - \p Buffer - the buffer type of \ref general_threaded (or \ref signal_threaded) URCU
+        - \p WorkerCount - the number of reclamation threads, default is 2
+    */
+    template <class Buffer, size_t WorkerCount = 2>
+    class dispose_thread_pool
+    {
+    public:
+        typedef Buffer  buffer_type ;   ///< Buffer type
+        static CDS_CONSTEXPR const size_t c_nWorkerCount = WorkerCount; ///< Reclamation thread count
+
+        static_assert( c_nWorkerCount > 0, "WorkerCount must be greater than zero" );
+
+    private:
+        //@cond
+        typedef std::thread             thread_type;
+        typedef std::mutex              mutex_type;
+        typedef std::condition_variable condvar_type;
+        typedef std::unique_lock< mutex_type >  unique_lock;
+
+        thread_type     m_Workers[c_nWorkerCount];
+
+        // synchronization with reclamation threads
+        mutex_type      m_Mutex;
+        condvar_type    m_cvDataReady;
+        condvar_type    m_cvReady;
+
+        // Task for threads (dispose cycle), guarded by m_Mutex
+        buffer_type *   m_pBuffer;
+        uint64_t        m_nCurEpoch;
+        uint64_t        m_nCycle;   // dispose cycle number, a worker waits for its change
+        size_t          m_nBusy;    // count of workers that have not completed current cycle
+        bool            m_bQuit;
+        //@endcond
+
+    private: // methods called from reclamation threads
+        //@cond
+        void execute()
+        {
+            uint64_t nCycle = 0;
+            bool     bQuit = false;
+
+            while ( !bQuit ) {
+                buffer_type *   pBuffer;
+                uint64_t        nCurEpoch;
+                {
+                    unique_lock lock( m_Mutex );
+                    while ( m_nCycle == nCycle )
+                        m_cvDataReady.wait( lock );
+
+                    nCycle = m_nCycle;
+                    pBuffer = m_pBuffer;
+                    nCurEpoch = m_nCurEpoch;
+                    bQuit = m_bQuit;
+                }
+
+                dispose_buffer( pBuffer, nCurEpoch );
+
+                {
+                    unique_lock lock( m_Mutex );
+                    if ( --m_nBusy == 0 )
+                        m_cvReady.notify_all();
+                }
+            }
+        }
+
+        static void dispose_buffer( buffer_type * pBuf, uint64_t nCurEpoch )
+        {
+            epoch_retired_ptr p;
+            while ( pBuf->pop( p ) ) {
+                if ( p.m_nEpoch <= nCurEpoch )
+                    p.free();
+                else {
+                    pBuf->push( p );
+                    break;
+                }
+            }
+        }
+
+        // Waits until the previous cycle is done and gives new work to all workers. m_Mutex must be locked
+        void new_cycle( unique_lock& lock, buffer_type& buf, uint64_t nCurEpoch, bool bQuit )
+        {
+            while ( m_nBusy )
+                m_cvReady.wait( lock );
+
+            m_pBuffer = &buf;
+            m_nCurEpoch = nCurEpoch;
+            m_bQuit = bQuit;
+            m_nBusy = c_nWorkerCount;
+            ++m_nCycle;
+            m_cvDataReady.notify_all();
+        }
+        //@endcond
+
+    public:
+        //@cond
+        dispose_thread_pool()
+            : m_pBuffer( nullptr )
+            , m_nCurEpoch( 0 )
+            , m_nCycle( 0 )
+            , m_nBusy( 0 )
+            , m_bQuit( false )
+        {}
+        //@endcond
+
+    public: // methods called from any thread
+        /// Starts reclamation threads
+        void start()
+        {
+            for ( size_t i = 0; i < c_nWorkerCount; ++i )
+                m_Workers[i] = thread_type( [this]() { execute(); } );
+        }
+
+        /// Starts last reclamation cycle and then terminates reclamation threads
+        /**
+            \p buf buffer contains retired objects ready to free.
+        */
+        void stop( buffer_type& buf, uint64_t nCurEpoch )
+        {
+            {
+                unique_lock lock( m_Mutex );
+                new_cycle( lock, buf, nCurEpoch, true );
+            }
+
+            for ( size_t i = 0; i < c_nWorkerCount; ++i )
+                m_Workers[i].join();
+        }
+
+        /// Starts reclamation cycle
+        /**
+            The semantics is the same as \ref dispose_thread::dispose():
+            the reclamation threads free all \p buf objects \p m_nEpoch field of which is no more than \p nCurEpoch.
+            If \p bSync parameter is \p true the calling thread waits until all workers complete the cycle.
+        */
+        void dispose( buffer_type& buf, uint64_t nCurEpoch, bool bSync )
+        {
+            unique_lock lock( m_Mutex );
+            new_cycle( lock, buf, nCurEpoch, false );
+
+            if ( bSync ) {
+                while ( m_nBusy )
+                    m_cvReady.wait( lock );
+            }
+        }
+    };
 }} // namespace cds::urcu
 
 #endif // #ifdef CDSLIB_URCU_DISPOSE_THREAD_H
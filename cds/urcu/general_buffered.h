@@ -37,14 +37,20 @@ namespace cds { namespace urcu {
         typedef typename rcu_implementation::rcu_tag     rcu_tag     ;   ///< URCU tag
         typedef typename rcu_implementation::thread_gc   thread_gc   ;   ///< Thread-side RCU part
         typedef typename rcu_implementation::scoped_lock scoped_lock ;   ///< Access lock class
+        typedef typename rcu_implementation::gp_cookie   gp_cookie   ;   ///< Grace period cookie
 
         using details::gc_common::atomic_marked_ptr;
 
     public:
         /// Creates URCU \p %general_buffered singleton.
-        gc( size_t nBufferCapacity = 256 )
+        /**
+            \p nBuffering - retired pointer buffering mode, see \p cds::urcu::retire_buffering
+
+            \p nReaderGroups - the number of reader groups, see \ref cds_urcu_gp_reader_groups "reader groups"
+        */
+        gc( size_t nBufferCapacity = 256, retire_buffering nBuffering = shared_buffer, size_t nReaderGroups = 0 )
         {
-            rcu_implementation::Construct( nBufferCapacity );
+            rcu_implementation::Construct( nBufferCapacity, nBuffering, nReaderGroups );
         }
 
         /// Destroys URCU \p %general_instant singleton
@@ -64,6 +70,36 @@ namespace cds { namespace urcu {
             rcu_implementation::instance()->synchronize();
         }
 
+        /// Starts a grace period without waiting for its end
+        /**
+            Returns the cookie of the grace period for \ref poll_grace_period.
+            The objects removed before the call may be freed when the cookie is completed.
+        */
+        static gp_cookie start_grace_period()
+        {
+            return rcu_implementation::instance()->start_grace_period();
+        }
+
+        /// Checks if the grace period identified by \p nCookie is completed
+        /**
+            The function never blocks; if possible it advances the grace period.
+            Call it periodically until it returns \p true, doing other work between the calls.
+        */
+        static bool poll_grace_period( gp_cookie nCookie )
+        {
+            return rcu_implementation::instance()->poll_grace_period( nCookie );
+        }
+
+        /// Waits for the end of grace period with minimal latency
+        /**
+            The function busy-waits for reader threads and does not free the buffer,
+            see \p general_buffered::synchronize_expedited()
+        */
+        static void synchronize_expedited()
+        {
+            rcu_implementation::instance()->synchronize_expedited();
+        }
+
         /// Places retired pointer <\p p, \p pFunc> to internal buffer
         /**
             If the buffer is full, \ref synchronize function is invoked.
@@ -101,6 +137,24 @@ namespace cds { namespace urcu {
             rcu_implementation::instance()->batch_retire( itFirst, itLast );
         }
 
+        /// Defers the call of functor \p f until the end of grace period
+        /**
+            The function allows to defer arbitrary work, for example releasing external resources,
+            until all pre-existing read-side critical sections end. \p f is a functor
+            with <tt>void operator()()</tt> signature; it is copied (or moved) into an internal node.
+
+            The callback is put into the internal buffer like a retired pointer and is called
+            after the grace period that frees the buffer, together with other callbacks and retired pointers
+            accumulated before the grace period. The callback is called in the thread that runs \ref synchronize.
+            If the buffer is full, \ref synchronize function is invoked.
+        */
+        template <typename Func>
+        static void call_rcu( Func&& f )
+        {
+            retired_ptr rp( details::rcu_callback< typename std::decay<Func>::type >::make( std::forward<Func>( f )));
+            retire_ptr( rp );
+        }
+
          /// Acquires access lock (so called RCU reader-side lock)
         /**
             For safety reasons, it is better to use \ref scoped_lock class for locking/unlocking
@@ -143,6 +197,12 @@ namespace cds { namespace urcu {
         {
             synchronize();
         }
+
+        /// Returns reclamation telemetry (see \p cds::gc::reclaim_stat)
+        static cds::gc::reclaim_stat& statistics( cds::gc::reclaim_stat& st )
+        {
+            return rcu_implementation::instance()->statistics( st );
+        }
     };
 
 }} // namespace cds::urcu
@@ -0,0 +1,189 @@
+//$$CDS-header$$
+
+#ifndef CDSLIB_URCU_MEMBARRIER_BUFFERED_H
+#define CDSLIB_URCU_MEMBARRIER_BUFFERED_H
+
+#include <cds/urcu/details/mb_buffered.h>
+
+namespace cds { namespace urcu {
+
+    /// User-space membarrier-based RCU with deferred buffered reclamation
+    /** @anchor cds_urcu_membarrier_buffered_gc
+
+        This is a wrapper around membarrier_buffered class used for metaprogramming.
+
+        Template arguments:
+        - \p Buffer - lock-free queue or lock-free bounded queue.
+            Default is cds::container::VyukovMPMCCycleQueue< retired_ptr >
+        - \p Lock - mutex type, default is \p std::mutex
+        - \p Backoff - back-off schema, default is cds::backoff::Default
+    */
+    template <
+#ifdef CDS_DOXGEN_INVOKED
+        class Buffer = cds::container::VyukovMPMCCycleQueue< retired_ptr >
+        ,class Lock = std::mutex
+        ,class Backoff = cds::backoff::Default
+#else
+        class Buffer
+       ,class Lock
+       ,class Backoff
+#endif
+    >
+    class gc< membarrier_buffered< Buffer, Lock, Backoff > >: public details::gc_common
+    {
+    public:
+        typedef membarrier_buffered< Buffer, Lock, Backoff >  rcu_implementation   ;    ///< Wrapped URCU implementation
+
+        typedef typename rcu_implementation::rcu_tag     rcu_tag     ;   ///< URCU tag
+        typedef typename rcu_implementation::thread_gc   thread_gc   ;   ///< Thread-side RCU part
+        typedef typename rcu_implementation::scoped_lock scoped_lock ;   ///< Access lock class
+        typedef typename rcu_implementation::gp_cookie   gp_cookie   ;   ///< Grace period cookie
+
+        using details::gc_common::atomic_marked_ptr;
+
+    public:
+        /// Creates URCU \p %membarrier_buffered singleton.
+        /**
+            The \p nBufferCapacity parameter defines RCU threshold.
+        */
+        gc( size_t nBufferCapacity = 256 )
+        {
+            rcu_implementation::Construct( nBufferCapacity );
+        }
+
+        /// Destroys URCU \p %membarrier_buffered singleton
+        ~gc()
+        {
+            rcu_implementation::Destruct( true );
+        }
+
+    public:
+        /// Waits to finish a grace period and clears the buffer
+        /**
+            After grace period finished the function frees all retired pointer
+            from internal buffer.
+        */
+        static void synchronize()
+        {
+            rcu_implementation::instance()->synchronize();
+        }
+
+        /// Starts a grace period without waiting for its end
+        /**
+            Returns the cookie of the grace period for \ref poll_grace_period.
+            The objects removed before the call may be freed when the cookie is completed.
+        */
+        static gp_cookie start_grace_period()
+        {
+            return rcu_implementation::instance()->start_grace_period();
+        }
+
+        /// Checks if the grace period identified by \p nCookie is completed
+        /**
+            The function never blocks; if possible it advances the grace period.
+            Call it periodically until it returns \p true, doing other work between the calls.
+        */
+        static bool poll_grace_period( gp_cookie nCookie )
+        {
+            return rcu_implementation::instance()->poll_grace_period( nCookie );
+        }
+
+        /// Waits for the end of grace period with minimal latency
+        /**
+            The function busy-waits for reader threads, see \p membarrier_buffered::synchronize_expedited()
+        */
+        static void synchronize_expedited()
+        {
+            rcu_implementation::instance()->synchronize_expedited();
+        }
+
+        /// Places retired pointer <\p p, \p pFunc> to internal buffer
+        /**
+            If the buffer is full, \ref synchronize function is invoked.
+        */
+        template <typename T>
+        static void retire_ptr( T * p, void (* pFunc)(T *) )
+        {
+            retired_ptr rp( reinterpret_cast<void *>( p ), reinterpret_cast<free_retired_ptr_func>( pFunc ) );
+            retire_ptr( rp );
+        }
+
+        /// Places retired pointer \p p with \p Disposer to internal buffer
+        /**
+            If the buffer is full, \ref synchronize function is invoked.
+        */
+        template <typename Disposer, typename T>
+        static void retire_ptr( T * p )
+        {
+            retire_ptr( p, cds::details::static_functor<Disposer, T>::call );
+        }
+
+        /// Places retired pointer \p p to internal buffer
+        /**
+            If the buffer is full, \ref synchronize function is invoked.
+        */
+        static void retire_ptr( retired_ptr& p )
+        {
+            rcu_implementation::instance()->retire_ptr(p);
+        }
+
+        /// Frees chain [ \p itFirst, \p itLast) in one synchronization cycle
+        template <typename ForwardIterator>
+        static void batch_retire( ForwardIterator itFirst, ForwardIterator itLast )
+        {
+            rcu_implementation::instance()->batch_retire( itFirst, itLast );
+        }
+
+         /// Acquires access lock (so called RCU reader-side lock)
+        /**
+            For safety reasons, it is better to use \ref scoped_lock class for locking/unlocking
+        */
+        static void access_lock()
+        {
+            thread_gc::access_lock();
+        }
+
+        /// Releases access lock (so called RCU reader-side lock)
+        /**
+            For safety reasons, it is better to use \ref scoped_lock class for locking/unlocking
+        */
+        static void access_unlock()
+        {
+            thread_gc::access_unlock();
+        }
+
+        /// Returns the threshold of internal buffer
+        static size_t capacity()
+        {
+            return rcu_implementation::instance()->capacity();
+        }
+
+        /// Checks if the thread is inside read-side critical section (i.e. the lock is acquired)
+        /**
+            Usually, this function is used internally to be convinced
+            that subsequent remove action is not lead to a deadlock.
+        */
+        static bool is_locked()
+        {
+            return thread_gc::is_locked();
+        }
+
+        /// Forces retired object removal
+        /**
+            This function calls \ref synchronize
+        */
+        static void force_dispose()
+        {
+            synchronize();
+        }
+
+        /// Returns reclamation telemetry (see \p cds::gc::reclaim_stat)
+        static cds::gc::reclaim_stat& statistics( cds::gc::reclaim_stat& st )
+        {
+            return rcu_implementation::instance()->statistics( st );
+        }
+    };
+
+}} // namespace cds::urcu
+
+#endif // #ifndef CDSLIB_URCU_MEMBARRIER_BUFFERED_H
@@ -2,10 +2,19 @@ CDS_SOURCES= \
          src/hp_gc.cpp \
          src/init.cpp \
          src/dhp_gc.cpp \
+         src/ebr_gc.cpp \
+         src/he_gc.cpp \
+         src/membarrier.cpp \
+         src/huge_page.cpp \
+         src/numa_page.cpp \
+         src/page_purge.cpp \
          src/urcu_gp.cpp \
          src/urcu_sh.cpp \
+         src/urcu_qsbr.cpp \
+         src/urcu_mb.cpp \
          src/michael_heap.cpp \
          src/topology_hpux.cpp \
          src/topology_linux.cpp \
          src/topology_osx.cpp \
+         src/thread_placement.cpp \
          src/dllmain.cpp
@@ -78,11 +78,16 @@ CDS_TESTHDR_ORDLIST := \
     tests/test-hdr/ordered_list/hdr_lazy_kv_rcu_shb.cpp \
     tests/test-hdr/ordered_list/hdr_lazy_kv_rcu_sht.cpp \
     tests/test-hdr/ordered_list/hdr_michael_dhp.cpp \
+    tests/test-hdr/ordered_list/hdr_michael_ebr.cpp \
+    tests/test-hdr/ordered_list/hdr_michael_he.cpp \
     tests/test-hdr/ordered_list/hdr_michael_hp.cpp \
     tests/test-hdr/ordered_list/hdr_michael_nogc.cpp \
     tests/test-hdr/ordered_list/hdr_michael_rcu_gpi.cpp \
     tests/test-hdr/ordered_list/hdr_michael_rcu_gpb.cpp \
     tests/test-hdr/ordered_list/hdr_michael_rcu_gpt.cpp \
+    tests/test-hdr/ordered_list/hdr_michael_rcu_qsbr.cpp \
+    tests/test-hdr/ordered_list/hdr_michael_rcu_mbb.cpp \
+    tests/test-hdr/ordered_list/hdr_michael_rcu_mbt.cpp \
     tests/test-hdr/ordered_list/hdr_michael_rcu_shb.cpp \
     tests/test-hdr/ordered_list/hdr_michael_rcu_sht.cpp \
     tests/test-hdr/ordered_list/hdr_michael_kv_dhp.cpp \
@@ -262,11 +267,18 @@ CDS_TESTHDR_MISC := \
     tests/test-hdr/misc/cxx11_atomic_class.cpp \
     tests/test-hdr/misc/cxx11_atomic_func.cpp \
     tests/test-hdr/misc/find_option.cpp \
+    tests/test-hdr/misc/he_birth_era.cpp \
     tests/test-hdr/misc/allocator_test.cpp \
     tests/test-hdr/misc/michael_allocator.cpp \
+    tests/test-hdr/misc/michael_heap.cpp \
     tests/test-hdr/misc/hash_tuple.cpp \
     tests/test-hdr/misc/bitop_st.cpp \
     tests/test-hdr/misc/permutation_generator.cpp \
+    tests/test-hdr/misc/reclaim_stat.cpp \
+    tests/test-hdr/misc/call_rcu.cpp \
+    tests/test-hdr/misc/rcu_grace_period.cpp \
+    tests/test-hdr/misc/rcu_qsbr.cpp \
+    tests/test-hdr/misc/topology.cpp \
     tests/test-hdr/misc/thread_init_fini.cpp
 
 CDS_TESTHDR_SOURCES := \
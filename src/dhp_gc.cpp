@@ -2,11 +2,14 @@
 
 // Dynamic Hazard Pointer memory manager implementation
 
-#include <algorithm>   // std::fill
+#include <algorithm>   // std::fill, std::sort
 #include <functional>  // std::hash
+#include <vector>
 
 #include <cds/gc/details/dhp.h>
 #include <cds/algo/int_algo.h>
+#include <cds/os/membarrier.h>
+#include <cds/gc/details/reclaimer_thread.h>
 
 namespace cds { namespace gc { namespace dhp {
 
@@ -134,26 +137,41 @@ namespace cds { namespace gc { namespace dhp {
     }
 
     GarbageCollector * GarbageCollector::m_pManager = nullptr;
+    bool               GarbageCollector::m_bAsymmetricFence = false;
 
     void CDS_STDCALL GarbageCollector::Construct(
         size_t nLiberateThreshold
         , size_t nInitialThreadGuardCount
+        , bool bAsymmetricFence
+        , bool bBackgroundReclaim
+        , scan_type nScanType
+        , void (* fnAttachThread)()
+        , void (* fnDetachThread)()
     )
     {
         if ( !m_pManager ) {
-            m_pManager = new GarbageCollector( nLiberateThreshold, nInitialThreadGuardCount );
+            // Fall back to the full fence mode if the process-wide barrier is not supported
+            m_bAsymmetricFence = bAsymmetricFence && cds::OS::membarrier::init();
+            m_pManager = new GarbageCollector( nLiberateThreshold, nInitialThreadGuardCount, nScanType );
+            if ( bBackgroundReclaim )
+                m_pManager->start_reclaimer( fnAttachThread, fnDetachThread );
         }
     }
 
     void CDS_STDCALL GarbageCollector::Destruct()
     {
+        if ( m_pManager )
+            m_pManager->stop_reclaimer();
         delete m_pManager;
         m_pManager = nullptr;
+        m_bAsymmetricFence = false;
     }
 
-    GarbageCollector::GarbageCollector( size_t nLiberateThreshold, size_t nInitialThreadGuardCount )
+    GarbageCollector::GarbageCollector( size_t nLiberateThreshold, size_t nInitialThreadGuardCount, scan_type nScanType )
         : m_nLiberateThreshold( nLiberateThreshold ? nLiberateThreshold : 1024 )
         , m_nInitialThreadGuardCount( nInitialThreadGuardCount ? nInitialThreadGuardCount : 8 )
+        , m_pReclaimer( nullptr )
+        , m_nScanType( nScanType )
         //, m_nInLiberate(0)
     {
     }
@@ -163,72 +181,213 @@ namespace cds { namespace gc { namespace dhp {
         scan();
     }
 
+    void GarbageCollector::start_reclaimer( void (* fnAttachThread)(), void (* fnDetachThread)() )
+    {
+        assert( m_pReclaimer == nullptr );
+        m_pReclaimer = new cds::gc::details::reclaimer_thread;
+        m_pReclaimer->start( [this]() {
+            // The retired pointers are in the shared buffer, the batch is always empty
+            cds::gc::details::reclaimer_thread::batch_type batch;
+            while ( m_pReclaimer->wait( batch )) {
+                scan();
+                m_pReclaimer->done();
+            }
+        }, fnAttachThread, fnDetachThread );
+    }
+
+    void GarbageCollector::stop_reclaimer()
+    {
+        if ( m_pReclaimer ) {
+            m_pReclaimer->stop();
+            delete m_pReclaimer;
+            m_pReclaimer = nullptr;
+        }
+    }
+
+    void GarbageCollector::wake_reclaimer()
+    {
+        assert( m_pReclaimer != nullptr );
+        m_pReclaimer->notify();
+    }
+
+    void GarbageCollector::flush_reclaimer()
+    {
+        assert( m_pReclaimer != nullptr );
+        // A disposer called by the reclamation thread cannot wait for the thread itself
+        if ( m_pReclaimer->is_reclaimer_thread())
+            scan();
+        else
+            m_pReclaimer->flush();
+    }
+
     void GarbageCollector::scan()
     {
         details::retired_ptr_buffer::privatize_result retiredList = m_RetiredBuffer.privatize();
         if ( retiredList.first ) {
-
-            size_t nLiberateThreshold = m_nLiberateThreshold.load(atomics::memory_order_relaxed);
-            details::liberate_set set( beans::ceil2( retiredList.second > nLiberateThreshold ? retiredList.second : nLiberateThreshold ) );
-
-            // Get list of retired pointers
-            details::retired_ptr_node * pHead = retiredList.first;
-            while ( pHead ) {
-                details::retired_ptr_node * pNext = pHead->m_pNext;
-                pHead->m_pNextFree = nullptr;
-                set.insert( *pHead );
-                pHead = pNext;
+            cds::gc::details::scan_timer timer;
+            size_t nFreed;
+            switch ( m_nScanType ) {
+                case sorted:
+                    nFreed = sorted_scan( retiredList );
+                    break;
+                default:
+                    assert( false );    // Forgotten something?..
+                case classic:
+                    nFreed = classic_scan( retiredList );
+                    break;
             }
+            m_ReclaimStat.on_scan( retiredList.second, nFreed, timer.elapsed() );
+        }
+    }
 
-            // Liberate cycle
-
-            details::retired_ptr_node * pBusyFirst = nullptr;
-            details::retired_ptr_node * pBusyLast = nullptr;
-            size_t nBusyCount = 0;
+    size_t GarbageCollector::classic_scan( details::retired_ptr_buffer::privatize_result& retiredList )
+    {
+        size_t nLiberateThreshold = m_nLiberateThreshold.load(atomics::memory_order_relaxed);
+        details::liberate_set set( beans::ceil2( retiredList.second > nLiberateThreshold ? retiredList.second : nLiberateThreshold ) );
+
+        // Get list of retired pointers
+        size_t nRetiredCount = 0;
+        details::retired_ptr_node * pHead = retiredList.first;
+        while ( pHead ) {
+            details::retired_ptr_node * pNext = pHead->m_pNext;
+            pHead->m_pNextFree = nullptr;
+            set.insert( *pHead );
+            pHead = pNext;
+            ++nRetiredCount;
+        }
 
-            for ( details::guard_data * pGuard = m_GuardPool.begin(); pGuard; pGuard = pGuard->pGlobalNext.load(atomics::memory_order_acquire) )
-            {
-                // get guarded pointer
-                details::guard_data::guarded_ptr  valGuarded = pGuard->pPost.load(atomics::memory_order_acquire);
-
-                if ( valGuarded ) {
-                    details::retired_ptr_node * pRetired = set.erase( valGuarded );
-                    if ( pRetired ) {
-                        // Retired pointer is being guarded
-                        // pRetired is the head of retired pointers list for which the m_ptr.m_p field is equal
-                        // List is linked on m_pNextFree field
-
-                        if ( pBusyLast )
-                            pBusyLast->m_pNext = pRetired;
-                        else
-                            pBusyFirst = pRetired;
-                        pBusyLast = pRetired;
+        // Make the guards published by other threads visible
+        if ( m_bAsymmetricFence )
+            cds::OS::membarrier::barrier();
+        else
+            atomics::atomic_thread_fence( atomics::memory_order_seq_cst );
+
+        // Liberate cycle
+
+        details::retired_ptr_node * pBusyFirst = nullptr;
+        details::retired_ptr_node * pBusyLast = nullptr;
+        size_t nBusyCount = 0;
+
+        for ( details::guard_data * pGuard = m_GuardPool.begin(); pGuard; pGuard = pGuard->pGlobalNext.load(atomics::memory_order_acquire) )
+        {
+            // get guarded pointer
+            details::guard_data::guarded_ptr  valGuarded = pGuard->pPost.load(atomics::memory_order_acquire);
+
+            if ( valGuarded ) {
+                details::retired_ptr_node * pRetired = set.erase( valGuarded );
+                if ( pRetired ) {
+                    // Retired pointer is being guarded
+                    // pRetired is the head of retired pointers list for which the m_ptr.m_p field is equal
+                    // List is linked on m_pNextFree field
+
+                    if ( pBusyLast )
+                        pBusyLast->m_pNext = pRetired;
+                    else
+                        pBusyFirst = pRetired;
+                    pBusyLast = pRetired;
+                    ++nBusyCount;
+                    while ( pBusyLast->m_pNextFree ) {
+                        pBusyLast = pBusyLast->m_pNext = pBusyLast->m_pNextFree;
                         ++nBusyCount;
-                        while ( pBusyLast->m_pNextFree ) {
-                            pBusyLast = pBusyLast->m_pNext = pBusyLast->m_pNextFree;
-                            ++nBusyCount;
-                        }
                     }
                 }
             }
+        }
 
-            // Place [pBusyList, pBusyLast] back to m_RetiredBuffer
-            if ( pBusyFirst )
-                m_RetiredBuffer.push_list( pBusyFirst, pBusyLast, nBusyCount );
+        // Place [pBusyList, pBusyLast] back to m_RetiredBuffer
+        if ( pBusyFirst )
+            m_RetiredBuffer.push_list( pBusyFirst, pBusyLast, nBusyCount );
 
-            // Free all retired pointers
-            details::liberate_set::list_range range = set.free_all();
+        // Free all retired pointers
+        details::liberate_set::list_range range = set.free_all();
 
-            m_RetiredAllocator.inc_epoch();
+        release_retired( range.first, range.second, nLiberateThreshold );
+        return nRetiredCount - nBusyCount;
+    }
 
-            if ( range.first ) {
-                assert( range.second != nullptr );
-                m_RetiredAllocator.free_range( range.first, range.second );
+    size_t GarbageCollector::sorted_scan( details::retired_ptr_buffer::privatize_result& retiredList )
+    {
+        size_t nLiberateThreshold = m_nLiberateThreshold.load(atomics::memory_order_relaxed);
+
+        // Collect retired nodes into contiguous array sorted by retired pointer
+        std::vector< details::retired_ptr_node * > arrRetired;
+        arrRetired.reserve( retiredList.second );
+        for ( details::retired_ptr_node * p = retiredList.first; p; p = p->m_pNext )
+            arrRetired.push_back( p );
+        std::sort( arrRetired.begin(), arrRetired.end(),
+            []( details::retired_ptr_node const * p1, details::retired_ptr_node const * p2 ) { return p1->m_ptr.m_p < p2->m_ptr.m_p; } );
+
+        // Make the guards published by other threads visible
+        if ( m_bAsymmetricFence )
+            cds::OS::membarrier::barrier();
+        else
+            atomics::atomic_thread_fence( atomics::memory_order_seq_cst );
+
+        // Sorted snapshot of non-null guards
+        std::vector< details::guard_data::guarded_ptr > arrGuarded;
+        for ( details::guard_data * pGuard = m_GuardPool.begin(); pGuard; pGuard = pGuard->pGlobalNext.load(atomics::memory_order_acquire) ) {
+            details::guard_data::guarded_ptr valGuarded = pGuard->pPost.load(atomics::memory_order_acquire);
+            if ( valGuarded )
+                arrGuarded.push_back( valGuarded );
+        }
+        std::sort( arrGuarded.begin(), arrGuarded.end() );
+
+        // Liberate cycle: merge two sorted arrays
+        details::retired_ptr_node * pBusyFirst = nullptr;
+        details::retired_ptr_node * pBusyLast = nullptr;
+        size_t nBusyCount = 0;
+
+        details::retired_ptr_node * pFreeFirst = nullptr;
+        details::retired_ptr_node * pFreeLast = nullptr;
+
+        auto itGuard = arrGuarded.cbegin();
+        auto const itGuardEnd = arrGuarded.cend();
+        for ( details::retired_ptr_node * pNode : arrRetired ) {
+            while ( itGuard != itGuardEnd && *itGuard < pNode->m_ptr.m_p )
+                ++itGuard;
+
+            if ( itGuard != itGuardEnd && *itGuard == pNode->m_ptr.m_p ) {
+                // Retired pointer is being guarded
+                if ( pBusyLast )
+                    pBusyLast->m_pNext = pNode;
+                else
+                    pBusyFirst = pNode;
+                pBusyLast = pNode;
+                ++nBusyCount;
             }
             else {
-                // scan() cycle did not free any retired pointer - double scan() threshold
-                m_nLiberateThreshold.compare_exchange_strong( nLiberateThreshold, nLiberateThreshold * 2, atomics::memory_order_release, atomics::memory_order_relaxed );
+                pNode->m_ptr.free();
+                pNode->m_pNext = nullptr;
+                if ( pFreeLast )
+                    pFreeLast->m_pNextFree = pNode;
+                else
+                    pFreeFirst = pNode;
+                pFreeLast = pNode;
             }
         }
+
+        // Place [pBusyList, pBusyLast] back to m_RetiredBuffer
+        if ( pBusyFirst )
+            m_RetiredBuffer.push_list( pBusyFirst, pBusyLast, nBusyCount );
+
+        if ( pFreeLast )
+            pFreeLast->m_pNextFree = nullptr;
+
+        release_retired( pFreeFirst, pFreeLast, nLiberateThreshold );
+        return arrRetired.size() - nBusyCount;
+    }
+
+    void GarbageCollector::release_retired( details::retired_ptr_node * pFirst, details::retired_ptr_node * pLast, size_t nLiberateThreshold )
+    {
+        m_RetiredAllocator.inc_epoch();
+
+        if ( pFirst ) {
+            assert( pLast != nullptr );
+            m_RetiredAllocator.free_range( pFirst, pLast );
+        }
+        else {
+            // scan() cycle did not free any retired pointer - double scan() threshold
+            m_nLiberateThreshold.compare_exchange_strong( nLiberateThreshold, nLiberateThreshold * 2, atomics::memory_order_release, atomics::memory_order_relaxed );
+        }
     }
 }}} // namespace cds::gc::dhp
@@ -0,0 +1,234 @@
+//$$CDS-header$$
+
+// Epoch-based reclamation memory manager implementation
+
+#include <cds/gc/details/ebr.h>
+
+#define CDS_EBR_STATISTIC( _x )    if ( m_bStatEnabled ) { _x; }
+
+namespace cds { namespace gc { namespace ebr {
+
+    GarbageCollector * GarbageCollector::m_pManager = nullptr;
+
+    void CDS_STDCALL GarbageCollector::Construct( size_t nRetiredThreshold )
+    {
+        if ( !m_pManager ) {
+            m_pManager = new GarbageCollector( nRetiredThreshold );
+        }
+    }
+
+    void CDS_STDCALL GarbageCollector::Destruct()
+    {
+        delete m_pManager;
+        m_pManager = nullptr;
+    }
+
+    GarbageCollector::GarbageCollector( size_t nRetiredThreshold )
+        : m_nGlobalEpoch( 1 )
+        , m_pListHead( nullptr )
+        , m_nRetiredThreshold( nRetiredThreshold ? nRetiredThreshold : 256 )
+        , m_bStatEnabled( true )
+    {}
+
+    GarbageCollector::~GarbageCollector()
+    {
+        CDS_DEBUG_ONLY( const cds::OS::ThreadId nullThreadId = cds::OS::c_NullThreadId; )
+        CDS_DEBUG_ONLY( const cds::OS::ThreadId mainThreadId = cds::OS::get_current_thread_id() ;)
+
+        details::thread_record * pHead = m_pListHead.load( atomics::memory_order_relaxed );
+        m_pListHead.store( nullptr, atomics::memory_order_relaxed );
+
+        details::thread_record * pNext = nullptr;
+        for ( details::thread_record * pRec = pHead; pRec; pRec = pNext ) {
+            assert( pRec->m_idOwner.load( atomics::memory_order_relaxed ) == nullThreadId
+                || pRec->m_idOwner.load( atomics::memory_order_relaxed ) == mainThreadId
+                || !cds::OS::is_thread_alive( pRec->m_idOwner.load( atomics::memory_order_relaxed ))
+            );
+
+            // No thread can be in critical section, so all retired pointers may be freed
+            for ( auto& r : pRec->m_arrRetired )
+                r.m_ptr.free();
+            pRec->m_arrRetired.clear();
+
+            pNext = pRec->m_pNextNode;
+            delete pRec;
+        }
+    }
+
+    details::thread_record * GarbageCollector::alloc_thread_record()
+    {
+        details::thread_record * pRec;
+        const cds::OS::ThreadId nullThreadId = cds::OS::c_NullThreadId;
+        const cds::OS::ThreadId curThreadId  = cds::OS::get_current_thread_id();
+
+        // First try to reuse a free record
+        for ( pRec = m_pListHead.load( atomics::memory_order_acquire ); pRec; pRec = pRec->m_pNextNode ) {
+            cds::OS::ThreadId thId = nullThreadId;
+            if ( !pRec->m_idOwner.compare_exchange_strong( thId, curThreadId, atomics::memory_order_seq_cst, atomics::memory_order_relaxed ))
+                continue;
+            pRec->m_bFree.store( false, atomics::memory_order_release );
+            pRec->m_nScanThreshold = pRec->m_arrRetired.size() + m_nRetiredThreshold;
+            return pRec;
+        }
+
+        // No records available for reuse
+        // Allocate and push a new record
+        pRec = new details::thread_record;
+        pRec->m_idOwner.store( curThreadId, atomics::memory_order_relaxed );
+        pRec->m_bFree.store( false, atomics::memory_order_relaxed );
+        pRec->m_nScanThreshold = m_nRetiredThreshold;
+        pRec->m_arrRetired.reserve( m_nRetiredThreshold );
+
+        atomics::atomic_thread_fence( atomics::memory_order_release );
+
+        details::thread_record * pOldHead = m_pListHead.load( atomics::memory_order_acquire );
+        do {
+            pRec->m_pNextNode = pOldHead;
+        } while ( !m_pListHead.compare_exchange_weak( pOldHead, pRec, atomics::memory_order_release, atomics::memory_order_relaxed ));
+
+        return pRec;
+    }
+
+    void GarbageCollector::free_thread_record( details::thread_record * pRec )
+    {
+        assert( pRec != nullptr );
+        assert( pRec->m_nNestCount == 0 );
+
+        pRec->m_nNestCount = 0;
+        pRec->m_nEpoch.store( 0, atomics::memory_order_release );
+
+        // Fast path: nothing to reclaim, the scan cycle is skipped on detach
+        if ( !pRec->m_arrRetired.empty() ) {
+            scan( pRec );
+            help_scan( pRec );
+        }
+
+        if ( pRec->m_arrRetired.empty() )
+            pRec->m_bFree.store( true, atomics::memory_order_release );
+        pRec->m_idOwner.store( cds::OS::c_NullThreadId, atomics::memory_order_release );
+    }
+
+    bool GarbageCollector::try_advance_epoch( size_t nEpoch )
+    {
+        // The fence pairs with the fence in enter(): either we see the announcement of a thread
+        // or the thread will see the retired pointer unlinked
+        atomics::atomic_thread_fence( atomics::memory_order_seq_cst );
+
+        size_t const nActive = ( nEpoch << 1 ) | 1;
+        for ( details::thread_record * pRec = m_pListHead.load( atomics::memory_order_acquire ); pRec; pRec = pRec->m_pNextNode ) {
+            size_t const nAnnounced = pRec->m_nEpoch.load( atomics::memory_order_acquire );
+            if ( nAnnounced && nAnnounced != nActive )
+                return false;
+        }
+
+        if ( m_nGlobalEpoch.compare_exchange_strong( nEpoch, nEpoch + 1, atomics::memory_order_acq_rel, atomics::memory_order_relaxed )) {
+            CDS_EBR_STATISTIC( ++m_stat.m_nEpochAdvance )
+        }
+        // else, the epoch has been advanced by another thread
+        return true;
+    }
+
+    void GarbageCollector::scan( details::thread_record * pRec )
+    {
+        // Disposers called from scan() may retire pointers too
+        if ( pRec->m_bInScan )
+            return;
+        pRec->m_bInScan = true;
+
+        CDS_EBR_STATISTIC( ++m_stat.m_nScanCall )
+
+        // A pointer retired in current epoch can be freed after two epoch advances
+        size_t nEpoch = m_nGlobalEpoch.load( atomics::memory_order_acquire );
+        for ( int i = 0; i < 2 && try_advance_epoch( nEpoch ); ++i )
+            nEpoch = m_nGlobalEpoch.load( atomics::memory_order_acquire );
+
+        // Privatize the retired array since the disposers may push new items to pRec->m_arrRetired
+        details::retired_vector arrRetired;
+        arrRetired.swap( pRec->m_arrRetired );
+
+        auto itInsert = arrRetired.begin();
+        for ( auto it = arrRetired.begin(), itEnd = arrRetired.end(); it != itEnd; ++it ) {
+            if ( it->m_nEpoch + 2 <= nEpoch )
+                it->m_ptr.free();
+            else {
+                if ( itInsert != it )
+                    *itInsert = *it;
+                ++itInsert;
+            }
+        }
+
+        size_t const nDeferred = itInsert - arrRetired.begin();
+        CDS_EBR_STATISTIC( m_stat.m_nDeferredNode += nDeferred )
+        CDS_EBR_STATISTIC( m_stat.m_nDeletedNode += arrRetired.size() - nDeferred )
+        arrRetired.erase( itInsert, arrRetired.end() );
+
+        if ( pRec->m_arrRetired.empty() )
+            arrRetired.swap( pRec->m_arrRetired );
+        else
+            pRec->m_arrRetired.insert( pRec->m_arrRetired.end(), arrRetired.begin(), arrRetired.end() );
+
+        // Do not call scan() for each retire() if the epoch cannot be advanced
+        pRec->m_nScanThreshold = pRec->m_arrRetired.size() + m_nRetiredThreshold;
+
+        pRec->m_bInScan = false;
+    }
+
+    void GarbageCollector::help_scan( details::thread_record * pThis )
+    {
+        assert( pThis->m_idOwner.load(atomics::memory_order_relaxed) == cds::OS::get_current_thread_id() );
+
+        const cds::OS::ThreadId nullThreadId = cds::OS::c_NullThreadId;
+        const cds::OS::ThreadId curThreadId = cds::OS::get_current_thread_id();
+        for ( details::thread_record * pRec = m_pListHead.load(atomics::memory_order_acquire); pRec; pRec = pRec->m_pNextNode ) {
+
+            // If m_bFree == true then pRec->m_arrRetired is empty - we don't need to see it
+            if ( pRec == pThis || pRec->m_bFree.load(atomics::memory_order_acquire) )
+                continue;
+
+            // Owns pRec if it is free.
+            // Several threads may work concurrently so we use atomic technique only.
+            {
+                cds::OS::ThreadId curOwner = pRec->m_idOwner.load(atomics::memory_order_acquire);
+                if ( curOwner == nullThreadId || !cds::OS::is_thread_alive( curOwner )) {
+                    if ( !pRec->m_idOwner.compare_exchange_strong( curOwner, curThreadId, atomics::memory_order_acquire, atomics::memory_order_relaxed ))
+                        continue;
+                }
+                else
+                    continue;
+            }
+
+            // We own the record successfully. Move its retired pointers to pThis that is private for current thread.
+            pRec->m_nEpoch.store( 0, atomics::memory_order_release );
+            pRec->m_nNestCount = 0;
+            pThis->m_arrRetired.insert( pThis->m_arrRetired.end(), pRec->m_arrRetired.begin(), pRec->m_arrRetired.end() );
+            pRec->m_arrRetired.clear();
+
+            pRec->m_bFree.store( true, atomics::memory_order_release );
+            pRec->m_idOwner.store( nullThreadId, atomics::memory_order_release );
+        }
+
+        scan( pThis );
+    }
+
+    GarbageCollector::InternalState& GarbageCollector::getInternalState( GarbageCollector::InternalState& stat ) const
+    {
+        stat.nGlobalEpoch       = m_nGlobalEpoch.load( atomics::memory_order_relaxed );
+        stat.nRetiredThreshold  = m_nRetiredThreshold;
+        stat.nThreadRecAllocated =
+            stat.nThreadRecUsed = 0;
+
+        for ( details::thread_record * pRec = m_pListHead.load(atomics::memory_order_acquire); pRec; pRec = pRec->m_pNextNode ) {
+            ++stat.nThreadRecAllocated;
+            if ( pRec->m_idOwner.load( atomics::memory_order_relaxed ) != cds::OS::c_NullThreadId )
+                ++stat.nThreadRecUsed;
+        }
+
+        stat.evcEpochAdvance    = m_stat.m_nEpochAdvance.load( atomics::memory_order_relaxed );
+        stat.evcScanCall        = m_stat.m_nScanCall.load( atomics::memory_order_relaxed );
+        stat.evcDeletedNode     = m_stat.m_nDeletedNode.load( atomics::memory_order_relaxed );
+        stat.evcDeferredNode    = m_stat.m_nDeferredNode.load( atomics::memory_order_relaxed );
+
+        return stat;
+    }
+
+}}} // namespace cds::gc::ebr
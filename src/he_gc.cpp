@@ -0,0 +1,272 @@
+//$$CDS-header$$
+
+// Hazard eras memory manager implementation
+
+#include <algorithm>   // std::sort, std::lower_bound, std::binary_search
+#include <cds/gc/details/he.h>
+
+#define CDS_HE_STATISTIC( _x )    if ( m_bStatEnabled ) { _x; }
+
+namespace cds { namespace gc { namespace he {
+
+    GarbageCollector * GarbageCollector::m_pManager = nullptr;
+
+    void CDS_STDCALL GarbageCollector::Construct( size_t nRetiredThreshold, size_t nEraAdvanceFreq )
+    {
+        if ( !m_pManager ) {
+            m_pManager = new GarbageCollector( nRetiredThreshold, nEraAdvanceFreq );
+        }
+    }
+
+    void CDS_STDCALL GarbageCollector::Destruct()
+    {
+        delete m_pManager;
+        m_pManager = nullptr;
+    }
+
+    GarbageCollector::GarbageCollector( size_t nRetiredThreshold, size_t nEraAdvanceFreq )
+        : m_nEraClock( 1 )
+        , m_pListHead( nullptr )
+        , m_nRetiredThreshold( nRetiredThreshold ? nRetiredThreshold : 256 )
+        , m_nEraAdvanceFreq( nEraAdvanceFreq ? nEraAdvanceFreq : 32 )
+        , m_bStatEnabled( true )
+    {}
+
+    GarbageCollector::~GarbageCollector()
+    {
+        CDS_DEBUG_ONLY( const cds::OS::ThreadId nullThreadId = cds::OS::c_NullThreadId; )
+        CDS_DEBUG_ONLY( const cds::OS::ThreadId mainThreadId = cds::OS::get_current_thread_id() ;)
+
+        details::thread_record * pHead = m_pListHead.load( atomics::memory_order_relaxed );
+        m_pListHead.store( nullptr, atomics::memory_order_relaxed );
+
+        details::thread_record * pNext = nullptr;
+        for ( details::thread_record * pRec = pHead; pRec; pRec = pNext ) {
+            assert( pRec->m_idOwner.load( atomics::memory_order_relaxed ) == nullThreadId
+                || pRec->m_idOwner.load( atomics::memory_order_relaxed ) == mainThreadId
+                || !cds::OS::is_thread_alive( pRec->m_idOwner.load( atomics::memory_order_relaxed ))
+            );
+
+            // No thread can hold a guard, so all retired pointers may be freed
+            for ( auto& r : pRec->m_arrRetired )
+                r.m_ptr.free();
+            pRec->m_arrRetired.clear();
+
+            details::slot_block * pNextBlock;
+            for ( details::slot_block * pBlock = pRec->m_pSlotBlocks.load( atomics::memory_order_relaxed ); pBlock; pBlock = pNextBlock ) {
+                pNextBlock = pBlock->m_pNext;
+                delete pBlock;
+            }
+
+            pNext = pRec->m_pNextNode;
+            delete pRec;
+        }
+    }
+
+    details::thread_record * GarbageCollector::alloc_thread_record()
+    {
+        details::thread_record * pRec;
+        const cds::OS::ThreadId nullThreadId = cds::OS::c_NullThreadId;
+        const cds::OS::ThreadId curThreadId  = cds::OS::get_current_thread_id();
+
+        // First try to reuse a free record
+        for ( pRec = m_pListHead.load( atomics::memory_order_acquire ); pRec; pRec = pRec->m_pNextNode ) {
+            cds::OS::ThreadId thId = nullThreadId;
+            if ( !pRec->m_idOwner.compare_exchange_strong( thId, curThreadId, atomics::memory_order_seq_cst, atomics::memory_order_relaxed ))
+                continue;
+            pRec->m_bFree.store( false, atomics::memory_order_release );
+            pRec->m_nScanThreshold = pRec->m_arrRetired.size() + m_nRetiredThreshold;
+            return pRec;
+        }
+
+        // No records available for reuse
+        // Allocate and push a new record
+        pRec = new details::thread_record;
+        pRec->m_idOwner.store( curThreadId, atomics::memory_order_relaxed );
+        pRec->m_bFree.store( false, atomics::memory_order_relaxed );
+        pRec->m_nScanThreshold = m_nRetiredThreshold;
+        pRec->m_arrRetired.reserve( m_nRetiredThreshold );
+
+        atomics::atomic_thread_fence( atomics::memory_order_release );
+
+        details::thread_record * pOldHead = m_pListHead.load( atomics::memory_order_acquire );
+        do {
+            pRec->m_pNextNode = pOldHead;
+        } while ( !m_pListHead.compare_exchange_weak( pOldHead, pRec, atomics::memory_order_release, atomics::memory_order_relaxed ));
+
+        return pRec;
+    }
+
+    void GarbageCollector::free_thread_record( details::thread_record * pRec )
+    {
+        assert( pRec != nullptr );
+
+        // Fast path: nothing to reclaim, the scan cycle is skipped on detach
+        if ( !pRec->m_arrRetired.empty() ) {
+            scan( pRec );
+            help_scan( pRec );
+        }
+
+        if ( pRec->m_arrRetired.empty() )
+            pRec->m_bFree.store( true, atomics::memory_order_release );
+        pRec->m_idOwner.store( cds::OS::c_NullThreadId, atomics::memory_order_release );
+    }
+
+    void GarbageCollector::extend_slots( details::thread_record * pRec )
+    {
+        details::slot_block * pBlock = new details::slot_block;
+
+        details::guard_slot * pFree = pRec->m_pFreeSlots;
+        for ( size_t i = details::slot_block::c_nCapacity; i > 0; --i ) {
+            pBlock->m_arr[i - 1].m_pNextFree = pFree;
+            pFree = &pBlock->m_arr[i - 1];
+        }
+        pRec->m_pFreeSlots = pFree;
+
+        // Only the owner extends the block list, so the store is enough to publish the block
+        pBlock->m_pNext = pRec->m_pSlotBlocks.load( atomics::memory_order_relaxed );
+        pRec->m_pSlotBlocks.store( pBlock, atomics::memory_order_release );
+    }
+
+    void GarbageCollector::scan( details::thread_record * pRec )
+    {
+        // Disposers called from scan() may retire pointers too
+        if ( pRec->m_bInScan )
+            return;
+        pRec->m_bInScan = true;
+
+        CDS_HE_STATISTIC( ++m_stat.m_nScanCall )
+
+        // The fence pairs with the fence in guard_slot::protect(): either we see the era published by a thread
+        // or the thread will see the retired pointer unlinked
+        atomics::atomic_thread_fence( atomics::memory_order_seq_cst );
+
+        // Stage 1: make sorted snapshots of published eras and hazard pointers
+        std::vector< era_type >& arrEras = pRec->m_arrEras;
+        std::vector< void * >& arrHazards = pRec->m_arrHazards;
+        arrEras.clear();
+        arrHazards.clear();
+
+        for ( details::thread_record * pNode = m_pListHead.load( atomics::memory_order_acquire ); pNode; pNode = pNode->m_pNextNode ) {
+            for ( details::slot_block * pBlock = pNode->m_pSlotBlocks.load( atomics::memory_order_acquire ); pBlock; pBlock = pBlock->m_pNext ) {
+                for ( details::guard_slot& slot : pBlock->m_arr ) {
+                    // The era is read first since guard_slot::set() publishes the hazard pointer before clearing the era
+                    era_type const nEra = slot.m_nEra.load( atomics::memory_order_acquire );
+                    if ( nEra )
+                        arrEras.push_back( nEra );
+                    void * pHazard = slot.m_pHazard.load( atomics::memory_order_acquire );
+                    if ( pHazard )
+                        arrHazards.push_back( pHazard );
+                }
+            }
+        }
+
+        std::sort( arrEras.begin(), arrEras.end() );
+        std::sort( arrHazards.begin(), arrHazards.end() );
+
+        // Stage 2: free the retired pointers whose lifetime interval contains no published era
+        // Privatize the retired array since the disposers may push new items to pRec->m_arrRetired
+        details::retired_vector arrRetired;
+        arrRetired.swap( pRec->m_arrRetired );
+
+        auto itInsert = arrRetired.begin();
+        for ( auto it = arrRetired.begin(), itEnd = arrRetired.end(); it != itEnd; ++it ) {
+            auto itEra = std::lower_bound( arrEras.begin(), arrEras.end(), it->m_nBirthEra );
+            if ( ( itEra != arrEras.end() && *itEra <= it->m_nRetireEra )
+                || std::binary_search( arrHazards.begin(), arrHazards.end(), it->m_ptr.m_p ))
+            {
+                if ( itInsert != it )
+                    *itInsert = *it;
+                ++itInsert;
+            }
+            else
+                it->m_ptr.free();
+        }
+
+        size_t const nDeferred = itInsert - arrRetired.begin();
+        CDS_HE_STATISTIC( m_stat.m_nDeferredNode += nDeferred )
+        CDS_HE_STATISTIC( m_stat.m_nDeletedNode += arrRetired.size() - nDeferred )
+        arrRetired.erase( itInsert, arrRetired.end() );
+
+        if ( pRec->m_arrRetired.empty() )
+            arrRetired.swap( pRec->m_arrRetired );
+        else
+            pRec->m_arrRetired.insert( pRec->m_arrRetired.end(), arrRetired.begin(), arrRetired.end() );
+
+        // A pointer with unknown birth era may be blocked by a stalled guard for a long time.
+        // Do not call scan() for each retire() in that case: next scan() is called
+        // when the count of new retired pointers reaches the count of deferred ones
+        pRec->m_nScanThreshold = pRec->m_arrRetired.size() + std::max( m_nRetiredThreshold, nDeferred );
+
+        pRec->m_bInScan = false;
+    }
+
+    void GarbageCollector::help_scan( details::thread_record * pThis )
+    {
+        assert( pThis->m_idOwner.load(atomics::memory_order_relaxed) == cds::OS::get_current_thread_id() );
+
+        CDS_HE_STATISTIC( ++m_stat.m_nHelpScanCall )
+
+        const cds::OS::ThreadId nullThreadId = cds::OS::c_NullThreadId;
+        const cds::OS::ThreadId curThreadId = cds::OS::get_current_thread_id();
+        for ( details::thread_record * pRec = m_pListHead.load(atomics::memory_order_acquire); pRec; pRec = pRec->m_pNextNode ) {
+
+            // If m_bFree == true then pRec->m_arrRetired is empty - we don't need to see it
+            if ( pRec == pThis || pRec->m_bFree.load(atomics::memory_order_acquire) )
+                continue;
+
+            // Owns pRec if it is free.
+            // Several threads may work concurrently so we use atomic technique only.
+            {
+                cds::OS::ThreadId curOwner = pRec->m_idOwner.load(atomics::memory_order_acquire);
+                if ( curOwner == nullThreadId || !cds::OS::is_thread_alive( curOwner )) {
+                    if ( !pRec->m_idOwner.compare_exchange_strong( curOwner, curThreadId, atomics::memory_order_acquire, atomics::memory_order_relaxed ))
+                        continue;
+                }
+                else
+                    continue;
+            }
+
+            // We own the record successfully. Clear the guards of dead owner
+            // and move its retired pointers to pThis that is private for current thread.
+            for ( details::slot_block * pBlock = pRec->m_pSlotBlocks.load( atomics::memory_order_relaxed ); pBlock; pBlock = pBlock->m_pNext ) {
+                for ( details::guard_slot& slot : pBlock->m_arr )
+                    slot.clear();
+            }
+            pThis->m_arrRetired.insert( pThis->m_arrRetired.end(), pRec->m_arrRetired.begin(), pRec->m_arrRetired.end() );
+            pRec->m_arrRetired.clear();
+
+            pRec->m_bFree.store( true, atomics::memory_order_release );
+            pRec->m_idOwner.store( nullThreadId, atomics::memory_order_release );
+        }
+
+        scan( pThis );
+    }
+
+    GarbageCollector::InternalState& GarbageCollector::getInternalState( GarbageCollector::InternalState& stat ) const
+    {
+        stat.nEra               = m_nEraClock.load( atomics::memory_order_relaxed );
+        stat.nRetiredThreshold  = m_nRetiredThreshold;
+        stat.nEraAdvanceFreq    = m_nEraAdvanceFreq;
+        stat.nThreadRecAllocated =
+            stat.nThreadRecUsed =
+            stat.nGuardAllocated = 0;
+
+        for ( details::thread_record * pRec = m_pListHead.load(atomics::memory_order_acquire); pRec; pRec = pRec->m_pNextNode ) {
+            ++stat.nThreadRecAllocated;
+            if ( pRec->m_idOwner.load( atomics::memory_order_relaxed ) != cds::OS::c_NullThreadId )
+                ++stat.nThreadRecUsed;
+            for ( details::slot_block * pBlock = pRec->m_pSlotBlocks.load( atomics::memory_order_acquire ); pBlock; pBlock = pBlock->m_pNext )
+                stat.nGuardAllocated += details::slot_block::c_nCapacity;
+        }
+
+        stat.evcEraAdvance      = m_stat.m_nEraAdvance.load( atomics::memory_order_relaxed );
+        stat.evcScanCall        = m_stat.m_nScanCall.load( atomics::memory_order_relaxed );
+        stat.evcHelpScanCall    = m_stat.m_nHelpScanCall.load( atomics::memory_order_relaxed );
+        stat.evcDeletedNode     = m_stat.m_nDeletedNode.load( atomics::memory_order_relaxed );
+        stat.evcDeferredNode    = m_stat.m_nDeferredNode.load( atomics::memory_order_relaxed );
+
+        return stat;
+    }
+
+}}} // namespace cds::gc::he
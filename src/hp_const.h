@@ -18,11 +18,11 @@ namespace cds { namespace gc {
     //---------------------------------------------------------------
     // Hazard Pointers reclamation schema constants
     namespace hp {
-        // Max number of threads expected
-        static const size_t c_nMaxThreadCount     = 100;
-
-        // Number of Hazard Pointers per thread
+        // Initial number of Hazard Pointers per thread, the size of HP block
         static const size_t c_nHazardPointerPerThread = 8;
+
+        // Min scan threshold of per-thread retired pointer array
+        static const size_t c_nRetiredThreshold = 256;
     } // namespace hp
 
 } /* namespace gc */ }    /* namespace cds */
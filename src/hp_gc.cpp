@@ -10,50 +10,170 @@
 */
 
 #include <cds/gc/details/hp.h>
+#include <cds/os/membarrier.h>
+#include <cds/algo/int_algo.h>
+#include <cds/gc/details/reclaimer_thread.h>
 
 #include <algorithm>    // std::sort
 #include "hp_const.h"
 
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#   include <emmintrin.h>
+#   define CDS_HAZARDPTR_SSE2
+#endif
+
 #define    CDS_HAZARDPTR_STATISTIC( _x )    if ( m_bStatEnabled ) { _x; }
 
+namespace cds { namespace gc { namespace hp { namespace {
+
+    // Hash table of hazard pointers used by hashed_scan.
+    // The table is an array of buckets, each bucket contains c_nBucketSize pointers;
+    // the collision is resolved by linear probing of buckets. The empty slot is nullptr,
+    // hazard pointers are never null. A bucket is compared with a key as a whole by SIMD instructions
+    class hazard_table
+    {
+    public:
+        static CDS_CONSTEXPR const size_t c_nBucketSize = 4;
+
+    private:
+        struct bucket {
+            void *  m_arr[c_nBucketSize];
+        };
+
+        std::vector< bucket >   m_Buckets;
+        size_t                  m_nMask;
+
+    public:
+        explicit hazard_table( size_t nCapacity )
+        {
+            // Load factor of the table is not greater than 1/2, so any probe sequence ends with
+            // a bucket that has an empty slot
+            size_t const nBucketCount = cds::beans::ceil2( nCapacity / (c_nBucketSize / 2) + 1 );
+            m_Buckets.resize( nBucketCount, bucket() );
+            m_nMask = nBucketCount - 1;
+        }
+
+        void insert( void * p )
+        {
+            assert( p != nullptr );
+            for ( size_t nIdx = hash( p ); ; nIdx = ( nIdx + 1 ) & m_nMask ) {
+                for ( void *& slot : m_Buckets[nIdx].m_arr ) {
+                    if ( slot == nullptr ) {
+                        slot = p;
+                        return;
+                    }
+                }
+            }
+        }
+
+        bool contains( void * p ) const
+        {
+            if ( p == nullptr )
+                return false;
+
+            for ( size_t nIdx = hash( p ); ; nIdx = ( nIdx + 1 ) & m_nMask ) {
+                bool bHasEmpty;
+                if ( find_in_bucket( m_Buckets[nIdx], p, bHasEmpty ))
+                    return true;
+                if ( bHasEmpty )
+                    return false;
+            }
+        }
+
+    private:
+        size_t hash( void * p ) const
+        {
+            // Fibonacci hashing; the high half of the product is folded to the low bits
+            size_t h = reinterpret_cast<size_t>( p ) * static_cast<size_t>( sizeof(size_t) == 8 ? 0x9E3779B97F4A7C15ULL : 0x9E3779B9UL );
+            h ^= h >> ( sizeof(size_t) * 4 );
+            return h & m_nMask;
+        }
+
+#   ifdef CDS_HAZARDPTR_SSE2
+        static bool find_in_bucket( bucket const& b, void * p, bool& bHasEmpty )
+        {
+            __m128i const zero = _mm_setzero_si128();
+#       if CDS_BUILD_BITS == 64
+            static_assert( sizeof(void *) == 8, "Unexpected pointer size" );
+            __m128i const key = _mm_set1_epi64x( static_cast<long long>( reinterpret_cast<size_t>( p )));
+            __m128i const lo = _mm_loadu_si128( reinterpret_cast<__m128i const *>( b.m_arr ));
+            __m128i const hi = _mm_loadu_si128( reinterpret_cast<__m128i const *>( b.m_arr + 2 ));
+
+            // SSE2 has no 64bit comparison: two 32bit halves of the pointer should be equal
+            auto cmpeq64 = []( __m128i x, __m128i y ) -> __m128i {
+                __m128i const eq = _mm_cmpeq_epi32( x, y );
+                return _mm_and_si128( eq, _mm_shuffle_epi32( eq, _MM_SHUFFLE( 2, 3, 0, 1 )));
+            };
+            bHasEmpty = _mm_movemask_epi8( _mm_or_si128( cmpeq64( lo, zero ), cmpeq64( hi, zero ))) != 0;
+            return _mm_movemask_epi8( _mm_or_si128( cmpeq64( lo, key ), cmpeq64( hi, key ))) != 0;
+#       else
+            static_assert( sizeof(void *) == 4, "Unexpected pointer size" );
+            __m128i const key = _mm_set1_epi32( static_cast<int>( reinterpret_cast<size_t>( p )));
+            __m128i const v = _mm_loadu_si128( reinterpret_cast<__m128i const *>( b.m_arr ));
+            bHasEmpty = _mm_movemask_epi8( _mm_cmpeq_epi32( v, zero )) != 0;
+            return _mm_movemask_epi8( _mm_cmpeq_epi32( v, key )) != 0;
+#       endif
+        }
+#   else
+        static bool find_in_bucket( bucket const& b, void * p, bool& bHasEmpty )
+        {
+            bool bFound = false;
+            bHasEmpty = false;
+            for ( void * slot : b.m_arr ) {
+                bFound |= slot == p;
+                bHasEmpty |= slot == nullptr;
+            }
+            return bFound;
+        }
+#   endif
+    };
+
+}}}} // namespace cds::gc::hp::<anonymous>
+
 namespace cds { namespace gc {
     namespace hp {
 
-        /// Max array size of retired pointers
-        static const size_t c_nMaxRetireNodeCount = c_nHazardPointerPerThread * c_nMaxThreadCount * 2;
-
         GarbageCollector *    GarbageCollector::m_pHZPManager = nullptr;
+        bool                  GarbageCollector::m_bAsymmetricFence = false;
 
-        void CDS_STDCALL GarbageCollector::Construct( size_t nHazardPtrCount, size_t nMaxThreadCount, size_t nMaxRetiredPtrCount, scan_type nScanType )
+        void CDS_STDCALL GarbageCollector::Construct( size_t nHazardPtrCount, size_t /*nMaxThreadCount*/, size_t nMaxRetiredPtrCount, scan_type nScanType, bool bAsymmetricFence, bool bBackgroundReclaim,
+            void (* fnAttachThread)(), void (* fnDetachThread)() )
         {
             if ( !m_pHZPManager ) {
-                m_pHZPManager = new GarbageCollector( nHazardPtrCount, nMaxThreadCount, nMaxRetiredPtrCount, nScanType );
+                // Fall back to the full fence mode if the process-wide barrier is not supported
+                m_bAsymmetricFence = bAsymmetricFence && cds::OS::membarrier::init();
+                m_pHZPManager = new GarbageCollector( nHazardPtrCount, nMaxRetiredPtrCount, nScanType );
+                if ( bBackgroundReclaim )
+                    m_pHZPManager->start_reclaimer( fnAttachThread, fnDetachThread );
             }
         }
 
         void CDS_STDCALL GarbageCollector::Destruct( bool bDetachAll )
         {
             if ( m_pHZPManager ) {
+                m_pHZPManager->stop_reclaimer();
+
                 if ( bDetachAll )
                     m_pHZPManager->detachAllThread();
 
                 delete m_pHZPManager;
                 m_pHZPManager = nullptr;
+                m_bAsymmetricFence = false;
             }
         }
 
         GarbageCollector::GarbageCollector(
             size_t nHazardPtrCount,
-            size_t nMaxThreadCount,
-            size_t nMaxRetiredPtrCount,
+            size_t nRetiredThreshold,
             scan_type nScanType
         )
             : m_pListHead( nullptr )
+            ,m_nFreeRecords( 0 )
             ,m_bStatEnabled( true )
             ,m_nHazardPointerCount( nHazardPtrCount == 0 ? c_nHazardPointerPerThread : nHazardPtrCount )
-            ,m_nMaxThreadCount( nMaxThreadCount == 0 ? c_nMaxThreadCount : nMaxThreadCount )
-            ,m_nMaxRetiredPtrCount( nMaxRetiredPtrCount > c_nMaxRetireNodeCount ? nMaxRetiredPtrCount : c_nMaxRetireNodeCount )
+            ,m_nRetiredThreshold( nRetiredThreshold == 0 ? c_nRetiredThreshold : nRetiredThreshold )
             ,m_nScanType( nScanType )
+            ,m_pReclaimer( nullptr )
         {}
 
         GarbageCollector::~GarbageCollector()
@@ -105,13 +225,18 @@ namespace cds { namespace gc {
             const cds::OS::ThreadId nullThreadId = cds::OS::c_NullThreadId;
             const cds::OS::ThreadId curThreadId  = cds::OS::get_current_thread_id();
 
-            // First try to reuse a retired (non-active) HP record
-            for ( hprec = m_pListHead.load( atomics::memory_order_acquire ); hprec; hprec = hprec->m_pNextNode ) {
-                cds::OS::ThreadId thId = nullThreadId;
-                if ( !hprec->m_idOwner.compare_exchange_strong( thId, curThreadId, atomics::memory_order_seq_cst, atomics::memory_order_relaxed ) )
-                    continue;
-                hprec->m_bFree.store( false, atomics::memory_order_release );
-                return hprec;
+            // First try to reuse a retired (non-active) HP record.
+            // m_nFreeRecords is only a hint: if it is zero we skip the list scan and allocate a new record
+            if ( m_nFreeRecords.load( atomics::memory_order_acquire ) != 0 ) {
+                for ( hprec = m_pListHead.load( atomics::memory_order_acquire ); hprec; hprec = hprec->m_pNextNode ) {
+                    cds::OS::ThreadId thId = nullThreadId;
+                    if ( hprec->m_idOwner.load( atomics::memory_order_relaxed ) != nullThreadId
+                      || !hprec->m_idOwner.compare_exchange_strong( thId, curThreadId, atomics::memory_order_seq_cst, atomics::memory_order_relaxed ) )
+                        continue;
+                    m_nFreeRecords.fetch_sub( 1, atomics::memory_order_relaxed );
+                    hprec->m_bFree.store( false, atomics::memory_order_release );
+                    return hprec;
+                }
             }
 
             // No HP records available for reuse
@@ -136,9 +261,23 @@ namespace cds { namespace gc {
             CDS_HAZARDPTR_STATISTIC( ++m_Stat.m_RetireHPRec )
 
             pRec->clear();
-            Scan( pRec );
-            HelpScan( pRec );
             hplist_node * pNode = static_cast<hplist_node *>( pRec );
+
+            // Fast path: a thread that has no retired pointers does not need a scan cycle on detach.
+            // Records of dead threads are still helped by HelpScan() of the other threads
+            if ( pRec->m_arrRetired.size() != 0 ) {
+                if ( m_pReclaimer )
+                    retire_batch( pRec );
+                else {
+                    Scan( pRec );
+                    HelpScan( pRec );
+                }
+            }
+            if ( pRec->m_arrRetired.size() == 0 )
+                pNode->m_bFree.store( true, atomics::memory_order_release );
+
+            // The counter is incremented before the record is released so that it never underflows
+            m_nFreeRecords.fetch_add( 1, atomics::memory_order_relaxed );
             pNode->m_idOwner.store( cds::OS::c_NullThreadId, atomics::memory_order_release );
         }
 
@@ -154,23 +293,126 @@ namespace cds { namespace gc {
             }
         }
 
+        void GarbageCollector::start_reclaimer( void (* fnAttachThread)(), void (* fnDetachThread)() )
+        {
+            assert( m_pReclaimer == nullptr );
+            m_pReclaimer = new cds::gc::details::reclaimer_thread;
+            m_pReclaimer->start( [this]() { reclaimer_func(); }, fnAttachThread, fnDetachThread );
+        }
+
+        void GarbageCollector::stop_reclaimer()
+        {
+            if ( m_pReclaimer ) {
+                m_pReclaimer->stop();
+                delete m_pReclaimer;
+                m_pReclaimer = nullptr;
+            }
+        }
+
+        void GarbageCollector::reclaimer_func()
+        {
+            // The reclamation thread owns an ordinary HP record; the batches handed off
+            // are moved to its retired array
+            details::hp_record * pRec = alloc_hp_record();
+
+            cds::gc::details::reclaimer_thread::batch_type batch;
+            while ( m_pReclaimer->wait( batch )) {
+                for ( auto const& p : batch )
+                    pRec->m_arrRetired.push( p );
+                pRec->update_retired_count();
+                Scan( pRec );
+                HelpScan( pRec );
+                m_pReclaimer->done();
+            }
+
+            free_hp_record( pRec );
+        }
+
+        void GarbageCollector::retire_batch( details::hp_record * pRec, bool bSync )
+        {
+            assert( m_pReclaimer != nullptr );
+
+            if ( m_pReclaimer->is_reclaimer_thread()) {
+                // A disposer called by the reclamation thread retires pointers or the thread detaches:
+                // the thread cannot hand off the batch and wait for itself, so it scans the record directly
+                Scan( pRec );
+                HelpScan( pRec );
+                return;
+            }
+
+            CDS_HAZARDPTR_STATISTIC( ++m_Stat.m_BatchHandoff )
+
+            cds::gc::details::reclaimer_thread::batch_type batch;
+            pRec->m_arrRetired.swap( batch );
+            m_pReclaimer->push( batch );
+
+            // batch is empty now but it may have the storage of the batch processed by the reclamation thread
+            pRec->m_arrRetired.swap( batch );
+            pRec->update_retired_count();
+
+            if ( bSync )
+                m_pReclaimer->flush();
+        }
+
+        void GarbageCollector::scan_fence() const
+        {
+            if ( m_bAsymmetricFence )
+                cds::OS::membarrier::barrier();
+            else
+                atomics::atomic_thread_fence( atomics::memory_order_seq_cst );
+        }
+
+        void GarbageCollector::Scan( details::hp_record * pRec )
+        {
+            cds::gc::details::scan_timer timer;
+            size_t const nBacklog = pRec->m_arrRetired.size();
+
+            switch ( m_nScanType ) {
+                case inplace:
+                    inplace_scan( pRec );
+                    break;
+                case hashed:
+                    hashed_scan( pRec );
+                    break;
+                default:
+                    assert(false)   ;   // Forgotten something?..
+                case classic:
+                    classic_scan( pRec );
+                    break;
+            }
+
+            uint64_t const nDuration = timer.elapsed();
+            pRec->m_ReclaimStat.on_scan( nBacklog, nBacklog - pRec->m_arrRetired.size(), nDuration );
+            pRec->update_retired_count();
+
+            if ( m_bStatEnabled ) {
+                m_Stat.m_ScanTime += static_cast<size_t>( nDuration );
+
+                size_t nMax = m_Stat.m_nMaxScanTime.load( atomics::memory_order_relaxed );
+                while ( nMax < nDuration
+                    && !m_Stat.m_nMaxScanTime.compare_exchange_weak( nMax, static_cast<size_t>( nDuration ), atomics::memory_order_relaxed, atomics::memory_order_relaxed ));
+            }
+        }
+
         void GarbageCollector::classic_scan( details::hp_record * pRec )
         {
             CDS_HAZARDPTR_STATISTIC( ++m_Stat.m_ScanCallCount )
 
+            // Make the hazard pointers published by other threads visible
+            scan_fence();
+
             std::vector< void * >   plist;
-            plist.reserve( m_nMaxThreadCount * m_nHazardPointerCount );
-            assert( plist.size() == 0 );
+            size_t nHPCount = 0;
 
             // Stage 1: Scan HP list and insert non-null values in plist
+            // Only the hazard pointers handed out to attached threads are read
 
             hplist_node * pNode = m_pListHead.load(atomics::memory_order_acquire);
 
             while ( pNode ) {
-                for ( size_t i = 0; i < m_nHazardPointerCount; ++i ) {
-                    void * hptr = pNode->m_hzp[i];
-                    if ( hptr )
-                        plist.push_back( hptr );
+                if ( !pNode->m_bFree.load( atomics::memory_order_acquire ) ) {
+                    nHPCount += pNode->m_hzp.size();
+                    pNode->m_hzp.for_each( [&plist]( void * hptr ) { plist.push_back( hptr ); } );
                 }
                 pNode = pNode->m_pNextNode;
             }
@@ -183,26 +425,28 @@ namespace cds { namespace gc {
 
             details::retired_vector::iterator itRetired     = arrRetired.begin();
             details::retired_vector::iterator itRetiredEnd  = arrRetired.end();
-            // arrRetired is not a std::vector!
-            // clear() is just set up item counter to 0, the items is not destroyed
-            arrRetired.clear();
 
             {
                 std::vector< void * >::iterator itBegin = plist.begin();
                 std::vector< void * >::iterator itEnd = plist.end();
-                size_t nDeferredCount = 0;
+                details::retired_vector::iterator itInsert = itRetired;
                 while ( itRetired != itRetiredEnd ) {
                     if ( std::binary_search( itBegin, itEnd, itRetired->m_p ) ) {
-                        arrRetired.push( *itRetired );
-                        ++nDeferredCount;
+                        if ( itInsert != itRetired )
+                            *itInsert = *itRetired;
+                        ++itInsert;
                     }
                     else
                         itRetired->free();
                     ++itRetired;
                 }
+                const size_t nDeferredCount = itInsert - arrRetired.begin();
                 CDS_HAZARDPTR_STATISTIC( m_Stat.m_DeferredNode += nDeferredCount )
-                CDS_HAZARDPTR_STATISTIC( m_Stat.m_DeletedNode += (itRetiredEnd - arrRetired.begin()) - nDeferredCount )
+                CDS_HAZARDPTR_STATISTIC( m_Stat.m_DeletedNode += arrRetired.size() - nDeferredCount )
+                arrRetired.size( nDeferredCount );
             }
+
+            set_scan_threshold( pRec, nHPCount );
         }
 
         void GarbageCollector::inplace_scan( details::hp_record * pRec )
@@ -241,24 +485,26 @@ namespace cds { namespace gc {
             }
             */
 
+            // Make the hazard pointers published by other threads visible
+            scan_fence();
+
             // Search guarded pointers in retired array
             hplist_node * pNode = m_pListHead.load( atomics::memory_order_acquire );
 
+            size_t nHPCount = 0;
             {
                 details::retired_ptr dummyRetired;
                 while ( pNode ) {
                     if ( !pNode->m_bFree.load( atomics::memory_order_acquire ) ) {
-                        for ( size_t i = 0; i < m_nHazardPointerCount; ++i ) {
-                            void * hptr = pNode->m_hzp[i];
-                            if ( hptr ) {
-                                dummyRetired.m_p = hptr;
-                                details::retired_vector::iterator it = std::lower_bound( itRetired, itRetiredEnd, dummyRetired, cds::gc::details::retired_ptr::less );
-                                if ( it != itRetiredEnd && it->m_p == hptr ) {
-                                    // Mark retired pointer as guarded
-                                    it->m_n |= 1;
-                                }
+                        nHPCount += pNode->m_hzp.size();
+                        pNode->m_hzp.for_each( [&]( void * hptr ) {
+                            dummyRetired.m_p = hptr;
+                            details::retired_vector::iterator it = std::lower_bound( itRetired, itRetiredEnd, dummyRetired, cds::gc::details::retired_ptr::less );
+                            if ( it != itRetiredEnd && it->m_p == hptr ) {
+                                // Mark retired pointer as guarded
+                                it->m_n |= 1;
                             }
-                        }
+                        });
                     }
                     pNode = pNode->m_pNextNode;
                 }
@@ -280,10 +526,55 @@ namespace cds { namespace gc {
                     }
                 }
                 const size_t nDeferred = itInsert - itRetired;
-                pRec->m_arrRetired.size( nDeferred );
                 CDS_HAZARDPTR_STATISTIC( m_Stat.m_DeferredNode += nDeferred )
                 CDS_HAZARDPTR_STATISTIC( m_Stat.m_DeletedNode += (itRetiredEnd - itRetired) - nDeferred )
+                pRec->m_arrRetired.size( nDeferred );
+            }
+
+            set_scan_threshold( pRec, nHPCount );
+        }
+
+        void GarbageCollector::hashed_scan( details::hp_record * pRec )
+        {
+            CDS_HAZARDPTR_STATISTIC( ++m_Stat.m_ScanCallCount )
+
+            // Make the hazard pointers published by other threads visible
+            scan_fence();
+
+            // Stage 1: make a snapshot of non-null hazard pointers of attached threads
+            std::vector< void * >   plist;
+            size_t nHPCount = 0;
+            for ( hplist_node * pNode = m_pListHead.load( atomics::memory_order_acquire ); pNode; pNode = pNode->m_pNextNode ) {
+                if ( !pNode->m_bFree.load( atomics::memory_order_acquire ) ) {
+                    nHPCount += pNode->m_hzp.size();
+                    pNode->m_hzp.for_each( [&plist]( void * hptr ) { plist.push_back( hptr ); } );
+                }
             }
+
+            // Stage 2: build the hash table of the snapshot
+            hazard_table hazards( plist.size() );
+            for ( void * hptr : plist )
+                hazards.insert( hptr );
+
+            // Stage 3: free the retired pointers that are not in the table, the rest are moved to head of the array
+            details::retired_vector& arrRetired = pRec->m_arrRetired;
+            details::retired_vector::iterator itRetiredEnd = arrRetired.end();
+            details::retired_vector::iterator itInsert = arrRetired.begin();
+            for ( details::retired_vector::iterator it = arrRetired.begin(); it != itRetiredEnd; ++it ) {
+                if ( hazards.contains( it->m_p )) {
+                    if ( itInsert != it )
+                        *itInsert = *it;
+                    ++itInsert;
+                }
+                else
+                    it->free();
+            }
+            const size_t nDeferredCount = itInsert - arrRetired.begin();
+            CDS_HAZARDPTR_STATISTIC( m_Stat.m_DeferredNode += nDeferredCount )
+            CDS_HAZARDPTR_STATISTIC( m_Stat.m_DeletedNode += arrRetired.size() - nDeferredCount )
+            arrRetired.size( nDeferredCount );
+
+            set_scan_threshold( pRec, nHPCount );
         }
 
         void GarbageCollector::HelpScan( details::hp_record * pThis )
@@ -297,7 +588,7 @@ namespace cds { namespace gc {
             for ( hplist_node * hprec = m_pListHead.load(atomics::memory_order_acquire); hprec; hprec = hprec->m_pNextNode ) {
 
                 // If m_bFree == true then hprec->m_arrRetired is empty - we don't need to see it
-                if ( hprec->m_bFree.load(atomics::memory_order_acquire) )
+                if ( hprec == pThis || hprec->m_bFree.load(atomics::memory_order_acquire) )
                     continue;
 
                 // Owns hprec if it is empty.
@@ -313,59 +604,71 @@ namespace cds { namespace gc {
                         if ( !hprec->m_idOwner.compare_exchange_strong( curOwner, curThreadId, atomics::memory_order_release, atomics::memory_order_relaxed ))
                             continue;
                     }
+
+                    // A record released by free_hp_record() is counted in m_nFreeRecords
+                    if ( curOwner == nullThreadId )
+                        m_nFreeRecords.fetch_sub( 1, atomics::memory_order_relaxed );
                 }
 
                 // We own the thread successfully. Now, we can see whether hp_record has retired pointers.
                 // If it has ones then we move to pThis that is private for current thread.
+                // The retired array of pThis grows on demand so all retired pointers of hprec are moved at once
                 details::retired_vector& src = hprec->m_arrRetired;
                 details::retired_vector& dest = pThis->m_arrRetired;
-                assert( !dest.isFull());
                 details::retired_vector::iterator itRetired = src.begin();
                 details::retired_vector::iterator itRetiredEnd = src.end();
                 while ( itRetired != itRetiredEnd ) {
                     dest.push( *itRetired );
-                    if ( dest.isFull()) {
-                        CDS_HAZARDPTR_STATISTIC( ++m_Stat.m_CallScanFromHelpScan )
-                        Scan( pThis );
-                    }
                     ++itRetired;
                 }
                 src.clear();
+                hprec->update_retired_count();
+                pThis->update_retired_count();
+                if ( dest.isFull()) {
+                    CDS_HAZARDPTR_STATISTIC( ++m_Stat.m_CallScanFromHelpScan )
+                    Scan( pThis );
+                }
 
                 hprec->m_bFree.store(true, atomics::memory_order_release);
+                m_nFreeRecords.fetch_add( 1, atomics::memory_order_relaxed );
                 hprec->m_idOwner.store( nullThreadId, atomics::memory_order_release );
-
-                Scan( pThis );
             }
+
+            Scan( pThis );
         }
 
         GarbageCollector::InternalState& GarbageCollector::getInternalState( GarbageCollector::InternalState& stat) const
         {
             stat.nHPCount                = m_nHazardPointerCount;
-            stat.nMaxThreadCount         = m_nMaxThreadCount;
-            stat.nMaxRetiredPtrCount     = m_nMaxRetiredPtrCount;
-            stat.nHPRecSize              = sizeof( hplist_node )
-                                            + sizeof(details::retired_ptr) * m_nMaxRetiredPtrCount;
+            stat.nRetiredThreshold       = m_nRetiredThreshold;
+            stat.nMaxRetiredPtrCount     = m_nRetiredThreshold;
+            stat.nHPRecSize              = sizeof( hplist_node );
 
-            stat.nHPRecAllocated         =
+            stat.nHPAllocated            =
+                stat.nHPUsed                 =
+                stat.nHPRecAllocated         =
                 stat.nHPRecUsed              =
                 stat.nTotalRetiredPtrCount   =
                 stat.nRetiredPtrInFreeHPRecs = 0;
 
             for ( hplist_node * hprec = m_pListHead.load(atomics::memory_order_acquire); hprec; hprec = hprec->m_pNextNode ) {
                 ++stat.nHPRecAllocated;
-                stat.nTotalRetiredPtrCount += hprec->m_arrRetired.size();
+                stat.nHPAllocated += hprec->m_hzp.capacity();
+                stat.nTotalRetiredPtrCount += hprec->retired_count();
 
                 if ( hprec->m_bFree.load(atomics::memory_order_relaxed) ) {
                     // Free HP record
-                    stat.nRetiredPtrInFreeHPRecs += hprec->m_arrRetired.size();
+                    stat.nRetiredPtrInFreeHPRecs += hprec->retired_count();
                 }
                 else {
                     // Used HP record
                     ++stat.nHPRecUsed;
+                    stat.nHPUsed += hprec->m_hzp.size();
                 }
             }
 
+            stat.nMaxThreadCount = stat.nHPRecAllocated;
+
             // Events
             stat.evcAllocHPRec   = m_Stat.m_AllocHPRec;
             stat.evcRetireHPRec  = m_Stat.m_RetireHPRec;
@@ -379,9 +682,25 @@ namespace cds { namespace gc {
             stat.evcDeletedNode  = m_Stat.m_DeletedNode;
             stat.evcDeferredNode = m_Stat.m_DeferredNode;
 
+            stat.evcScanTime     = m_Stat.m_ScanTime;
+            stat.nMaxScanTime    = m_Stat.m_nMaxScanTime.load( atomics::memory_order_relaxed );
+
+            stat.evcBatchHandoff = m_Stat.m_BatchHandoff;
+
             return stat;
         }
 
+        cds::gc::reclaim_stat& GarbageCollector::getReclaimStat( cds::gc::reclaim_stat& st ) const
+        {
+            st.clear();
+            for ( hplist_node * hprec = m_pListHead.load(atomics::memory_order_acquire); hprec; hprec = hprec->m_pNextNode ) {
+                hprec->m_ReclaimStat.collect( st );
+                // m_arrRetired may be changed by its owner concurrently, so the published count is read
+                st.nBacklog += hprec->retired_count();
+            }
+            return st;
+        }
+
 
     } //namespace hp
 }} // namespace cds::gc
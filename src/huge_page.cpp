@@ -0,0 +1,109 @@
+//$$CDS-header$$
+
+#include <cds/os/huge_page.h>
+#include <cds/os/alloc_aligned.h>
+#include <algorithm>
+
+#if CDS_OS_TYPE == CDS_OS_LINUX
+#   include <sys/mman.h>
+#   include <errno.h>
+#   define CDS_OS_HUGE_PAGE_MMAP
+#   ifdef MAP_HUGETLB
+        // Old glibc defines the huge page size flags in <linux/mman.h> only
+#       ifndef MAP_HUGE_SHIFT
+#           define MAP_HUGE_SHIFT   26
+#       endif
+#       ifndef MAP_HUGE_2MB
+#           define MAP_HUGE_2MB     ( 21 << MAP_HUGE_SHIFT )
+#       endif
+#   endif
+#endif
+
+namespace cds { namespace OS {
+
+    atomics::atomic<bool> huge_page::s_bHugeTLBFailed( false );
+    atomics::atomic<unsigned int> huge_page::s_nHugeTLBSkip( 0 );
+    atomics::atomic<unsigned int> huge_page::s_nHugeTLBBackoff( 0 );
+
+    namespace {
+        // Max count of alloc() calls that do not try MAP_HUGETLB after ENOMEM
+        unsigned int const c_nHugeTLBMaxBackoff = 1024;
+    }
+
+    bool huge_page::skip_hugetlb()
+    {
+        if ( s_bHugeTLBFailed.load( atomics::memory_order_relaxed ))
+            return true;
+
+        unsigned int nSkip = s_nHugeTLBSkip.load( atomics::memory_order_relaxed );
+        while ( nSkip && !s_nHugeTLBSkip.compare_exchange_weak( nSkip, nSkip - 1, atomics::memory_order_relaxed, atomics::memory_order_relaxed ));
+        return nSkip != 0;
+    }
+
+    void * huge_page::alloc( size_t nSize, kind& k )
+    {
+        assert( nSize % c_nSize == 0 );
+        k = regular_pages;
+
+#ifdef CDS_OS_HUGE_PAGE_MMAP
+#   ifdef MAP_HUGETLB
+        if ( !skip_hugetlb()) {
+            // The default huge page size of the system may be 1G, so 2M pages are requested explicitly
+            void * p = ::mmap( nullptr, nSize, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB | MAP_HUGE_2MB, -1, 0 );
+            if ( p != MAP_FAILED ) {
+                if ( s_nHugeTLBBackoff.load( atomics::memory_order_relaxed ))
+                    s_nHugeTLBBackoff.store( 0, atomics::memory_order_relaxed );
+                k = hugetlb_pages;
+                return p;
+            }
+            // EINVAL, ENOSYS - the kernel does not support 2M huge pages, do not try again.
+            // ENOMEM - no free reserved huge pages now (or none is reserved at all), they may be freed later.
+            // The failed mmap is a syscall, so the next alloc() calls do not try MAP_HUGETLB,
+            // the count of skipped calls is doubled after each ENOMEM in a row up to c_nHugeTLBMaxBackoff
+            int const nErr = errno;
+            if ( nErr == EINVAL || nErr == ENOSYS )
+                s_bHugeTLBFailed.store( true, atomics::memory_order_relaxed );
+            else if ( nErr == ENOMEM ) {
+                unsigned int nBackoff = s_nHugeTLBBackoff.load( atomics::memory_order_relaxed );
+                nBackoff = nBackoff ? std::min( nBackoff * 2, c_nHugeTLBMaxBackoff ) : 1;
+                s_nHugeTLBBackoff.store( nBackoff, atomics::memory_order_relaxed );
+                s_nHugeTLBSkip.store( nBackoff, atomics::memory_order_relaxed );
+            }
+        }
+#   endif
+
+        // Map c_nSize more to align the region on huge page boundary, then trim the head and the tail
+        size_t const nMapSize = nSize + c_nSize;
+        void * pMap = ::mmap( nullptr, nMapSize, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0 );
+        if ( pMap == MAP_FAILED )
+            return nullptr;
+
+        uintptr_t const nMap = reinterpret_cast<uintptr_t>( pMap );
+        uintptr_t const nBegin = ( nMap + c_nSize - 1 ) & ~uintptr_t( c_nSize - 1 );
+        if ( nBegin > nMap )
+            ::munmap( pMap, nBegin - nMap );
+        if ( nMap + nMapSize > nBegin + nSize )
+            ::munmap( reinterpret_cast<void *>( nBegin + nSize ), nMap + nMapSize - nBegin - nSize );
+
+        void * p = reinterpret_cast<void *>( nBegin );
+#   ifdef MADV_HUGEPAGE
+        if ( ::madvise( p, nSize, MADV_HUGEPAGE ) == 0 )
+            k = transparent_pages;
+#   endif
+        return p;
+#else
+        return cds::OS::aligned_malloc( nSize, c_nSize );
+#endif
+    }
+
+    void huge_page::free( void * p, size_t nSize )
+    {
+#ifdef CDS_OS_HUGE_PAGE_MMAP
+        ::munmap( p, nSize );
+#else
+        CDS_UNUSED( nSize );
+        cds::OS::aligned_free( p );
+#endif
+    }
+
+}} // namespace cds::OS
@@ -0,0 +1,66 @@
+//$$CDS-header$$
+
+#include <cds/os/membarrier.h>
+
+#if CDS_OS_TYPE == CDS_OS_LINUX
+#   include <unistd.h>
+#   include <sys/syscall.h>
+#   include <cerrno>
+#   include <cstdio>
+#   include <cstdlib>
+#endif
+
+#if CDS_OS_TYPE == CDS_OS_LINUX && defined(__NR_membarrier)
+#   define CDS_OS_MEMBARRIER_SUPPORTED
+    // membarrier(2) commands, see <linux/membarrier.h>
+    // The constants are declared here since old kernel headers may not define them
+    enum {
+        CDS_MEMBARRIER_CMD_QUERY = 0,
+        CDS_MEMBARRIER_CMD_PRIVATE_EXPEDITED = 1 << 3,
+        CDS_MEMBARRIER_CMD_REGISTER_PRIVATE_EXPEDITED = 1 << 4
+    };
+#endif
+
+namespace cds { namespace OS {
+
+    // 0 - not initialized, 1 - available, -1 - not supported
+    atomics::atomic<int> membarrier::s_nState( 0 );
+
+    bool membarrier::init()
+    {
+        int nState = s_nState.load( atomics::memory_order_acquire );
+        if ( nState == 0 ) {
+            nState = -1;
+#   ifdef CDS_OS_MEMBARRIER_SUPPORTED
+            long nCmdMask = ::syscall( __NR_membarrier, CDS_MEMBARRIER_CMD_QUERY, 0 );
+            if ( nCmdMask > 0 && ( nCmdMask & CDS_MEMBARRIER_CMD_PRIVATE_EXPEDITED )
+                && ( nCmdMask & CDS_MEMBARRIER_CMD_REGISTER_PRIVATE_EXPEDITED )
+                && ::syscall( __NR_membarrier, CDS_MEMBARRIER_CMD_REGISTER_PRIVATE_EXPEDITED, 0 ) == 0 )
+            {
+                nState = 1;
+            }
+#   endif
+            // Registration is idempotent, so a race between threads is harmless
+            s_nState.store( nState, atomics::memory_order_release );
+        }
+        return nState > 0;
+    }
+
+    void membarrier::barrier()
+    {
+#   ifdef CDS_OS_MEMBARRIER_SUPPORTED
+        if ( is_available() ) {
+            // The fast side has only a compiler barrier since init() succeeded.
+            // A fence of the calling thread does not order it, so the failure is fatal
+            if ( ::syscall( __NR_membarrier, CDS_MEMBARRIER_CMD_PRIVATE_EXPEDITED, 0 ) != 0 ) {
+                int const nErr = errno;
+                ::fprintf( stderr, "libcds: membarrier(MEMBARRIER_CMD_PRIVATE_EXPEDITED) failed after registration, errno=%d\n", nErr );
+                ::abort();
+            }
+            return;
+        }
+#   endif
+        atomics::atomic_thread_fence( atomics::memory_order_seq_cst );
+    }
+
+}} // namespace cds::OS
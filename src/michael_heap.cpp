@@ -10,6 +10,7 @@
 */
 
 #include <cds/memory/michael/allocator.h>
+#include <thread>
 
 #ifdef _DEBUG
 //#   include <iostream>
@@ -324,4 +325,97 @@ namespace cds { namespace memory { namespace michael {
         62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62,
         62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62
     };
+
+    namespace details {
+
+        namespace {
+            struct thread_cache_heap {
+                unsigned long long          nHeapId;
+                void *                      pHeap;
+                thread_cache_release_func   fnRelease;
+            };
+
+            // Registered heaps. Thread exit and the heap destructor are serialized by the lock,
+            // so a record is never released to a destroyed heap.
+            // The lock is a plain atomic flag: it must be usable by static heaps
+            // before dynamic initialization and after destruction of this module
+            thread_cache_heap   s_arrThreadCacheHeap[ c_nMaxThreadCacheHeaps ];
+            unsigned long long  s_nLastHeapId = 0;
+            atomics::atomic<bool> s_bThreadCacheLocked( false );
+
+            struct thread_cache_lock {
+                thread_cache_lock()
+                {
+                    while ( s_bThreadCacheLocked.exchange( true, atomics::memory_order_acquire ))
+                        std::this_thread::yield();
+                }
+                ~thread_cache_lock()
+                {
+                    s_bThreadCacheLocked.store( false, atomics::memory_order_release );
+                }
+            };
+
+            void release_thread_cache( thread_cache_slot * pSlots )
+            {
+                thread_cache_lock al;
+                for ( unsigned int i = 0; i < c_nMaxThreadCacheHeaps; ++i ) {
+                    if ( pSlots[i].nHeapId != 0 && pSlots[i].nHeapId == s_arrThreadCacheHeap[i].nHeapId )
+                        s_arrThreadCacheHeap[i].fnRelease( s_arrThreadCacheHeap[i].pHeap, pSlots[i].pRecord );
+                    pSlots[i].nHeapId = 0;
+                    pSlots[i].pRecord = nullptr;
+                }
+            }
+
+#ifdef CDS_CXX11_THREAD_LOCAL_SUPPORT
+            struct thread_cache_slots_holder {
+                thread_cache_slot   arrSlot[ c_nMaxThreadCacheHeaps ];
+                bool                bTerminated;
+
+                ~thread_cache_slots_holder()
+                {
+                    bTerminated = true;
+                    release_thread_cache( arrSlot );
+                }
+            };
+
+            thread_local thread_cache_slots_holder s_ThreadCacheSlots;
+#endif
+        } // namespace
+
+        CDS_EXPORT_API unsigned int register_thread_cache_heap( void * pHeap, thread_cache_release_func func, unsigned long long& nHeapId )
+        {
+            thread_cache_lock al;
+            nHeapId = ++s_nLastHeapId;
+            for ( unsigned int i = 0; i < c_nMaxThreadCacheHeaps; ++i ) {
+                if ( s_arrThreadCacheHeap[i].nHeapId == 0 ) {
+                    s_arrThreadCacheHeap[i].nHeapId = nHeapId;
+                    s_arrThreadCacheHeap[i].pHeap = pHeap;
+                    s_arrThreadCacheHeap[i].fnRelease = func;
+                    return i;
+                }
+            }
+            return c_nMaxThreadCacheHeaps;
+        }
+
+        CDS_EXPORT_API void unregister_thread_cache_heap( unsigned int nSlot )
+        {
+            if ( nSlot < c_nMaxThreadCacheHeaps ) {
+                thread_cache_lock al;
+                s_arrThreadCacheHeap[nSlot].nHeapId = 0;
+                s_arrThreadCacheHeap[nSlot].pHeap = nullptr;
+                s_arrThreadCacheHeap[nSlot].fnRelease = nullptr;
+            }
+        }
+
+        CDS_EXPORT_API thread_cache_slot * thread_cache_slots()
+        {
+#ifdef CDS_CXX11_THREAD_LOCAL_SUPPORT
+            // The heap may be used by destructors of other thread-local objects after our holder is destroyed
+            return s_ThreadCacheSlots.bTerminated ? nullptr : s_ThreadCacheSlots.arrSlot;
+#else
+            return nullptr;
+#endif
+        }
+    } // namespace details
+
 }}} // namespace cds::memory::michael
@@ -0,0 +1,53 @@
+//$$CDS-header$$
+
+#include <cds/os/numa_page.h>
+#include <cds/os/page_purge.h>
+#include <cds/os/topology.h>
+#include <cds/os/alloc_aligned.h>
+
+#if CDS_OS_TYPE == CDS_OS_LINUX
+#   include <sys/mman.h>
+#   define CDS_OS_NUMA_PAGE_MMAP
+#endif
+
+namespace cds { namespace OS {
+
+    atomics::atomic<size_t> numa_page::s_nBindFailed( 0 );
+
+    namespace {
+        size_t round_to_page( size_t nSize )
+        {
+            size_t const nPageSize = page_purge::page_size();
+            return ( nSize + nPageSize - 1 ) & ~( nPageSize - 1 );
+        }
+    } // namespace
+
+    void * numa_page::alloc( size_t nSize )
+    {
+        nSize = round_to_page( nSize );
+
+#ifdef CDS_OS_NUMA_PAGE_MMAP
+        void * p = ::mmap( nullptr, nSize, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0 );
+        if ( p == MAP_FAILED )
+            return nullptr;
+
+        // The pages are not touched yet, so the policy places them when they are touched first
+        if ( topology::node_count() > 1 && !topology::bind_to_local_node( p, nSize ))
+            s_nBindFailed.fetch_add( 1, atomics::memory_order_relaxed );
+        return p;
+#else
+        return cds::OS::aligned_malloc( nSize, page_purge::page_size());
+#endif
+    }
+
+    void numa_page::free( void * p, size_t nSize )
+    {
+#ifdef CDS_OS_NUMA_PAGE_MMAP
+        ::munmap( p, round_to_page( nSize ));
+#else
+        CDS_UNUSED( nSize );
+        cds::OS::aligned_free( p );
+#endif
+    }
+
+}} // namespace cds::OS
@@ -0,0 +1,57 @@
+//$$CDS-header$$
+
+#include <cds/os/page_purge.h>
+
+#if CDS_OS_INTERFACE == CDS_OSI_UNIX
+#   include <unistd.h>
+#   include <sys/mman.h>
+#   if defined(MADV_FREE) || defined(MADV_DONTNEED)
+#       define CDS_OS_PAGE_PURGE_SUPPORTED
+#   endif
+#endif
+
+namespace cds { namespace OS {
+
+    atomics::atomic<bool> page_purge::s_bFreeFailed( false );
+
+    size_t page_purge::page_size()
+    {
+#if CDS_OS_INTERFACE == CDS_OSI_UNIX
+        static size_t const s_nPageSize = static_cast<size_t>( ::sysconf( _SC_PAGESIZE ));
+        return s_nPageSize;
+#else
+        return 4096;
+#endif
+    }
+
+    size_t page_purge::purge( void * p, size_t nSize )
+    {
+#ifdef CDS_OS_PAGE_PURGE_SUPPORTED
+        uintptr_t const nPageSize = static_cast<uintptr_t>( page_size());
+        uintptr_t const nBegin = ( reinterpret_cast<uintptr_t>( p ) + nPageSize - 1 ) & ~( nPageSize - 1 );
+        uintptr_t const nEnd = ( reinterpret_cast<uintptr_t>( p ) + nSize ) & ~( nPageSize - 1 );
+        if ( nBegin >= nEnd )
+            return 0;
+        size_t const nPurgeSize = static_cast<size_t>( nEnd - nBegin );
+
+#   ifdef MADV_FREE
+        if ( !s_bFreeFailed.load( atomics::memory_order_relaxed )) {
+            if ( ::madvise( reinterpret_cast<void *>( nBegin ), nPurgeSize, MADV_FREE ) == 0 )
+                return nPurgeSize;
+            // The kernel does not support MADV_FREE, do not try again
+            s_bFreeFailed.store( true, atomics::memory_order_relaxed );
+        }
+#   endif
+#   ifdef MADV_DONTNEED
+        return ::madvise( reinterpret_cast<void *>( nBegin ), nPurgeSize, MADV_DONTNEED ) == 0 ? nPurgeSize : 0;
+#   else
+        return 0;
+#   endif
+#else
+        CDS_UNUSED( p );
+        CDS_UNUSED( nSize );
+        return 0;
+#endif
+    }
+
+}} // namespace cds::OS
@@ -0,0 +1,233 @@
+//$$CDS-header$$
+
+#include <cds/threading/placement.h>
+
+#include <vector>
+#include <algorithm>
+
+#if CDS_OS_TYPE == CDS_OS_LINUX
+#   include <sched.h>
+#   include <pthread.h>
+#   include <unistd.h>
+#endif
+
+namespace cds { namespace threading {
+
+    CDS_EXPORT_API atomics::atomic<int>    ThreadData::s_nPlacement( placement_none );
+    CDS_EXPORT_API atomics::atomic<size_t> ThreadData::s_nPlacedThreadCount( 0 );
+
+    namespace {
+        typedef cds::OS::topology topology;
+
+        // Returns the IDs of the processors a thread may be pinned to: the online processors
+        // that are in the affinity mask of the process. Processor IDs may be sparse
+        std::vector<unsigned int> usable_processors()
+        {
+            unsigned int const nBound = topology::processor_id_bound();
+            std::vector<unsigned int> arrProc;
+            arrProc.reserve( topology::processor_count() );
+            for ( unsigned int nProc = 0; nProc < nBound; ++nProc ) {
+                if ( topology::is_processor_online( nProc ))
+                    arrProc.push_back( nProc );
+            }
+
+#if CDS_OS_TYPE == CDS_OS_LINUX
+            // The fake processors are not real CPUs, the affinity mask of the process is not applicable
+            cpu_set_t cpuset;
+            CPU_ZERO( &cpuset );
+            if ( !topology::is_fake_topology() && ::sched_getaffinity( ::getpid(), sizeof(cpuset), &cpuset ) == 0 ) {
+                std::vector<unsigned int> arrAllowed;
+                arrAllowed.reserve( arrProc.size() );
+                for ( unsigned int nProc : arrProc ) {
+                    if ( nProc < CPU_SETSIZE && CPU_ISSET( nProc, &cpuset ))
+                        arrAllowed.push_back( nProc );
+                }
+                if ( !arrAllowed.empty() )
+                    arrProc.swap( arrAllowed );
+            }
+#endif
+            return arrProc;
+        }
+
+        // Sorts the processors arrProc for compact or scatter policy.
+        // The processors are sorted by the key built from their location
+        void build_processor_order( thread_placement p, std::vector<unsigned int>& arrProc )
+        {
+            unsigned int const nNodeCount = topology::node_count();
+            unsigned int const nCoreCount = topology::core_count();
+            unsigned int const nProcBound = topology::processor_id_bound();
+
+            // The processor with invalid location is skipped
+            arrProc.erase( std::remove_if( arrProc.begin(), arrProc.end(), [nNodeCount, nCoreCount]( unsigned int nProc ) {
+                return topology::processor_core( nProc ) >= nCoreCount || topology::processor_node( nProc ) >= nNodeCount;
+            }), arrProc.end() );
+
+            // SMT sibling index of a processor in its core and core index in its node
+            std::vector<unsigned int> arrSiblingNo( arrProc.size() );
+            std::vector<unsigned int> arrCoreNo( nCoreCount, static_cast<unsigned int>(-1) );
+            std::vector<unsigned int> arrThreadsInCore( nCoreCount, 0 );
+            std::vector<unsigned int> arrCoresInNode( nNodeCount, 0 );
+            unsigned int nMaxCoresInNode = 1;
+            for ( size_t i = 0; i < arrProc.size(); ++i ) {
+                unsigned int const nCore = topology::processor_core( arrProc[i] );
+                unsigned int const nNode = topology::processor_node( arrProc[i] );
+                arrSiblingNo[i] = arrThreadsInCore[nCore]++;
+                if ( arrCoreNo[nCore] == static_cast<unsigned int>(-1) ) {
+                    arrCoreNo[nCore] = arrCoresInNode[nNode]++;
+                    nMaxCoresInNode = std::max( nMaxCoresInNode, arrCoresInNode[nNode] );
+                }
+            }
+
+            std::vector< std::pair<uint64_t, unsigned int> > arrOrder;
+            arrOrder.reserve( arrProc.size() );
+            for ( size_t i = 0; i < arrProc.size(); ++i ) {
+                unsigned int const nProc = arrProc[i];
+                uint64_t const nNode = topology::processor_node( nProc );
+                uint64_t const nCore = topology::processor_core( nProc );
+                uint64_t nKey;
+                if ( p == placement_compact )
+                    nKey = nNode * nCoreCount + nCore;
+                else
+                    nKey = ( uint64_t( arrSiblingNo[i] ) * nMaxCoresInNode + arrCoreNo[nCore] ) * nNodeCount + nNode;
+                arrOrder.push_back( std::make_pair( nKey * nProcBound + nProc, nProc ));
+            }
+            std::sort( arrOrder.begin(), arrOrder.end() );
+            for ( size_t i = 0; i < arrOrder.size(); ++i )
+                arrProc[i] = arrOrder[i].second;
+        }
+
+        // Sets the affinity of current thread to the usable processors n such that fAllowed( n ) is true
+        template <typename Func>
+        bool set_affinity( Func fAllowed )
+        {
+            std::vector<unsigned int> const arrProc = usable_processors();
+#if CDS_OS_TYPE == CDS_OS_LINUX
+            cpu_set_t cpuset;
+            CPU_ZERO( &cpuset );
+            bool bEmpty = true;
+            for ( unsigned int nProc : arrProc ) {
+                if ( nProc < CPU_SETSIZE && fAllowed( nProc )) {
+                    CPU_SET( nProc, &cpuset );
+                    bEmpty = false;
+                }
+            }
+            return !bEmpty && ::pthread_setaffinity_np( ::pthread_self(), sizeof(cpuset), &cpuset ) == 0;
+#elif CDS_OS_TYPE == CDS_OS_WIN32 || CDS_OS_TYPE == CDS_OS_WIN64 || CDS_OS_TYPE == CDS_OS_MINGW
+            DWORD_PTR nMask = 0;
+            for ( unsigned int nProc : arrProc ) {
+                if ( nProc < sizeof(nMask) * 8 && fAllowed( nProc ))
+                    nMask |= DWORD_PTR(1) << nProc;
+            }
+            return nMask && ::SetThreadAffinityMask( ::GetCurrentThread(), nMask ) != 0;
+#else
+            // Thread pinning is not supported
+            CDS_UNUSED( arrProc );
+            CDS_UNUSED( fAllowed );
+            return false;
+#endif
+        }
+    } // namespace
+
+    CDS_EXPORT_API char const * placement_name( thread_placement p )
+    {
+        switch ( p ) {
+        case placement_compact:
+            return "compact";
+        case placement_scatter:
+            return "scatter";
+        case placement_per_node:
+            return "per_node";
+        default:
+            return "none";
+        }
+    }
+
+    placement_map::placement_map( thread_placement p )
+        : m_nPolicy( placement_none )
+        , m_pOrder( nullptr )
+        , m_nProcCount( 0 )
+    {
+        reset( p );
+    }
+
+    placement_map::~placement_map()
+    {
+        delete [] m_pOrder;
+    }
+
+    void placement_map::reset( thread_placement p )
+    {
+        delete [] m_pOrder;
+        m_pOrder = nullptr;
+        m_nProcCount = 0;
+        m_nPolicy = p;
+
+        if ( p == placement_compact || p == placement_scatter ) {
+            std::vector<unsigned int> arrProc = usable_processors();
+            build_processor_order( p, arrProc );
+            if ( arrProc.empty() ) {
+                m_nPolicy = placement_none;
+                return;
+            }
+            m_nProcCount = static_cast<unsigned int>( arrProc.size() );
+            m_pOrder = new unsigned int[ m_nProcCount ];
+            std::copy( arrProc.begin(), arrProc.end(), m_pOrder );
+        }
+    }
+
+    unsigned int placement_map::target( size_t nThreadNo ) const
+    {
+        switch ( m_nPolicy ) {
+        case placement_compact:
+        case placement_scatter:
+            return m_pOrder[ nThreadNo % m_nProcCount ];
+        case placement_per_node:
+            return static_cast<unsigned int>( nThreadNo % topology::node_count() );
+        default:
+            return 0;
+        }
+    }
+
+    bool placement_map::place_current_thread( size_t nThreadNo ) const
+    {
+        switch ( m_nPolicy ) {
+        case placement_compact:
+        case placement_scatter:
+            {
+                unsigned int const nTarget = target( nThreadNo );
+                return set_affinity( [nTarget]( unsigned int nProc ) { return nProc == nTarget; } );
+            }
+        case placement_per_node:
+            {
+                unsigned int const nNode = target( nThreadNo );
+                return set_affinity( [nNode]( unsigned int nProc ) { return topology::processor_node( nProc ) == nNode; } );
+            }
+        default:
+            return false;
+        }
+    }
+
+    CDS_EXPORT_API unsigned int placement_target( thread_placement p, size_t nThreadNo )
+    {
+        return placement_map( p ).target( nThreadNo );
+    }
+
+    CDS_EXPORT_API bool place_current_thread( thread_placement p, size_t nThreadNo )
+    {
+        return placement_map( p ).place_current_thread( nThreadNo );
+    }
+
+    CDS_EXPORT_API void set_thread_placement( thread_placement p )
+    {
+        ThreadData::s_nPlacedThreadCount.store( 0, atomics::memory_order_relaxed );
+        ThreadData::s_nPlacement.store( p, atomics::memory_order_release );
+    }
+
+    CDS_EXPORT_API void ThreadData::place_attached_thread()
+    {
+        thread_placement p = static_cast<thread_placement>( s_nPlacement.load( atomics::memory_order_acquire ));
+        if ( p != placement_none )
+            place_current_thread( p, s_nPlacedThreadCount.fetch_add( 1, atomics::memory_order_relaxed ));
+    }
+
+}} // namespace cds::threading
@@ -5,11 +5,233 @@
 #if CDS_OS_TYPE == CDS_OS_LINUX
 
 #include <unistd.h>
+#include <sys/syscall.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
 #include <fstream>
 
 namespace cds { namespace OS { CDS_CXX11_INLINE_NAMESPACE namespace Linux {
 
     unsigned int topology::s_nProcessorCount = 0;
+    unsigned int topology::s_nLocationCount = 0;
+    unsigned int topology::s_nNodeCount = 1;
+    unsigned int topology::s_nCoreCount = 0;
+    unsigned int topology::s_nCacheCount = 1;
+    topology::processor_location * topology::s_pLocation = nullptr;
+    bool topology::s_bFake = false;
+
+    namespace {
+        static unsigned int const c_nUndefined = static_cast<unsigned int>(-1);
+
+        // Parses the list in /sys format like "0-3,8-11" and calls f( n ) for each number.
+        // Returns false if the file cannot be read
+        template <typename Func>
+        bool read_list( char const * pszPath, Func f )
+        {
+            // We cannot use operator new or std::ifstream here
+            // since the initialization phase may be called from
+            // our overloaded operator new that based on cds::michael::Heap
+            FILE * pFile = ::fopen( pszPath, "r" );
+            if ( !pFile )
+                return false;
+
+            char buf[1024];
+            bool bOk = ::fgets( buf, sizeof(buf), pFile ) != nullptr;
+            ::fclose( pFile );
+            if ( !bOk )
+                return false;
+
+            char * p = buf;
+            while ( *p >= '0' && *p <= '9' ) {
+                unsigned long nFirst = ::strtoul( p, &p, 10 );
+                unsigned long nLast = nFirst;
+                if ( *p == '-' )
+                    nLast = ::strtoul( p + 1, &p, 10 );
+                for ( unsigned long n = nFirst; n <= nLast; ++n )
+                    f( static_cast<unsigned int>( n ));
+                if ( *p == ',' )
+                    ++p;
+            }
+            return true;
+        }
+
+        static unsigned int read_number( char const * pszPath )
+        {
+            unsigned int nValue = c_nUndefined;
+            read_list( pszPath, [&nValue]( unsigned int n ) { if ( nValue == c_nUndefined ) nValue = n; } );
+            return nValue;
+        }
+
+        // The key of the domain is its smallest processor number; keys are mapped to dense numbers
+        static unsigned int dense_number( unsigned int * pMap, unsigned int nKey, unsigned int& nCount )
+        {
+            if ( pMap[nKey] == c_nUndefined )
+                pMap[nKey] = nCount++;
+            return pMap[nKey];
+        }
+
+        // Processor IDs may be sparse when some processors are offline,
+        // so the per-processor tables are indexed up to the highest possible ID
+        static unsigned int possible_processor_count()
+        {
+            unsigned int nCount = 0;
+            read_list( "/sys/devices/system/cpu/possible", [&nCount]( unsigned int nProc ) {
+                if ( nProc >= nCount )
+                    nCount = nProc + 1;
+            });
+            if ( nCount == 0 ) {
+                long n = ::sysconf( _SC_NPROCESSORS_CONF );
+                if ( n > 0 )
+                    nCount = static_cast<unsigned int>( n );
+            }
+            return nCount;
+        }
+
+        // Calls f( nProc ) for each online processor below nCount
+        template <typename Func>
+        void for_each_online_processor( unsigned int nCount, Func f )
+        {
+            if ( !read_list( "/sys/devices/system/cpu/online", [&]( unsigned int nProc ) { if ( nProc < nCount ) f( nProc ); } )) {
+                for ( unsigned int nProc = 0; nProc < nCount; ++nProc )
+                    f( nProc );
+            }
+        }
+    } // namespace
+
+    void topology::make_processor_map()
+    {
+        // Unknown topology: one node and one cache domain, each processor is a separate core
+        s_nLocationCount = 0;
+        s_nNodeCount = 1;
+        s_nCoreCount = s_nProcessorCount;
+        s_nCacheCount = 1;
+
+        unsigned int nCount = possible_processor_count();
+        if ( nCount < s_nProcessorCount )
+            nCount = s_nProcessorCount;
+
+        s_pLocation = reinterpret_cast<processor_location *>( ::malloc( sizeof(s_pLocation[0]) * nCount ));
+        unsigned int * pMap = reinterpret_cast<unsigned int *>( ::malloc( sizeof(unsigned int) * nCount ));
+        if ( !s_pLocation || !pMap ) {
+            ::free( pMap );
+            free_processor_map();
+            return;
+        }
+        s_nLocationCount = nCount;
+
+        for ( unsigned int i = 0; i < nCount; ++i ) {
+            s_pLocation[i].nNode = 0;
+            s_pLocation[i].nCore = i;
+            s_pLocation[i].nCache = 0;
+            s_pLocation[i].bOnline = false;
+        }
+
+        char szPath[128];
+
+        // NUMA nodes
+        unsigned int nNodeCount = 0;
+        read_list( "/sys/devices/system/node/online", [&]( unsigned int nNode ) {
+            ::snprintf( szPath, sizeof(szPath), "/sys/devices/system/node/node%u/cpulist", nNode );
+            bool bHasProcessor = false;
+            read_list( szPath, [&]( unsigned int nProc ) {
+                if ( nProc < nCount ) {
+                    s_pLocation[nProc].nNode = nNodeCount;
+                    bHasProcessor = true;
+                }
+            });
+            // memory-only nodes are skipped
+            if ( bHasProcessor )
+                ++nNodeCount;
+        });
+        s_nNodeCount = nNodeCount ? nNodeCount : 1;
+
+        // SMT siblings
+        for ( unsigned int i = 0; i < nCount; ++i )
+            pMap[i] = c_nUndefined;
+        unsigned int nCoreCount = 0;
+        for_each_online_processor( nCount, [&]( unsigned int nProc ) {
+            ::snprintf( szPath, sizeof(szPath), "/sys/devices/system/cpu/cpu%u/topology/thread_siblings_list", nProc );
+            unsigned int nKey = read_number( szPath );
+            s_pLocation[nProc].bOnline = true;
+            s_pLocation[nProc].nCore = dense_number( pMap, nKey < nCount ? nKey : nProc, nCoreCount );
+        });
+        s_nCoreCount = nCoreCount ? nCoreCount : s_nProcessorCount;
+
+        // Last-level cache domains
+        for ( unsigned int i = 0; i < nCount; ++i )
+            pMap[i] = c_nUndefined;
+        unsigned int nCacheCount = 0;
+        for_each_online_processor( nCount, [&]( unsigned int nProc ) {
+            unsigned int nMaxLevel = 0;
+            unsigned int nKey = c_nUndefined;
+            for ( unsigned int nIndex = 0; ; ++nIndex ) {
+                ::snprintf( szPath, sizeof(szPath), "/sys/devices/system/cpu/cpu%u/cache/index%u/level", nProc, nIndex );
+                unsigned int nLevel = read_number( szPath );
+                if ( nLevel == c_nUndefined )
+                    break;
+                if ( nLevel >= nMaxLevel ) {
+                    ::snprintf( szPath, sizeof(szPath), "/sys/devices/system/cpu/cpu%u/cache/index%u/shared_cpu_list", nProc, nIndex );
+                    unsigned int nFirst = read_number( szPath );
+                    if ( nFirst != c_nUndefined ) {
+                        nMaxLevel = nLevel;
+                        nKey = nFirst;
+                    }
+                }
+            }
+            s_pLocation[nProc].nCache = nKey < nCount ? dense_number( pMap, nKey, nCacheCount ) : 0;
+        });
+        s_nCacheCount = nCacheCount ? nCacheCount : 1;
+
+        ::free( pMap );
+    }
+
+    bool topology::bind_to_local_node( void * pMemory, size_t nSize )
+    {
+#if defined(SYS_mbind) && defined(SYS_getcpu)
+        if ( s_nNodeCount < 2 )
+            return false;
+
+        // Only whole pages are bound
+        uintptr_t const nPageSize = static_cast<uintptr_t>( ::sysconf( _SC_PAGESIZE ));
+        uintptr_t const nBegin = ( reinterpret_cast<uintptr_t>( pMemory ) + nPageSize - 1 ) & ~( nPageSize - 1 );
+        uintptr_t const nEnd = ( reinterpret_cast<uintptr_t>( pMemory ) + nSize ) & ~( nPageSize - 1 );
+        if ( nBegin >= nEnd )
+            return false;
+
+        // The node is the OS node id, not the dense number of topology::processor_node()
+        unsigned int nCpu;
+        unsigned int nNode;
+        if ( ::syscall( SYS_getcpu, &nCpu, &nNode, nullptr ) != 0 )
+            return false;
+
+        // Constants from <numaif.h>; libnuma headers are not required
+        static int const c_nMPolPreferred = 1;      // MPOL_PREFERRED
+        static unsigned int const c_nMPolMoveFlag = 1 << 1;  // MPOL_MF_MOVE
+        static size_t const c_nMaxNode = 1024;
+
+        unsigned long arrNodeMask[ c_nMaxNode / ( sizeof(unsigned long) * 8 ) ];
+        if ( nNode >= c_nMaxNode )
+            return false;
+        memset( arrNodeMask, 0, sizeof(arrNodeMask) );
+        arrNodeMask[ nNode / ( sizeof(unsigned long) * 8 ) ] |= 1UL << ( nNode % ( sizeof(unsigned long) * 8 ));
+
+        return ::syscall( SYS_mbind, nBegin, nEnd - nBegin, c_nMPolPreferred, arrNodeMask, c_nMaxNode + 1, c_nMPolMoveFlag ) == 0;
+#else
+        CDS_UNUSED( pMemory );
+        CDS_UNUSED( nSize );
+        return false;
+#endif
+    }
+
+    void topology::free_processor_map()
+    {
+        if ( s_pLocation ) {
+            ::free( s_pLocation );
+            s_pLocation = nullptr;
+        }
+        s_nLocationCount = 0;
+    }
 
     void topology::init()
     {
@@ -36,10 +258,59 @@ namespace cds { namespace OS { CDS_CXX11_INLINE_NAMESPACE namespace Linux {
                 s_nProcessorCount = 1;
             }
          }
+         if ( s_nProcessorCount == 0 )
+             s_nProcessorCount = 1;
+
+         free_processor_map();
+         make_processor_map();
+         s_bFake = false;
     }
 
     void topology::fini()
-    {}
+    {
+        free_processor_map();
+        s_bFake = false;
+    }
+
+    void topology::set_fake_topology( unsigned int nNodeCount, unsigned int nCoresPerNode, unsigned int nThreadsPerCore )
+    {
+        if ( nNodeCount == 0 )
+            nNodeCount = 1;
+        if ( nCoresPerNode == 0 )
+            nCoresPerNode = 1;
+        if ( nThreadsPerCore == 0 )
+            nThreadsPerCore = 1;
+
+        free_processor_map();
+
+        unsigned int const nProcCount = nNodeCount * nCoresPerNode * nThreadsPerCore;
+        s_pLocation = reinterpret_cast<processor_location *>( ::malloc( sizeof(s_pLocation[0]) * nProcCount ));
+        if ( !s_pLocation ) {
+            // Keep the real topology
+            init();
+            return;
+        }
+
+        s_nProcessorCount = nProcCount;
+        s_nLocationCount = nProcCount;
+        s_nNodeCount = nNodeCount;
+        s_nCoreCount = nNodeCount * nCoresPerNode;
+        s_nCacheCount = nNodeCount;
+        for ( unsigned int nProc = 0; nProc < nProcCount; ++nProc ) {
+            s_pLocation[nProc].nCore = nProc / nThreadsPerCore;
+            s_pLocation[nProc].nNode = s_pLocation[nProc].nCore / nCoresPerNode;
+            s_pLocation[nProc].nCache = s_pLocation[nProc].nNode;
+            s_pLocation[nProc].bOnline = true;
+        }
+        s_bFake = true;
+    }
+
+    void topology::reset_fake_topology()
+    {
+        if ( s_bFake )
+            init();
+    }
+
 }}} // namespace cds::OS::Linux
 
 #endif  // #if CDS_OS_TYPE == CDS_OS_LINUX
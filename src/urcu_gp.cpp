@@ -1,6 +1,7 @@
 //$$CDS-header$$
 
 #include <cds/urcu/details/gp.h>
+#include <cds/os/topology.h>
 
 namespace cds { namespace urcu { namespace details {
 
@@ -8,4 +9,17 @@ namespace cds { namespace urcu { namespace details {
     template<> CDS_EXPORT_API singleton_vtbl * gp_singleton_instance< general_buffered_tag >::s_pRCU = nullptr;
     template<> CDS_EXPORT_API singleton_vtbl * gp_singleton_instance< general_threaded_tag >::s_pRCU = nullptr;
 
+    // If the group count is equal to NUMA node count the group is the node of current processor.
+    // Otherwise the group is the current processor ID modulo the group count: processor IDs may be sparse
+    // (offline processors), so the groups are not necessarily balanced and processors of different nodes
+    // may share a group. The mapping affects the scan cost of synchronize() only, not the correctness
+    CDS_EXPORT_API size_t gp_reader_group_index( size_t nGroupCount )
+    {
+        assert( nGroupCount > 0 );
+        unsigned int const nProcessor = cds::OS::topology::current_processor();
+        if ( nGroupCount > 1 && nGroupCount == cds::OS::topology::node_count() )
+            return cds::OS::topology::processor_node( nProcessor ) % nGroupCount;
+        return nProcessor % nGroupCount;
+    }
+
 }}} // namespace cds::urcu::details
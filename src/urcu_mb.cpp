@@ -0,0 +1,10 @@
+//$$CDS-header$$
+
+#include <cds/urcu/details/mb.h>
+
+namespace cds { namespace urcu { namespace details {
+
+    template<> CDS_EXPORT_API singleton_vtbl * mb_singleton_instance< membarrier_buffered_tag >::s_pRCU = nullptr;
+    template<> CDS_EXPORT_API singleton_vtbl * mb_singleton_instance< membarrier_threaded_tag >::s_pRCU = nullptr;
+
+}}} // namespace cds::urcu::details
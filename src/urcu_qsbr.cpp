@@ -0,0 +1,9 @@
+//$$CDS-header$$
+
+#include <cds/urcu/details/qsbr.h>
+
+namespace cds { namespace urcu { namespace details {
+
+    template<> CDS_EXPORT_API singleton_vtbl * qsbr_singleton_instance< qsbr_buffered_tag >::s_pRCU = nullptr;
+
+}}} // namespace cds::urcu::details
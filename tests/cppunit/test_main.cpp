@@ -25,15 +25,21 @@
 
 #include "cppunit/cppunit_proxy.h"
 #include "cppunit/file_reporter.h"
+#include "cppunit/thread.h"
 
 #include <cds/init.h>
 #include <cds/gc/hp.h>
 #include <cds/gc/dhp.h>
+#include <cds/gc/ebr.h>
+#include <cds/gc/he.h>
 #include <cds/urcu/general_instant.h>
 #include <cds/urcu/general_buffered.h>
 #include <cds/urcu/general_threaded.h>
 #include <cds/urcu/signal_buffered.h>
 #include <cds/urcu/signal_threaded.h>
+#include <cds/urcu/qsbr_buffered.h>
+#include <cds/urcu/membarrier_buffered.h>
+#include <cds/urcu/membarrier_threaded.h>
 #include <cds/os/topology.h>
 
 #include "stdio.h"
@@ -56,6 +62,8 @@ std::ostream& operator << (std::ostream& s, const cds::gc::hp::GarbageCollector:
     s << "\nHZP GC internal state:"
         << "\n\t            HP record allocated=" << stat.nHPRecAllocated
         << "\n\t                HP records used=" << stat.nHPRecUsed
+        << "\n\t      Hazard pointers allocated=" << stat.nHPAllocated
+        << "\n\t           Hazard pointers used=" << stat.nHPUsed
         << "\n\t        Total retired ptr count=" << stat.nTotalRetiredPtrCount
         << "\n\t Retired ptr in free HP records=" << stat.nRetiredPtrInFreeHPRecs
         << "\n\tEvents:"
@@ -68,6 +76,9 @@ std::ostream& operator << (std::ostream& s, const cds::gc::hp::GarbageCollector:
         << "\n\t       Scan calls from HelpScan=" << stat.evcScanFromHelpScan
         << "\n\t       retired object deleting=" << stat.evcDeletedNode
         << "\n\t        guarded object on Scan=" << stat.evcDeferredNode
+        << "\n\t         Total Scan time, nsec=" << stat.evcScanTime
+        << "\n\t           Max Scan time, nsec=" << stat.nMaxScanTime
+        << "\n\t Batches to reclamation thread=" << stat.evcBatchHandoff
         << std::endl;
 
     return s;
@@ -359,24 +370,49 @@ int main(int argc, char** argv)
   int num_errors;
   {
       size_t nHazardPtrCount = 0;
+      bool bAsymmetricFence = false;
+      bool bBackgroundReclaim = false;
+      size_t nRCUReaderGroups = 0;
       {
         CppUnitMini::TestCfg& cfg = CppUnitMini::TestCase::m_Cfg.get( "General" );
         nHazardPtrCount = cfg.getULong( "hazard_pointer_count", 0 );
+        bAsymmetricFence = cfg.getBool( "asymmetric_fence", false );
+        bBackgroundReclaim = cfg.getBool( "background_reclaim", false );
+        nRCUReaderGroups = cfg.getULong( "rcu_reader_groups", 0 );
+
+        std::string strPlacement = cfg.get( "thread_placement", std::string("none") );
+        cds::threading::thread_placement const arrPlacement[] = {
+            cds::threading::placement_none,
+            cds::threading::placement_compact,
+            cds::threading::placement_scatter,
+            cds::threading::placement_per_node
+        };
+        bool bPlacementFound = false;
+        for ( size_t i = 0; i < sizeof(arrPlacement) / sizeof(arrPlacement[0]); ++i ) {
+            if ( strPlacement == cds::threading::placement_name( arrPlacement[i] )) {
+                CppUnitMini::ThreadPool::s_nDefaultPlacement = arrPlacement[i];
+                bPlacementFound = true;
+            }
+        }
+        if ( !bPlacementFound )
+            std::cout << "Error value of thread_placement in General section of test config\n";
       }
 
       // Safe reclamation schemes
-      cds::gc::HP hzpGC( nHazardPtrCount );
-      cds::gc::DHP dhpGC;
+      cds::gc::HP hzpGC( nHazardPtrCount, 0, 0, cds::gc::HP::scan_type::inplace, bAsymmetricFence, bBackgroundReclaim );
+      cds::gc::DHP dhpGC( 1024, 8, bAsymmetricFence, bBackgroundReclaim );
+      cds::gc::EBR ebrGC;
+      cds::gc::HE heGC;
 
       // RCU varieties
       typedef cds::urcu::gc< cds::urcu::general_instant<> >    rcu_gpi;
-      rcu_gpi   gpiRCU;
+      rcu_gpi   gpiRCU( nRCUReaderGroups );
 
       typedef cds::urcu::gc< cds::urcu::general_buffered<> >    rcu_gpb;
-      rcu_gpb   gpbRCU;
+      rcu_gpb   gpbRCU( 256, cds::urcu::shared_buffer, nRCUReaderGroups );
 
       typedef cds::urcu::gc< cds::urcu::general_threaded<> >    rcu_gpt;
-      rcu_gpt   gptRCU;
+      rcu_gpt   gptRCU( 256, cds::urcu::shared_buffer, nRCUReaderGroups );
 
 #ifdef CDS_URCU_SIGNAL_HANDLING_ENABLED
       typedef cds::urcu::gc< cds::urcu::signal_buffered<> >    rcu_shb;
@@ -386,11 +422,23 @@ int main(int argc, char** argv)
       rcu_sht   shtRCU( 256, SIGUSR2 );
 #endif
 
+      typedef cds::urcu::gc< cds::urcu::qsbr_buffered<> >    rcu_qsbr;
+      rcu_qsbr  qsbrRCU;
+
+      typedef cds::urcu::gc< cds::urcu::membarrier_buffered<> >    rcu_mbb;
+      rcu_mbb   mbbRCU;
+
+      typedef cds::urcu::gc< cds::urcu::membarrier_threaded<> >    rcu_mbt;
+      rcu_mbt   mbtRCU;
+
       // System topology
       {
           std::cout
               << "System topology:\n"
-              << "    Logical processor count: " << cds::OS::topology::processor_count() << "\n";
+              << "    Logical processor count: " << cds::OS::topology::processor_count() << "\n"
+              << "    NUMA node count:         " << cds::OS::topology::node_count() << "\n"
+              << "    Physical core count:     " << cds::OS::topology::core_count() << "\n"
+              << "    LLC domain count:        " << cds::OS::topology::cache_domain_count() << "\n";
           std::cout << std::endl;
       }
 
@@ -401,6 +449,8 @@ int main(int argc, char** argv)
             hzpGC.setScanType( cds::gc::HP::scan_type::inplace );
         else if ( strHZPScanStrategy == "classic" )
             hzpGC.setScanType( cds::gc::HP::scan_type::classic );
+        else if ( strHZPScanStrategy == "hashed" )
+            hzpGC.setScanType( cds::gc::HP::scan_type::hashed );
         else {
             std::cout << "Error value of HZP_scan_strategy in General section of test config\n";
         }
@@ -412,14 +462,41 @@ int main(int argc, char** argv)
         case cds::gc::HP::scan_type::classic:
             std::cout << "Use classic scan strategy for Hazard Pointer memory reclamation algorithm\n";
             break;
+        case cds::gc::HP::scan_type::hashed:
+            std::cout << "Use hashed scan strategy for Hazard Pointer memory reclamation algorithm\n";
+            break;
         default:
             std::cout << "ERROR: use unknown scan strategy for Hazard Pointer memory reclamation algorithm\n";
             break;
         }
 
         std::cout << "     Hazard Pointer count: " << hzpGC.max_hazard_count() << "\n"
-                  << "  Max thread count for HP: " << hzpGC.max_thread_count() << "\n"
-                  << "Retired HP array capacity: " << hzpGC.retired_array_capacity() << "\n";
+                  << "Retired HP scan threshold: " << hzpGC.retired_array_capacity() << "\n"
+                  << "  HP/DHP asymmetric fence: " << ( hzpGC.is_asymmetric_fence() ? "yes" : "no" ) << "\n"
+                  << "HP/DHP reclamation thread: " << ( hzpGC.is_background_reclaim() ? "yes" : "no" ) << "\n"
+                  << "     GP RCU reader groups: " << nRCUReaderGroups << "\n"
+                  << "         Thread placement: " << cds::threading::placement_name( CppUnitMini::ThreadPool::s_nDefaultPlacement ) << "\n";
+
+        std::string strDHPScanStrategy = cfg.get( "DHP_scan_strategy", std::string("classic") );
+        if ( strDHPScanStrategy == "classic" )
+            dhpGC.setScanType( cds::gc::DHP::scan_type::classic );
+        else if ( strDHPScanStrategy == "sorted" )
+            dhpGC.setScanType( cds::gc::DHP::scan_type::sorted );
+        else {
+            std::cout << "Error value of DHP_scan_strategy in General section of test config\n";
+        }
+
+        switch (dhpGC.getScanType()) {
+        case cds::gc::DHP::scan_type::classic:
+            std::cout << "Use classic scan strategy for Dynamic Hazard Pointer memory reclamation algorithm\n";
+            break;
+        case cds::gc::DHP::scan_type::sorted:
+            std::cout << "Use sorted scan strategy for Dynamic Hazard Pointer memory reclamation algorithm\n";
+            break;
+        default:
+            std::cout << "ERROR: use unknown scan strategy for Dynamic Hazard Pointer memory reclamation algorithm\n";
+            break;
+        }
       }
 
       if ( CppUnitMini::TestCase::m_bPrintGCState ) {
@@ -427,9 +504,8 @@ int main(int argc, char** argv)
         cds::gc::hp::GarbageCollector::instance().getInternalState( stat );
 
         std::cout << "HP constants:"
-            << "\n\tHP count per thread=" << stat.nHPCount
-            << "\n\tMax thread count=" << stat.nMaxThreadCount
-            << "\n\tMax retired pointer count per thread=" << stat.nMaxRetiredPtrCount
+            << "\n\tInitial HP count per thread=" << stat.nHPCount
+            << "\n\tMin retired pointer scan threshold=" << stat.nRetiredThreshold
             << "\n\tHP record size in bytes=" << stat.nHPRecSize
             << "\n" << std::endl;
       }
@@ -2,9 +2,12 @@
 
 #include "cppunit/thread.h"
 #include <boost/date_time/posix_time/posix_time_types.hpp>
+#include <sstream>
 
 namespace CppUnitMini {
 
+    cds::threading::thread_placement ThreadPool::s_nDefaultPlacement = cds::threading::placement_none;
+
     void TestThread::threadEntryPoint( TestThread * pInst )
     {
         pInst->run();
@@ -18,6 +21,8 @@ namespace CppUnitMini {
     void TestThread::run()
     {
         try {
+            m_Pool.placementMap().place_current_thread( m_nThreadNo );
+
             init();
             m_Pool.onThreadInitDone( this );
 
@@ -70,6 +75,8 @@ namespace CppUnitMini {
         // nThreadCount threads + current thread
         m_pBarrierDone = new boost::barrier( (unsigned int) (nThreadCount + 1) );
 
+        m_PlacementMap.reset( m_nPlacement );
+        reportPlacement();
         for ( size_t i = 0; i < nThreadCount; ++i )
             m_arrThreads[i]->create();
 
@@ -84,6 +91,8 @@ namespace CppUnitMini {
         m_pBarrierStart = new boost::barrier( (unsigned int) nThreadCount );
         m_pBarrierDone = new boost::barrier( (unsigned int) (nThreadCount + 1) );
 
+        m_PlacementMap.reset( m_nPlacement );
+        reportPlacement();
         for ( size_t i = 0; i < nThreadCount; ++i )
             m_arrThreads[i]->create();
 
@@ -100,6 +109,19 @@ namespace CppUnitMini {
         boost::this_thread::sleep(boost::posix_time::milliseconds(500));
     }
 
+    void ThreadPool::reportPlacement() const
+    {
+        if ( m_nPlacement == cds::threading::placement_none )
+            return;
+
+        std::ostringstream os;
+        os << "   Thread placement: " << cds::threading::placement_name( m_nPlacement )
+           << ( m_nPlacement == cds::threading::placement_per_node ? ", thread->node:" : ", thread->processor:" );
+        for ( size_t i = 0; i < m_arrThreads.size(); ++i )
+            os << " " << m_arrThreads[i]->m_nThreadNo << "->" << m_PlacementMap.target( m_arrThreads[i]->m_nThreadNo );
+        TestCase::message( os.str().c_str() );
+    }
+
     void    ThreadPool::onThreadInitDone( TestThread * pThread )
     {
         // Calls in context of caller thread
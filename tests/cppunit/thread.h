@@ -8,6 +8,7 @@
 #include <boost/thread.hpp>
 #include <cds/os/timer.h>
 #include <cds/threading/model.h>    // for attach/detach thread
+#include <cds/threading/placement.h>
 #include <cds/algo/atomic.h>
 
 // Visual leak detector (see http://vld.codeplex.com/)
@@ -96,6 +97,9 @@ namespace CppUnitMini {
     public:
         TestCase&                       m_Test;
 
+        /// Default placement of the test threads, [General] thread_placement config parameter
+        static cds::threading::thread_placement s_nDefaultPlacement;
+
     private:
         typedef std::vector< TestThread * >     thread_vector;
 
@@ -105,6 +109,11 @@ namespace CppUnitMini {
         boost::barrier * volatile       m_pBarrierStart;
         boost::barrier * volatile       m_pBarrierDone;
 
+        cds::threading::thread_placement m_nPlacement;
+        cds::threading::placement_map    m_PlacementMap;  // built by run() from m_nPlacement
+
+        void    reportPlacement() const;
+
     public:
         typedef thread_vector::iterator    iterator;
 
@@ -113,9 +122,16 @@ namespace CppUnitMini {
             : m_Test( tc )
             , m_pBarrierStart( nullptr )
             , m_pBarrierDone( nullptr )
+            , m_nPlacement( s_nDefaultPlacement )
         {}
         ~ThreadPool();
 
+        /// Sets the placement policy for the threads of the pool, must be called before \p run()
+        void    placement( cds::threading::thread_placement p ) { m_nPlacement = p; }
+        cds::threading::thread_placement placement() const { return m_nPlacement; }
+        /// Placement map built for the threads of the pool by \p run()
+        cds::threading::placement_map const& placementMap() const { return m_PlacementMap; }
+
         void    add( TestThread * pThread, size_t nCount );
 
         void    run();
@@ -0,0 +1,105 @@
+//$$CDS-header$$
+
+#include "cppunit/cppunit_proxy.h"
+
+#include <cds/urcu/general_instant.h>
+#include <cds/urcu/general_buffered.h>
+#include <cds/urcu/general_threaded.h>
+
+namespace misc {
+
+    class CallRcuHdrTest: public CppUnitMini::TestCase
+    {
+        static size_t const c_nCallbackCount = 5000;
+
+        struct counter_callback {
+            atomics::atomic<size_t> * m_pCounter;
+            size_t                    m_nValue;
+
+            counter_callback( atomics::atomic<size_t>& counter, size_t nValue )
+                : m_pCounter( &counter )
+                , m_nValue( nValue )
+            {}
+
+            void operator()()
+            {
+                m_pCounter->fetch_add( m_nValue, atomics::memory_order_relaxed );
+            }
+        };
+
+        template <class RCU>
+        void test_rcu()
+        {
+            atomics::atomic<size_t> nCounter( 0 );
+
+            for ( size_t i = 0; i < c_nCallbackCount; ++i ) {
+                if ( i & 1 )
+                    RCU::call_rcu( counter_callback( nCounter, 1 ));
+                else {
+                    atomics::atomic<size_t> * pCounter = &nCounter;
+                    RCU::call_rcu( [pCounter]() { pCounter->fetch_add( 1, atomics::memory_order_relaxed ); } );
+                }
+            }
+            RCU::force_dispose();
+
+            CPPUNIT_CHECK_EX( nCounter.load( atomics::memory_order_relaxed ) == c_nCallbackCount,
+                "callbacks called=" << nCounter.load( atomics::memory_order_relaxed ));
+        }
+
+        void RCU_GPI()
+        {
+            test_rcu< cds::urcu::gc< cds::urcu::general_instant<> > >();
+        }
+        void RCU_GPB()
+        {
+            test_rcu< cds::urcu::gc< cds::urcu::general_buffered<> > >();
+        }
+        void RCU_GPT()
+        {
+            test_rcu< cds::urcu::gc< cds::urcu::general_threaded<> > >();
+        }
+
+        static void inc_counter( atomics::atomic<size_t> * p )
+        {
+            p->fetch_add( 1, atomics::memory_order_relaxed );
+        }
+
+        void dispose_thread_pool()
+        {
+            typedef cds::container::VyukovMPMCCycleQueue< cds::urcu::epoch_retired_ptr > buffer_type;
+            typedef cds::urcu::dispose_thread_pool< buffer_type, 3 > pool_type;
+
+            static size_t const c_nCycleSize = 100;
+            atomics::atomic<size_t> nCounter( 0 );
+            buffer_type buf( c_nCycleSize * 2 );
+            pool_type pool;
+            pool.start();
+
+            for ( uint64_t nEpoch = 1; nEpoch <= 10; ++nEpoch ) {
+                // half of the items is retired after the grace period and must stay in the buffer
+                for ( size_t i = 0; i < c_nCycleSize; ++i ) {
+                    cds::urcu::retired_ptr rp( &nCounter, reinterpret_cast<cds::urcu::free_retired_ptr_func>( inc_counter ));
+                    cds::urcu::epoch_retired_ptr ep( rp, i < c_nCycleSize / 2 ? nEpoch : nEpoch + 1 );
+                    CPPUNIT_ASSERT( buf.push( ep ));
+                }
+                pool.dispose( buf, nEpoch, true );
+                CPPUNIT_CHECK_EX( nCounter.load( atomics::memory_order_relaxed ) == nEpoch * c_nCycleSize - c_nCycleSize / 2,
+                    "epoch=" << nEpoch << " freed=" << nCounter.load( atomics::memory_order_relaxed ));
+            }
+
+            pool.stop( buf, uint64_t(-1) );
+            CPPUNIT_CHECK( nCounter.load( atomics::memory_order_relaxed ) == 10 * c_nCycleSize );
+            CPPUNIT_CHECK( buf.empty() );
+        }
+
+        CPPUNIT_TEST_SUITE(CallRcuHdrTest)
+            CPPUNIT_TEST(RCU_GPI)
+            CPPUNIT_TEST(RCU_GPB)
+            CPPUNIT_TEST(RCU_GPT)
+            CPPUNIT_TEST(dispose_thread_pool)
+        CPPUNIT_TEST_SUITE_END();
+    };
+
+} // namespace misc
+
+CPPUNIT_TEST_SUITE_REGISTRATION(misc::CallRcuHdrTest);
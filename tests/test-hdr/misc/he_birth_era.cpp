@@ -0,0 +1,221 @@
+//$$CDS-header$$
+
+#include "cppunit/cppunit_proxy.h"
+
+#include <cds/intrusive/skip_list_he.h>
+#include <cds/intrusive/ellen_bintree_he.h>
+#include <cds/intrusive/michael_list_he.h>
+#include <cds/intrusive/lazy_list_he.h>
+#include <cds/intrusive/treiber_stack.h>
+
+namespace misc {
+
+    namespace ci = cds::intrusive;
+    namespace co = cds::opt;
+
+    // The nodes linked after a thread has published its era must be freed
+    // on erasing even if the thread still holds the era
+    class HEBirthEraHdrTest: public CppUnitMini::TestCase
+    {
+        static size_t const c_nItemCount = 100;
+
+        static size_t s_nDisposed;
+
+        struct dummy {
+            int n;
+        };
+
+        static void free_dummy( dummy * p )
+        {
+            delete p;
+        }
+
+        struct disposer {
+            template <typename T>
+            void operator()( T * /*p*/ )
+            {
+                ++s_nDisposed;
+            }
+        };
+
+        struct skip_list_item: public ci::skip_list::node< cds::gc::HE >
+        {
+            int nKey;
+        };
+
+        struct skip_list_less {
+            bool operator()( skip_list_item const& v1, skip_list_item const& v2 ) const { return v1.nKey < v2.nKey; }
+            bool operator()( skip_list_item const& v, int k ) const { return v.nKey < k; }
+            bool operator()( int k, skip_list_item const& v ) const { return k < v.nKey; }
+        };
+
+        struct ellen_item: public ci::ellen_bintree::node< cds::gc::HE >
+        {
+            int nKey;
+        };
+
+        struct ellen_key_extractor {
+            void operator()( int& dest, ellen_item const& src ) const
+            {
+                dest = src.nKey;
+            }
+        };
+
+        struct ellen_less {
+            bool operator()( int k1, int k2 ) const { return k1 < k2; }
+            bool operator()( ellen_item const& v, int k ) const { return v.nKey < k; }
+            bool operator()( int k, ellen_item const& v ) const { return k < v.nKey; }
+            bool operator()( ellen_item const& v1, ellen_item const& v2 ) const { return v1.nKey < v2.nKey; }
+        };
+
+        struct michael_item: public ci::michael_list::node< cds::gc::HE >
+        {
+            int nKey;
+        };
+
+        struct lazy_item: public ci::lazy_list::node< cds::gc::HE >
+        {
+            int nKey;
+        };
+
+        struct list_less {
+            template <typename Item>
+            bool operator()( Item const& v1, Item const& v2 ) const { return v1.nKey < v2.nKey; }
+            template <typename Item>
+            bool operator()( Item const& v, int k ) const { return v.nKey < k; }
+            template <typename Item>
+            bool operator()( int k, Item const& v ) const { return k < v.nKey; }
+        };
+
+        struct stack_item: public ci::single_link::node< cds::gc::HE >
+        {
+            int nKey;
+        };
+
+        // Advances the era clock past the era published by the caller
+        static void advance_era( cds::gc::he::era_type nEra )
+        {
+            while ( cds::gc::HE::current_era() <= nEra )
+                cds::gc::HE::retire( new dummy, free_dummy );
+        }
+
+        template <class Set, typename Item>
+        void test_set()
+        {
+            std::vector< Item > arr( c_nItemCount );
+            for ( size_t i = 0; i < arr.size(); ++i )
+                arr[i].nKey = static_cast<int>( i );
+
+            {
+                // Publish the current era and keep it for the whole test
+                atomics::atomic< dummy * > pNull( nullptr );
+                cds::gc::HE::Guard guard;
+                guard.protect( pNull );
+                advance_era( cds::gc::HE::current_era() );
+
+                Set s;
+                for ( auto& item : arr )
+                    CPPUNIT_ASSERT( s.insert( item ));
+
+                s_nDisposed = 0;
+                for ( auto& item : arr )
+                    CPPUNIT_ASSERT( s.erase( item.nKey ));
+                CPPUNIT_ASSERT( s.empty());
+
+                cds::gc::HE::scan();
+                CPPUNIT_CHECK_EX( s_nDisposed == c_nItemCount, "disposed=" << s_nDisposed );
+            }
+
+            cds::gc::HE::scan();
+        }
+
+        void treiber_stack_clear()
+        {
+            struct traits: public ci::treiber_stack::traits {
+                typedef ci::treiber_stack::base_hook< co::gc< cds::gc::HE > > hook;
+                typedef HEBirthEraHdrTest::disposer disposer;
+            };
+            typedef ci::TreiberStack< cds::gc::HE, stack_item, traits > stack_type;
+
+            std::vector< stack_item > arr( c_nItemCount );
+            {
+                atomics::atomic< dummy * > pNull( nullptr );
+                cds::gc::HE::Guard guard;
+                guard.protect( pNull );
+                advance_era( cds::gc::HE::current_era() );
+
+                stack_type s;
+                for ( auto& item : arr )
+                    CPPUNIT_ASSERT( s.push( item ));
+
+                // clear() retires the whole stack by range retire
+                s_nDisposed = 0;
+                s.clear();
+                CPPUNIT_ASSERT( s.empty());
+
+                cds::gc::HE::scan();
+                CPPUNIT_CHECK_EX( s_nDisposed == c_nItemCount, "disposed=" << s_nDisposed );
+            }
+
+            cds::gc::HE::scan();
+        }
+
+        void michael_list()
+        {
+            struct traits: public ci::michael_list::traits {
+                typedef ci::michael_list::base_hook< co::gc< cds::gc::HE > > hook;
+                typedef list_less less;
+                typedef HEBirthEraHdrTest::disposer disposer;
+            };
+            typedef ci::MichaelList< cds::gc::HE, michael_item, traits > list_type;
+            test_set< list_type, michael_item >();
+        }
+
+        void lazy_list()
+        {
+            struct traits: public ci::lazy_list::traits {
+                typedef ci::lazy_list::base_hook< co::gc< cds::gc::HE > > hook;
+                typedef list_less less;
+                typedef HEBirthEraHdrTest::disposer disposer;
+            };
+            typedef ci::LazyList< cds::gc::HE, lazy_item, traits > list_type;
+            test_set< list_type, lazy_item >();
+        }
+
+        void skip_list()
+        {
+            struct traits: public ci::skip_list::traits {
+                typedef ci::skip_list::base_hook< co::gc< cds::gc::HE > > hook;
+                typedef skip_list_less less;
+                typedef HEBirthEraHdrTest::disposer disposer;
+            };
+            typedef ci::SkipListSet< cds::gc::HE, skip_list_item, traits > set_type;
+            test_set< set_type, skip_list_item >();
+        }
+
+        void ellen_bintree()
+        {
+            struct traits: public ci::ellen_bintree::traits {
+                typedef ci::ellen_bintree::base_hook< co::gc< cds::gc::HE > > hook;
+                typedef ellen_key_extractor key_extractor;
+                typedef ellen_less less;
+                typedef HEBirthEraHdrTest::disposer disposer;
+            };
+            typedef ci::EllenBinTree< cds::gc::HE, int, ellen_item, traits > set_type;
+            test_set< set_type, ellen_item >();
+        }
+
+        CPPUNIT_TEST_SUITE(HEBirthEraHdrTest)
+            CPPUNIT_TEST(michael_list)
+            CPPUNIT_TEST(lazy_list)
+            CPPUNIT_TEST(skip_list)
+            CPPUNIT_TEST(ellen_bintree)
+            CPPUNIT_TEST(treiber_stack_clear)
+        CPPUNIT_TEST_SUITE_END()
+    };
+
+    size_t HEBirthEraHdrTest::s_nDisposed = 0;
+
+} // namespace misc
+
+CPPUNIT_TEST_SUITE_REGISTRATION(misc::HEBirthEraHdrTest);
@@ -174,6 +174,7 @@ namespace misc {
             << "\t        alloc from partial: " << s.nAllocFromPartial << "\n"
             << "\t            alloc from new: " << s.nAllocFromNew << "\n"
             << "\t           free call count: " << s.nFreeCount << "\n"
+            << "\t    remote free call count: " << s.nRemoteFreeCount << "\n"
             << "\t      superblock allocated: " << s.nPageAllocCount << "\n"
             << "\t    superblock deallocated: " << s.nPageDeallocCount << "\n"
             << "\t superblock desc allocated: " << s.nDescAllocCount << "\n"
@@ -185,6 +186,10 @@ namespace misc {
             << "\t           free call count: " << s.nSysFreeCount << "\n"
             << "\t     total allocated bytes: " << s.nSysBytesAllocated << "\n"
             << "\t   total deallocated bytes: " << s.nSysBytesDeallocated << "\n"
+            << "\t      hugetlb region bytes: " << s.nHugeTLBBytes << "\n"
+            << "\t          THP region bytes: " << s.nTransparentHugeBytes << "\n"
+            << "\t      regular region bytes: " << s.nRegularRegionBytes << "\n"
+            << "\t         purged page bytes: " << s.nPurgedBytes << "\n"
             << "\tCAS contention indicators\n"
             << "\t updating active field of active block: " << s.nActiveDescCASFailureCount << "\n"
             << "\t updating anchor field of active block: " << s.nActiveAnchorCASFailureCount << "\n"
@@ -0,0 +1,442 @@
+//$$CDS-header$$
+
+#include "cppunit/cppunit_proxy.h"
+
+#include <cds/memory/michael/allocator.h>
+#include <vector>
+#include <thread>
+#include <chrono>
+
+namespace misc {
+
+    namespace ma = cds::memory::michael;
+
+    class MichaelHeapHdrTest: public CppUnitMini::TestCase
+    {
+        typedef cds::OS::topology topology;
+
+        // Bytes of the whole OS pages of a cached page of nSize bytes at p.
+        // The cache list header is smaller than an OS page, so the first OS page is not purged
+        static size_t purgeable_bytes( void * p, size_t nSize )
+        {
+            uintptr_t const nOSPageSize = cds::OS::page_purge::page_size();
+            uintptr_t const nBegin = ( reinterpret_cast<uintptr_t>( p ) & ~( nOSPageSize - 1 )) + nOSPageSize;
+            uintptr_t const nEnd = ( reinterpret_cast<uintptr_t>( p ) + nSize ) & ~( nOSPageSize - 1 );
+            return static_cast<size_t>( nEnd - nBegin );
+        }
+
+        template <class Heap>
+        void alloc_free( Heap& heap, size_t nCount )
+        {
+            std::vector<unsigned char *> arr;
+            arr.reserve( nCount );
+            for ( size_t i = 0; i < nCount; ++i ) {
+                size_t const nSize = 8 + ( i * 37 ) % 2000;
+                unsigned char * p = reinterpret_cast<unsigned char *>( heap.alloc( nSize ));
+                CPPUNIT_ASSERT( p != nullptr );
+                memset( p, static_cast<int>( i & 0xFF ), nSize );
+                arr.push_back( p );
+            }
+            for ( size_t i = 0; i < nCount; ++i ) {
+                size_t const nSize = 8 + ( i * 37 ) % 2000;
+                CPPUNIT_CHECK_EX( arr[i][0] == ( i & 0xFF ) && arr[i][nSize - 1] == ( i & 0xFF ), "block=" << i );
+                heap.free( arr[i] );
+            }
+        }
+
+        void numa_local_heap()
+        {
+            typedef ma::Heap<
+                ma::opt::page_heap< ma::page_cached_allocator< 16, ma::numa_local_heap > >,
+                ma::opt::procheap_stat< ma::procheap_atomic_stat >
+            > numa_heap;
+
+            size_t const nBindFailed = ma::numa_local_heap::bind_failed_count();
+            void * p = ma::numa_local_heap::alloc( 64 * 1024 );
+            CPPUNIT_ASSERT( p != nullptr );
+            CPPUNIT_CHECK( ( reinterpret_cast<uintptr_t>( p ) & ( cds::OS::page_purge::page_size() - 1 )) == 0 );
+            memset( p, 0xA5, 64 * 1024 );
+            ma::numa_local_heap::free( p, 64 * 1024 );
+
+            // On a single-node system there is nothing to bind
+            if ( topology::node_count() == 1 ) {
+                char buf[ 8192 ];
+                CPPUNIT_CHECK( !topology::bind_to_local_node( buf, sizeof(buf) ));
+                CPPUNIT_CHECK( ma::numa_local_heap::bind_failed_count() == nBindFailed );
+            }
+
+            numa_heap heap;
+            alloc_free( heap, 10000 );
+
+            ma::summary_stat s;
+            heap.summaryStat( s );
+            CPPUNIT_CHECK( s.nFreeCount >= 10000 );
+            CPPUNIT_CHECK( s.nPageAllocCount > 0 );
+            if ( topology::node_count() == 1 )
+                CPPUNIT_CHECK( s.nRemoteFreeCount == 0 );
+        }
+
+        void remote_free()
+        {
+#if CDS_OS_TYPE == CDS_OS_LINUX
+            typedef ma::Heap<
+                ma::opt::page_heap< ma::page_cached_allocator< 16, ma::numa_local_heap > >,
+                ma::opt::procheap_stat< ma::procheap_atomic_stat >
+            > numa_heap;
+
+            // 2 nodes x 1 core x 1 SMT thread: the fake processor is the node
+            topology::set_fake_topology( 2, 1, 1 );
+            {
+                numa_heap heap;
+                size_t const nCount = 1000;
+                std::vector<void *> arr( nCount );
+                unsigned int nAllocNode = 0;
+                unsigned int nFreeNode = 0;
+
+                std::thread tAlloc( [&]() {
+                    cds::threading::Manager::attachThread();
+                    nAllocNode = topology::current_node();
+                    for ( size_t i = 0; i < nCount; ++i )
+                        arr[i] = heap.alloc( 16 + i % 100 );
+                    cds::threading::Manager::detachThread();
+                });
+                tAlloc.join();
+
+                std::thread tFree( [&]() {
+                    cds::threading::Manager::attachThread();
+                    nFreeNode = topology::current_node();
+                    for ( size_t i = 0; i < nCount; ++i )
+                        heap.free( arr[i] );
+                    cds::threading::Manager::detachThread();
+                });
+                tFree.join();
+
+                ma::summary_stat s;
+                heap.summaryStat( s );
+                CPPUNIT_CHECK( s.nFreeCount >= nCount );
+                CPPUNIT_CHECK_EX( nAllocNode != nFreeNode ? s.nRemoteFreeCount >= nCount : s.nRemoteFreeCount == 0,
+                    "alloc node=" << nAllocNode << ", free node=" << nFreeNode << ", remote free=" << s.nRemoteFreeCount );
+            }
+            topology::reset_fake_topology();
+#endif
+        }
+
+        // Caches the blocks of 1M superblocks only
+        struct medium_block_cache {
+            static unsigned int capacity( ma::size_class const& sc )
+            {
+                return sc.nBlockSize >= 512 && sc.nBlockSize <= 1024 ? 16 : 0;
+            }
+        };
+
+        static bool balanced( ma::summary_stat const& sBegin, ma::summary_stat const& sEnd )
+        {
+            return sEnd.nBytesAllocated - sBegin.nBytesAllocated == sEnd.nBytesDeallocated - sBegin.nBytesDeallocated;
+        }
+
+        template <class Heap>
+        void thread_cache_test()
+        {
+            Heap heap;
+            alloc_free( heap, 10000 );
+            heap.flush_thread_cache();
+
+            // The blocks up to 1K are placed in 1M superblocks of the page heap.
+            // The bytes of such superblocks are not counted by the statistics, so the allocated and deallocated
+            // byte counters are balanced when no block is allocated or cached
+            ma::summary_stat sBegin;
+            heap.summaryStat( sBegin );
+            for ( size_t nPass = 0; nPass < 1000; ++nPass ) {
+                void * p1 = heap.alloc( 600 );
+                void * p2 = heap.alloc( 900 );
+                void * p3 = heap.alloc_aligned( 520, 64 );
+                CPPUNIT_ASSERT( ( reinterpret_cast<uintptr_t>( p3 ) & 63 ) == 0 );
+                heap.free( p2 );
+                heap.free_aligned( p3 );
+                heap.free( p1 );
+            }
+
+            ma::summary_stat sEnd;
+            heap.summaryStat( sEnd );
+            CPPUNIT_CHECK( !balanced( sBegin, sEnd ));
+
+            heap.flush_thread_cache();
+            sEnd.clear();
+            heap.summaryStat( sEnd );
+            CPPUNIT_CHECK( balanced( sBegin, sEnd ));
+
+            // The blocks are allocated by one thread and freed by another,
+            // the thread caches are flushed on thread exit
+            size_t const nCount = 5000;
+            std::vector<void *> arr( nCount );
+            std::thread tAlloc( [&]() {
+                for ( size_t i = 0; i < nCount; ++i )
+                    arr[i] = heap.alloc( 512 + i % 400 );
+            });
+            tAlloc.join();
+            std::thread tFree( [&]() {
+                for ( size_t i = 0; i < nCount; ++i ) {
+                    heap.free( arr[i] );
+                    heap.free( heap.alloc( 512 + i % 400 ));
+                }
+            });
+            tFree.join();
+
+            sEnd.clear();
+            heap.summaryStat( sEnd );
+            CPPUNIT_CHECK( balanced( sBegin, sEnd ));
+        }
+
+        void thread_cache()
+        {
+            thread_cache_test< ma::Heap<
+                ma::opt::thread_cache< ma::thread_cache_capacity<> >,
+                ma::opt::procheap_stat< ma::procheap_atomic_stat >,
+                ma::opt::check_bounds< ma::debug_bound_checking >
+            > >();
+
+            thread_cache_test< ma::Heap<
+                ma::opt::thread_cache< medium_block_cache >,
+                ma::opt::procheap_stat< ma::procheap_atomic_stat >
+            > >();
+        }
+
+        void lockfree_lists()
+        {
+            typedef ma::details::lockfree_superblock_desc desc;
+            std::vector<desc> arr( 16 );
+
+            ma::free_list_lockfree<> freeList;
+            CPPUNIT_ASSERT( freeList.pop() == nullptr );
+            for ( size_t i = 0; i < arr.size(); ++i )
+                freeList.push( &arr[i] );
+            CPPUNIT_CHECK( freeList.size() == arr.size() );
+            for ( size_t i = arr.size(); i > 0; --i )
+                CPPUNIT_CHECK_EX( freeList.pop() == &arr[i - 1], "item=" << i - 1 );
+            CPPUNIT_CHECK( freeList.pop() == nullptr );
+            CPPUNIT_CHECK( freeList.size() == 0 );
+
+            ma::partial_list_lockfree<4> partialList;
+            for ( size_t i = 0; i < arr.size(); ++i )
+                partialList.push( &arr[i] );
+            // Only top 4 items may be unlinked
+            CPPUNIT_CHECK( partialList.unlink( &arr[12] ));
+            CPPUNIT_CHECK( !partialList.unlink( &arr[12] ));
+            CPPUNIT_CHECK( !partialList.unlink( &arr[0] ));
+            CPPUNIT_CHECK( partialList.size() == arr.size() - 1 );
+            // The order of other items is kept
+            for ( size_t i = arr.size(); i > 0; --i ) {
+                if ( i - 1 != 12 )
+                    CPPUNIT_CHECK_EX( partialList.pop() == &arr[i - 1], "item=" << i - 1 );
+            }
+            CPPUNIT_CHECK( partialList.pop() == nullptr );
+
+            // Concurrent push/pop: each item is owned by one thread at a time
+            std::vector<desc> items( 64 );
+            for ( size_t i = 0; i < items.size(); ++i )
+                freeList.push( &items[i] );
+            std::vector< atomics::atomic<int> > owners( items.size() );
+            for ( auto& o : owners )
+                o.store( 0 );
+            std::vector<std::thread> threads;
+            atomics::atomic<size_t> nErrors( 0 );
+            for ( size_t nThread = 0; nThread < 4; ++nThread ) {
+                threads.emplace_back( [&]() {
+                    for ( size_t nPass = 0; nPass < 100000; ++nPass ) {
+                        desc * p = freeList.pop();
+                        if ( p ) {
+                            atomics::atomic<int>& owner = owners[ p - &items[0] ];
+                            if ( owner.fetch_add( 1 ) != 0 )
+                                nErrors.fetch_add( 1 );
+                            owner.fetch_sub( 1 );
+                            freeList.push( p );
+                        }
+                    }
+                });
+            }
+            for ( auto& t : threads )
+                t.join();
+            CPPUNIT_CHECK( nErrors.load() == 0 );
+            CPPUNIT_CHECK( freeList.size() == items.size() );
+            size_t nCount = 0;
+            while ( freeList.pop() )
+                ++nCount;
+            CPPUNIT_CHECK( nCount == items.size() );
+        }
+
+        template <class Heap>
+        void mt_alloc_free( Heap& heap )
+        {
+            std::vector<std::thread> threads;
+            for ( size_t nThread = 0; nThread < 4; ++nThread ) {
+                threads.emplace_back( [&heap, this]() {
+                    for ( size_t nPass = 0; nPass < 10; ++nPass )
+                        alloc_free( heap, 5000 );
+                });
+            }
+            for ( auto& t : threads )
+                t.join();
+        }
+
+        void lockfree_heap()
+        {
+            ma::Heap<
+                ma::opt::free_list< ma::free_list_lockfree<> >,
+                ma::opt::partial_list< ma::partial_list_lockfree<> >,
+                ma::opt::procheap_stat< ma::procheap_atomic_stat >
+            > heap;
+            mt_alloc_free( heap );
+
+            ma::summary_stat s;
+            heap.summaryStat( s );
+            CPPUNIT_CHECK( s.nFreeCount >= 4 * 10 * 5000 );
+            CPPUNIT_CHECK( s.nPageDeallocCount > 0 );
+
+            // Lock-free free list with locked partial list
+            ma::Heap<
+                ma::opt::free_list< ma::free_list_lockfree<> >,
+                ma::opt::thread_cache< ma::thread_cache_capacity<> >
+            > heap2;
+            mt_alloc_free( heap2 );
+        }
+
+        void huge_page()
+        {
+            typedef cds::OS::huge_page os_huge_page;
+
+            os_huge_page::kind k;
+            void * pRegion = os_huge_page::alloc( 2 * os_huge_page::c_nSize, k );
+            CPPUNIT_ASSERT( pRegion != nullptr );
+            CPPUNIT_CHECK( ( reinterpret_cast<uintptr_t>( pRegion ) & ( os_huge_page::c_nSize - 1 )) == 0 );
+            memset( pRegion, 0x5A, 2 * os_huge_page::c_nSize );
+            os_huge_page::free( pRegion, 2 * os_huge_page::c_nSize );
+            CPPUNIT_MSG( "   huge page kind=" << ( k == os_huge_page::hugetlb_pages ? "hugetlb" : k == os_huge_page::transparent_pages ? "transparent" : "regular" ));
+
+            {
+                ma::os_allocated_atomic stat;
+                {
+                    // 1M pages: 2 pages per region
+                    ma::huge_page_allocator<> pageHeap( 1024 * 1024, stat );
+                    std::vector<void *> arr;
+                    for ( size_t i = 0; i < 5; ++i ) {
+                        void * p = pageHeap.alloc();
+                        CPPUNIT_ASSERT( p != nullptr );
+                        CPPUNIT_CHECK( ( reinterpret_cast<uintptr_t>( p ) & ( 1024 * 1024 - 1 )) == 0 );
+                        memset( p, static_cast<int>( i ), 1024 * 1024 );
+                        arr.push_back( p );
+                    }
+                    size_t const nMapped = static_cast<size_t>( stat.hugeRegionBytes( k ));
+                    CPPUNIT_CHECK_EX( nMapped == 3 * os_huge_page::c_nSize, "mapped=" << nMapped );
+
+                    // The freed page is reused
+                    pageHeap.free( arr[2] );
+                    CPPUNIT_CHECK( pageHeap.alloc() == arr[2] );
+                    for ( size_t i = 0; i < arr.size(); ++i )
+                        pageHeap.free( arr[i] );
+                }
+                CPPUNIT_CHECK( stat.hugeRegionBytes( k ) == 0 );
+            }
+
+            typedef ma::Heap<
+                ma::opt::page_heap< ma::huge_page_allocator<> >,
+                ma::opt::os_allocated_stat< ma::os_allocated_atomic >,
+                ma::opt::procheap_stat< ma::procheap_atomic_stat >
+            > huge_page_heap;
+
+            huge_page_heap heap;
+            alloc_free( heap, 10000 );
+            mt_alloc_free( heap );
+
+            ma::summary_stat s;
+            heap.summaryStat( s );
+            cds::atomic64u_t const nMapped = s.nHugeTLBBytes + s.nTransparentHugeBytes + s.nRegularRegionBytes;
+            CPPUNIT_CHECK( nMapped > 0 );
+            CPPUNIT_CHECK( nMapped % os_huge_page::c_nSize == 0 );
+            CPPUNIT_CHECK( s.nPageAllocCount > 0 );
+        }
+
+        void decaying_page_heap()
+        {
+            size_t const nPageSize = 1024 * 1024;
+            bool const bPurgeSupported = CDS_OS_INTERFACE == CDS_OSI_UNIX;
+
+            void * pMem = cds::OS::aligned_malloc( nPageSize, cds::OS::page_purge::page_size() );
+            memset( pMem, 0x5A, nPageSize );
+            CPPUNIT_CHECK( cds::OS::page_purge::purge( pMem, nPageSize ) == ( bPurgeSupported ? nPageSize : 0 ));
+            // No whole page within the range
+            CPPUNIT_CHECK( cds::OS::page_purge::purge( reinterpret_cast<char *>( pMem ) + 1, cds::OS::page_purge::page_size() ) == 0 );
+            cds::OS::aligned_free( pMem );
+
+            {
+                ma::os_allocated_atomic stat;
+                ma::decaying_page_allocator< ma::page_allocator<>, 50, 8, 4 > pageHeap( nPageSize, stat );
+
+                std::vector<void *> arr;
+                for ( size_t i = 0; i < 10; ++i ) {
+                    void * p = pageHeap.alloc();
+                    CPPUNIT_ASSERT( p != nullptr );
+                    memset( p, static_cast<int>( i ), nPageSize );
+                    arr.push_back( p );
+                }
+                // 8 pages are cached, 2 pages are freed to the page_allocator
+                size_t nPurgeable = 0;
+                for ( size_t i = 0; i < arr.size(); ++i ) {
+                    if ( i < 8 )
+                        nPurgeable += purgeable_bytes( arr[i], nPageSize );
+                    pageHeap.free( arr[i] );
+                }
+
+                // The pages are not expired yet
+                pageHeap.purge();
+                CPPUNIT_CHECK( stat.purgedBytes() == 0 );
+
+                std::this_thread::sleep_for( std::chrono::milliseconds( 100 ));
+                pageHeap.purge();
+                if ( bPurgeSupported )
+                    CPPUNIT_CHECK_EX( stat.purgedBytes() == nPurgeable, "purged=" << stat.purgedBytes() << ", expected=" << nPurgeable );
+
+                // The purged pages are reused and they are valid
+                for ( size_t i = 0; i < arr.size(); ++i ) {
+                    arr[i] = pageHeap.alloc();
+                    CPPUNIT_ASSERT( arr[i] != nullptr );
+                    memset( arr[i], static_cast<int>( i ), nPageSize );
+                }
+                for ( size_t i = 0; i < arr.size(); ++i )
+                    pageHeap.free( arr[i] );
+            }
+
+            typedef ma::Heap<
+                ma::opt::page_heap< ma::decaying_page_allocator< ma::page_allocator<>, 20 > >,
+                ma::opt::os_allocated_stat< ma::os_allocated_atomic >,
+                ma::opt::procheap_stat< ma::procheap_atomic_stat >
+            > decaying_heap;
+
+            decaying_heap heap;
+            {
+                ma::purge_thread< decaying_heap > purgeThread( heap, 10 );
+                alloc_free( heap, 10000 );
+                mt_alloc_free( heap );
+                std::this_thread::sleep_for( std::chrono::milliseconds( 200 ));
+            }
+
+            ma::summary_stat s;
+            heap.summaryStat( s );
+            CPPUNIT_CHECK( s.nPageDeallocCount > 0 );
+            if ( bPurgeSupported )
+                CPPUNIT_CHECK( s.nPurgedBytes > 0 );
+        }
+
+        CPPUNIT_TEST_SUITE(MichaelHeapHdrTest)
+            CPPUNIT_TEST(numa_local_heap)
+            CPPUNIT_TEST(remote_free)
+            CPPUNIT_TEST(thread_cache)
+            CPPUNIT_TEST(lockfree_lists)
+            CPPUNIT_TEST(lockfree_heap)
+            CPPUNIT_TEST(huge_page)
+            CPPUNIT_TEST(decaying_page_heap)
+        CPPUNIT_TEST_SUITE_END();
+    };
+
+} // namespace misc
+
+CPPUNIT_TEST_SUITE_REGISTRATION(misc::MichaelHeapHdrTest);
@@ -0,0 +1,178 @@
+//$$CDS-header$$
+
+#include "cppunit/cppunit_proxy.h"
+
+#include <thread>
+#include <chrono>
+#include <cds/urcu/general_instant.h>
+#include <cds/urcu/general_buffered.h>
+#include <cds/urcu/general_threaded.h>
+#include <cds/urcu/signal_buffered.h>
+#include <cds/urcu/signal_threaded.h>
+#include <cds/urcu/qsbr_buffered.h>
+#include <cds/urcu/membarrier_buffered.h>
+#include <cds/urcu/membarrier_threaded.h>
+
+namespace misc {
+
+    class RcuGracePeriodHdrTest: public CppUnitMini::TestCase
+    {
+        static size_t const c_nRetireCount = 100;
+
+        struct item {
+            atomics::atomic<size_t> * pCounter;
+        };
+
+        struct disposer {
+            void operator()( item * p )
+            {
+                p->pCounter->fetch_add( 1, atomics::memory_order_relaxed );
+                delete p;
+            }
+        };
+
+        template <class RCU>
+        static bool poll_until_done( typename RCU::gp_cookie nCookie )
+        {
+            for ( size_t i = 0; i < 1000000; ++i ) {
+                if ( RCU::poll_grace_period( nCookie ))
+                    return true;
+                std::this_thread::yield();
+            }
+            return false;
+        }
+
+        // The threaded RCUs free the retired pointers in the reclamation thread
+        static bool wait_for_count( atomics::atomic<size_t> const& nCounter, size_t nExpected )
+        {
+            auto const tEnd = std::chrono::steady_clock::now() + std::chrono::seconds( 10 );
+            while ( nCounter.load( atomics::memory_order_relaxed ) != nExpected ) {
+                if ( std::chrono::steady_clock::now() >= tEnd )
+                    return false;
+                std::this_thread::yield();
+            }
+            return true;
+        }
+
+        template <class RCU>
+        void poll()
+        {
+            atomics::atomic<size_t> nFreed( 0 );
+            for ( size_t i = 0; i < c_nRetireCount; ++i ) {
+                item * p = new item;
+                p->pCounter = &nFreed;
+                RCU::template retire_ptr<disposer>( p );
+            }
+
+            typename RCU::gp_cookie nCookie = RCU::start_grace_period();
+            CPPUNIT_ASSERT( poll_until_done<RCU>( nCookie ));
+            CPPUNIT_CHECK_EX( wait_for_count( nFreed, c_nRetireCount ),
+                "freed=" << nFreed.load( atomics::memory_order_relaxed ));
+
+            // The cookie remains completed
+            CPPUNIT_ASSERT( RCU::poll_grace_period( nCookie ));
+        }
+
+        // For QSBR the reader blocks the grace period since it is online and does not announce quiescent states
+        template <class RCU>
+        void poll_with_reader()
+        {
+            atomics::atomic<int> nReaderState( 0 ); // 1 - inside critical section, 2 - exit request
+            std::thread reader( [&nReaderState]() {
+                cds::threading::Manager::attachThread();
+                {
+                    typename RCU::scoped_lock sl;
+                    nReaderState.store( 1, atomics::memory_order_release );
+                    while ( nReaderState.load( atomics::memory_order_acquire ) != 2 )
+                        std::this_thread::yield();
+                }
+                cds::threading::Manager::detachThread();
+            });
+
+            while ( nReaderState.load( atomics::memory_order_acquire ) != 1 )
+                std::this_thread::yield();
+
+            typename RCU::gp_cookie nCookie = RCU::start_grace_period();
+            for ( int i = 0; i < 100; ++i ) {
+                CPPUNIT_ASSERT( !RCU::poll_grace_period( nCookie ));
+                std::this_thread::yield();
+            }
+
+            nReaderState.store( 2, atomics::memory_order_release );
+            reader.join();
+            CPPUNIT_ASSERT( poll_until_done<RCU>( nCookie ));
+        }
+
+        template <class RCU>
+        void expedited()
+        {
+            typename RCU::gp_cookie nCookie = RCU::start_grace_period();
+            RCU::synchronize_expedited();
+            CPPUNIT_ASSERT( RCU::poll_grace_period( nCookie ));
+
+            // polled and blocking grace periods are interchangeable
+            nCookie = RCU::start_grace_period();
+            RCU::synchronize();
+            CPPUNIT_ASSERT( RCU::poll_grace_period( nCookie ));
+        }
+
+        template <class RCU>
+        void test_rcu()
+        {
+            poll<RCU>();
+            poll_with_reader<RCU>();
+            expedited<RCU>();
+        }
+
+        void RCU_GPI()
+        {
+            test_rcu< cds::urcu::gc< cds::urcu::general_instant<> > >();
+        }
+        void RCU_GPB()
+        {
+            test_rcu< cds::urcu::gc< cds::urcu::general_buffered<> > >();
+        }
+        void RCU_GPT()
+        {
+            test_rcu< cds::urcu::gc< cds::urcu::general_threaded<> > >();
+        }
+        void RCU_SHB()
+        {
+#ifdef CDS_URCU_SIGNAL_HANDLING_ENABLED
+            test_rcu< cds::urcu::gc< cds::urcu::signal_buffered<> > >();
+#endif
+        }
+        void RCU_SHT()
+        {
+#ifdef CDS_URCU_SIGNAL_HANDLING_ENABLED
+            test_rcu< cds::urcu::gc< cds::urcu::signal_threaded<> > >();
+#endif
+        }
+        void RCU_QSBR()
+        {
+            test_rcu< cds::urcu::gc< cds::urcu::qsbr_buffered<> > >();
+        }
+        void RCU_MBB()
+        {
+            test_rcu< cds::urcu::gc< cds::urcu::membarrier_buffered<> > >();
+        }
+        void RCU_MBT()
+        {
+            test_rcu< cds::urcu::gc< cds::urcu::membarrier_threaded<> > >();
+        }
+
+        CPPUNIT_TEST_SUITE(RcuGracePeriodHdrTest)
+            CPPUNIT_TEST(RCU_GPI)
+            CPPUNIT_TEST(RCU_GPB)
+            CPPUNIT_TEST(RCU_GPT)
+            CPPUNIT_TEST(RCU_SHB)
+            CPPUNIT_TEST(RCU_SHT)
+            CPPUNIT_TEST(RCU_QSBR)
+            CPPUNIT_TEST(RCU_MBB)
+            CPPUNIT_TEST(RCU_MBT)
+        CPPUNIT_TEST_SUITE_END();
+    };
+
+} // namespace misc
+
+CPPUNIT_TEST_SUITE_REGISTRATION(misc::RcuGracePeriodHdrTest);
@@ -0,0 +1,108 @@
+//$$CDS-header$$
+
+#include "cppunit/cppunit_proxy.h"
+
+#include <thread>
+#include <chrono>
+#include <cds/urcu/qsbr_buffered.h>
+
+namespace misc {
+
+    // QSBR synchronize() must wait for each online thread
+    // until it announces a quiescent state or goes offline
+    class RcuQsbrHdrTest: public CppUnitMini::TestCase
+    {
+        typedef cds::urcu::gc< cds::urcu::qsbr_buffered<> > rcu_type;
+
+        enum reader_state {
+            reader_init,
+            reader_online,      // the reader is attached and online
+            reader_release,     // request to the reader to stop blocking grace periods
+            reader_exit         // request to the reader to detach
+        };
+
+        static bool wait_for( atomics::atomic<bool> const& bFlag, unsigned int nMilliseconds )
+        {
+            auto const tEnd = std::chrono::steady_clock::now() + std::chrono::milliseconds( nMilliseconds );
+            while ( !bFlag.load( atomics::memory_order_acquire )) {
+                if ( std::chrono::steady_clock::now() >= tEnd )
+                    return false;
+                std::this_thread::yield();
+            }
+            return true;
+        }
+
+        template <typename Release>
+        void test_release( Release release )
+        {
+            // The main thread is attached to the RCU too, it must not block the grace period
+            rcu_type::thread_offline();
+
+            atomics::atomic<int> nReaderState( reader_init );
+            bool bReaderOnline = false;
+            std::thread reader( [&nReaderState, &bReaderOnline, &release]() {
+                cds::threading::Manager::attachThread();
+                bReaderOnline = rcu_type::is_online();
+                nReaderState.store( reader_online, atomics::memory_order_release );
+
+                while ( nReaderState.load( atomics::memory_order_acquire ) == reader_online )
+                    std::this_thread::yield();
+                release( nReaderState );
+
+                cds::threading::Manager::detachThread();
+            });
+
+            while ( nReaderState.load( atomics::memory_order_acquire ) != reader_online )
+                std::this_thread::yield();
+
+            atomics::atomic<bool> bSynchronized( false );
+            std::thread writer( [&bSynchronized]() {
+                cds::threading::Manager::attachThread();
+                rcu_type::synchronize();
+                bSynchronized.store( true, atomics::memory_order_release );
+                cds::threading::Manager::detachThread();
+            });
+
+            // The reader is online and does not announce quiescent states
+            CPPUNIT_CHECK( !wait_for( bSynchronized, 200 ));
+
+            nReaderState.store( reader_release, atomics::memory_order_release );
+            CPPUNIT_CHECK( wait_for( bSynchronized, 10000 ));
+
+            nReaderState.store( reader_exit, atomics::memory_order_release );
+            writer.join();
+            reader.join();
+            CPPUNIT_CHECK( bReaderOnline );
+
+            rcu_type::thread_online();
+        }
+
+        void quiescent_state()
+        {
+            test_release( []( atomics::atomic<int>& nReaderState ) {
+                // The grace period may start after the first announce, so the reader repeats it
+                while ( nReaderState.load( atomics::memory_order_acquire ) == reader_release ) {
+                    rcu_type::quiescent_state();
+                    std::this_thread::yield();
+                }
+            });
+        }
+
+        void thread_offline()
+        {
+            test_release( []( atomics::atomic<int>& nReaderState ) {
+                rcu_type::thread_offline();
+                while ( nReaderState.load( atomics::memory_order_acquire ) == reader_release )
+                    std::this_thread::yield();
+            });
+        }
+
+        CPPUNIT_TEST_SUITE(RcuQsbrHdrTest)
+            CPPUNIT_TEST(quiescent_state)
+            CPPUNIT_TEST(thread_offline)
+        CPPUNIT_TEST_SUITE_END();
+    };
+
+} // namespace misc
+
+CPPUNIT_TEST_SUITE_REGISTRATION(misc::RcuQsbrHdrTest);
@@ -0,0 +1,269 @@
+//$$CDS-header$$
+
+#include "cppunit/cppunit_proxy.h"
+
+#include <cds/gc/hp.h>
+#include <cds/gc/dhp.h>
+#include <cds/urcu/general_instant.h>
+#include <cds/urcu/general_buffered.h>
+#include <cds/urcu/general_threaded.h>
+#include <cds/urcu/signal_buffered.h>
+#include <cds/urcu/signal_threaded.h>
+#include <cds/urcu/qsbr_buffered.h>
+#include <cds/urcu/membarrier_buffered.h>
+#include <cds/urcu/membarrier_threaded.h>
+
+#include <thread>
+#include <vector>
+
+namespace misc {
+
+    class ReclaimStatHdrTest: public CppUnitMini::TestCase
+    {
+        static size_t const c_nRetireCount = 5000;
+
+        struct item {
+            size_t  nKey;
+        };
+
+        struct disposer {
+            void operator()( item * p )
+            {
+                delete p;
+            }
+        };
+
+        static atomics::atomic<size_t> s_nDisposed;
+
+        struct counting_disposer {
+            void operator()( item * p )
+            {
+                delete p;
+                s_nDisposed.fetch_add( 1, atomics::memory_order_relaxed );
+            }
+        };
+
+        static uint64_t histogram_sum( cds::gc::reclaim_stat const& st )
+        {
+            uint64_t nSum = 0;
+            for ( size_t i = 0; i < cds::gc::reclaim_stat::c_nHistogramSize; ++i )
+                nSum += st.arrScanHistogram[i];
+            return nSum;
+        }
+
+        void check_stat( cds::gc::reclaim_stat const& stBefore, cds::gc::reclaim_stat const& stAfter )
+        {
+            CPPUNIT_CHECK( stAfter.nScanCount > stBefore.nScanCount );
+            CPPUNIT_CHECK_EX( stAfter.nFreed - stBefore.nFreed >= c_nRetireCount, "freed=" << (stAfter.nFreed - stBefore.nFreed) );
+            CPPUNIT_CHECK( stAfter.nBacklog == 0 );
+            CPPUNIT_CHECK( stAfter.nPeakBacklog > 0 );
+            CPPUNIT_CHECK( stAfter.nMaxFreedPerScan > 0 );
+            CPPUNIT_CHECK( stAfter.nMaxFreedPerScan <= stAfter.nFreed );
+            CPPUNIT_CHECK( stAfter.nMaxScanTime <= stAfter.nScanTime );
+            CPPUNIT_CHECK( histogram_sum( stAfter ) == stAfter.nScanCount );
+            CPPUNIT_CHECK( stAfter.freed_per_scan() > 0.0 );
+        }
+
+        template <class GC>
+        void test_gc()
+        {
+            cds::gc::reclaim_stat st0;
+            GC::statistics( st0 );
+
+            for ( size_t i = 0; i < c_nRetireCount; ++i ) {
+                item * p = new item;
+                p->nKey = i;
+                GC::template retire<disposer>( p );
+            }
+            GC::force_dispose();
+
+            cds::gc::reclaim_stat st;
+            GC::statistics( st );
+            check_stat( st0, st );
+        }
+
+        template <class RCU>
+        void test_rcu()
+        {
+            cds::gc::reclaim_stat st0;
+            RCU::statistics( st0 );
+
+            for ( size_t i = 0; i < c_nRetireCount; ++i ) {
+                item * p = new item;
+                p->nKey = i;
+                RCU::template retire_ptr<disposer>( p );
+            }
+            RCU::force_dispose();
+
+            cds::gc::reclaim_stat st;
+            RCU::statistics( st );
+            check_stat( st0, st );
+        }
+
+        void test_histogram()
+        {
+            typedef cds::gc::reclaim_stat stat;
+
+            CPPUNIT_ASSERT( stat::histogram_bucket( 0 ) == 0 );
+            CPPUNIT_ASSERT( stat::histogram_bucket( 999 ) == 0 );
+            CPPUNIT_ASSERT( stat::histogram_bucket( 1000 ) == 1 );
+            CPPUNIT_ASSERT( stat::histogram_bucket( 1999 ) == 1 );
+            CPPUNIT_ASSERT( stat::histogram_bucket( 2000 ) == 2 );
+            CPPUNIT_ASSERT( stat::histogram_bucket( 1000 * 1000 ) == 10 );
+            CPPUNIT_ASSERT( stat::histogram_bucket( uint64_t(-1) ) == stat::c_nHistogramSize - 1 );
+
+            for ( size_t i = 0; i + 1 < stat::c_nHistogramSize; ++i ) {
+                // the upper bound of the bucket in microseconds belongs to the next bucket
+                CPPUNIT_ASSERT( stat::histogram_bucket( stat::histogram_bound( i ) * 1000 - 1 ) == i );
+                CPPUNIT_ASSERT( stat::histogram_bucket( stat::histogram_bound( i ) * 1000 ) == i + 1 );
+            }
+            CPPUNIT_ASSERT( stat::histogram_bound( stat::c_nHistogramSize - 1 ) == 0 );
+        }
+
+        template <class RCU>
+        void test_rcu_thread_buffer()
+        {
+            typedef typename RCU::rcu_implementation rcu_implementation;
+
+            CPPUNIT_ASSERT( rcu_implementation::instance()->buffering() == cds::urcu::shared_buffer );
+            rcu_implementation::instance()->set_buffering( cds::urcu::thread_buffer );
+            test_rcu<RCU>();
+            rcu_implementation::instance()->set_buffering( cds::urcu::shared_buffer );
+        }
+
+        // Each thread leaves almost full buffer; the sum of the buffers exceeds the capacity of one buffer.
+        // One grace period must drain all of them
+        template <class RCU>
+        void test_rcu_thread_buffer_mt()
+        {
+            typedef typename RCU::rcu_implementation rcu_implementation;
+            static size_t const c_nThreadCount = 4;
+
+            RCU::force_dispose();
+            rcu_implementation::instance()->set_buffering( cds::urcu::thread_buffer );
+            size_t const nPerThread = rcu_implementation::instance()->capacity() - 1;
+            s_nDisposed.store( 0, atomics::memory_order_relaxed );
+
+            // The threads stay attached until the check is done, otherwise a thread could reuse
+            // the record of finished thread and fill its buffer
+            atomics::atomic<size_t> nReady( 0 );
+            atomics::atomic<bool> bDone( false );
+            std::vector<std::thread> threads;
+            for ( size_t nThread = 0; nThread < c_nThreadCount; ++nThread ) {
+                threads.emplace_back( [nPerThread, &nReady, &bDone]() {
+                    cds::threading::Manager::attachThread();
+                    for ( size_t i = 0; i < nPerThread; ++i ) {
+                        item * p = new item;
+                        p->nKey = i;
+                        RCU::template retire_ptr<counting_disposer>( p );
+                    }
+                    nReady.fetch_add( 1, atomics::memory_order_release );
+                    while ( !bDone.load( atomics::memory_order_acquire ))
+                        std::this_thread::yield();
+                    cds::threading::Manager::detachThread();
+                });
+            }
+            while ( nReady.load( atomics::memory_order_acquire ) != c_nThreadCount )
+                std::this_thread::yield();
+
+            cds::gc::reclaim_stat stat;
+            RCU::statistics( stat );
+            CPPUNIT_CHECK_EX( stat.nBacklog == c_nThreadCount * nPerThread, "backlog=" << stat.nBacklog );
+
+            RCU::force_dispose();
+            RCU::statistics( stat );
+            CPPUNIT_CHECK_EX( stat.nBacklog == 0, "backlog=" << stat.nBacklog );
+            CPPUNIT_CHECK_EX( s_nDisposed.load( atomics::memory_order_relaxed ) == c_nThreadCount * nPerThread,
+                "disposed=" << s_nDisposed.load( atomics::memory_order_relaxed ) << ", expected=" << c_nThreadCount * nPerThread );
+
+            bDone.store( true, atomics::memory_order_release );
+            for ( auto& t : threads )
+                t.join();
+            rcu_implementation::instance()->set_buffering( cds::urcu::shared_buffer );
+        }
+
+        void HP()
+        {
+            test_gc<cds::gc::HP>();
+        }
+        void DHP()
+        {
+            test_gc<cds::gc::DHP>();
+        }
+        void RCU_GPI()
+        {
+            test_rcu< cds::urcu::gc< cds::urcu::general_instant<> > >();
+        }
+        void RCU_GPB()
+        {
+            test_rcu< cds::urcu::gc< cds::urcu::general_buffered<> > >();
+        }
+        void RCU_GPT()
+        {
+            test_rcu< cds::urcu::gc< cds::urcu::general_threaded<> > >();
+        }
+        void RCU_GPB_thread_buffer()
+        {
+            test_rcu_thread_buffer< cds::urcu::gc< cds::urcu::general_buffered<> > >();
+        }
+        void RCU_GPT_thread_buffer()
+        {
+            test_rcu_thread_buffer< cds::urcu::gc< cds::urcu::general_threaded<> > >();
+        }
+        void RCU_GPB_thread_buffer_mt()
+        {
+            test_rcu_thread_buffer_mt< cds::urcu::gc< cds::urcu::general_buffered<> > >();
+        }
+        void RCU_GPT_thread_buffer_mt()
+        {
+            test_rcu_thread_buffer_mt< cds::urcu::gc< cds::urcu::general_threaded<> > >();
+        }
+        void RCU_SHB()
+        {
+#ifdef CDS_URCU_SIGNAL_HANDLING_ENABLED
+            test_rcu< cds::urcu::gc< cds::urcu::signal_buffered<> > >();
+#endif
+        }
+        void RCU_SHT()
+        {
+#ifdef CDS_URCU_SIGNAL_HANDLING_ENABLED
+            test_rcu< cds::urcu::gc< cds::urcu::signal_threaded<> > >();
+#endif
+        }
+        void RCU_QSBR()
+        {
+            test_rcu< cds::urcu::gc< cds::urcu::qsbr_buffered<> > >();
+        }
+        void RCU_MBB()
+        {
+            test_rcu< cds::urcu::gc< cds::urcu::membarrier_buffered<> > >();
+        }
+        void RCU_MBT()
+        {
+            test_rcu< cds::urcu::gc< cds::urcu::membarrier_threaded<> > >();
+        }
+
+        CPPUNIT_TEST_SUITE(ReclaimStatHdrTest)
+            CPPUNIT_TEST(test_histogram)
+            CPPUNIT_TEST(HP)
+            CPPUNIT_TEST(DHP)
+            CPPUNIT_TEST(RCU_GPI)
+            CPPUNIT_TEST(RCU_GPB)
+            CPPUNIT_TEST(RCU_GPT)
+            CPPUNIT_TEST(RCU_GPB_thread_buffer)
+            CPPUNIT_TEST(RCU_GPT_thread_buffer)
+            CPPUNIT_TEST(RCU_GPB_thread_buffer_mt)
+            CPPUNIT_TEST(RCU_GPT_thread_buffer_mt)
+            CPPUNIT_TEST(RCU_SHB)
+            CPPUNIT_TEST(RCU_SHT)
+            CPPUNIT_TEST(RCU_QSBR)
+            CPPUNIT_TEST(RCU_MBB)
+            CPPUNIT_TEST(RCU_MBT)
+        CPPUNIT_TEST_SUITE_END();
+    };
+
+    atomics::atomic<size_t> ReclaimStatHdrTest::s_nDisposed( 0 );
+
+} // namespace misc
+
+CPPUNIT_TEST_SUITE_REGISTRATION(misc::ReclaimStatHdrTest);
@@ -0,0 +1,163 @@
+//$$CDS-header$$
+
+#include "cppunit/cppunit_proxy.h"
+
+#include <cds/os/topology.h>
+#include <cds/threading/placement.h>
+#include <vector>
+#include <thread>
+
+namespace misc {
+
+    class TopologyHdrTest: public CppUnitMini::TestCase
+    {
+        typedef cds::OS::topology topology;
+
+        void check_topology()
+        {
+            unsigned int const nProcCount = topology::processor_count();
+            CPPUNIT_ASSERT( nProcCount > 0 );
+            CPPUNIT_ASSERT( topology::node_count() > 0 );
+            CPPUNIT_ASSERT( topology::core_count() > 0 );
+            CPPUNIT_ASSERT( topology::core_count() <= nProcCount );
+            CPPUNIT_ASSERT( topology::cache_domain_count() > 0 );
+
+            std::vector<bool> nodes( topology::node_count(), false );
+            std::vector<bool> cores( topology::core_count(), false );
+            std::vector<bool> caches( topology::cache_domain_count(), false );
+            unsigned int nOnlineCount = 0;
+            for ( unsigned int i = 0; i < topology::processor_id_bound(); ++i ) {
+                if ( !topology::is_processor_online( i ))
+                    continue;
+                ++nOnlineCount;
+                CPPUNIT_ASSERT_EX( topology::processor_node( i ) < topology::node_count(), "processor=" << i );
+                CPPUNIT_ASSERT_EX( topology::processor_core( i ) < topology::core_count(), "processor=" << i );
+                CPPUNIT_ASSERT_EX( topology::processor_cache_domain( i ) < topology::cache_domain_count(), "processor=" << i );
+                nodes[ topology::processor_node( i ) ] = true;
+                cores[ topology::processor_core( i ) ] = true;
+                caches[ topology::processor_cache_domain( i ) ] = true;
+            }
+            CPPUNIT_CHECK( nOnlineCount == nProcCount );
+
+            // The numbering is dense
+            for ( size_t i = 0; i < nodes.size(); ++i )
+                CPPUNIT_CHECK_EX( nodes[i], "node=" << i );
+            for ( size_t i = 0; i < cores.size(); ++i )
+                CPPUNIT_CHECK_EX( cores[i], "core=" << i );
+            for ( size_t i = 0; i < caches.size(); ++i )
+                CPPUNIT_CHECK_EX( caches[i], "cache domain=" << i );
+
+            CPPUNIT_ASSERT( topology::current_node() < topology::node_count() );
+        }
+
+        void system_topology()
+        {
+            CPPUNIT_MSG( "   processors=" << topology::processor_count()
+                << ", nodes=" << topology::node_count()
+                << ", cores=" << topology::core_count()
+                << ", cache domains=" << topology::cache_domain_count() );
+            check_topology();
+        }
+
+        void fake_topology()
+        {
+#if CDS_OS_TYPE == CDS_OS_LINUX
+            unsigned int const nProcCount = topology::processor_count();
+
+            // 2 nodes x 3 cores x 2 SMT threads
+            topology::set_fake_topology( 2, 3, 2 );
+            CPPUNIT_ASSERT( topology::is_fake_topology() );
+            CPPUNIT_ASSERT( topology::processor_count() == 12 );
+            CPPUNIT_ASSERT( topology::node_count() == 2 );
+            CPPUNIT_ASSERT( topology::core_count() == 6 );
+            CPPUNIT_ASSERT( topology::cache_domain_count() == 2 );
+            check_topology();
+
+            // SMT siblings are adjacent
+            CPPUNIT_CHECK( topology::processor_core( 4 ) == topology::processor_core( 5 ));
+            CPPUNIT_CHECK( topology::processor_core( 5 ) != topology::processor_core( 6 ));
+            CPPUNIT_CHECK( topology::processor_node( 5 ) == 0 );
+            CPPUNIT_CHECK( topology::processor_node( 6 ) == 1 );
+            CPPUNIT_CHECK( topology::processor_cache_domain( 11 ) == 1 );
+            CPPUNIT_CHECK( topology::current_processor() < topology::processor_count() );
+
+            topology::reset_fake_topology();
+            CPPUNIT_ASSERT( !topology::is_fake_topology() );
+            CPPUNIT_CHECK( topology::processor_count() == nProcCount );
+            check_topology();
+#endif
+        }
+
+        void placement()
+        {
+            using namespace cds::threading;
+
+            CPPUNIT_CHECK( std::string( placement_name( placement_compact )) == "compact" );
+            CPPUNIT_CHECK( std::string( placement_name( placement_per_node )) == "per_node" );
+            for ( size_t i = 0; i < 2 * topology::processor_count(); ++i ) {
+                CPPUNIT_ASSERT( topology::is_processor_online( placement_target( placement_compact, i )));
+                CPPUNIT_ASSERT( topology::is_processor_online( placement_target( placement_scatter, i )));
+                CPPUNIT_ASSERT( placement_target( placement_per_node, i ) < topology::node_count() );
+            }
+
+#if CDS_OS_TYPE == CDS_OS_LINUX
+            // Pin a separate thread to keep the affinity of the test thread
+            bool bPinned = false;
+            unsigned int nProcessor = 0;
+            std::thread t( [&bPinned, &nProcessor]() {
+                bPinned = place_current_thread( placement_compact, 0 );
+                nProcessor = topology::current_processor();
+            });
+            t.join();
+            CPPUNIT_CHECK( bPinned );
+            CPPUNIT_CHECK( nProcessor == placement_target( placement_compact, 0 ));
+
+            // The policy is applied by Manager::attachThread()
+            set_thread_placement( placement_scatter );
+            CPPUNIT_CHECK( get_thread_placement() == placement_scatter );
+            nProcessor = topology::processor_count();
+            std::thread t2( [&nProcessor]() {
+                Manager::attachThread();
+                nProcessor = topology::current_processor();
+                Manager::detachThread();
+            });
+            t2.join();
+            set_thread_placement( placement_none );
+            CPPUNIT_CHECK( nProcessor == placement_target( placement_scatter, 0 ));
+
+            // 2 nodes x 2 cores x 2 SMT threads
+            topology::set_fake_topology( 2, 2, 2 );
+
+            unsigned int const arrCompact[] = { 0, 1, 2, 3, 4, 5, 6, 7 };
+            // node first, then core, then SMT sibling
+            unsigned int const arrScatter[] = { 0, 4, 2, 6, 1, 5, 3, 7 };
+            for ( size_t i = 0; i < 8; ++i ) {
+                CPPUNIT_CHECK_EX( placement_target( placement_compact, i ) == arrCompact[i], "thread=" << i );
+                CPPUNIT_CHECK_EX( placement_target( placement_scatter, i ) == arrScatter[i], "thread=" << i );
+                CPPUNIT_CHECK_EX( placement_target( placement_per_node, i ) == i % 2, "thread=" << i );
+            }
+            // Wraps around
+            CPPUNIT_CHECK( placement_target( placement_scatter, 9 ) == arrScatter[1] );
+
+            // The map keeps the order built from the topology at construction time
+            placement_map mapScatter( placement_scatter );
+            topology::reset_fake_topology();
+            CPPUNIT_CHECK( mapScatter.policy() == placement_scatter );
+            for ( size_t i = 0; i < 8; ++i )
+                CPPUNIT_CHECK_EX( mapScatter.target( i ) == arrScatter[i], "thread=" << i );
+            mapScatter.reset( placement_none );
+            CPPUNIT_CHECK( mapScatter.target( 5 ) == 0 );
+            CPPUNIT_CHECK( !mapScatter.place_current_thread( 0 ));
+#endif
+        }
+
+        CPPUNIT_TEST_SUITE(TopologyHdrTest)
+            CPPUNIT_TEST(system_topology)
+            CPPUNIT_TEST(fake_topology)
+            CPPUNIT_TEST(placement)
+        CPPUNIT_TEST_SUITE_END();
+    };
+
+} // namespace misc
+
+CPPUNIT_TEST_SUITE_REGISTRATION(misc::TopologyHdrTest);
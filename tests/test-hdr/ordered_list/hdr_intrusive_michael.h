@@ -794,6 +794,24 @@ namespace ordlist {
         void DHP_member_cmpmix();
         void DHP_member_ic();
 
+        void EBR_base_cmp();
+        void EBR_base_less();
+        void EBR_base_cmpmix();
+        void EBR_base_ic();
+        void EBR_member_cmp();
+        void EBR_member_less();
+        void EBR_member_cmpmix();
+        void EBR_member_ic();
+
+        void HE_base_cmp();
+        void HE_base_less();
+        void HE_base_cmpmix();
+        void HE_base_ic();
+        void HE_member_cmp();
+        void HE_member_less();
+        void HE_member_cmpmix();
+        void HE_member_ic();
+
         void RCU_GPI_base_cmp();
         void RCU_GPI_base_less();
         void RCU_GPI_base_cmpmix();
@@ -812,6 +830,15 @@ namespace ordlist {
         void RCU_GPB_member_cmpmix();
         void RCU_GPB_member_ic();
 
+        void RCU_QSBR_base_cmp();
+        void RCU_QSBR_base_less();
+        void RCU_QSBR_base_cmpmix();
+        void RCU_QSBR_base_ic();
+        void RCU_QSBR_member_cmp();
+        void RCU_QSBR_member_less();
+        void RCU_QSBR_member_cmpmix();
+        void RCU_QSBR_member_ic();
+
         void RCU_GPT_base_cmp();
         void RCU_GPT_base_less();
         void RCU_GPT_base_cmpmix();
@@ -868,6 +895,24 @@ namespace ordlist {
             CPPUNIT_TEST(DHP_member_cmpmix)
             CPPUNIT_TEST(DHP_member_ic)
 
+            CPPUNIT_TEST(EBR_base_cmp)
+            CPPUNIT_TEST(EBR_base_less)
+            CPPUNIT_TEST(EBR_base_cmpmix)
+            CPPUNIT_TEST(EBR_base_ic)
+            CPPUNIT_TEST(EBR_member_cmp)
+            CPPUNIT_TEST(EBR_member_less)
+            CPPUNIT_TEST(EBR_member_cmpmix)
+            CPPUNIT_TEST(EBR_member_ic)
+
+            CPPUNIT_TEST(HE_base_cmp)
+            CPPUNIT_TEST(HE_base_less)
+            CPPUNIT_TEST(HE_base_cmpmix)
+            CPPUNIT_TEST(HE_base_ic)
+            CPPUNIT_TEST(HE_member_cmp)
+            CPPUNIT_TEST(HE_member_less)
+            CPPUNIT_TEST(HE_member_cmpmix)
+            CPPUNIT_TEST(HE_member_ic)
+
             CPPUNIT_TEST(RCU_GPI_base_cmp)
             CPPUNIT_TEST(RCU_GPI_base_less)
             CPPUNIT_TEST(RCU_GPI_base_cmpmix)
@@ -886,6 +931,15 @@ namespace ordlist {
             CPPUNIT_TEST(RCU_GPB_member_cmpmix)
             CPPUNIT_TEST(RCU_GPB_member_ic)
 
+            CPPUNIT_TEST(RCU_QSBR_base_cmp)
+            CPPUNIT_TEST(RCU_QSBR_base_less)
+            CPPUNIT_TEST(RCU_QSBR_base_cmpmix)
+            CPPUNIT_TEST(RCU_QSBR_base_ic)
+            CPPUNIT_TEST(RCU_QSBR_member_cmp)
+            CPPUNIT_TEST(RCU_QSBR_member_less)
+            CPPUNIT_TEST(RCU_QSBR_member_cmpmix)
+            CPPUNIT_TEST(RCU_QSBR_member_ic)
+
             CPPUNIT_TEST(RCU_GPT_base_cmp)
             CPPUNIT_TEST(RCU_GPT_base_less)
             CPPUNIT_TEST(RCU_GPT_base_cmpmix)
@@ -0,0 +1,127 @@
+//$$CDS-header$$
+
+#include "ordered_list/hdr_intrusive_michael.h"
+#include <cds/intrusive/michael_list_he.h>
+
+namespace ordlist {
+    void IntrusiveMichaelListHeaderTest::HE_base_cmp()
+    {
+        typedef base_int_item< cds::gc::HE > item;
+        struct traits : public ci::michael_list::traits {
+            typedef ci::michael_list::base_hook< co::gc<cds::gc::HE> > hook;
+            typedef cmp<item> compare;
+            typedef faked_disposer disposer;
+        };
+        typedef ci::MichaelList< cds::gc::HE, item, traits > list;
+        test_int<list>();
+    }
+    void IntrusiveMichaelListHeaderTest::HE_base_less()
+    {
+        typedef base_int_item< cds::gc::HE > item;
+        typedef ci::MichaelList< cds::gc::HE
+            ,item
+            ,ci::michael_list::make_traits<
+                ci::opt::hook< ci::michael_list::base_hook< co::gc<cds::gc::HE> > >
+                ,co::less< less<item> >
+                ,ci::opt::disposer< faked_disposer >
+            >::type
+        >    list;
+        test_int<list>();
+    }
+    void IntrusiveMichaelListHeaderTest::HE_base_cmpmix()
+    {
+        typedef base_int_item< cds::gc::HE > item;
+        typedef ci::MichaelList< cds::gc::HE
+            ,item
+            ,ci::michael_list::make_traits<
+                ci::opt::hook< ci::michael_list::base_hook< co::gc<cds::gc::HE> > >
+                ,co::less< less<item> >
+                ,co::compare< cmp<item> >
+                ,ci::opt::disposer< faked_disposer >
+            >::type
+        >    list;
+        test_int<list>();
+    }
+    void IntrusiveMichaelListHeaderTest::HE_base_ic()
+    {
+        typedef base_int_item< cds::gc::HE > item;
+        typedef ci::MichaelList< cds::gc::HE
+            ,item
+            ,ci::michael_list::make_traits<
+                ci::opt::hook< ci::michael_list::base_hook< co::gc<cds::gc::HE> > >
+                ,co::less< less<item> >
+                ,co::compare< cmp<item> >
+                ,ci::opt::disposer< faked_disposer >
+                ,co::item_counter< cds::atomicity::item_counter >
+            >::type
+        >    list;
+        test_int<list>();
+    }
+    void IntrusiveMichaelListHeaderTest::HE_member_cmp()
+    {
+        typedef member_int_item< cds::gc::HE > item;
+        typedef ci::MichaelList< cds::gc::HE
+            ,item
+            ,ci::michael_list::make_traits<
+                ci::opt::hook< ci::michael_list::member_hook<
+                    offsetof( item, hMember ),
+                    co::gc<cds::gc::HE>
+                > >
+                ,co::compare< cmp<item> >
+                ,ci::opt::disposer< faked_disposer >
+            >::type
+        >    list;
+        test_int<list>();
+    }
+    void IntrusiveMichaelListHeaderTest::HE_member_less()
+    {
+        typedef member_int_item< cds::gc::HE > item;
+        typedef ci::MichaelList< cds::gc::HE
+            ,item
+            ,ci::michael_list::make_traits<
+                ci::opt::hook< ci::michael_list::member_hook<
+                    offsetof( item, hMember ),
+                    co::gc<cds::gc::HE>
+                > >
+                ,co::less< less<item> >
+                ,ci::opt::disposer< faked_disposer >
+            >::type
+        >    list;
+        test_int<list>();
+    }
+    void IntrusiveMichaelListHeaderTest::HE_member_cmpmix()
+    {
+        typedef member_int_item< cds::gc::HE > item;
+        typedef ci::MichaelList< cds::gc::HE
+            ,item
+            ,ci::michael_list::make_traits<
+                ci::opt::hook< ci::michael_list::member_hook<
+                    offsetof( item, hMember ),
+                    co::gc<cds::gc::HE>
+                > >
+                ,co::less< less<item> >
+                ,co::compare< cmp<item> >
+                ,ci::opt::disposer< faked_disposer >
+            >::type
+        >    list;
+        test_int<list>();
+    }
+    void IntrusiveMichaelListHeaderTest::HE_member_ic()
+    {
+        typedef member_int_item< cds::gc::HE > item;
+        typedef ci::MichaelList< cds::gc::HE
+            ,item
+            ,ci::michael_list::make_traits<
+                ci::opt::hook< ci::michael_list::member_hook<
+                    offsetof( item, hMember ),
+                    co::gc<cds::gc::HE>
+                > >
+                ,co::compare< cmp<item> >
+                ,ci::opt::disposer< faked_disposer >
+                ,co::item_counter< cds::atomicity::item_counter >
+            >::type
+        >    list;
+        test_int<list>();
+    }
+
+} // namespace ordlist
@@ -742,6 +742,16 @@ namespace ordlist {
         void DHP_cmpmix();
         void DHP_ic();
 
+        void EBR_cmp();
+        void EBR_less();
+        void EBR_cmpmix();
+        void EBR_ic();
+
+        void HE_cmp();
+        void HE_less();
+        void HE_cmpmix();
+        void HE_ic();
+
         void RCU_GPI_cmp();
         void RCU_GPI_less();
         void RCU_GPI_cmpmix();
@@ -752,6 +762,21 @@ namespace ordlist {
         void RCU_GPB_cmpmix();
         void RCU_GPB_ic();
 
+        void RCU_QSBR_cmp();
+        void RCU_QSBR_less();
+        void RCU_QSBR_cmpmix();
+        void RCU_QSBR_ic();
+
+        void RCU_MBB_cmp();
+        void RCU_MBB_less();
+        void RCU_MBB_cmpmix();
+        void RCU_MBB_ic();
+
+        void RCU_MBT_cmp();
+        void RCU_MBT_less();
+        void RCU_MBT_cmpmix();
+        void RCU_MBT_ic();
+
         void RCU_GPT_cmp();
         void RCU_GPT_less();
         void RCU_GPT_cmpmix();
@@ -783,6 +808,16 @@ namespace ordlist {
             CPPUNIT_TEST(DHP_cmpmix)
             CPPUNIT_TEST(DHP_ic)
 
+            CPPUNIT_TEST(EBR_cmp)
+            CPPUNIT_TEST(EBR_less)
+            CPPUNIT_TEST(EBR_cmpmix)
+            CPPUNIT_TEST(EBR_ic)
+
+            CPPUNIT_TEST(HE_cmp)
+            CPPUNIT_TEST(HE_less)
+            CPPUNIT_TEST(HE_cmpmix)
+            CPPUNIT_TEST(HE_ic)
+
             CPPUNIT_TEST(RCU_GPI_cmp)
             CPPUNIT_TEST(RCU_GPI_less)
             CPPUNIT_TEST(RCU_GPI_cmpmix)
@@ -793,6 +828,21 @@ namespace ordlist {
             CPPUNIT_TEST(RCU_GPB_cmpmix)
             CPPUNIT_TEST(RCU_GPB_ic)
 
+            CPPUNIT_TEST(RCU_QSBR_cmp)
+            CPPUNIT_TEST(RCU_QSBR_less)
+            CPPUNIT_TEST(RCU_QSBR_cmpmix)
+            CPPUNIT_TEST(RCU_QSBR_ic)
+
+            CPPUNIT_TEST(RCU_MBB_cmp)
+            CPPUNIT_TEST(RCU_MBB_less)
+            CPPUNIT_TEST(RCU_MBB_cmpmix)
+            CPPUNIT_TEST(RCU_MBB_ic)
+
+            CPPUNIT_TEST(RCU_MBT_cmp)
+            CPPUNIT_TEST(RCU_MBT_less)
+            CPPUNIT_TEST(RCU_MBT_cmpmix)
+            CPPUNIT_TEST(RCU_MBT_ic)
+
             CPPUNIT_TEST(RCU_GPT_cmp)
             CPPUNIT_TEST(RCU_GPT_less)
             CPPUNIT_TEST(RCU_GPT_cmpmix)
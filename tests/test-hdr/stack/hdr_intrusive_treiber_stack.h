@@ -111,6 +111,27 @@ namespace stack {
                 CPPUNIT_ASSERT( v2.nDisposeCount == 1 );
                 CPPUNIT_ASSERT( v3.nDisposeCount == 1 );
             }
+
+            // Retire the range of items
+            {
+                int const nDisposeCount = v1.nDisposeCount;
+                stack.push(v1);
+                stack.push(v2);
+                stack.push(v3);
+
+                value_type * arr[3];
+                for ( size_t i = 0; i < sizeof(arr) / sizeof(arr[0]); ++i ) {
+                    arr[i] = stack.pop();
+                    CPPUNIT_ASSERT( arr[i] != nullptr );
+                }
+                CPPUNIT_ASSERT( stack.empty() );
+
+                Stack::gc::template retire<faked_disposer>( arr, arr + sizeof(arr) / sizeof(arr[0]) );
+                Stack::gc::scan();
+                CPPUNIT_ASSERT( v1.nDisposeCount == nDisposeCount + 1 );
+                CPPUNIT_ASSERT( v2.nDisposeCount == nDisposeCount + 1 );
+                CPPUNIT_ASSERT( v3.nDisposeCount == nDisposeCount + 1 );
+            }
         }
 
         void Treiber_HP_default();
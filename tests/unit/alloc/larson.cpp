@@ -180,6 +180,9 @@ namespace memory {
 
         TEST_ALLOC_STAT( michael_heap_stat,      MichaelHeap_Stat<int> )
         TEST_ALLOC( michael_heap_nostat,    MichaelHeap_NoStat<int> )
+        TEST_ALLOC_STAT( michael_heap_tcache,    MichaelHeap_TCache<int> )
+        TEST_ALLOC_STAT( michael_heap_lockfree,  MichaelHeap_LockFree<int> )
+        TEST_ALLOC_STAT( michael_heap_hugepage,  MichaelHeap_HugePage<int> )
         TEST_ALLOC( std_alloc,              std_allocator<int> )
 
         TEST_ALLOC_STAT( michael_alignheap_stat,     t_MichaelAlignHeap_Stat )
@@ -188,6 +191,9 @@ namespace memory {
 
         CPPUNIT_TEST_SUITE( Larson )
             CPPUNIT_TEST( michael_heap_stat )
+            CPPUNIT_TEST( michael_heap_tcache )
+            CPPUNIT_TEST( michael_heap_lockfree )
+            CPPUNIT_TEST( michael_heap_hugepage )
             CPPUNIT_TEST( michael_heap_nostat )
             CPPUNIT_TEST( std_alloc )
 
@@ -136,6 +136,9 @@ namespace memory {
 
         TEST_ALLOC_STAT( michael_heap_stat,      MichaelHeap_Stat<char> )
         TEST_ALLOC( michael_heap_nostat,    MichaelHeap_NoStat<char> )
+        TEST_ALLOC_STAT( michael_heap_tcache,    MichaelHeap_TCache<char> )
+        TEST_ALLOC_STAT( michael_heap_lockfree,  MichaelHeap_LockFree<char> )
+        TEST_ALLOC_STAT( michael_heap_hugepage,  MichaelHeap_HugePage<char> )
         TEST_ALLOC( std_alloc,              std_allocator<char> )
 
         TEST_ALLOC_STAT( michael_alignheap_stat,     t_MichaelAlignHeap_Stat )
@@ -145,6 +148,9 @@ namespace memory {
         CPPUNIT_TEST_SUITE( Linux_Scale )
             CPPUNIT_TEST( michael_heap_nostat )
             CPPUNIT_TEST( michael_heap_stat )
+            CPPUNIT_TEST( michael_heap_tcache )
+            CPPUNIT_TEST( michael_heap_lockfree )
+            CPPUNIT_TEST( michael_heap_hugepage )
             CPPUNIT_TEST( std_alloc )
 
             CPPUNIT_TEST( system_aligned_alloc )
@@ -5,4 +5,7 @@
 namespace memory {
     t_MichaelHeap_NoStat  s_MichaelHeap_NoStat;
     t_MichaelHeap_Stat    s_MichaelHeap_Stat;
+    t_MichaelHeap_TCache  s_MichaelHeap_TCache;
+    t_MichaelHeap_LockFree  s_MichaelHeap_LockFree;
+    t_MichaelHeap_HugePage  s_MichaelHeap_HugePage;
 }
@@ -18,10 +18,35 @@ namespace memory {
         ma::opt::check_bounds<ma::debug_bound_checking>
     >  t_MichaelHeap_Stat;
 
+    typedef ma::Heap<
+        ma::opt::procheap_stat<ma::procheap_atomic_stat >,
+        ma::opt::os_allocated_stat<ma::os_allocated_atomic >,
+        ma::opt::check_bounds<ma::debug_bound_checking>,
+        ma::opt::thread_cache< ma::thread_cache_capacity<> >
+    >  t_MichaelHeap_TCache;
+
+    typedef ma::Heap<
+        ma::opt::procheap_stat<ma::procheap_atomic_stat >,
+        ma::opt::os_allocated_stat<ma::os_allocated_atomic >,
+        ma::opt::check_bounds<ma::debug_bound_checking>,
+        ma::opt::free_list< ma::free_list_lockfree<> >,
+        ma::opt::partial_list< ma::partial_list_lockfree<> >
+    >  t_MichaelHeap_LockFree;
+
+    typedef ma::Heap<
+        ma::opt::procheap_stat<ma::procheap_atomic_stat >,
+        ma::opt::os_allocated_stat<ma::os_allocated_atomic >,
+        ma::opt::check_bounds<ma::debug_bound_checking>,
+        ma::opt::page_heap< ma::huge_page_allocator<> >
+    >  t_MichaelHeap_HugePage;
+
     typedef ma::summary_stat            summary_stat;
 
     extern t_MichaelHeap_NoStat  s_MichaelHeap_NoStat;
     extern t_MichaelHeap_Stat    s_MichaelHeap_Stat;
+    extern t_MichaelHeap_TCache  s_MichaelHeap_TCache;
+    extern t_MichaelHeap_LockFree  s_MichaelHeap_LockFree;
+    extern t_MichaelHeap_HugePage  s_MichaelHeap_HugePage;
 
     template <typename T>
     class MichaelHeap_NoStat
@@ -90,6 +115,88 @@ namespace memory {
         }
     };
 
+    template <typename T>
+    class MichaelHeap_TCache
+    {
+    public:
+        typedef T value_type;
+        typedef T * pointer;
+
+        enum {
+            alignment = 1
+        };
+
+        pointer allocate( size_t nSize, const void * /*pHint*/ )
+        {
+            return reinterpret_cast<pointer>( s_MichaelHeap_TCache.alloc( sizeof(T) * nSize ) );
+        }
+
+        void deallocate( pointer p, size_t /*nCount*/ )
+        {
+            s_MichaelHeap_TCache.free( p );
+        }
+
+        static void stat(summary_stat& s)
+        {
+            s_MichaelHeap_TCache.flush_thread_cache();
+            s_MichaelHeap_TCache.summaryStat(s);
+        }
+    };
+
+    template <typename T>
+    class MichaelHeap_LockFree
+    {
+    public:
+        typedef T value_type;
+        typedef T * pointer;
+
+        enum {
+            alignment = 1
+        };
+
+        pointer allocate( size_t nSize, const void * /*pHint*/ )
+        {
+            return reinterpret_cast<pointer>( s_MichaelHeap_LockFree.alloc( sizeof(T) * nSize ) );
+        }
+
+        void deallocate( pointer p, size_t /*nCount*/ )
+        {
+            s_MichaelHeap_LockFree.free( p );
+        }
+
+        static void stat(summary_stat& s)
+        {
+            s_MichaelHeap_LockFree.summaryStat(s);
+        }
+    };
+
+    template <typename T>
+    class MichaelHeap_HugePage
+    {
+    public:
+        typedef T value_type;
+        typedef T * pointer;
+
+        enum {
+            alignment = 1
+        };
+
+        pointer allocate( size_t nSize, const void * /*pHint*/ )
+        {
+            return reinterpret_cast<pointer>( s_MichaelHeap_HugePage.alloc( sizeof(T) * nSize ) );
+        }
+
+        void deallocate( pointer p, size_t /*nCount*/ )
+        {
+            s_MichaelHeap_HugePage.free( p );
+        }
+
+        static void stat(summary_stat& s)
+        {
+            s_MichaelHeap_HugePage.summaryStat(s);
+        }
+    };
+
     template <typename T, size_t ALIGN>
     class MichaelAlignHeap_NoStat
     {
@@ -174,6 +281,7 @@ namespace memory {
             << "\t        alloc from partial: " << s.nAllocFromPartial << "\n"
             << "\t            alloc from new: " << s.nAllocFromNew << "\n"
             << "\t           free call count: " << s.nFreeCount << "\n"
+            << "\t    remote free call count: " << s.nRemoteFreeCount << "\n"
             << "\t      superblock allocated: " << s.nPageAllocCount << "\n"
             << "\t    superblock deallocated: " << s.nPageDeallocCount << "\n"
             << "\t superblock desc allocated: " << s.nDescAllocCount << "\n"
@@ -185,6 +293,10 @@ namespace memory {
             << "\t           free call count: " << s.nSysFreeCount << "\n"
             << "\t     total allocated bytes: " << s.nSysBytesAllocated << "\n"
             << "\t   total deallocated bytes: " << s.nSysBytesDeallocated << "\n"
+            << "\t      hugetlb region bytes: " << s.nHugeTLBBytes << "\n"
+            << "\t          THP region bytes: " << s.nTransparentHugeBytes << "\n"
+            << "\t      regular region bytes: " << s.nRegularRegionBytes << "\n"
+            << "\t         purged page bytes: " << s.nPurgedBytes << "\n"
             << "\tCAS contention indicators\n"
             << "\t updating active field of active block: " << s.nActiveDescCASFailureCount << "\n"
             << "\t updating anchor field of active block: " << s.nActiveAnchorCASFailureCount << "\n"
@@ -7,6 +7,8 @@ namespace ellen_bintree_pool {
 
     bounded_update_desc_pool_type s_BoundedUpdateDescPool;
 
+    he_update_desc_pool_type s_HEUpdateDescPool;
+
     cds::atomicity::event_counter   internal_node_counter::m_nAlloc;
     cds::atomicity::event_counter   internal_node_counter::m_nFree;
 }
@@ -4,6 +4,7 @@
 #define CDSUNIT_ELLEN_BINTREE_UPDATE_DESC_POOL_H
 
 #include <cds/urcu/general_instant.h>
+#include <cds/gc/he.h>
 #include <cds/container/details/ellen_bintree_base.h>
 #include <cds/memory/vyukov_queue_pool.h>
 #include <cds/memory/pool_allocator.h>
@@ -50,6 +51,21 @@ namespace ellen_bintree_pool {
     };
 
 
+    // gc::HE update descriptor carries a birth era, so it needs a pool of its own
+    typedef cds::container::ellen_bintree::node_types< cds::gc::HE, int >::update_desc_type he_update_desc;
+
+    typedef cds::memory::vyukov_queue_pool< he_update_desc, update_desc_pool_traits > he_update_desc_pool_type;
+    extern he_update_desc_pool_type s_HEUpdateDescPool;
+
+    struct he_update_desc_pool_accessor {
+        typedef he_update_desc_pool_type::value_type     value_type;
+
+        he_update_desc_pool_type& operator()() const
+        {
+            return s_HEUpdateDescPool;
+        }
+    };
+
     // Internal node allocator
     struct internal_node_counter
     {
@@ -42,6 +42,8 @@
     TEST_MAP_EXTRACT(MichaelMap_HP_less_michaelAlloc) \
     TEST_MAP_EXTRACT(MichaelMap_DHP_cmp_stdAlloc) \
     TEST_MAP_EXTRACT(MichaelMap_DHP_less_michaelAlloc) \
+    TEST_MAP_EXTRACT(MichaelMap_HE_cmp_stdAlloc) \
+    TEST_MAP_EXTRACT(MichaelMap_HE_less_michaelAlloc) \
     TEST_MAP_EXTRACT(MichaelMap_RCU_GPI_cmp_stdAlloc) \
     TEST_MAP_EXTRACT(MichaelMap_RCU_GPI_less_michaelAlloc) \
     TEST_MAP_EXTRACT(MichaelMap_RCU_GPB_cmp_stdAlloc) \
@@ -52,6 +54,8 @@
     TEST_MAP_EXTRACT(MichaelMap_Lazy_HP_less_michaelAlloc) \
     TEST_MAP_EXTRACT(MichaelMap_Lazy_DHP_cmp_stdAlloc) \
     TEST_MAP_EXTRACT(MichaelMap_Lazy_DHP_less_michaelAlloc) \
+    TEST_MAP_EXTRACT(MichaelMap_Lazy_HE_cmp_stdAlloc) \
+    TEST_MAP_EXTRACT(MichaelMap_Lazy_HE_less_michaelAlloc) \
     TEST_MAP_EXTRACT(MichaelMap_Lazy_RCU_GPI_cmp_stdAlloc) \
     TEST_MAP_EXTRACT(MichaelMap_Lazy_RCU_GPI_less_michaelAlloc) \
     TEST_MAP_EXTRACT(MichaelMap_Lazy_RCU_GPB_cmp_stdAlloc) \
@@ -65,6 +69,8 @@
     CPPUNIT_TEST(MichaelMap_HP_less_michaelAlloc) \
     CPPUNIT_TEST(MichaelMap_DHP_cmp_stdAlloc) \
     CPPUNIT_TEST(MichaelMap_DHP_less_michaelAlloc) \
+    CPPUNIT_TEST(MichaelMap_HE_cmp_stdAlloc) \
+    CPPUNIT_TEST(MichaelMap_HE_less_michaelAlloc) \
     CPPUNIT_TEST(MichaelMap_RCU_GPI_cmp_stdAlloc) \
     CPPUNIT_TEST(MichaelMap_RCU_GPI_less_michaelAlloc) \
     CPPUNIT_TEST(MichaelMap_RCU_GPB_cmp_stdAlloc) \
@@ -75,6 +81,8 @@
     CPPUNIT_TEST(MichaelMap_Lazy_HP_less_michaelAlloc) \
     CPPUNIT_TEST(MichaelMap_Lazy_DHP_cmp_stdAlloc) \
     CPPUNIT_TEST(MichaelMap_Lazy_DHP_less_michaelAlloc) \
+    CPPUNIT_TEST(MichaelMap_Lazy_HE_cmp_stdAlloc) \
+    CPPUNIT_TEST(MichaelMap_Lazy_HE_less_michaelAlloc) \
     CPPUNIT_TEST(MichaelMap_Lazy_RCU_GPI_cmp_stdAlloc) \
     CPPUNIT_TEST(MichaelMap_Lazy_RCU_GPI_less_michaelAlloc) \
     CPPUNIT_TEST(MichaelMap_Lazy_RCU_GPB_cmp_stdAlloc) \
@@ -166,6 +174,8 @@ TEST_MAP_EXTRACT(SplitList_Lazy_RCU_SHT_st_less_stat)
     TEST_MAP_EXTRACT(SplitList_Michael_DHP_dyn_less)\
     TEST_MAP_EXTRACT(SplitList_Michael_DHP_st_less)\
     TEST_MAP_EXTRACT(SplitList_Michael_DHP_st_less_stat)\
+    TEST_MAP_EXTRACT(SplitList_Michael_HE_dyn_cmp)\
+    TEST_MAP_EXTRACT(SplitList_Michael_HE_st_less)\
     TEST_MAP_EXTRACT(SplitList_Michael_RCU_GPI_dyn_cmp)\
     TEST_MAP_EXTRACT(SplitList_Michael_RCU_GPI_dyn_cmp_stat)\
     TEST_MAP_EXTRACT(SplitList_Michael_RCU_GPI_st_cmp)\
@@ -196,6 +206,8 @@ TEST_MAP_EXTRACT(SplitList_Lazy_RCU_SHT_st_less_stat)
     TEST_MAP_EXTRACT(SplitList_Lazy_DHP_dyn_less)\
     TEST_MAP_EXTRACT(SplitList_Lazy_DHP_st_less)\
     TEST_MAP_EXTRACT(SplitList_Lazy_DHP_st_less_stat)\
+    TEST_MAP_EXTRACT(SplitList_Lazy_HE_dyn_cmp)\
+    TEST_MAP_EXTRACT(SplitList_Lazy_HE_st_less)\
     TEST_MAP_EXTRACT(SplitList_Lazy_RCU_GPI_dyn_cmp)\
     TEST_MAP_EXTRACT(SplitList_Lazy_RCU_GPI_dyn_cmp_stat)\
     TEST_MAP_EXTRACT(SplitList_Lazy_RCU_GPI_st_cmp)\
@@ -229,6 +241,8 @@ TEST_MAP_EXTRACT(SplitList_Lazy_RCU_SHT_st_less_stat)
     CPPUNIT_TEST(SplitList_Michael_DHP_dyn_less)\
     CPPUNIT_TEST(SplitList_Michael_DHP_st_less)\
     CPPUNIT_TEST(SplitList_Michael_DHP_st_less_stat)\
+    CPPUNIT_TEST(SplitList_Michael_HE_dyn_cmp)\
+    CPPUNIT_TEST(SplitList_Michael_HE_st_less)\
     CPPUNIT_TEST(SplitList_Michael_RCU_GPI_dyn_cmp)\
     CPPUNIT_TEST(SplitList_Michael_RCU_GPI_dyn_cmp_stat)\
     CPPUNIT_TEST(SplitList_Michael_RCU_GPI_st_cmp)\
@@ -259,6 +273,8 @@ TEST_MAP_EXTRACT(SplitList_Lazy_RCU_SHT_st_less_stat)
     CPPUNIT_TEST(SplitList_Lazy_DHP_dyn_less)\
     CPPUNIT_TEST(SplitList_Lazy_DHP_st_less)\
     CPPUNIT_TEST(SplitList_Lazy_DHP_st_less_stat)\
+    CPPUNIT_TEST(SplitList_Lazy_HE_dyn_cmp)\
+    CPPUNIT_TEST(SplitList_Lazy_HE_st_less)\
     CPPUNIT_TEST(SplitList_Lazy_RCU_GPI_dyn_cmp)\
     CPPUNIT_TEST(SplitList_Lazy_RCU_GPI_dyn_cmp_stat)\
     CPPUNIT_TEST(SplitList_Lazy_RCU_GPI_st_cmp)\
@@ -334,6 +350,7 @@ TEST_MAP_EXTRACT(SplitList_Lazy_RCU_SHT_st_less_stat)
     TEST_MAP_NOLF_EXTRACT(SkipListMap_dhp_cmp_pascal_stat)\
     TEST_MAP_NOLF_EXTRACT(SkipListMap_dhp_less_xorshift)\
     TEST_MAP_NOLF_EXTRACT(SkipListMap_dhp_cmp_xorshift_stat)\
+    TEST_MAP_NOLF_EXTRACT(SkipListMap_he_less_pascal)\
     TEST_MAP_NOLF_EXTRACT(SkipListMap_rcu_gpi_less_pascal)\
     TEST_MAP_NOLF_EXTRACT(SkipListMap_rcu_gpi_cmp_pascal_stat)\
     TEST_MAP_NOLF_EXTRACT(SkipListMap_rcu_gpi_less_xorshift)\
@@ -358,6 +375,7 @@ TEST_MAP_EXTRACT(SplitList_Lazy_RCU_SHT_st_less_stat)
     CPPUNIT_TEST(SkipListMap_dhp_cmp_pascal_stat)\
     CPPUNIT_TEST(SkipListMap_dhp_less_xorshift)\
     CPPUNIT_TEST(SkipListMap_dhp_cmp_xorshift_stat)\
+    CPPUNIT_TEST(SkipListMap_he_less_pascal)\
     CPPUNIT_TEST(SkipListMap_rcu_gpi_less_pascal)\
     CPPUNIT_TEST(SkipListMap_rcu_gpi_cmp_pascal_stat)\
     CPPUNIT_TEST(SkipListMap_rcu_gpi_less_xorshift)\
@@ -408,6 +426,7 @@ TEST_MAP_EXTRACT(SplitList_Lazy_RCU_SHT_st_less_stat)
     TEST_MAP_NOLF_EXTRACT(EllenBinTreeMap_dhp)\
     TEST_MAP_NOLF_EXTRACT(EllenBinTreeMap_dhp_yield)\
     TEST_MAP_NOLF_EXTRACT(EllenBinTreeMap_dhp_stat)\
+    TEST_MAP_NOLF_EXTRACT(EllenBinTreeMap_he)\
     TEST_MAP_NOLF_EXTRACT(EllenBinTreeMap_rcu_gpi)\
     TEST_MAP_NOLF_EXTRACT(EllenBinTreeMap_rcu_gpi_stat)\
     TEST_MAP_NOLF_EXTRACT(EllenBinTreeMap_rcu_gpb)\
@@ -424,6 +443,7 @@ TEST_MAP_EXTRACT(SplitList_Lazy_RCU_SHT_st_less_stat)
     CPPUNIT_TEST(EllenBinTreeMap_dhp)\
     CPPUNIT_TEST(EllenBinTreeMap_dhp_yield)\
     CPPUNIT_TEST(EllenBinTreeMap_dhp_stat)\
+    CPPUNIT_TEST(EllenBinTreeMap_he)\
     CPPUNIT_TEST(EllenBinTreeMap_rcu_gpi)\
     CPPUNIT_TEST(EllenBinTreeMap_rcu_gpi_stat)\
     CPPUNIT_TEST(EllenBinTreeMap_rcu_gpb)\
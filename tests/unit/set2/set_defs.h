@@ -41,6 +41,8 @@
     TEST_SET_EXTRACT(MichaelSet_HP_less_michaelAlloc) \
     TEST_SET_EXTRACT(MichaelSet_DHP_cmp_stdAlloc) \
     TEST_SET_EXTRACT(MichaelSet_DHP_less_michaelAlloc) \
+    TEST_SET_EXTRACT(MichaelSet_HE_cmp_stdAlloc) \
+    TEST_SET_EXTRACT(MichaelSet_HE_less_michaelAlloc) \
     TEST_SET_EXTRACT(MichaelSet_RCU_GPI_cmp_stdAlloc) \
     TEST_SET_EXTRACT(MichaelSet_RCU_GPI_less_michaelAlloc) \
     TEST_SET_EXTRACT(MichaelSet_RCU_GPB_cmp_stdAlloc) \
@@ -51,6 +53,8 @@
     TEST_SET_EXTRACT(MichaelSet_Lazy_HP_less_michaelAlloc) \
     TEST_SET_EXTRACT(MichaelSet_Lazy_DHP_cmp_stdAlloc) \
     TEST_SET_EXTRACT(MichaelSet_Lazy_DHP_less_michaelAlloc) \
+    TEST_SET_EXTRACT(MichaelSet_Lazy_HE_cmp_stdAlloc) \
+    TEST_SET_EXTRACT(MichaelSet_Lazy_HE_less_michaelAlloc) \
     TEST_SET_EXTRACT(MichaelSet_Lazy_RCU_GPI_cmp_stdAlloc) \
     TEST_SET_EXTRACT(MichaelSet_Lazy_RCU_GPI_less_michaelAlloc) \
     TEST_SET_EXTRACT(MichaelSet_Lazy_RCU_GPB_cmp_stdAlloc) \
@@ -64,6 +68,8 @@
     CPPUNIT_TEST(MichaelSet_HP_less_michaelAlloc) \
     CPPUNIT_TEST(MichaelSet_DHP_cmp_stdAlloc) \
     CPPUNIT_TEST(MichaelSet_DHP_less_michaelAlloc) \
+    CPPUNIT_TEST(MichaelSet_HE_cmp_stdAlloc) \
+    CPPUNIT_TEST(MichaelSet_HE_less_michaelAlloc) \
     CPPUNIT_TEST(MichaelSet_RCU_GPI_cmp_stdAlloc) \
     CPPUNIT_TEST(MichaelSet_RCU_GPI_less_michaelAlloc) \
     CPPUNIT_TEST(MichaelSet_RCU_GPB_cmp_stdAlloc) \
@@ -74,6 +80,8 @@
     CPPUNIT_TEST(MichaelSet_Lazy_HP_less_michaelAlloc) \
     CPPUNIT_TEST(MichaelSet_Lazy_DHP_cmp_stdAlloc) \
     CPPUNIT_TEST(MichaelSet_Lazy_DHP_less_michaelAlloc) \
+    CPPUNIT_TEST(MichaelSet_Lazy_HE_cmp_stdAlloc) \
+    CPPUNIT_TEST(MichaelSet_Lazy_HE_less_michaelAlloc) \
     CPPUNIT_TEST(MichaelSet_Lazy_RCU_GPI_cmp_stdAlloc) \
     CPPUNIT_TEST(MichaelSet_Lazy_RCU_GPI_less_michaelAlloc) \
     CPPUNIT_TEST(MichaelSet_Lazy_RCU_GPB_cmp_stdAlloc) \
@@ -154,6 +162,8 @@
     TEST_SET_EXTRACT(SplitList_Michael_DHP_dyn_less)\
     TEST_SET_EXTRACT(SplitList_Michael_DHP_st_less)\
     TEST_SET_EXTRACT(SplitList_Michael_DHP_st_less_stat)\
+    TEST_SET_EXTRACT(SplitList_Michael_HE_dyn_cmp)\
+    TEST_SET_EXTRACT(SplitList_Michael_HE_st_less)\
     TEST_SET_EXTRACT(SplitList_Michael_RCU_GPI_dyn_cmp)\
     TEST_SET_EXTRACT(SplitList_Michael_RCU_GPI_dyn_cmp_stat)\
     TEST_SET_EXTRACT(SplitList_Michael_RCU_GPI_st_cmp)\
@@ -184,6 +194,8 @@
     TEST_SET_EXTRACT(SplitList_Lazy_DHP_dyn_less)\
     TEST_SET_EXTRACT(SplitList_Lazy_DHP_st_less)\
     TEST_SET_EXTRACT(SplitList_Lazy_DHP_st_less_stat)\
+    TEST_SET_EXTRACT(SplitList_Lazy_HE_dyn_cmp)\
+    TEST_SET_EXTRACT(SplitList_Lazy_HE_st_less)\
     TEST_SET_EXTRACT(SplitList_Lazy_RCU_GPI_dyn_cmp)\
     TEST_SET_EXTRACT(SplitList_Lazy_RCU_GPI_dyn_cmp_stat)\
     TEST_SET_EXTRACT(SplitList_Lazy_RCU_GPI_st_cmp)\
@@ -217,6 +229,8 @@
     CPPUNIT_TEST(SplitList_Michael_DHP_dyn_less)\
     CPPUNIT_TEST(SplitList_Michael_DHP_st_less)\
     CPPUNIT_TEST(SplitList_Michael_DHP_st_less_stat)\
+    CPPUNIT_TEST(SplitList_Michael_HE_dyn_cmp)\
+    CPPUNIT_TEST(SplitList_Michael_HE_st_less)\
     CPPUNIT_TEST(SplitList_Michael_RCU_GPI_dyn_cmp)\
     CPPUNIT_TEST(SplitList_Michael_RCU_GPI_dyn_cmp_stat)\
     CPPUNIT_TEST(SplitList_Michael_RCU_GPI_st_cmp)\
@@ -247,6 +261,8 @@
     CPPUNIT_TEST(SplitList_Lazy_DHP_dyn_less)\
     CPPUNIT_TEST(SplitList_Lazy_DHP_st_less)\
     CPPUNIT_TEST(SplitList_Lazy_DHP_st_less_stat)\
+    CPPUNIT_TEST(SplitList_Lazy_HE_dyn_cmp)\
+    CPPUNIT_TEST(SplitList_Lazy_HE_st_less)\
     CPPUNIT_TEST(SplitList_Lazy_RCU_GPI_dyn_cmp)\
     CPPUNIT_TEST(SplitList_Lazy_RCU_GPI_dyn_cmp_stat)\
     CPPUNIT_TEST(SplitList_Lazy_RCU_GPI_st_cmp)\
@@ -358,6 +374,7 @@
     TEST_SET_NOLF_EXTRACT(SkipListSet_dhp_cmp_pascal_stat)\
     TEST_SET_NOLF_EXTRACT(SkipListSet_dhp_less_xorshift)\
     TEST_SET_NOLF_EXTRACT(SkipListSet_dhp_cmp_xorshift_stat)\
+    TEST_SET_NOLF_EXTRACT(SkipListSet_he_less_pascal)\
     TEST_SET_NOLF_EXTRACT(SkipListSet_rcu_gpi_less_pascal)\
     TEST_SET_NOLF_EXTRACT(SkipListSet_rcu_gpi_cmp_pascal_stat)\
     TEST_SET_NOLF_EXTRACT(SkipListSet_rcu_gpi_less_xorshift)\
@@ -381,6 +398,7 @@
     CPPUNIT_TEST(SkipListSet_dhp_cmp_pascal_stat)\
     CPPUNIT_TEST(SkipListSet_dhp_less_xorshift)\
     CPPUNIT_TEST(SkipListSet_dhp_cmp_xorshift_stat)\
+    CPPUNIT_TEST(SkipListSet_he_less_pascal)\
     CPPUNIT_TEST(SkipListSet_rcu_gpi_less_pascal)\
     CPPUNIT_TEST(SkipListSet_rcu_gpi_cmp_pascal_stat)\
     CPPUNIT_TEST(SkipListSet_rcu_gpi_less_xorshift)\
@@ -420,6 +438,7 @@
     TEST_SET_NOLF_EXTRACT(EllenBinTreeSet_dhp)\
     TEST_SET_NOLF_EXTRACT(EllenBinTreeSet_yield_dhp)\
     TEST_SET_NOLF_EXTRACT(EllenBinTreeSet_dhp_stat)\
+    TEST_SET_NOLF_EXTRACT(EllenBinTreeSet_he)\
     TEST_SET_NOLF_EXTRACT(EllenBinTreeSet_rcu_gpi)\
     TEST_SET_NOLF_EXTRACT(EllenBinTreeSet_rcu_gpi_stat)\
     TEST_SET_NOLF_EXTRACT(EllenBinTreeSet_rcu_gpb)\
@@ -436,6 +455,7 @@
     CPPUNIT_TEST(EllenBinTreeSet_dhp)\
     CPPUNIT_TEST(EllenBinTreeSet_yield_dhp)\
     CPPUNIT_TEST(EllenBinTreeSet_dhp_stat)\
+    CPPUNIT_TEST(EllenBinTreeSet_he)\
     CPPUNIT_TEST(EllenBinTreeSet_rcu_gpi)\
     /*CPPUNIT_TEST(EllenBinTreeSet_rcu_gpi_stat)*/\
     CPPUNIT_TEST(EllenBinTreeSet_rcu_gpb)\